@@ -99,8 +99,15 @@ namespace isobus
 
 		/// @brief Call this periodically if you have threads disabled.
 		/// @note Try to call this very often, say at least every millisecond to ensure CAN messages are retrieved from the hardware
+		/// and requested deadlines are serviced on time.
 		static void update();
 
+		/// @brief Requests that the stack is serviced as soon as possible once a point in time is reached,
+		/// without waiting for the next periodic update. When threads are enabled, this wakes up the update thread in time.
+		/// @details Only the earliest requested deadline is kept until it is serviced.
+		/// @param[in] deadline_us The point in time to be serviced at, in microseconds, from SystemTiming::get_timestamp_us()
+		static void request_deadline_update(std::uint64_t deadline_us);
+
 		/// @brief Set the interval between periodic updates to the network manager
 		/// @param[in] value The interval between update calls in milliseconds
 		static void set_periodic_update_interval(std::uint32_t value);
@@ -182,6 +189,8 @@ namespace isobus
 		static std::condition_variable updateThreadWakeupCondition; ///< A condition variable to allow for signaling the `updateThread` to wakeup
 #endif
 		static std::uint32_t lastUpdateTimestamp; ///< The last time the network manager was updated
+		static std::uint64_t nextDeadline_us; ///< The earliest requested deadline that has not been serviced yet, or the maximum value if there is none
+		static Mutex deadlineMutex; ///< A mutex to protect `nextDeadline_us`
 		static std::uint32_t periodicUpdateInterval; ///< The period between calls to the network manager update function in milliseconds
 		static EventDispatcher<const CANMessageFrame &> frameReceivedEventDispatcher; ///< The event dispatcher for when a CAN message frame is received from hardware event
 		static EventDispatcher<const CANMessageFrame &> frameTransmittedEventDispatcher; ///< The event dispatcher for when a CAN message has been transmitted via hardware
@@ -23,6 +23,8 @@ namespace isobus
 #endif
 	std::uint32_t CANHardwareInterface::periodicUpdateInterval = PERIODIC_UPDATE_INTERVAL;
 	std::uint32_t CANHardwareInterface::lastUpdateTimestamp;
+	std::uint64_t CANHardwareInterface::nextDeadline_us = std::numeric_limits<std::uint64_t>::max();
+	Mutex CANHardwareInterface::deadlineMutex;
 
 	EventDispatcher<const CANMessageFrame &> CANHardwareInterface::frameReceivedEventDispatcher;
 	EventDispatcher<const CANMessageFrame &> CANHardwareInterface::frameTransmittedEventDispatcher;
@@ -262,6 +264,7 @@ namespace isobus
 		});
 
 		started = true;
+		register_deadline_request_handler_from_hardware(request_deadline_update);
 		return true;
 	}
 
@@ -272,6 +275,7 @@ namespace isobus
 			LOG_ERROR("[HardwareInterface] Cannot stop interface before it is started.");
 			return false;
 		}
+		register_deadline_request_handler_from_hardware(nullptr);
 		frameReceivedEventDispatcher.clear_listeners();
 		frameTransmittedEventDispatcher.clear_listeners();
 		periodicUpdateEventDispatcher.clear_listeners();
@@ -350,6 +354,28 @@ namespace isobus
 		return periodicUpdateInterval;
 	}
 
+	void CANHardwareInterface::request_deadline_update(std::uint64_t deadline_us)
+	{
+		bool earlierDeadline = false;
+		{
+			LOCK_GUARD(Mutex, deadlineMutex);
+			if (deadline_us < nextDeadline_us)
+			{
+				nextDeadline_us = deadline_us;
+				earlierDeadline = true;
+			}
+		}
+
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		if (earlierDeadline)
+		{
+			updateThreadWakeupCondition.notify_all(); // So it can go back to sleep until the new deadline
+		}
+#else
+		(void)earlierDeadline;
+#endif
+	}
+
 	void CANHardwareInterface::update()
 	{
 		if (started)
@@ -360,8 +386,11 @@ namespace isobus
 				for (std::uint8_t i = 0; i < hardwareChannels.size(); i++)
 				{
 #if defined CAN_STACK_DISABLE_THREADS || defined ARDUINO
-					// If we don't have threads, we need to poll the hardware for messages here
-					hardwareChannels[i]->receive_can_frame();
+					// If we don't have threads, we need to poll the hardware for messages here.
+					// Drain everything that is pending so a burst doesn't wait several updates to be processed.
+					while (hardwareChannels[i]->receive_can_frame())
+					{
+					}
 #endif
 
 					isobus::CANMessageFrame frame;
@@ -376,6 +405,21 @@ namespace isobus
 			}
 
 			// Stage 2 - Update stack. That will fill up the transmit queues if needed
+			bool deadlineReached = false;
+			{
+				LOCK_GUARD(Mutex, deadlineMutex);
+				if (SystemTiming::get_timestamp_us() >= nextDeadline_us)
+				{
+					nextDeadline_us = std::numeric_limits<std::uint64_t>::max();
+					deadlineReached = true;
+				}
+			}
+			if (deadlineReached)
+			{
+				// Serviced before the periodic update, so anything due is transmitted first
+				deadline_update_from_hardware();
+			}
+
 			if (SystemTiming::time_expired_ms(lastUpdateTimestamp, periodicUpdateInterval))
 			{
 				periodicUpdateEventDispatcher.invoke();
@@ -416,7 +460,24 @@ namespace isobus
 		while (started)
 		{
 			std::unique_lock<std::mutex> threadLock(updateMutex);
-			updateThreadWakeupCondition.wait_for(threadLock, std::chrono::milliseconds(periodicUpdateInterval)); // Update with at least the periodic interval
+			std::uint64_t timeToWait_us = static_cast<std::uint64_t>(periodicUpdateInterval) * 1000; // Update with at least the periodic interval
+			{
+				LOCK_GUARD(Mutex, deadlineMutex);
+				const std::uint64_t now_us = SystemTiming::get_timestamp_us();
+
+				if (nextDeadline_us <= now_us)
+				{
+					timeToWait_us = 0;
+				}
+				else if ((nextDeadline_us - now_us) < timeToWait_us)
+				{
+					timeToWait_us = nextDeadline_us - now_us; // Wake up in time for the next deadline
+				}
+			}
+			if (0 != timeToWait_us)
+			{
+				updateThreadWakeupCondition.wait_for(threadLock, std::chrono::microseconds(timeToWait_us));
+			}
 			update();
 		}
 	}
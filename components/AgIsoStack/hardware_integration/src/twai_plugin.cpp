@@ -82,7 +82,12 @@ namespace isobus
 
 		//Wait for message to be received
 		twai_message_t message = {};
+#ifdef CAN_STACK_DISABLE_THREADS
+		// Polled from the application's update task, so only take what is already queued
+		esp_err_t error = twai_receive(&message, 0);
+#else
 		esp_err_t error = twai_receive(&message, pdMS_TO_TICKS(100));
+#endif
 		if (ESP_OK == error)
 		{
 			// Process received message
@@ -91,6 +96,7 @@ namespace isobus
 				canFrame.identifier = message.identifier;
 				canFrame.isExtendedFrame = message.extd;
 				canFrame.dataLength = message.data_length_code;
+				canFrame.timestamp_us = SystemTiming::get_timestamp_us();
 				if (isobus::CAN_DATA_LENGTH >= canFrame.dataLength)
 				{
 					memset(canFrame.data, 0, sizeof(canFrame.data));
@@ -43,6 +43,14 @@ namespace isobus
 		/// @returns true if a NAME matches this filter class's components
 		bool check_name_matches_filter(const NAME &nameToCompare) const;
 
+		/// @brief Returns the bits of a raw 64 bit NAME that this filter checks, and the value those bits must have.
+		/// A NAME matches the filter if `(NAME & mask) == maskedValue`, which lets several filters be checked at once
+		/// by combining their masks and values.
+		/// @param[out] mask The bits of the NAME that this filter checks
+		/// @param[out] maskedValue The value the checked bits must have for a NAME to match
+		/// @returns true if the mask was returned, false if no NAME can match this filter, because its value doesn't fit in the NAME component
+		bool get_name_mask(std::uint64_t &mask, std::uint64_t &maskedValue) const;
+
 	private:
 		NAME::NAMEParameters parameter; ///< The NAME component to filter against
 		std::uint32_t value; ///< The value of the data associated with the filter component
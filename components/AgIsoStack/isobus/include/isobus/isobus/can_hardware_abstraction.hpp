@@ -32,6 +32,21 @@ namespace isobus
 	/// @brief The periodic update abstraction layer between the hardware and the stack
 	void periodic_update_from_hardware();
 
+	/// @brief A function the hardware layer can provide to be told when the stack next needs deadline_update_from_hardware() to be called
+	/// @param[in] deadline_us The point in time to be serviced at, in microseconds, from SystemTiming::get_timestamp_us()
+	using DeadlineRequestHandler = void (*)(std::uint64_t deadline_us);
+
+	/// @brief Lets a hardware layer service deadlines requested by the stack, independently of the periodic update interval.
+	/// @details Registering a handler is optional. Without one, the stack doesn't request deadlines, and anything that
+	/// relies on them falls back to the periodic update. Only the earliest requested deadline needs to be kept, and it is
+	/// forgotten once it is serviced, so anything that still has a later deadline requests it again when it is serviced.
+	/// @param[in] handler The function to call with each requested deadline, or nullptr to stop servicing deadlines
+	void register_deadline_request_handler_from_hardware(DeadlineRequestHandler handler);
+
+	/// @brief The deadline update abstraction layer between the hardware and the stack,
+	/// called once the earliest requested deadline is reached
+	void deadline_update_from_hardware();
+
 } // namespace isobus
 
 #endif // CAN_HARDWARE_ABSTRACTION_HPP
@@ -35,6 +35,7 @@ namespace isobus
 			None, ///< Initial state
 			WaitForClaim, ///< Waiting for the random delay time to expire
 			SendRequestForClaim, ///< Sending the request for address claim to the bus
+			SendRememberedAddressClaim, ///< Claiming an address we claimed before, without waiting for the request contention period
 			WaitForRequestContentionPeriod, ///< Waiting for the address claim contention period to expire
 			SendPreferredAddressClaim, ///< Claiming the preferred address as our own
 			ContendForPreferredAddress, ///< Contending the preferred address with another ECU
@@ -69,6 +70,15 @@ namespace isobus
 		/// @returns The preferred address
 		std::uint8_t get_preferred_address() const;
 
+		/// @brief Lets address claiming start by claiming an address this control function claimed successfully before,
+		/// such as on the previous power cycle, instead of requesting the bus's address claims and waiting out the contention period first.
+		/// @details The address is claimed once the random claim delay expires, and the request for address claim is sent afterwards
+		/// so the rest of the bus is still learned. A CF that already holds the address with a higher priority NAME will contend
+		/// it as usual, after which claiming continues from the request contention period. Only used for the next claim.
+		/// @param[in] address The address to claim, must be the preferred address if our NAME is not arbitrary address capable
+		/// @returns true if the address will be claimed, false if address claiming has already started or the address can't be used
+		bool set_remembered_address(std::uint8_t address);
+
 		/// @brief Returns the event dispatcher for when an address is claimed. Use this to register a callback
 		/// for when an address is claimed.
 		/// @returns The event dispatcher for when an address is claimed
@@ -122,6 +132,7 @@ namespace isobus
 		State state = State::None; ///< The current state of the internal control function
 		std::uint32_t stateChangeTimestamp_ms = 0; ///< A timestamp in milliseconds used for timing the address claiming process
 		std::uint8_t preferredAddress; ///< The address we'd prefer to claim as (we may not get it)
+		std::uint8_t rememberedAddress = NULL_CAN_ADDRESS; ///< An address claimed before that we should claim straight away, or NULL_CAN_ADDRESS
 		std::uint8_t randomClaimDelay_ms; ///< The random delay before claiming an address as required by the ISO11783 standard
 		EventDispatcher<std::uint8_t> addressClaimedDispatcher; ///< The event dispatcher for when an address is claimed
 	};
@@ -145,6 +145,14 @@ namespace isobus
 		/// @returns The CAN channel index associated with the message
 		std::uint8_t get_can_port_index() const;
 
+		/// @brief Returns when the frame that carried the message was received from the hardware
+		/// @returns The timestamp in microseconds, from SystemTiming::get_timestamp_us(), or 0 if it isn't known
+		std::uint64_t get_timestamp_us() const;
+
+		/// @brief Sets when the frame that carried the message was received from the hardware
+		/// @param[in] timestamp The timestamp in microseconds, from SystemTiming::get_timestamp_us()
+		void set_timestamp_us(std::uint64_t timestamp);
+
 		/// @brief Sets the message data to the value supplied. Creates a copy.
 		/// @param[in] dataBuffer The data payload
 		/// @param[in] length the length of the data payload in bytes
@@ -265,6 +273,7 @@ namespace isobus
 		std::vector<std::uint8_t> data; ///< A data buffer for the message, used when not using data chunk callbacks
 		std::shared_ptr<ControlFunction> source; ///< The source control function of the message
 		std::shared_ptr<ControlFunction> destination; ///< The destination control function of the message
+		std::uint64_t timestamp_us = 0; ///< When the frame that carried the message was received from the hardware, or 0 if not known
 		std::uint8_t CANPortIndex; ///< The CAN channel index associated with the message
 	};
 
@@ -17,6 +17,7 @@
 #include "isobus/isobus/can_constants.hpp"
 #include "isobus/isobus/can_control_function.hpp"
 #include "isobus/isobus/can_extended_transport_protocol.hpp"
+#include "isobus/isobus/can_hardware_abstraction.hpp"
 #include "isobus/isobus/can_identifier.hpp"
 #include "isobus/isobus/can_internal_control_function.hpp"
 #include "isobus/isobus/can_message.hpp"
@@ -30,10 +31,12 @@
 #include "isobus/utility/thread_synchronization.hpp"
 
 #include <array>
+#include <atomic>
 #include <deque>
 #include <list>
 #include <memory>
 #include <queue>
+#include <unordered_map>
 
 /// @brief This namespace encompasses all of the ISO11783 stack's functionality to reduce global namespace pollution
 namespace isobus
@@ -75,6 +78,17 @@ namespace isobus
 		/// @param[in] controlFunction The control function to deactivate
 		void deactivate_control_function(std::shared_ptr<PartneredControlFunction> controlFunction);
 
+		/// @brief Adds an external control function that is expected to be on the bus, such as one remembered from the previous power cycle,
+		/// so that it and any partner it matches are usable before it has claimed its address.
+		/// @details The control function is treated as if a request for address claim was just sent on the port, so it is moved to the
+		/// inactive list like any other control function if it doesn't claim its address within the address claim resolution time.
+		/// If it claims a different address, it is moved to it as usual.
+		/// @param[in] controlFunctionNAME The NAME of the control function
+		/// @param[in] address The address the control function is expected to be at
+		/// @param[in] CANPort The CAN channel index of the control function
+		/// @returns true if the control function was added, false if the NAME is already known or the address is already in use
+		bool add_known_control_function(NAME controlFunctionNAME, std::uint8_t address, std::uint8_t CANPort);
+
 		/// @brief Getter for a control function based on certain port and address, normally only used internaly.
 		/// You should try to refrain from using addresses directly, instead try keeping a reference to the control function.
 		/// @param[in] channelIndex CAN Channel index of the control function
@@ -213,6 +227,18 @@ namespace isobus
 		/// @returns An event dispatcher which can be used to get notified about address violations
 		EventDispatcher<std::shared_ptr<InternalControlFunction>> &get_address_violation_event_dispatcher();
 
+		/// @brief Returns the network manager's event dispatcher for notifying consumers whenever
+		/// a deadline requested with request_deadline_update() is reached.
+		/// @details Every listener is notified when any deadline is reached, so listeners should check
+		/// if they are due, and request their next deadline again.
+		/// @returns An event dispatcher which can be used to get notified about reached deadlines
+		EventDispatcher<> &get_deadline_event_dispatcher();
+
+		/// @brief Asks the hardware layer to notify the deadline event dispatcher as soon as possible once a point in time is reached.
+		/// @param[in] deadline_us The point in time to be serviced at, in microseconds, from SystemTiming::get_timestamp_us()
+		/// @returns true if the request was passed on, false if the hardware layer doesn't service deadlines
+		bool request_deadline_update(std::uint64_t deadline_us) const;
+
 		/// @brief Transmits a request for the address claim PGN on the specified channel.
 		/// @attention This is not to be used for normal address claiming. The Internal Control Functions handle this automatically.
 		/// This function is only for special cases where you need to request an address claim to forcefully reconstruct the address table.
@@ -229,6 +255,7 @@ namespace isobus
 		friend class DiagnosticProtocol; ///< Allows the diagnostic protocol to access the protected functions on the network manager
 		friend class ParameterGroupNumberRequestProtocol; ///< Allows the PGN request protocol to access the network manager protected functions
 		friend class FastPacketProtocol; ///< Allows the FP protocol to access the network manager protected functions
+		friend void register_deadline_request_handler_from_hardware(DeadlineRequestHandler handler); ///< Allows the hardware layer to register how it services deadlines
 
 		/// @brief Adds a PGN callback for a protocol class
 		/// @param[in] parameterGroupNumber The PGN to register for
@@ -307,6 +334,17 @@ namespace isobus
 		/// @brief Checks if new partners have been created and matches them to existing control functions
 		void update_new_partners();
 
+		/// @brief Finds a control function that is already known on a channel by its NAME, whether it is
+		/// in the address table or in the inactive list.
+		/// @param[in] NAMEValue The raw 64 bit NAME to look for
+		/// @param[in] channelIndex The CAN channel to look on
+		/// @returns The control function with the NAME, or nullptr if none is known
+		std::shared_ptr<ControlFunction> find_control_function_by_NAME(std::uint64_t NAMEValue, std::uint8_t channelIndex);
+
+		/// @brief Adds a control function to the NAME index of its channel. Called whenever a control function is put in the address table.
+		/// @param[in] controlFunction The control function to index
+		void index_control_function_NAME(const std::shared_ptr<ControlFunction> &controlFunction);
+
 		/// @brief Builds a CAN frame from a frame's discrete components
 		/// @param[in] portIndex The CAN channel index of the CAN message being processed
 		/// @param[in] sourceAddress The source address to send the CAN message from
@@ -406,6 +444,7 @@ namespace isobus
 
 		std::array<std::array<std::shared_ptr<ControlFunction>, NULL_CAN_ADDRESS>, CAN_PORT_MAXIMUM> controlFunctionTable; ///< Table to maintain address to NAME mappings
 		std::list<std::shared_ptr<ControlFunction>> inactiveControlFunctions; ///< A list of the control function that currently don't have a valid address
+		std::array<std::unordered_map<std::uint64_t, std::weak_ptr<ControlFunction>>, CAN_PORT_MAXIMUM> controlFunctionNAMEIndex; ///< Control functions in the address table or inactive list, by NAME, per channel. Entries are checked when used, so ones that were dropped from both are ignored.
 		std::list<std::shared_ptr<InternalControlFunction>> internalControlFunctions; ///< A list of the internal control functions
 		Mutex internalControlFunctionsMutex; ///< A mutex for internal control functions thread safety
 		std::list<std::shared_ptr<PartneredControlFunction>> partneredControlFunctions; ///< A list of the partnered control functions
@@ -418,6 +457,8 @@ namespace isobus
 		std::vector<ParameterGroupNumberCallbackData> anyControlFunctionParameterGroupNumberCallbacks; ///< A list of all global PGN callbacks
 		EventDispatcher<CANMessage> messageTransmittedEventDispatcher; ///< An event dispatcher for notifying consumers about transmitted messages by our application
 		EventDispatcher<std::shared_ptr<InternalControlFunction>> addressViolationEventDispatcher; ///< An event dispatcher for notifying consumers about address violations
+		EventDispatcher<> deadlineEventDispatcher; ///< An event dispatcher for notifying consumers about reached deadlines
+		std::atomic<DeadlineRequestHandler> deadlineRequestHandler = { nullptr }; ///< How the hardware layer is asked to service a deadline, or nullptr if it doesn't
 		Mutex receivedMessageQueueMutex; ///< A mutex for receive messages thread safety
 		Mutex protocolPGNCallbacksMutex; ///< A mutex for PGN callback thread safety
 		Mutex anyControlFunctionCallbacksMutex; ///< Mutex to protect the "any CF" callbacks
@@ -97,6 +97,9 @@ namespace isobus
 		ParameterGroupNumberCallbackData &get_parameter_group_number_callback(std::size_t index);
 
 		const std::vector<NAMEFilter> NAMEFilterList; ///< A list of NAME parameters that describe this control function's identity
+		std::uint64_t NAMEFilterMask = 0; ///< The bits of a NAME checked by the NAME filters, combined from all of them so a NAME can be checked in one go
+		std::uint64_t NAMEFilterValue = 0; ///< The value the bits in NAMEFilterMask must have for a NAME to match the NAME filters
+		bool NAMEFiltersCanMatch = false; ///< False if no NAME can match the NAME filters, like when there are none, or when they contradict each other
 		std::vector<ParameterGroupNumberCallbackData> parameterGroupNumberCallbacks; ///< A list of all parameter group number callbacks associated with this control function
 		bool initialized = false; ///< A way to track if the network manager has processed this CF against existing CFs
 	};
@@ -115,6 +115,22 @@ namespace isobus
 		/// @param[in] success True if the session was successful, false otherwise
 		void complete(bool success) const;
 
+		/// @brief Reinitializes the session for a new message, keeping its data buffer
+		/// @param[in] sessionDirection The direction of the session
+		/// @param[in] sessionParameterGroupNumber The PGN of the message
+		/// @param[in] sessionTotalMessageSize The total size of the message in bytes
+		/// @param[in] sessionSource The source control function
+		/// @param[in] sessionDestination The destination control function
+		/// @param[in] completeCallback A callback for when the session completes
+		/// @param[in] parentPointer A generic context object for the tx complete and chunk callbacks
+		void reset(Direction sessionDirection,
+		           std::uint32_t sessionParameterGroupNumber,
+		           std::uint32_t sessionTotalMessageSize,
+		           std::shared_ptr<ControlFunction> sessionSource,
+		           std::shared_ptr<ControlFunction> sessionDestination,
+		           TransmitCompleteCallback completeCallback,
+		           void *parentPointer);
+
 	private:
 		Direction direction; ///< The direction of the session
 		std::uint32_t parameterGroupNumber; ///< The PGN of the message
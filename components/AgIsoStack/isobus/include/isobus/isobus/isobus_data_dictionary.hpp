@@ -47,6 +47,37 @@ namespace isobus
 			std::string format_value(std::int32_t value) const;
 		};
 
+		/// @brief Formats values of a single DDI, with the DDI's entry and scaling looked up once up front
+		/// @details Use this instead of `format_value_with_ddi` when formatting many values of the same DDI,
+		/// such as when logging or displaying high rate process data.
+		class Formatter
+		{
+		public:
+			/**
+			 * @brief Constructor for a Formatter
+			 * @param ddi The device data identifier whose values will be formatted
+			 */
+			explicit Formatter(std::uint16_t ddi);
+
+			/**
+			 * @brief Format a value to a string, the same way as `Entry::format_value`
+			 * @param value The value to format
+			 * @return The formatted value
+			 */
+			std::string format_value(std::int32_t value) const;
+
+			/**
+			 * @brief Get the entry for the DDI this formatter was made for
+			 * @return The entry for the DDI, or the default entry if it is not in the database
+			 */
+			const Entry &get_entry() const;
+
+		private:
+			const Entry *entry; ///< The entry for the DDI
+			double resolution; ///< The resolution of the DDI
+			double offset; ///< The offset to apply to scaled values so that they start at the display range minimum
+		};
+
 		/**
 		 * @brief Get the string representation of a device data identifier
 		 * @param ddi The device data identifier
@@ -69,8 +100,31 @@ namespace isobus
 		static const Entry &get_entry(std::uint16_t dataDictionaryIdentifier);
 
 	private:
+		/**
+		 * @brief Format a value of a DDI that is an enumeration or bitfield instead of a scaled number
+		 * @param ddi The device data identifier
+		 * @param value The value to format
+		 * @return The formatted value, or an empty string if the DDI is a scaled number
+		 */
+		static std::string format_enumerated_value(std::uint16_t ddi, std::int32_t value);
+
+		/**
+		 * @brief Format a scaled value with trailing zeros removed, followed by a unit
+		 * @param scaledValue The value, already scaled and offset
+		 * @param unitSymbol The unit to append
+		 * @return The formatted value
+		 */
+		static std::string format_scaled_value(double scaledValue, const std::string &unitSymbol);
+
+		/**
+		 * @brief Get the offset that maps the lowest raw value of a DDI to the bottom of its display range
+		 * @param entry The entry for the DDI
+		 * @return The offset to add to a scaled value
+		 */
+		static double get_offset(const Entry &entry);
+
 #ifndef DISABLE_ISOBUS_DATA_DICTIONARY
-		static const Entry DDI_ENTRIES[724]; ///< A lookup table of all DDI entries in ISO11783-11
+		static const Entry DDI_ENTRIES[724]; ///< A lookup table of all DDI entries in ISO11783-11, sorted by DDI so it can be binary searched
 #endif
 		static const Entry DEFAULT_ENTRY; ///< A default "unknown" DDI to return if a DDI is not in the database
 	};
@@ -15,6 +15,7 @@
 
 #include <functional>
 #include <memory>
+#include <unordered_map>
 
 namespace isobus
 {
@@ -164,6 +165,16 @@ namespace isobus
 		/// @returns Pointer to the object matching the provided ID, or nullptr if no match was found
 		std::shared_ptr<task_controller_object::Object> get_object_by_id(std::uint16_t objectID);
 
+		/// @brief Gets the process data object with a certain DDI that is a child of the device element with a certain element number
+		/// @details This is the lookup a TC or TC client needs when it receives a process data message.
+		/// It uses an index that is rebuilt the next time it's needed after objects are added to or removed from the DDOP.
+		/// @note If you change element numbers, DDIs or child references through an object's setters after a lookup,
+		/// the index may not notice until an object is next added or removed.
+		/// @param[in] elementNumber The element number of the device element that owns the process data
+		/// @param[in] ddi The DDI of the process data
+		/// @returns Pointer to the matching process data object, or nullptr if no match was found
+		std::shared_ptr<task_controller_object::DeviceProcessDataObject> get_process_data_object(std::uint16_t elementNumber, std::uint16_t ddi);
+
 		/// @brief Gets an object from the DDOP by index based on object creation
 		/// @param[in] index The index of the object to get
 		/// @returns Pointer to the object matching the index, or nullptr if no match was found
@@ -208,9 +219,38 @@ namespace isobus
 		/// @returns true if the object ID parameter is unique in the DDOP, otherwise false
 		bool check_object_id_unique(std::uint16_t uniqueID) const;
 
+		/// @brief Adds the most recently added object to the object ID index
+		void index_last_object();
+
+		/// @brief Removes an object from the DDOP's indexes
+		/// @param[in] object The object to remove from the indexes
+		void remove_object_from_index(const std::shared_ptr<task_controller_object::Object> &object);
+
+		/// @brief Rebuilds the object ID index from the object list
+		void rebuild_object_id_index();
+
+		/// @brief Rebuilds the element number and DDI to process data index from the object list
+		void rebuild_process_data_index();
+
+		/// @brief Returns the key used by the process data index for an element number and DDI pair
+		/// @param[in] elementNumber The element number
+		/// @param[in] ddi The DDI
+		/// @returns The key for the pair
+		static std::uint32_t get_process_data_key(std::uint16_t elementNumber, std::uint16_t ddi);
+
+		/// @brief Stores a process data object along with the device element it belongs to in the process data index
+		struct ProcessDataIndexEntry
+		{
+			std::shared_ptr<task_controller_object::DeviceElementObject> element; ///< The device element that owns the process data
+			std::shared_ptr<task_controller_object::DeviceProcessDataObject> processData; ///< The process data object
+		};
+
 		static constexpr std::uint8_t MAX_TC_VERSION_SUPPORTED = 4; ///< The max TC version a DDOP object can support as of today
 
 		std::vector<std::shared_ptr<task_controller_object::Object>> objectList; ///< Maintains a list of all added objects
+		std::unordered_map<std::uint16_t, std::shared_ptr<task_controller_object::Object>> objectIDIndex; ///< Maps object IDs to the objects in the object list
+		std::unordered_map<std::uint32_t, ProcessDataIndexEntry> processDataIndex; ///< Maps element number and DDI pairs to process data objects
+		bool processDataIndexValid = false; ///< Tracks if the process data index needs to be rebuilt before it's used
 		std::uint8_t taskControllerCompatibilityLevel = MAX_TC_VERSION_SUPPORTED; ///< Stores the max TC version
 	};
 } // namespace isobus
@@ -16,6 +16,8 @@
 #include "isobus/isobus/isobus_device_descriptor_object_pool.hpp"
 #include "isobus/isobus/isobus_standard_data_description_indices.hpp"
 
+#include <unordered_map>
+
 namespace isobus
 {
 	/// @brief Helper object for parsing DDOPs
@@ -145,11 +147,22 @@ namespace isobus
 		static Implement get_implement_geometry(DeviceDescriptorObjectPool &ddop);
 
 	private:
+		/// @brief Maps an object ID to the device elements whose parent it is, in the order they appear in the DDOP
+		using ChildElementMap = std::unordered_map<std::uint16_t, std::vector<std::shared_ptr<task_controller_object::DeviceElementObject>>>;
+
+		/// @brief Builds a map from each object ID to the device elements whose parent it is
+		/// @details Elements only link to their parent, so this lets the parsers find an element's children without searching the whole DDOP each time
+		/// @param[in] ddop The DDOP to map
+		/// @returns The map of parent object IDs to their child elements
+		static ChildElementMap get_child_elements(DeviceDescriptorObjectPool &ddop);
+
 		/// @brief Parse an element of the DDOP
 		/// @param[in] ddop The DDOP to get the implement geometry and info from
+		/// @param[in] childElements The child elements of each object in the DDOP
 		/// @param[in] elementObject The object to parse
 		/// @param[out] implementToPopulate The implement to populate with the parsed data
 		static void parse_element(DeviceDescriptorObjectPool &ddop,
+		                          const ChildElementMap &childElements,
 		                          std::shared_ptr<task_controller_object::DeviceElementObject> elementObject,
 		                          Implement &implementToPopulate);
 
@@ -162,9 +175,11 @@ namespace isobus
 
 		/// @brief Parse a sub boom element of the DDOP
 		/// @param[in] ddop The DDOP to get the implement geometry and info from
+		/// @param[in] childElements The child elements of each object in the DDOP
 		/// @param[in] elementObject The element to parse
 		/// @returns The parsed sub boom, or a default sub boom if the elementObject is invalid
 		static SubBoom parse_sub_boom(DeviceDescriptorObjectPool &ddop,
+		                              const ChildElementMap &childElements,
 		                              std::shared_ptr<task_controller_object::DeviceElementObject> elementObject);
 
 		/// @brief Parses a bin element of the DDOP
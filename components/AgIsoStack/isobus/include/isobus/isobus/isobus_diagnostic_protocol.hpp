@@ -44,6 +44,8 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace isobus
 {
@@ -208,6 +210,7 @@ namespace isobus
 			FailureModeIdentifier failureModeIdentifier = FailureModeIdentifier::ConditionExists; ///< The FMI defines the type of failure detected in the sub-system identified by an SPN
 			LampStatus lampState = LampStatus::None; ///< The J1939 lamp state for this DTC
 			std::uint8_t occurrenceCount = 0; ///< Number of times the DTC has been active (0 to 126 with 127 being not available)
+			bool active = false; ///< Set by the protocol to track if the DTC is active (DM1) or previously active (DM2)
 		};
 
 		/// @brief The constructor for this protocol
@@ -270,6 +273,8 @@ namespace isobus
 		/// @brief Adds a DTC to the active list, or removes one from the active list
 		/// @details When you call this function with a DTC and `true`, it will be added to the DM1 message.
 		/// When you call it with a DTC and `false` it will be moved to the inactive list.
+		/// DTCs are identified by their SPN and FMI, so activating an already active DTC with a different lamp state
+		/// just updates its lamp state.
 		/// If you get `false` as a return value, either the DTC was already in the target state or the data was not valid
 		/// @param[in] dtc A diagnostic trouble code whose state should be altered
 		/// @param[in] active Sets if the DTC is currently active or not
@@ -392,33 +397,58 @@ namespace isobus
 		std::uint8_t convert_flash_state_to_byte(FlashState flash) const;
 
 		/// @brief This is a way to find the overall lamp states to report
-		/// @details This searches the active DTC list to find if a lamp is on or off, and to find the overall flash state for that lamp.
+		/// @details This searches either the active or inactive DTCs to find if a lamp is on or off, and to find the overall flash state for that lamp.
 		/// Basically, since the lamp states are global to the CAN message, we need a way to resolve the "total" lamp state from the list.
 		/// @param[in] targetLamp The lamp to find the status of
+		/// @param[in] activeCodes `true` to search the active DTCs, `false` to search the inactive ones
 		/// @param[out] flash How the lamp should be flashing
 		/// @param[out] lampOn If the lamp state is on for any DTC
-		void get_active_list_lamp_state_and_flash_state(Lamps targetLamp, FlashState &flash, bool &lampOn) const;
-
-		/// @brief This is a way to find the overall lamp states to report
-		/// @details This searches the inactive DTC list to find if a lamp is on or off, and to find the overall flash state for that lamp.
-		/// Basically, since the lamp states are global to the CAN message, we need a way to resolve the "total" lamp state from the list.
-		/// @param[in] targetLamp The lamp to find the status of
-		/// @param[out] flash How the lamp should be flashing
-		/// @param[out] lampOn If the lamp state is on for any DTC
-		void get_inactive_list_lamp_state_and_flash_state(Lamps targetLamp, FlashState &flash, bool &lampOn) const;
+		void get_lamp_state_and_flash_state(Lamps targetLamp, bool activeCodes, FlashState &flash, bool &lampOn) const;
 
 		/// @brief A callback function used to consume address violation events and activate a DTC
 		/// as required in ISO11783-5.
 		/// @param[in] affectedControlFunction The control function affected by an address violation
 		void on_address_violation(std::shared_ptr<InternalControlFunction> affectedControlFunction);
 
+		/// @brief Serializes the DM1 or DM2 payload from the DTC table
+		/// @param[in] activeCodes `true` to build the DM1 from the active DTCs, `false` to build the DM2 from the inactive ones
+		/// @param[out] payload The payload to fill, which is left empty if the DTCs don't fit in one message
+		void build_diagnostic_message_payload(bool activeCodes, std::vector<std::uint8_t> &payload) const;
+
+		/// @brief Returns the key used to index a DTC in the DTC table
+		/// @param[in] suspectParameterNumber The DTC's SPN
+		/// @param[in] failureModeIdentifier The DTC's FMI
+		/// @returns The SPN and FMI packed the same way they are in a DM1
+		static std::uint32_t get_diagnostic_trouble_code_key(std::uint32_t suspectParameterNumber, std::uint8_t failureModeIdentifier);
+
+		/// @brief Finds a DTC in the DTC table
+		/// @param[in] suspectParameterNumber The DTC's SPN
+		/// @param[in] failureModeIdentifier The DTC's FMI
+		/// @returns The DTC, or nullptr if it is neither active nor previously active
+		DiagnosticTroubleCode *find_diagnostic_trouble_code(std::uint32_t suspectParameterNumber, std::uint8_t failureModeIdentifier);
+
+		/// @brief Moves a DTC that is in the DTC table between active and previously active
+		/// @param[in] dtc The DTC to change
+		/// @param[in] active The new state of the DTC
+		void set_diagnostic_trouble_code_state(DiagnosticTroubleCode &dtc, bool active);
+
+		/// @brief Removes a DTC from the DTC table, if it is in it
+		/// @param[in] suspectParameterNumber The DTC's SPN
+		/// @param[in] failureModeIdentifier The DTC's FMI
+		void remove_diagnostic_trouble_code(std::uint32_t suspectParameterNumber, std::uint8_t failureModeIdentifier);
+
+		/// @brief Rebuilds the DTC table's index after DTCs are removed from it
+		void rebuild_diagnostic_trouble_code_indices();
+
 		/// @brief Sends a DM1 encoded CAN message
+		/// @details The payload is cached, and only rebuilt when the active DTCs change
 		/// @returns true if the message was sent, otherwise false
-		bool send_diagnostic_message_1() const;
+		bool send_diagnostic_message_1();
 
 		/// @brief Sends a DM2 encoded CAN message
+		/// @details The payload is cached, and only rebuilt when the inactive DTCs change
 		/// @returns true if the message was sent, otherwise false
-		bool send_diagnostic_message_2() const;
+		bool send_diagnostic_message_2();
 
 		/// @brief Sends a message that identifies which diagnostic protocols are supported
 		/// @returns true if the message was sent, otherwise false
@@ -492,8 +522,14 @@ namespace isobus
 		std::shared_ptr<InternalControlFunction> myControlFunction; ///< The internal control function that this protocol will send from
 		EventCallbackHandle addressViolationEventHandle; ///< Stores the handle from registering for address violation events
 		NetworkType networkType; ///< The diagnostic network type that this protocol will use
-		std::vector<DiagnosticTroubleCode> activeDTCList; ///< Keeps track of all the active DTCs
-		std::vector<DiagnosticTroubleCode> inactiveDTCList; ///< Keeps track of all the previously active DTCs
+		std::vector<DiagnosticTroubleCode> diagnosticTroubleCodes; ///< Keeps track of all the active and previously active DTCs, in the order they were first activated
+		std::unordered_map<std::uint32_t, std::size_t> diagnosticTroubleCodeIndices; ///< Maps the SPN and FMI of each DTC to its index in diagnosticTroubleCodes
+		std::vector<std::uint8_t> dm1Payload; ///< The cached DM1 payload
+		std::vector<std::uint8_t> dm2Payload; ///< The cached DM2 payload
+		std::size_t numberOfActiveDTCs = 0; ///< The number of DTCs in the table that are active
+		std::size_t numberOfInactiveDTCs = 0; ///< The number of DTCs in the table that are previously active
+		bool dm1PayloadDirty = true; ///< Tells the protocol that the DM1 payload needs to be rebuilt before it is sent
+		bool dm2PayloadDirty = true; ///< Tells the protocol that the DM2 payload needs to be rebuilt before it is sent
 		std::vector<DM22Data> dm22ResponseQueue; ///< Maintaining a list of DM22 responses we need to send to allow for retrying in case of Tx failures
 		std::vector<std::string> ecuIdentificationFields; ///< Stores the ECU ID fields so we can transmit them when ECU ID's PGN is requested
 		std::vector<std::string> softwareIdentificationFields; ///< Stores the Software ID fields so we can transmit them when the PGN is requested
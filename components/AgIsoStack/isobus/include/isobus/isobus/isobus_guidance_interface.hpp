@@ -25,7 +25,9 @@
 #include "isobus/isobus/can_internal_control_function.hpp"
 #include "isobus/utility/event_dispatcher.hpp"
 #include "isobus/utility/processing_flags.hpp"
+#include "isobus/utility/thread_synchronization.hpp"
 
+#include <array>
 #include <memory>
 #include <vector>
 
@@ -111,9 +113,19 @@ namespace isobus
 			/// @returns The timestamp for when the message was received, in milliseconds
 			std::uint32_t get_timestamp_ms() const;
 
+			/// @brief Sets when the frame carrying the message was received from the hardware
+			/// @param[in] timestamp The timestamp in microseconds, from SystemTiming::get_timestamp_us()
+			void set_received_timestamp_us(std::uint64_t timestamp);
+
+			/// @brief Returns when the frame carrying the most recent message was received from the hardware,
+			/// which is earlier than get_timestamp_ms() by however long the message waited to be processed
+			/// @returns The timestamp in microseconds, or 0 if it isn't known
+			std::uint64_t get_received_timestamp_us() const;
+
 		private:
 			std::shared_ptr<ControlFunction> const controlFunction; ///< The CF that is sending the message
 			float commandedCurvature = 0.0f; ///< The commanded curvature in km^-1 (inverse kilometers)
+			std::uint64_t receivedTimestamp_us = 0; ///< When the frame carrying the message was received from the hardware, in microseconds
 			std::uint32_t timestamp_ms = 0; ///< A timestamp for when the message was released in milliseconds
 			CurvatureCommandStatus commandedStatus = CurvatureCommandStatus::NotAvailable; ///< The current status for the command
 		};
@@ -316,10 +328,12 @@ namespace isobus
 
 		/// @brief Use this to configure the transmission of the guidance machine info message from your application. If you pass in an internal control function
 		/// to the constructor of this class, then this message is available to be sent.
+		/// @note Lock get_transmit_data_mutex() while changing it if the deadline driven transmit mode is enabled with threads.
 		GuidanceMachineInfo guidanceMachineInfoTransmitData;
 
 		/// @brief Use this to configure transmission the guidance system command message from your application. If you pass in an internal control function
 		/// to the constructor of this class, then this message is available to be sent.
+		/// @note Lock get_transmit_data_mutex() while changing it if the deadline driven transmit mode is enabled with threads.
 		GuidanceSystemCommand guidanceSystemCommandTransmitData;
 
 		/// @brief Returns the number of received, unique guidance system command sources
@@ -354,6 +368,51 @@ namespace isobus
 		/// @returns The event publisher for guidance system command messages
 		EventDispatcher<const std::shared_ptr<GuidanceSystemCommand>, bool> &get_guidance_system_command_event_publisher();
 
+		/// @brief Counts how late each message sent by the deadline driven transmit mode was,
+		/// compared to when it was due.
+		struct TransmitJitterHistogram
+		{
+			static constexpr std::size_t NUMBER_OF_BINS = 8; ///< The number of ranges the lateness is counted in
+
+			std::array<std::uint32_t, NUMBER_OF_BINS> bins = {}; ///< The number of messages sent in each range of lateness. See get_transmit_jitter_histogram_bin_limit_us() for the ranges.
+			std::uint32_t numberOfMessages = 0; ///< The total number of messages counted
+			std::uint32_t maximumLateness_us = 0; ///< The latest a message has been sent
+			std::uint64_t totalLateness_us = 0; ///< The sum of the lateness of all messages, for the average
+		};
+
+		/// @brief Enables or disables the deadline driven transmit mode.
+		/// @details By default, the periodic messages are sent from update() once their interval has expired, so they are
+		/// late by up to however often update() is called. In the deadline driven mode, the interface asks the hardware
+		/// layer to service it when the next message is due instead, and the messages are sent from CANHardwareInterface::update()
+		/// (the hardware interface's update thread, if threads are enabled) at that time, keeping their schedule.
+		/// If the hardware layer doesn't service deadlines, they are checked from update() instead.
+		/// update() must still be called to process received messages and to retry messages that could not be sent.
+		/// @param[in] enable true to send the periodic messages when they are due, false to send them from update()
+		void set_deadline_driven_transmit(bool enable);
+
+		/// @brief Returns if the deadline driven transmit mode is enabled.
+		/// @returns true if the periodic messages are sent when they are due, false if they are sent from update()
+		bool get_deadline_driven_transmit() const;
+
+		/// @brief Returns the mutex that protects the transmit data while messages are being sent.
+		/// @details In the deadline driven transmit mode, messages are sent from the hardware interface's update thread
+		/// when threads are enabled, so lock this while changing guidanceMachineInfoTransmitData or guidanceSystemCommandTransmitData.
+		/// @returns The mutex that protects the transmit data
+		Mutex &get_transmit_data_mutex();
+
+		/// @brief Returns a histogram of how late the messages sent by the deadline driven transmit mode were.
+		/// @returns A copy of the transmit jitter histogram
+		TransmitJitterHistogram get_transmit_jitter_histogram() const;
+
+		/// @brief Clears the transmit jitter histogram
+		void reset_transmit_jitter_histogram();
+
+		/// @brief Returns the upper limit of the lateness counted in a bin of the transmit jitter histogram.
+		/// Each bin counts the messages that were later than the limit of the bin before it, and at most as late as its own limit.
+		/// @param[in] bin The index of the bin
+		/// @returns The upper limit of the bin in microseconds, or the maximum value for the last bin, which counts everything else
+		static std::uint32_t get_transmit_jitter_histogram_bin_limit_us(std::size_t bin);
+
 		/// @brief Call this cyclically to update the interface. Transmits messages if needed and processes
 		/// timeouts for received messages.
 		void update();
@@ -378,7 +437,25 @@ namespace isobus
 		/// @param[in] parentPointer A context variable to find the relevant instance of this class
 		static void process_rx_message(const CANMessage &message, void *parentPointer);
 
+		/// @brief Registers for deadline events and schedules the periodic messages to be sent right away
+		void start_deadline_driven_transmit();
+
+		/// @brief Stops listening for deadline events
+		void stop_deadline_driven_transmit();
+
+		/// @brief Called when a deadline is reached. Sends the periodic messages that are due and requests the next deadline.
+		/// @note Locks the transmit data mutex
+		void process_deadline();
+
+		/// @brief Sends a periodic message if it's due, and advances its deadline to the next interval.
+		/// The transmit data mutex must be locked.
+		/// @param[in] flag The transmit flag of the message to send
+		/// @param[in,out] deadline_us When the message is due
+		/// @param[in] timestamp_us The current time
+		void process_message_deadline(TransmitFlags flag, std::uint64_t &deadline_us, std::uint64_t timestamp_us);
+
 		static constexpr std::uint32_t GUIDANCE_MESSAGE_TX_INTERVAL_MS = 100; ///< How often guidance messages are sent, defined in ISO 11783-7
+		static constexpr std::uint64_t GUIDANCE_MESSAGE_TX_INTERVAL_US = GUIDANCE_MESSAGE_TX_INTERVAL_MS * 1000; ///< How often guidance messages are sent, in microseconds for the deadline driven transmit mode
 		static constexpr std::uint32_t GUIDANCE_MESSAGE_TIMEOUT_MS = 150; ///< Amount of time before a guidance message is stale. We currently tolerate 50ms of delay.
 		static constexpr float CURVATURE_COMMAND_OFFSET_INVERSE_KM = 8032.0f; ///< Constant offset for curvature being sent on the bus in km-1
 		static constexpr float CURVATURE_COMMAND_MAX_INVERSE_KM = 8031.75f; ///< The maximum curvature that can be encoded once scaling is applied
@@ -401,6 +478,13 @@ namespace isobus
 		std::vector<std::shared_ptr<GuidanceSystemCommand>> receivedGuidanceSystemCommandMessages; ///< A list of all received curvature commands and statuses
 		std::uint32_t guidanceSystemCommandTransmitTimestamp_ms = 0; ///< Timestamp used to know when to transmit the guidance system command message
 		std::uint32_t guidanceMachineInfoTransmitTimestamp_ms = 0; ///< Timestamp used to know when to transmit the guidance machine info message
+		std::uint64_t guidanceSystemCommandDeadline_us = 0; ///< When the guidance system command message is next due in the deadline driven transmit mode
+		std::uint64_t guidanceMachineInfoDeadline_us = 0; ///< When the guidance machine info message is next due in the deadline driven transmit mode
+		TransmitJitterHistogram transmitJitterHistogram; ///< Counts how late the messages sent in the deadline driven transmit mode were
+		EventCallbackHandle deadlineEventHandle = 0; ///< Stores the handle from registering for deadline events
+		bool deadlineDrivenTransmit = false; ///< Stores if the periodic messages are sent when they are due instead of from update()
+		bool deadlinesServicedByHardware = false; ///< Stores if the hardware layer accepted our last deadline request, otherwise update() checks the deadlines
+		mutable Mutex transmitDataMutex; ///< Protects the transmit data, transmit flags, deadlines and histogram, which the hardware interface's thread uses in the deadline driven transmit mode
 		bool initialized = false; ///< Stores if the interface has been initialized
 	};
 } // namespace isobus
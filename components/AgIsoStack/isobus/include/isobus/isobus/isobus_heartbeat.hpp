@@ -18,11 +18,14 @@
 #define ISOBUS_HEARTBEAT_HPP
 
 #include "isobus/isobus/can_callbacks.hpp"
+#include "isobus/isobus/can_constants.hpp"
 #include "isobus/isobus/can_internal_control_function.hpp"
 #include "isobus/isobus/can_message.hpp"
 #include "isobus/utility/event_dispatcher.hpp"
 
-#include <list>
+#include <array>
+#include <memory>
+#include <vector>
 
 namespace isobus
 {
@@ -37,6 +40,21 @@ namespace isobus
 			TimedOut ///< The heartbeat message has not been received within the repetition rate
 		};
 
+		/// @brief Aggregate statistics about the heartbeat of a control function on the bus,
+		/// which can be used to monitor the integrity of its communication over time.
+		/// @details The statistics are kept while the control function holds its address,
+		/// including across timeouts, and are reset if another control function starts sending
+		/// heartbeats from that address.
+		struct HeartbeatStatistics
+		{
+			std::uint32_t numberOfHeartbeatsReceived = 0; ///< The number of heartbeat messages received from the control function
+			std::uint32_t numberOfMissedSequences = 0; ///< The number of sequence counter values that were skipped, which is the number of heartbeats that were presumably lost
+			std::uint32_t numberOfInvalidSequences = 0; ///< The number of heartbeats that had a duplicate or otherwise unexpected sequence counter
+			std::uint32_t numberOfTimeouts = 0; ///< The number of times the heartbeat was not received within the timeout
+			std::uint32_t lastGap_ms = 0; ///< The time between the two most recently received heartbeats
+			std::uint32_t maximumGap_ms = 0; ///< The longest time seen between two received heartbeats
+		};
+
 		/// @brief Constructor for a HeartbeatInterface
 		/// @param[in] sendCANFrameCallback A callback used to send CAN frames
 		HeartbeatInterface(const CANMessageFrameCallback &sendCANFrameCallback);
@@ -79,7 +97,8 @@ namespace isobus
 		/// @brief Returns an event dispatcher which can be used to register for heartbeat errors.
 		/// Heartbeat errors are generated when a heartbeat message is not received within the
 		/// repetition rate, or when the sequence counter is not valid.
-		/// The control function that generated the error is passed as an argument to the event.
+		/// The control function that generated the error is passed as an argument to the event. Timeouts of control
+		/// functions that no longer exist anywhere else in the stack are only counted in their statistics.
 		/// @returns An event dispatcher for heartbeat errors
 		EventDispatcher<HeartBeatError, std::shared_ptr<ControlFunction>> &get_heartbeat_error_event_dispatcher();
 
@@ -89,6 +108,17 @@ namespace isobus
 		/// @returns An event dispatcher for new tracked heartbeat events
 		EventDispatcher<std::shared_ptr<ControlFunction>> &get_new_tracked_heartbeat_event_dispatcher();
 
+		/// @brief Returns the aggregate statistics of the heartbeat received from a control function.
+		/// @param[in] controlFunction The control function to get the statistics of
+		/// @param[out] statistics The statistics of the control function's heartbeat
+		/// @returns true if a heartbeat has been received from the control function at its current address, otherwise false
+		bool get_heartbeat_statistics(std::shared_ptr<ControlFunction> controlFunction, HeartbeatStatistics &statistics) const;
+
+		/// @brief Returns the number of control functions whose heartbeat is currently being received
+		/// within the timeout.
+		/// @returns The number of tracked heartbeats
+		std::size_t get_number_of_tracked_heartbeats() const;
+
 		/// @brief Processes a CAN message, called by the network manager.
 		/// @param[in] message The CAN message being received
 		void process_rx_message(const CANMessage &message);
@@ -110,7 +140,7 @@ namespace isobus
 		static constexpr std::uint32_t SEQUENCE_INITIAL_RESPONSE_TIMEOUT_MS = 250; ///< When requesting a heartbeat from another device, If no response for the repetition rate has been received after 250 ms, the requester shall assume that the request was not accepted
 		static constexpr std::uint32_t SEQUENCE_REPETITION_RATE_MS = 100; ///< A consuming CF shall send a Request for Repetition rate for the heart beat message with a repetition rate of 100 ms
 
-		/// @brief This class is used to store information about a tracked heartbeat.
+		/// @brief This class is used to store information about a heartbeat sent by an internal control function.
 		class Heartbeat
 		{
 		public:
@@ -130,6 +160,36 @@ namespace isobus
 			std::uint8_t sequenceCounter = static_cast<std::uint8_t>(SequenceCounterSpecialValue::Initial); ///< The sequence counter used to validate the heartbeat. Counts from 0-250 normally.
 		};
 
+		/// @brief Stores information about a heartbeat received from another control function.
+		/// @details One of these exists for each address on the bus. The ones currently being received
+		/// are linked together by address in the order they were last received, oldest first, so that
+		/// timeouts can be found without looking at every address.
+		struct ReceivedHeartbeat
+		{
+			std::weak_ptr<ControlFunction> controlFunction; ///< The CF that is sending the message, or empty if no heartbeat was received from this address. Weak so that a CF that left the bus isn't kept alive by its statistics.
+			HeartbeatStatistics statistics; ///< Aggregate statistics about the heartbeat
+			std::uint32_t timestamp_ms = 0; ///< The last time the message was received from the associated control function
+			std::uint8_t sequenceCounter = static_cast<std::uint8_t>(SequenceCounterSpecialValue::Initial); ///< The last sequence counter received
+			std::uint8_t previousAddress = NULL_CAN_ADDRESS; ///< The address of the heartbeat received before this one, or NULL_CAN_ADDRESS if this is the oldest one
+			std::uint8_t nextAddress = NULL_CAN_ADDRESS; ///< The address of the heartbeat received after this one, or NULL_CAN_ADDRESS if this is the newest one
+			bool tracked = false; ///< Whether the heartbeat is in the timeout list, meaning it's being received within the timeout
+		};
+
+		/// @brief Adds a received heartbeat to the end of the timeout list, as it's the most recently received one.
+		/// @param[in] address The address of the heartbeat to add
+		void link_received_heartbeat(std::uint8_t address);
+
+		/// @brief Removes a received heartbeat from the timeout list.
+		/// @param[in] address The address of the heartbeat to remove
+		void unlink_received_heartbeat(std::uint8_t address);
+
+		/// @brief Checks the sequence counter of a received heartbeat against the previous one,
+		/// and updates the heartbeat's statistics accordingly.
+		/// @param[in] heartbeat The heartbeat that was received
+		/// @param[in] sequenceCounter The sequence counter that was received
+		/// @returns true if the sequence counter is the expected one, otherwise false
+		static bool validate_sequence_counter(ReceivedHeartbeat &heartbeat, std::uint8_t sequenceCounter);
+
 		/// @brief Processes a PGN request for a heartbeat.
 		/// @param[in] parameterGroupNumber The PGN being requested
 		/// @param[in] requestingControlFunction The control function that is requesting the heartbeat
@@ -146,7 +206,11 @@ namespace isobus
 		const CANMessageFrameCallback sendCANFrameCallback; ///< A callback for sending a CAN frame
 		EventDispatcher<HeartBeatError, std::shared_ptr<ControlFunction>> heartbeatErrorEventDispatcher; ///< Event dispatcher for heartbeat errors
 		EventDispatcher<std::shared_ptr<ControlFunction>> newTrackedHeartbeatEventDispatcher; ///< Event dispatcher for when a heartbeat message from another control function becomes tracked by this interface
-		std::list<Heartbeat> trackedHeartbeats; ///< Store tracked heartbeat data, per CF
+		std::vector<Heartbeat> transmittedHeartbeats; ///< Store the heartbeats our internal control functions were requested to send
+		std::unique_ptr<std::array<ReceivedHeartbeat, NULL_CAN_ADDRESS>> receivedHeartbeats; ///< Store received heartbeat data, indexed by the source address. Only allocated once a heartbeat is received, as most interfaces never receive one.
+		std::size_t numberOfTrackedHeartbeats = 0; ///< The number of received heartbeats in the timeout list
+		std::uint8_t oldestReceivedHeartbeatAddress = NULL_CAN_ADDRESS; ///< The head of the timeout list, the heartbeat that will time out first
+		std::uint8_t newestReceivedHeartbeatAddress = NULL_CAN_ADDRESS; ///< The tail of the timeout list, the most recently received heartbeat
 		bool enabled = true; ///< Attribute that specifies if this interface is enabled. When false, the interface does nothing.
 	};
 } // namespace isobus
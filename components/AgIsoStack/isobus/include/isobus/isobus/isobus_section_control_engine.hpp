@@ -0,0 +1,247 @@
+//================================================================================================
+/// @file isobus_section_control_engine.hpp
+///
+/// @brief Defines an automatic section control engine for task controller servers.
+/// The engine takes an implement's geometry from its DDOP and a stream of positions, keeps a
+/// raster of the area that has already been worked, and decides which sections should be on
+/// so that the implement does not work the same ground twice.
+/// @author The Little Dawn Developers
+///
+/// @copyright 2026 The Little Dawn Developers
+//================================================================================================
+#ifndef ISOBUS_SECTION_CONTROL_ENGINE_HPP
+#define ISOBUS_SECTION_CONTROL_ENGINE_HPP
+
+#include "isobus/isobus/isobus_device_descriptor_object_pool_helpers.hpp"
+#include "isobus/utility/event_dispatcher.hpp"
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace isobus
+{
+	/// @brief Automatic section control based on a coverage raster of the field.
+	/// @details Positions are given in a local east/north plane in metres, such as one made by projecting
+	/// GNSS positions around a point in the field, and are the position of the implement's device reference point (DRP).
+	/// Section offsets are relative to the DRP, as ISO 11783-10 defines them, so the DDOP's offsets can be used as they are.
+	///
+	/// Each update, sections that are on paint the ground they passed over into the coverage raster, then every
+	/// section is checked against the raster at a look-ahead position that compensates for the time the implement
+	/// takes to actually turn it on or off. A section that would be on ground that is already covered by more than
+	/// the overlap tolerance is turned off, otherwise it is turned on. The raster is only as fine as its cells, so
+	/// the tolerance should be larger than one cell's share of a section's width.
+	///
+	/// When the commanded states change, the engine publishes the new setpoint condensed work states
+	/// (DDIs 290 to 305) for each parent element of the sections, which a TC server can send with send_set_value.
+	///
+	/// The section geometry is kept as flat arrays so that moving all the sections is a few branch free loops
+	/// the compiler can vectorize, which keeps large planters cheap to update at high rates.
+	class SectionControlEngine
+	{
+	public:
+		/// @brief Constructor for a SectionControlEngine
+		/// @param[in] cellSize_mm The size of each square cell in the coverage raster in mm
+		explicit SectionControlEngine(std::uint32_t cellSize_mm = 100);
+
+		/// @brief Sets up the engine's sections from an implement's geometry.
+		/// @details This also resets all section states, but keeps the coverage raster.
+		/// @param[in] implement The implement geometry, usually from DeviceDescriptorObjectPoolHelper::get_implement_geometry
+		/// @returns true if the implement had at least one section with a width, otherwise false
+		bool set_implement(const DeviceDescriptorObjectPoolHelper::Implement &implement);
+
+		/// @brief Returns the number of sections the engine is controlling
+		/// @returns The number of sections
+		std::size_t get_number_sections() const;
+
+		/// @brief Sets how long the implement takes to turn a section on, which is compensated for by looking ahead
+		/// @param[in] latency_ms The turn on latency in milliseconds
+		void set_turn_on_latency(std::uint32_t latency_ms);
+
+		/// @brief Returns the turn on latency
+		/// @returns The turn on latency in milliseconds
+		std::uint32_t get_turn_on_latency() const;
+
+		/// @brief Sets how long the implement takes to turn a section off, which is compensated for by looking ahead
+		/// @param[in] latency_ms The turn off latency in milliseconds
+		void set_turn_off_latency(std::uint32_t latency_ms);
+
+		/// @brief Returns the turn off latency
+		/// @returns The turn off latency in milliseconds
+		std::uint32_t get_turn_off_latency() const;
+
+		/// @brief Sets how much of a section's width may be over covered ground before it is turned off.
+		/// @param[in] tolerance_percent The overlap tolerance, from 0 to 100 percent
+		void set_overlap_tolerance(std::uint8_t tolerance_percent);
+
+		/// @brief Returns the overlap tolerance
+		/// @returns The overlap tolerance in percent
+		std::uint8_t get_overlap_tolerance() const;
+
+		/// @brief Sets the speed below which all sections are turned off
+		/// @param[in] speed_mm_per_s The minimum working speed in mm/s
+		void set_minimum_speed(std::uint32_t speed_mm_per_s);
+
+		/// @brief Turns automatic section control on or off. When it is off, all sections are commanded off.
+		/// @param[in] enable true to control sections automatically, false to turn them all off
+		void set_enabled(bool enable);
+
+		/// @brief Returns if automatic section control is on
+		/// @returns true if automatic section control is on, otherwise false
+		bool get_enabled() const;
+
+		/// @brief Tells the engine the actual work state of a section, as reported by the implement.
+		/// @details Once any actual state has been reported, coverage is painted from the actual states instead
+		/// of the commanded ones, so that sections that are slow or manually overridden are accounted for.
+		/// @param[in] sectionIndex The index of the section, in the order it appears in the implement geometry
+		/// @param[in] isOn true if the section is actually working, otherwise false
+		void set_section_actual_work_state(std::size_t sectionIndex, bool isOn);
+
+		/// @brief Tells the engine the actual work states of a parent element's sections from an actual condensed work state (DDIs 161 to 176).
+		/// @param[in] elementNumber The element number of the sections' parent element
+		/// @param[in] dataDescriptionIndex The DDI of the condensed work state
+		/// @param[in] value The value of the condensed work state
+		void set_actual_condensed_work_state(std::uint16_t elementNumber, std::uint16_t dataDescriptionIndex, std::uint32_t value);
+
+		/// @brief Moves the implement and updates the coverage raster and section states.
+		/// @param[in] east_m The east position of the DRP in metres
+		/// @param[in] north_m The north position of the DRP in metres
+		/// @param[in] heading_deg The heading of the implement in degrees, clockwise from north
+		/// @param[in] speed_mm_per_s The forwards speed of the implement in mm/s
+		void update(double east_m, double north_m, float heading_deg, std::uint32_t speed_mm_per_s);
+
+		/// @brief Returns the state the engine is commanding a section to be in
+		/// @param[in] sectionIndex The index of the section, in the order it appears in the implement geometry
+		/// @returns true if the section is commanded on, otherwise false
+		bool get_section_setpoint_work_state(std::size_t sectionIndex) const;
+
+		/// @brief Returns how much of a section's width was over covered ground at its last check
+		/// @param[in] sectionIndex The index of the section
+		/// @returns The covered part of the section's width in percent
+		std::uint8_t get_section_overlap(std::size_t sectionIndex) const;
+
+		/// @brief Returns the element number of a section
+		/// @param[in] sectionIndex The index of the section
+		/// @returns The section's element number, or NULL_OBJECT_ID if the index is not valid
+		std::uint16_t get_section_element_number(std::size_t sectionIndex) const;
+
+		/// @brief Returns the current setpoint condensed work state for a group of 16 sections of a parent element
+		/// @param[in] elementNumber The element number of the sections' parent element
+		/// @param[in] dataDescriptionIndex The setpoint condensed work state DDI, from 290 to 305
+		/// @param[out] value The condensed work state value
+		/// @returns true if the element and DDI are controlled by the engine, otherwise false
+		bool get_setpoint_condensed_work_state(std::uint16_t elementNumber, std::uint16_t dataDescriptionIndex, std::uint32_t &value) const;
+
+		/// @brief Returns an event dispatcher which is called with the parent element number, DDI and value
+		/// of each setpoint condensed work state that changed during an update.
+		/// @returns The setpoint event dispatcher
+		EventDispatcher<std::uint16_t, std::uint16_t, std::uint32_t> &get_setpoint_event_dispatcher();
+
+		/// @brief Returns if a point is in the coverage raster
+		/// @param[in] east_m The east position of the point in metres
+		/// @param[in] north_m The north position of the point in metres
+		/// @returns true if the point has been covered, otherwise false
+		bool is_covered(double east_m, double north_m) const;
+
+		/// @brief Returns the area covered so far
+		/// @returns The covered area in square metres
+		double get_covered_area() const;
+
+		/// @brief Forgets all covered area, such as when starting a new field
+		void clear_coverage();
+
+	private:
+		/// @brief A square block of cells in the coverage raster, one bit per cell
+		using CoverageTile = std::array<std::uint64_t, 64>;
+
+		/// @brief Stores the position of a parent element's sections in the flat section arrays
+		struct SectionGroup
+		{
+			std::uint16_t elementNumber; ///< The element number of the sections' parent element
+			std::size_t firstSection; ///< The index of the first section of the parent element
+			std::size_t numberOfSections; ///< The number of sections of the parent element
+		};
+
+		/// @brief Returns the tile key of a cell in the raster
+		/// @param[in] cellEast The east index of the cell
+		/// @param[in] cellNorth The north index of the cell
+		/// @returns The key of the tile that holds the cell
+		static std::uint64_t get_tile_key(std::int32_t cellEast, std::int32_t cellNorth);
+
+		/// @brief Converts a position into a raster cell index
+		/// @param[in] position_m The position along one axis in metres
+		/// @returns The cell index along the axis
+		std::int32_t get_cell_index(double position_m) const;
+
+		/// @brief Returns if a cell is covered
+		/// @param[in] cellEast The east index of the cell
+		/// @param[in] cellNorth The north index of the cell
+		/// @returns true if the cell is covered, otherwise false
+		bool is_cell_covered(std::int32_t cellEast, std::int32_t cellNorth) const;
+
+		/// @brief Marks a cell as covered
+		/// @param[in] cellEast The east index of the cell
+		/// @param[in] cellNorth The north index of the cell
+		void cover_cell(std::int32_t cellEast, std::int32_t cellNorth);
+
+		/// @brief Paints the area a section passed over since the last update into the raster
+		/// @param[in] sectionIndex The index of the section
+		void paint_section(std::size_t sectionIndex);
+
+		/// @brief Returns how much of a section's width is over covered ground
+		/// @param[in] sectionIndex The index of the section
+		/// @param[in] shiftEast_m How far east of the section's current position to check
+		/// @param[in] shiftNorth_m How far north of the section's current position to check
+		/// @returns The covered fraction of the section's width, from 0 to 1
+		float get_covered_fraction(std::size_t sectionIndex, double shiftEast_m, double shiftNorth_m) const;
+
+		/// @brief Packs the states of up to 16 sections into a condensed work state value
+		/// @param[in] states The section states
+		/// @param[in] firstSection The index of the first section to pack
+		/// @param[in] numberOfSections The number of sections to pack
+		/// @returns The condensed work state value, with unused sections marked as not installed
+		static std::uint32_t get_condensed_work_state(const std::vector<bool> &states, std::size_t firstSection, std::size_t numberOfSections);
+
+		/// @brief Publishes the condensed work states of every group whose setpoints changed
+		/// @param[in] previousSetpoints The section setpoints from before the update
+		void publish_setpoint_changes(const std::vector<bool> &previousSetpoints);
+
+		static constexpr std::size_t MAX_SECTIONS_PER_ELEMENT = 256; ///< The most sections the condensed work state DDIs can describe
+		static constexpr std::int32_t TILE_SIZE = 64; ///< The number of cells along each side of a coverage tile
+		static constexpr double MAX_PAINT_DISTANCE_M = 10.0; ///< Position jumps larger than this are not painted, as they are probably a GNSS glitch
+		static constexpr double MIN_LOOK_AHEAD_CELLS = 2.0; ///< Sections always look at least this many cells ahead, so they don't see the cells they just covered
+
+		EventDispatcher<std::uint16_t, std::uint16_t, std::uint32_t> setpointEventDispatcher; ///< Publishes changes to the setpoint condensed work states
+		std::unordered_map<std::uint64_t, CoverageTile> coverage; ///< The coverage raster, stored as sparse tiles
+		std::vector<SectionGroup> sectionGroups; ///< The parent elements of the sections
+		std::vector<float> sectionXOffsets_m; ///< The fore/aft offset of each section's centre from the DRP
+		std::vector<float> sectionYOffsets_m; ///< The left/right offset of each section's centre from the DRP
+		std::vector<float> sectionHalfWidths_m; ///< Half the width of each section
+		std::vector<double> sectionLeftEast_m; ///< The east position of each section's left end
+		std::vector<double> sectionLeftNorth_m; ///< The north position of each section's left end
+		std::vector<double> sectionRightEast_m; ///< The east position of each section's right end
+		std::vector<double> sectionRightNorth_m; ///< The north position of each section's right end
+		std::vector<double> previousLeftEast_m; ///< The east position of each section's left end at the last update
+		std::vector<double> previousLeftNorth_m; ///< The north position of each section's left end at the last update
+		std::vector<double> previousRightEast_m; ///< The east position of each section's right end at the last update
+		std::vector<double> previousRightNorth_m; ///< The north position of each section's right end at the last update
+		std::vector<std::uint16_t> sectionElementNumbers; ///< The element number of each section
+		std::vector<std::uint8_t> sectionOverlaps; ///< The covered percentage of each section's width at its last check
+		std::vector<bool> sectionSetpoints; ///< The state the engine commands each section to be in
+		std::vector<bool> sectionActualStates; ///< The actual state of each section as reported by the implement
+		CoverageTile *cachedTile = nullptr; ///< The tile that was last painted, to avoid looking it up for every cell
+		std::uint64_t cachedTileKey = 0; ///< The key of the cached tile
+		std::size_t numberOfCoveredCells = 0; ///< The number of cells that have been covered
+		double cellSize_m; ///< The size of each cell in metres
+		std::uint32_t turnOnLatency_ms = 0; ///< How long the implement takes to turn a section on
+		std::uint32_t turnOffLatency_ms = 0; ///< How long the implement takes to turn a section off
+		std::uint32_t minimumSpeed_mm_per_s = 500; ///< The speed below which all sections are turned off
+		std::uint8_t overlapTolerance_percent = 10; ///< How much of a section's width may be over covered ground
+		bool enabled = true; ///< Whether automatic section control is on
+		bool actualStatesReported = false; ///< Whether the implement has reported any actual work states
+		bool hasPreviousPosition = false; ///< Whether the previous section positions are valid
+	};
+} // namespace isobus
+
+#endif // ISOBUS_SECTION_CONTROL_ENGINE_HPP
@@ -0,0 +1,813 @@
+//================================================================================================
+/// @file isobus_static_device_descriptor_object_pool.hpp
+///
+/// @brief Defines a way to describe a Task Controller DDOP that is serialized at compile time.
+/// For implements whose DDOP never changes, this avoids building the pool out of heap allocated
+/// objects and serializing it at runtime, and lets the binary pool live in flash.
+/// @author The Little Dawn Developers
+///
+/// @copyright 2026 The Little Dawn Developers
+//================================================================================================
+
+#ifndef ISOBUS_STATIC_DEVICE_DESCRIPTOR_OBJECT_POOL_HPP
+#define ISOBUS_STATIC_DEVICE_DESCRIPTOR_OBJECT_POOL_HPP
+
+#include "isobus/isobus/isobus_task_controller_client_objects.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace isobus
+{
+	/// @brief Functions for building a binary DDOP at compile time
+	/// @details Each object function returns the serialized object as a ByteArray, and make_pool
+	/// concatenates them into the binary DDOP in the order given. The arguments of each function match the
+	/// equivalent DeviceDescriptorObjectPool::add_ function, and the output is the same as what
+	/// DeviceDescriptorObjectPool::generate_binary_object_pool would produce for a TC version 4 DDOP.
+	/// Unlike the runtime builder, designators are never truncated, so they must already fit the limits
+	/// of the TC version you are targeting.
+	///
+	/// A DDOP can be declared like this, where each of the results is placed in read only memory:
+	/// @code
+	/// static constexpr auto BINARY_DDOP = isobus::static_ddop::make_pool(
+	///   isobus::static_ddop::device("Sprayer", "1.0.0", "123", "SPR1.0", LOCALIZATION_LABEL, CLIENT_NAME),
+	///   isobus::static_ddop::device_element("Sprayer", 0, 0, isobus::task_controller_object::DeviceElementObject::Type::Device, 1, { 2 }),
+	///   isobus::static_ddop::device_process_data("Actual Work State", 141, isobus::NULL_OBJECT_ID, 1, 8, 2));
+	/// static constexpr auto PROCESS_DATA = isobus::static_ddop::make_process_data_table<isobus::static_ddop::count_process_data(BINARY_DDOP)>(BINARY_DDOP);
+	/// @endcode
+	/// @note Everything here is evaluated using recursion, so very large pools may need the compiler's constexpr depth limit raised.
+	namespace static_ddop
+	{
+		/// @brief A list of indices used to expand a pack of bytes at compile time
+		template<std::size_t... Indices>
+		struct IndexSequence
+		{
+		};
+
+		/// @brief Joins two index sequences, offsetting the second one by the length of the first
+		template<typename First, typename Second>
+		struct ConcatenateIndexSequences;
+
+		/// @brief Joins two index sequences, offsetting the second one by the length of the first
+		template<std::size_t... First, std::size_t... Second>
+		struct ConcatenateIndexSequences<IndexSequence<First...>, IndexSequence<Second...>>
+		{
+			using type = IndexSequence<First..., (sizeof...(First) + Second)...>; ///< The joined sequence
+		};
+
+		/// @brief Makes the index sequence 0 to Length - 1, splitting it in half each time to keep the template depth low
+		template<std::size_t Length>
+		struct MakeIndexSequence : ConcatenateIndexSequences<typename MakeIndexSequence<Length / 2>::type, typename MakeIndexSequence<Length - (Length / 2)>::type>
+		{
+		};
+
+		/// @brief Makes an empty index sequence
+		template<>
+		struct MakeIndexSequence<0>
+		{
+			using type = IndexSequence<>; ///< The empty sequence
+		};
+
+		/// @brief Makes an index sequence with the single index 0
+		template<>
+		struct MakeIndexSequence<1>
+		{
+			using type = IndexSequence<0>; ///< The sequence with one index
+		};
+
+		/// @brief A fixed size array of bytes that can be built at compile time
+		template<std::size_t Length>
+		struct ByteArray
+		{
+			/// @brief Returns the number of bytes in the array
+			/// @returns The number of bytes in the array
+			constexpr std::size_t size() const
+			{
+				return Length;
+			}
+
+			/// @brief Returns a byte from the array
+			/// @param[in] index The index of the byte to get
+			/// @returns The byte at the index
+			constexpr std::uint8_t operator[](std::size_t index) const
+			{
+				return bytes[index];
+			}
+
+			std::uint8_t bytes[Length]; ///< The bytes
+		};
+
+		/// @brief Identifies a process data object in a DDOP by the element number and DDI that process data messages address it with
+		struct ProcessDataEntry
+		{
+			std::uint16_t elementNumber; ///< The element number of the device element that owns the process data
+			std::uint16_t ddi; ///< The DDI of the process data
+			std::uint16_t objectID; ///< The object ID of the process data object
+		};
+
+		/// @brief A fixed size table of the process data in a DDOP, in the order the device elements reference them
+		template<std::size_t Count>
+		struct ProcessDataTable
+		{
+			ProcessDataEntry entries[(Count > 0) ? Count : 1]; ///< The entries, of which only the first Count are valid
+		};
+
+		/// @brief Runs a generator for each index in a sequence to build a byte array
+		/// @param[in] generator An object with a constexpr at(index) function that returns the byte at each index
+		/// @returns The generated bytes
+		template<typename Generator, std::size_t... Indices>
+		constexpr ByteArray<sizeof...(Indices)> generate_bytes(const Generator &generator, IndexSequence<Indices...>)
+		{
+			return ByteArray<sizeof...(Indices)>{ { generator.at(Indices)... } };
+		}
+
+		/// @brief Returns the exponent of a float in base 2
+		/// @param[in] value The value, which must be positive
+		/// @returns The unbiased exponent
+		constexpr std::int32_t get_float_exponent(float value)
+		{
+			return (value >= 2.0f) ? (1 + get_float_exponent(value / 2.0f)) : ((value < 1.0f) ? (get_float_exponent(value * 2.0f) - 1) : 0);
+		}
+
+		/// @brief Scales a float by powers of 2 until it's in the range [1, 2)
+		/// @param[in] value The value, which must be positive
+		/// @returns The scaled value
+		constexpr float get_float_significand(float value)
+		{
+			return (value >= 2.0f) ? get_float_significand(value / 2.0f) : ((value < 1.0f) ? get_float_significand(value * 2.0f) : value);
+		}
+
+		/// @brief Returns the IEEE 754 representation of a float, since it can't be copied into an integer at compile time
+		/// @note Subnormal numbers, infinity and NaN are not supported
+		/// @param[in] value The value to convert
+		/// @returns The bits of the float
+		constexpr std::uint32_t get_float_bits(float value)
+		{
+			return (0.0f == value) ? 0 : ((value < 0.0f) ? (0x80000000 | get_float_bits(-value)) : ((static_cast<std::uint32_t>(get_float_exponent(value) + 127) << 23) | static_cast<std::uint32_t>((get_float_significand(value) - 1.0f) * 8388608.0f)));
+		}
+
+		/// @brief Generates the bytes of a device object
+		struct DeviceObjectGenerator
+		{
+			/// @brief Returns the offset of the software version length
+			/// @returns The offset of the software version length
+			constexpr std::size_t software_version_offset() const
+			{
+				return 6 + designatorLength;
+			}
+
+			/// @brief Returns the offset of the client NAME
+			/// @returns The offset of the client NAME
+			constexpr std::size_t name_offset() const
+			{
+				return software_version_offset() + 1 + softwareVersionLength;
+			}
+
+			/// @brief Returns the offset of the serial number length
+			/// @returns The offset of the serial number length
+			constexpr std::size_t serial_number_offset() const
+			{
+				return name_offset() + 8;
+			}
+
+			/// @brief Returns the offset of the structure label
+			/// @returns The offset of the structure label
+			constexpr std::size_t structure_label_offset() const
+			{
+				return serial_number_offset() + 1 + serialNumberLength;
+			}
+
+			/// @brief Returns the offset of the localization label
+			/// @returns The offset of the localization label
+			constexpr std::size_t localization_label_offset() const
+			{
+				return structure_label_offset() + task_controller_object::DeviceObject::MAX_STRUCTURE_AND_LOCALIZATION_LABEL_LENGTH;
+			}
+
+			/// @brief Returns the offset of the extended structure label length
+			/// @returns The offset of the extended structure label length
+			constexpr std::size_t extended_structure_label_offset() const
+			{
+				return localization_label_offset() + task_controller_object::DeviceObject::MAX_STRUCTURE_AND_LOCALIZATION_LABEL_LENGTH;
+			}
+
+			/// @brief Returns a byte of the serialized object
+			/// @param[in] index The index of the byte
+			/// @returns The byte at the index
+			constexpr std::uint8_t at(std::size_t index) const
+			{
+				return static_cast<std::uint8_t>((index < 3) ? "DVC"[index] :
+				                                 (index < 5) ? 0 :
+				                                 (index == 5) ? designatorLength :
+				                                 (index < software_version_offset()) ? designator[index - 6] :
+				                                 (index == software_version_offset()) ? softwareVersionLength :
+				                                 (index < name_offset()) ? softwareVersion[index - software_version_offset() - 1] :
+				                                 (index < serial_number_offset()) ? (clientNAME >> (8 * (index - name_offset()))) :
+				                                 (index == serial_number_offset()) ? serialNumberLength :
+				                                 (index < structure_label_offset()) ? serialNumber[index - serial_number_offset() - 1] :
+				                                 (index < localization_label_offset()) ? (((index - structure_label_offset()) < structureLabelLength) ? structureLabel[index - structure_label_offset()] : ' ') :
+				                                 (index < extended_structure_label_offset()) ? localizationLabel[index - localization_label_offset()] :
+				                                 (index == extended_structure_label_offset()) ? extendedStructureLabelLength :
+				                                                                                extendedStructureLabel[index - extended_structure_label_offset() - 1]);
+			}
+
+			const char *designator; ///< The device designator
+			std::size_t designatorLength; ///< The number of bytes in the designator
+			const char *softwareVersion; ///< The software version
+			std::size_t softwareVersionLength; ///< The number of bytes in the software version
+			const char *serialNumber; ///< The serial number
+			std::size_t serialNumberLength; ///< The number of bytes in the serial number
+			const char *structureLabel; ///< The structure label, which is padded with spaces to 7 bytes
+			std::size_t structureLabelLength; ///< The number of bytes in the structure label
+			const std::uint8_t *localizationLabel; ///< The 7 byte localization label
+			const std::uint8_t *extendedStructureLabel; ///< The extended structure label
+			std::size_t extendedStructureLabelLength; ///< The number of bytes in the extended structure label
+			std::uint64_t clientNAME; ///< The NAME of the client
+		};
+
+		/// @brief Generates the bytes of a device element object
+		struct DeviceElementObjectGenerator
+		{
+			/// @brief Returns a byte of the serialized object
+			/// @param[in] index The index of the byte
+			/// @returns The byte at the index
+			constexpr std::uint8_t at(std::size_t index) const
+			{
+				return static_cast<std::uint8_t>((index < 3) ? "DET"[index] :
+				                                 (index == 3) ? objectID :
+				                                 (index == 4) ? (objectID >> 8) :
+				                                 (index == 5) ? type :
+				                                 (index == 6) ? designatorLength :
+				                                 (index < (7 + designatorLength)) ? designator[index - 7] :
+				                                 (index == (7 + designatorLength)) ? elementNumber :
+				                                 (index == (8 + designatorLength)) ? (elementNumber >> 8) :
+				                                 (index == (9 + designatorLength)) ? parentObjectID :
+				                                 (index == (10 + designatorLength)) ? (parentObjectID >> 8) :
+				                                 (index == (11 + designatorLength)) ? numberOfChildren :
+				                                 (index == (12 + designatorLength)) ? (numberOfChildren >> 8) :
+				                                                                      (children[(index - 13 - designatorLength) / 2] >> (8 * ((index - 13 - designatorLength) % 2))));
+			}
+
+			const char *designator; ///< The element designator
+			std::size_t designatorLength; ///< The number of bytes in the designator
+			std::uint8_t type; ///< The element type
+			std::uint16_t elementNumber; ///< The element number
+			std::uint16_t parentObjectID; ///< The object ID of the parent
+			std::uint16_t objectID; ///< The object ID
+			const std::uint16_t *children; ///< The object IDs of the children
+			std::size_t numberOfChildren; ///< The number of children
+		};
+
+		/// @brief Generates the bytes of a device process data object
+		struct DeviceProcessDataObjectGenerator
+		{
+			/// @brief Returns a byte of the serialized object
+			/// @param[in] index The index of the byte
+			/// @returns The byte at the index
+			constexpr std::uint8_t at(std::size_t index) const
+			{
+				return static_cast<std::uint8_t>((index < 3) ? "DPD"[index] :
+				                                 (index == 3) ? objectID :
+				                                 (index == 4) ? (objectID >> 8) :
+				                                 (index == 5) ? ddi :
+				                                 (index == 6) ? (ddi >> 8) :
+				                                 (index == 7) ? properties :
+				                                 (index == 8) ? triggerMethods :
+				                                 (index == 9) ? designatorLength :
+				                                 (index < (10 + designatorLength)) ? designator[index - 10] :
+				                                 (index == (10 + designatorLength)) ? presentationObjectID :
+				                                                                      (presentationObjectID >> 8));
+			}
+
+			const char *designator; ///< The process data designator
+			std::size_t designatorLength; ///< The number of bytes in the designator
+			std::uint16_t ddi; ///< The DDI
+			std::uint16_t presentationObjectID; ///< The object ID of the value presentation, or the null object ID
+			std::uint8_t properties; ///< The properties bitfield
+			std::uint8_t triggerMethods; ///< The available trigger methods bitfield
+			std::uint16_t objectID; ///< The object ID
+		};
+
+		/// @brief Generates the bytes of a device property object
+		struct DevicePropertyObjectGenerator
+		{
+			/// @brief Returns a byte of the serialized object
+			/// @param[in] index The index of the byte
+			/// @returns The byte at the index
+			constexpr std::uint8_t at(std::size_t index) const
+			{
+				return static_cast<std::uint8_t>((index < 3) ? "DPT"[index] :
+				                                 (index == 3) ? objectID :
+				                                 (index == 4) ? (objectID >> 8) :
+				                                 (index == 5) ? ddi :
+				                                 (index == 6) ? (ddi >> 8) :
+				                                 (index < 11) ? (static_cast<std::uint32_t>(value) >> (8 * (index - 7))) :
+				                                 (index == 11) ? designatorLength :
+				                                 (index < (12 + designatorLength)) ? designator[index - 12] :
+				                                 (index == (12 + designatorLength)) ? presentationObjectID :
+				                                                                      (presentationObjectID >> 8));
+			}
+
+			const char *designator; ///< The property designator
+			std::size_t designatorLength; ///< The number of bytes in the designator
+			std::int32_t value; ///< The value of the property
+			std::uint16_t ddi; ///< The DDI
+			std::uint16_t presentationObjectID; ///< The object ID of the value presentation, or the null object ID
+			std::uint16_t objectID; ///< The object ID
+		};
+
+		/// @brief Generates the bytes of a device value presentation object
+		struct DeviceValuePresentationObjectGenerator
+		{
+			/// @brief Returns a byte of the serialized object
+			/// @param[in] index The index of the byte
+			/// @returns The byte at the index
+			constexpr std::uint8_t at(std::size_t index) const
+			{
+				return static_cast<std::uint8_t>((index < 3) ? "DVP"[index] :
+				                                 (index == 3) ? objectID :
+				                                 (index == 4) ? (objectID >> 8) :
+				                                 (index < 9) ? (static_cast<std::uint32_t>(offset) >> (8 * (index - 5))) :
+				                                 (index < 13) ? (get_float_bits(scale) >> (8 * (index - 9))) :
+				                                 (index == 13) ? numberOfDecimals :
+				                                 (index == 14) ? designatorLength :
+				                                                 designator[index - 15]);
+			}
+
+			const char *designator; ///< The unit designator
+			std::size_t designatorLength; ///< The number of bytes in the designator
+			std::int32_t offset; ///< The offset applied to values for presentation
+			float scale; ///< The scale applied to values for presentation
+			std::uint8_t numberOfDecimals; ///< The number of decimals to present
+			std::uint16_t objectID; ///< The object ID
+		};
+
+		/// @brief Serializes a device object with an extended structure label
+		/// @param[in] deviceDesignator Descriptive text for the object, UTF-8
+		/// @param[in] deviceSoftwareVersion Software version indicating text
+		/// @param[in] deviceSerialNumber Device and manufacturer-specific serial number of the Device (UTF-8)
+		/// @param[in] deviceStructureLabel This label allows the device to identify the current version of the device descriptor object pool
+		/// @param[in] deviceLocalizationLabel Defined by the language command PGN
+		/// @param[in] deviceExtendedStructureLabel Continuation of the Label given by Device to identify the Device descriptor Structure
+		/// @param[in] clientIsoNAME NAME of client device as defined in ISO 11783-5
+		/// @returns The serialized object
+		template<std::size_t DesignatorSize, std::size_t SoftwareVersionSize, std::size_t SerialNumberSize, std::size_t StructureLabelSize, std::size_t ExtendedStructureLabelSize>
+		constexpr ByteArray<31 + (DesignatorSize - 1) + (SoftwareVersionSize - 1) + (SerialNumberSize - 1) + ExtendedStructureLabelSize> device(const char (&deviceDesignator)[DesignatorSize],
+		                                                                                                                                  const char (&deviceSoftwareVersion)[SoftwareVersionSize],
+		                                                                                                                                  const char (&deviceSerialNumber)[SerialNumberSize],
+		                                                                                                                                  const char (&deviceStructureLabel)[StructureLabelSize],
+		                                                                                                                                  const std::uint8_t (&deviceLocalizationLabel)[task_controller_object::DeviceObject::MAX_STRUCTURE_AND_LOCALIZATION_LABEL_LENGTH],
+		                                                                                                                                  const std::uint8_t (&deviceExtendedStructureLabel)[ExtendedStructureLabelSize],
+		                                                                                                                                  std::uint64_t clientIsoNAME)
+		{
+			static_assert((DesignatorSize - 1) <= task_controller_object::Object::MAX_DESIGNATOR_LENGTH, "Device designator is too long");
+			static_assert((SerialNumberSize - 1) <= task_controller_object::Object::MAX_DESIGNATOR_LENGTH, "Device serial number is too long");
+			static_assert((StructureLabelSize - 1) <= task_controller_object::DeviceObject::MAX_STRUCTURE_AND_LOCALIZATION_LABEL_LENGTH, "Device structure label is too long");
+			static_assert(ExtendedStructureLabelSize <= task_controller_object::DeviceObject::MAX_EXTENDED_STRUCTURE_LABEL_LENGTH, "Device extended structure label is too long");
+			return generate_bytes(DeviceObjectGenerator{ deviceDesignator, DesignatorSize - 1, deviceSoftwareVersion, SoftwareVersionSize - 1, deviceSerialNumber, SerialNumberSize - 1, deviceStructureLabel, StructureLabelSize - 1, deviceLocalizationLabel, deviceExtendedStructureLabel, ExtendedStructureLabelSize, clientIsoNAME },
+			                      typename MakeIndexSequence<31 + (DesignatorSize - 1) + (SoftwareVersionSize - 1) + (SerialNumberSize - 1) + ExtendedStructureLabelSize>::type());
+		}
+
+		/// @brief Serializes a device object with an empty extended structure label
+		/// @param[in] deviceDesignator Descriptive text for the object, UTF-8
+		/// @param[in] deviceSoftwareVersion Software version indicating text
+		/// @param[in] deviceSerialNumber Device and manufacturer-specific serial number of the Device (UTF-8)
+		/// @param[in] deviceStructureLabel This label allows the device to identify the current version of the device descriptor object pool
+		/// @param[in] deviceLocalizationLabel Defined by the language command PGN
+		/// @param[in] clientIsoNAME NAME of client device as defined in ISO 11783-5
+		/// @returns The serialized object
+		template<std::size_t DesignatorSize, std::size_t SoftwareVersionSize, std::size_t SerialNumberSize, std::size_t StructureLabelSize>
+		constexpr ByteArray<31 + (DesignatorSize - 1) + (SoftwareVersionSize - 1) + (SerialNumberSize - 1)> device(const char (&deviceDesignator)[DesignatorSize],
+		                                                                                                      const char (&deviceSoftwareVersion)[SoftwareVersionSize],
+		                                                                                                      const char (&deviceSerialNumber)[SerialNumberSize],
+		                                                                                                      const char (&deviceStructureLabel)[StructureLabelSize],
+		                                                                                                      const std::uint8_t (&deviceLocalizationLabel)[task_controller_object::DeviceObject::MAX_STRUCTURE_AND_LOCALIZATION_LABEL_LENGTH],
+		                                                                                                      std::uint64_t clientIsoNAME)
+		{
+			static_assert((DesignatorSize - 1) <= task_controller_object::Object::MAX_DESIGNATOR_LENGTH, "Device designator is too long");
+			static_assert((SerialNumberSize - 1) <= task_controller_object::Object::MAX_DESIGNATOR_LENGTH, "Device serial number is too long");
+			static_assert((StructureLabelSize - 1) <= task_controller_object::DeviceObject::MAX_STRUCTURE_AND_LOCALIZATION_LABEL_LENGTH, "Device structure label is too long");
+			return generate_bytes(DeviceObjectGenerator{ deviceDesignator, DesignatorSize - 1, deviceSoftwareVersion, SoftwareVersionSize - 1, deviceSerialNumber, SerialNumberSize - 1, deviceStructureLabel, StructureLabelSize - 1, deviceLocalizationLabel, nullptr, 0, clientIsoNAME },
+			                      typename MakeIndexSequence<31 + (DesignatorSize - 1) + (SoftwareVersionSize - 1) + (SerialNumberSize - 1)>::type());
+		}
+
+		/// @brief Serializes a device element object with child objects
+		/// @param[in] deviceElementDesignator Descriptive text for the object, UTF-8
+		/// @param[in] deviceElementNumber The Element number for process data variable addressing
+		/// @param[in] parentObjectID Object ID of parent DeviceElementObject or DeviceObject
+		/// @param[in] deviceElementType The type of element, such as "device" or "bin"
+		/// @param[in] uniqueID The object ID of the object. Must be unique in the DDOP.
+		/// @param[in] childObjectIDs The object IDs of the process data and property objects that belong to this element
+		/// @returns The serialized object
+		template<std::size_t DesignatorSize, std::size_t NumberOfChildren>
+		constexpr ByteArray<13 + (DesignatorSize - 1) + (2 * NumberOfChildren)> device_element(const char (&deviceElementDesignator)[DesignatorSize],
+		                                                                                     std::uint16_t deviceElementNumber,
+		                                                                                     std::uint16_t parentObjectID,
+		                                                                                     task_controller_object::DeviceElementObject::Type deviceElementType,
+		                                                                                     std::uint16_t uniqueID,
+		                                                                                     const std::uint16_t (&childObjectIDs)[NumberOfChildren])
+		{
+			static_assert((DesignatorSize - 1) <= task_controller_object::Object::MAX_DESIGNATOR_LENGTH, "Device element designator is too long");
+			return generate_bytes(DeviceElementObjectGenerator{ deviceElementDesignator, DesignatorSize - 1, static_cast<std::uint8_t>(deviceElementType), deviceElementNumber, parentObjectID, uniqueID, childObjectIDs, NumberOfChildren },
+			                      typename MakeIndexSequence<13 + (DesignatorSize - 1) + (2 * NumberOfChildren)>::type());
+		}
+
+		/// @brief Serializes a device element object with no child objects
+		/// @param[in] deviceElementDesignator Descriptive text for the object, UTF-8
+		/// @param[in] deviceElementNumber The Element number for process data variable addressing
+		/// @param[in] parentObjectID Object ID of parent DeviceElementObject or DeviceObject
+		/// @param[in] deviceElementType The type of element, such as "device" or "bin"
+		/// @param[in] uniqueID The object ID of the object. Must be unique in the DDOP.
+		/// @returns The serialized object
+		template<std::size_t DesignatorSize>
+		constexpr ByteArray<13 + (DesignatorSize - 1)> device_element(const char (&deviceElementDesignator)[DesignatorSize],
+		                                                             std::uint16_t deviceElementNumber,
+		                                                             std::uint16_t parentObjectID,
+		                                                             task_controller_object::DeviceElementObject::Type deviceElementType,
+		                                                             std::uint16_t uniqueID)
+		{
+			static_assert((DesignatorSize - 1) <= task_controller_object::Object::MAX_DESIGNATOR_LENGTH, "Device element designator is too long");
+			return generate_bytes(DeviceElementObjectGenerator{ deviceElementDesignator, DesignatorSize - 1, static_cast<std::uint8_t>(deviceElementType), deviceElementNumber, parentObjectID, uniqueID, nullptr, 0 },
+			                      typename MakeIndexSequence<13 + (DesignatorSize - 1)>::type());
+		}
+
+		/// @brief Serializes a device process data object
+		/// @param[in] processDataDesignator Descriptive text for the object, UTF-8
+		/// @param[in] processDataDDI Identifier of process data variable (DDI) according to definitions in Annex B and ISO 11783 - 11
+		/// @param[in] deviceValuePresentationObjectID Object identifier of a DeviceValuePresentationObject, or the null ID
+		/// @param[in] processDataProperties A bitset of properties associated to this object. Some combination of `PropertiesBit`
+		/// @param[in] processDataTriggerMethods A bitset of available trigger methods, built from some combination of `AvailableTriggerMethods`
+		/// @param[in] uniqueID The object ID of the object. Must be unique in the DDOP.
+		/// @returns The serialized object
+		template<std::size_t DesignatorSize>
+		constexpr ByteArray<12 + (DesignatorSize - 1)> device_process_data(const char (&processDataDesignator)[DesignatorSize],
+		                                                                  std::uint16_t processDataDDI,
+		                                                                  std::uint16_t deviceValuePresentationObjectID,
+		                                                                  std::uint8_t processDataProperties,
+		                                                                  std::uint8_t processDataTriggerMethods,
+		                                                                  std::uint16_t uniqueID)
+		{
+			static_assert((DesignatorSize - 1) <= task_controller_object::Object::MAX_DESIGNATOR_LENGTH, "Process data designator is too long");
+			return generate_bytes(DeviceProcessDataObjectGenerator{ processDataDesignator, DesignatorSize - 1, processDataDDI, deviceValuePresentationObjectID, processDataProperties, processDataTriggerMethods, uniqueID },
+			                      typename MakeIndexSequence<12 + (DesignatorSize - 1)>::type());
+		}
+
+		/// @brief Serializes a device property object
+		/// @param[in] propertyDesignator Descriptive text for the object, UTF-8
+		/// @param[in] propertyValue The value of the property
+		/// @param[in] propertyDDI Identifier of property (DDI) according to definitions in Annex B and ISO 11783 - 11.
+		/// @param[in] valuePresentationObject Object identifier of DeviceValuePresentationObject, or NULL object ID
+		/// @param[in] uniqueID The object ID of the object. Must be unique in the DDOP.
+		/// @returns The serialized object
+		template<std::size_t DesignatorSize>
+		constexpr ByteArray<14 + (DesignatorSize - 1)> device_property(const char (&propertyDesignator)[DesignatorSize],
+		                                                              std::int32_t propertyValue,
+		                                                              std::uint16_t propertyDDI,
+		                                                              std::uint16_t valuePresentationObject,
+		                                                              std::uint16_t uniqueID)
+		{
+			static_assert((DesignatorSize - 1) <= task_controller_object::Object::MAX_DESIGNATOR_LENGTH, "Property designator is too long");
+			return generate_bytes(DevicePropertyObjectGenerator{ propertyDesignator, DesignatorSize - 1, propertyValue, propertyDDI, valuePresentationObject, uniqueID },
+			                      typename MakeIndexSequence<14 + (DesignatorSize - 1)>::type());
+		}
+
+		/// @brief Serializes a device value presentation object
+		/// @param[in] unitDesignator Unit designator for this value presentation
+		/// @param[in] offsetValue Offset to be applied to the value for presentation.
+		/// @param[in] scaleFactor Scale to be applied to the value for presentation.
+		/// @param[in] numberDecimals Specifies the number of decimals to display after the decimal point.
+		/// @param[in] uniqueID The object ID of the object. Must be unique in the DDOP.
+		/// @returns The serialized object
+		template<std::size_t DesignatorSize>
+		constexpr ByteArray<15 + (DesignatorSize - 1)> device_value_presentation(const char (&unitDesignator)[DesignatorSize],
+		                                                                        std::int32_t offsetValue,
+		                                                                        float scaleFactor,
+		                                                                        std::uint8_t numberDecimals,
+		                                                                        std::uint16_t uniqueID)
+		{
+			static_assert((DesignatorSize - 1) <= task_controller_object::Object::MAX_DESIGNATOR_LENGTH, "Unit designator is too long");
+			return generate_bytes(DeviceValuePresentationObjectGenerator{ unitDesignator, DesignatorSize - 1, offsetValue, scaleFactor, numberDecimals, uniqueID },
+			                      typename MakeIndexSequence<15 + (DesignatorSize - 1)>::type());
+		}
+
+		/// @brief Computes the total size of a list of byte array types
+		template<typename... Objects>
+		struct TotalSize;
+
+		/// @brief Computes the total size of an empty list of byte array types
+		template<>
+		struct TotalSize<>
+		{
+			static constexpr std::size_t value = 0; ///< The total size
+		};
+
+		/// @brief Computes the total size of a list of byte array types
+		template<std::size_t FirstLength, typename... Rest>
+		struct TotalSize<ByteArray<FirstLength>, Rest...>
+		{
+			static constexpr std::size_t value = FirstLength + TotalSize<Rest...>::value; ///< The total size
+		};
+
+		/// @brief Returns a byte from a list of byte arrays as if they were one array
+		/// @param[in] index The index of the byte
+		/// @param[in] first The first array
+		/// @returns The byte at the index
+		template<std::size_t FirstLength>
+		constexpr std::uint8_t get_byte(std::size_t index, const ByteArray<FirstLength> &first)
+		{
+			return first[index];
+		}
+
+		/// @brief Returns a byte from a list of byte arrays as if they were one array
+		/// @param[in] index The index of the byte
+		/// @param[in] first The first array
+		/// @param[in] second The second array
+		/// @param[in] rest The other arrays
+		/// @returns The byte at the index
+		template<std::size_t FirstLength, std::size_t SecondLength, typename... Rest>
+		constexpr std::uint8_t get_byte(std::size_t index, const ByteArray<FirstLength> &first, const ByteArray<SecondLength> &second, const Rest &...rest)
+		{
+			return (index < FirstLength) ? first[index] : get_byte(index - FirstLength, second, rest...);
+		}
+
+		/// @brief Concatenates a list of byte arrays
+		/// @param[in] objects The arrays to concatenate
+		/// @returns The concatenated array
+		template<std::size_t... Indices, typename... Objects>
+		constexpr ByteArray<sizeof...(Indices)> concatenate(IndexSequence<Indices...>, const Objects &...objects)
+		{
+			return ByteArray<sizeof...(Indices)>{ { get_byte(Indices, objects...)... } };
+		}
+
+		/// @brief Builds a binary DDOP out of serialized objects
+		/// @param[in] objects The serialized objects, in the order they should appear in the DDOP
+		/// @returns The binary DDOP
+		template<typename... Objects>
+		constexpr ByteArray<TotalSize<Objects...>::value> make_pool(const Objects &...objects)
+		{
+			return concatenate(typename MakeIndexSequence<TotalSize<Objects...>::value>::type(), objects...);
+		}
+
+		/// @brief Reads a little endian 16 bit value from a binary DDOP
+		/// @param[in] pool The binary DDOP
+		/// @param[in] offset The offset of the value
+		/// @returns The value
+		template<std::size_t Length>
+		constexpr std::uint16_t read_uint16(const ByteArray<Length> &pool, std::size_t offset)
+		{
+			return static_cast<std::uint16_t>(pool[offset] | (pool[offset + 1] << 8));
+		}
+
+		/// @brief Returns if the object at an offset in a binary DDOP has a certain table ID
+		/// @param[in] pool The binary DDOP
+		/// @param[in] offset The offset of the object
+		/// @param[in] tableID The table ID to check for, such as "DET"
+		/// @returns true if the object has the table ID, otherwise false
+		template<std::size_t Length>
+		constexpr bool is_table(const ByteArray<Length> &pool, std::size_t offset, const char *tableID)
+		{
+			return (pool[offset] == static_cast<std::uint8_t>(tableID[0])) &&
+			  (pool[offset + 1] == static_cast<std::uint8_t>(tableID[1])) &&
+			  (pool[offset + 2] == static_cast<std::uint8_t>(tableID[2]));
+		}
+
+		/// @brief Returns the offset of the structure label of the device object at an offset in a binary DDOP
+		/// @param[in] pool The binary DDOP
+		/// @param[in] serialNumberOffset The offset of the device object's serial number length
+		/// @returns The offset of the structure label
+		template<std::size_t Length>
+		constexpr std::size_t get_device_structure_label_offset(const ByteArray<Length> &pool, std::size_t serialNumberOffset)
+		{
+			return serialNumberOffset + 1 + pool[serialNumberOffset];
+		}
+
+		/// @brief Returns the offset of the structure label of the device object at an offset in a binary DDOP
+		/// @param[in] pool The binary DDOP
+		/// @param[in] softwareVersionOffset The offset of the device object's software version length
+		/// @returns The offset of the structure label
+		template<std::size_t Length>
+		constexpr std::size_t get_device_structure_label_offset_from_software_version(const ByteArray<Length> &pool, std::size_t softwareVersionOffset)
+		{
+			return get_device_structure_label_offset(pool, softwareVersionOffset + 1 + pool[softwareVersionOffset] + 8);
+		}
+
+		/// @brief Returns the offset of the structure label of the device object at an offset in a binary DDOP
+		/// @param[in] pool The binary DDOP
+		/// @param[in] offset The offset of the device object
+		/// @returns The offset of the structure label
+		template<std::size_t Length>
+		constexpr std::size_t get_device_structure_label_offset_from_object(const ByteArray<Length> &pool, std::size_t offset)
+		{
+			return get_device_structure_label_offset_from_software_version(pool, offset + 6 + pool[offset + 5]);
+		}
+
+		/// @brief Returns the size of the object at an offset in a binary DDOP
+		/// @param[in] pool The binary DDOP
+		/// @param[in] offset The offset of the object
+		/// @returns The size of the object in bytes, or the rest of the pool if the object is not recognized
+		template<std::size_t Length>
+		constexpr std::size_t get_object_size(const ByteArray<Length> &pool, std::size_t offset)
+		{
+			return is_table(pool, offset, "DVC") ? (get_device_structure_label_offset_from_object(pool, offset) + 15 + pool[get_device_structure_label_offset_from_object(pool, offset) + 14] - offset) :
+			  is_table(pool, offset, "DET") ? (13 + pool[offset + 6] + (2 * read_uint16(pool, offset + 11 + pool[offset + 6]))) :
+			  is_table(pool, offset, "DPD") ? (12 + pool[offset + 9]) :
+			  is_table(pool, offset, "DPT") ? (14 + pool[offset + 11]) :
+			  is_table(pool, offset, "DVP") ? (15 + pool[offset + 14]) :
+			                                  (Length - offset);
+		}
+
+		/// @brief Finds the first object with a certain table ID in a binary DDOP
+		/// @param[in] pool The binary DDOP
+		/// @param[in] tableID The table ID to search for
+		/// @param[in] offset The offset to start searching from
+		/// @returns The offset of the object, or the size of the pool if it wasn't found
+		template<std::size_t Length>
+		constexpr std::size_t find_table(const ByteArray<Length> &pool, const char *tableID, std::size_t offset)
+		{
+			return (offset >= Length) ? Length : (is_table(pool, offset, tableID) ? offset : find_table(pool, tableID, offset + get_object_size(pool, offset)));
+		}
+
+		/// @brief Finds an object by its ID in a binary DDOP
+		/// @param[in] pool The binary DDOP
+		/// @param[in] objectID The object ID to search for
+		/// @param[in] offset The offset to start searching from
+		/// @returns The offset of the object, or the size of the pool if it wasn't found
+		template<std::size_t Length>
+		constexpr std::size_t find_object(const ByteArray<Length> &pool, std::uint16_t objectID, std::size_t offset)
+		{
+			return (offset >= Length) ? Length : ((objectID == read_uint16(pool, offset + 3)) ? offset : find_object(pool, objectID, offset + get_object_size(pool, offset)));
+		}
+
+		/// @brief Returns if an object ID refers to a process data object in a binary DDOP
+		/// @param[in] pool The binary DDOP
+		/// @param[in] objectID The object ID to check
+		/// @returns true if the object is a process data object, otherwise false
+		template<std::size_t Length>
+		constexpr bool is_process_data(const ByteArray<Length> &pool, std::uint16_t objectID)
+		{
+			return (find_object(pool, objectID, 0) < Length) && is_table(pool, find_object(pool, objectID, 0), "DPD");
+		}
+
+		/// @brief Returns a child object ID of the device element object at an offset in a binary DDOP
+		/// @param[in] pool The binary DDOP
+		/// @param[in] offset The offset of the device element object
+		/// @param[in] childIndex The index of the child
+		/// @returns The object ID of the child
+		template<std::size_t Length>
+		constexpr std::uint16_t get_child_object_id(const ByteArray<Length> &pool, std::size_t offset, std::size_t childIndex)
+		{
+			return read_uint16(pool, offset + 13 + pool[offset + 6] + (2 * childIndex));
+		}
+
+		/// @brief Counts the process data children of the device element object at an offset in a binary DDOP
+		/// @param[in] pool The binary DDOP
+		/// @param[in] offset The offset of the device element object
+		/// @param[in] childIndex The index of the child to start counting from
+		/// @returns The number of process data children
+		template<std::size_t Length>
+		constexpr std::size_t count_process_data_children(const ByteArray<Length> &pool, std::size_t offset, std::size_t childIndex)
+		{
+			return (childIndex >= read_uint16(pool, offset + 11 + pool[offset + 6])) ? 0 : ((is_process_data(pool, get_child_object_id(pool, offset, childIndex)) ? 1 : 0) + count_process_data_children(pool, offset, childIndex + 1));
+		}
+
+		/// @brief Counts the process data children of the object at an offset in a binary DDOP
+		/// @param[in] pool The binary DDOP
+		/// @param[in] offset The offset of the object
+		/// @returns The number of process data children, which is 0 for anything other than a device element
+		template<std::size_t Length>
+		constexpr std::size_t count_object_process_data(const ByteArray<Length> &pool, std::size_t offset)
+		{
+			return is_table(pool, offset, "DET") ? count_process_data_children(pool, offset, 0) : 0;
+		}
+
+		/// @brief Counts the process data referenced by the device elements in a binary DDOP, which is the size of its process data table
+		/// @param[in] pool The binary DDOP
+		/// @param[in] offset The offset to start counting from
+		/// @returns The number of process data entries
+		template<std::size_t Length>
+		constexpr std::size_t count_process_data(const ByteArray<Length> &pool, std::size_t offset = 0)
+		{
+			return (offset >= Length) ? 0 : (count_object_process_data(pool, offset) + count_process_data(pool, offset + get_object_size(pool, offset)));
+		}
+
+		/// @brief Builds a process data table entry for a device element object and one of its children
+		/// @param[in] pool The binary DDOP
+		/// @param[in] offset The offset of the device element object
+		/// @param[in] childObjectID The object ID of the process data child
+		/// @returns The process data table entry
+		template<std::size_t Length>
+		constexpr ProcessDataEntry make_process_data_entry(const ByteArray<Length> &pool, std::size_t offset, std::uint16_t childObjectID)
+		{
+			return ProcessDataEntry{ read_uint16(pool, offset + 7 + pool[offset + 6]), read_uint16(pool, find_object(pool, childObjectID, 0) + 5), childObjectID };
+		}
+
+		/// @brief Finds the process data table entry for a process data child of the device element object at an offset in a binary DDOP
+		/// @param[in] pool The binary DDOP
+		/// @param[in] offset The offset of the device element object
+		/// @param[in] index The index of the entry among the element's process data children
+		/// @param[in] childIndex The index of the child to start searching from
+		/// @returns The process data table entry
+		template<std::size_t Length>
+		constexpr ProcessDataEntry get_element_process_data_entry(const ByteArray<Length> &pool, std::size_t offset, std::size_t index, std::size_t childIndex)
+		{
+			return is_process_data(pool, get_child_object_id(pool, offset, childIndex)) ?
+			  ((0 == index) ? make_process_data_entry(pool, offset, get_child_object_id(pool, offset, childIndex)) : get_element_process_data_entry(pool, offset, index - 1, childIndex + 1)) :
+			  get_element_process_data_entry(pool, offset, index, childIndex + 1);
+		}
+
+		/// @brief Finds an entry of the process data table of a binary DDOP
+		/// @param[in] pool The binary DDOP
+		/// @param[in] index The index of the entry
+		/// @param[in] offset The offset to start searching from
+		/// @returns The process data table entry
+		template<std::size_t Length>
+		constexpr ProcessDataEntry get_process_data_entry(const ByteArray<Length> &pool, std::size_t index, std::size_t offset)
+		{
+			return (index < count_object_process_data(pool, offset)) ?
+			  get_element_process_data_entry(pool, offset, index, 0) :
+			  get_process_data_entry(pool, index - count_object_process_data(pool, offset), offset + get_object_size(pool, offset));
+		}
+
+		/// @brief Builds the process data table of a binary DDOP
+		/// @param[in] pool The binary DDOP
+		/// @returns The process data table
+		template<std::size_t Count, std::size_t Length, std::size_t... Indices>
+		constexpr ProcessDataTable<Count> generate_process_data_table(const ByteArray<Length> &pool, IndexSequence<Indices...>)
+		{
+			return ProcessDataTable<Count>{ { get_process_data_entry(pool, Indices, 0)... } };
+		}
+
+		/// @brief Builds the table that maps element numbers and DDIs to the process data objects of a binary DDOP
+		/// @tparam Count The number of entries, which must be count_process_data(pool)
+		/// @param[in] pool The binary DDOP
+		/// @returns The process data table
+		template<std::size_t Count, std::size_t Length>
+		constexpr ProcessDataTable<Count> make_process_data_table(const ByteArray<Length> &pool)
+		{
+			return generate_process_data_table<Count>(pool, typename MakeIndexSequence<Count>::type());
+		}
+	} // namespace static_ddop
+
+	/// @brief Refers to a DDOP that was serialized at compile time using the static_ddop functions
+	/// @details This is what the task controller client accepts for a compile time DDOP.
+	/// It only points to the binary pool and process data table, which should have static storage duration.
+	class StaticDeviceDescriptorObjectPool
+	{
+	public:
+		/// @brief Constructs a reference to a compile time DDOP
+		/// @param[in] pool The binary DDOP, which must contain a device object
+		/// @param[in] processDataTable The DDOP's process data table
+		template<std::size_t Length, std::size_t Count>
+		StaticDeviceDescriptorObjectPool(const static_ddop::ByteArray<Length> &pool, const static_ddop::ProcessDataTable<Count> &processDataTable) :
+		  binaryPool(pool.bytes),
+		  binaryPoolSize(static_cast<std::uint32_t>(Length)),
+		  processData(processDataTable.entries),
+		  numberOfProcessData(Count),
+		  structureLabelOffset(static_ddop::get_device_structure_label_offset_from_object(pool, static_ddop::find_table(pool, "DVC", 0)))
+		{
+		}
+
+		/// @brief Returns the binary DDOP
+		/// @returns Pointer to the binary DDOP
+		const std::uint8_t *get_binary_object_pool() const;
+
+		/// @brief Returns the size of the binary DDOP
+		/// @returns The number of bytes in the binary DDOP
+		std::uint32_t size() const;
+
+		/// @brief Returns the structure label of the device object
+		/// @returns The 7 character structure label
+		std::string get_structure_label() const;
+
+		/// @brief Returns the localization label of the device object
+		/// @returns The 7 byte localization label
+		std::array<std::uint8_t, task_controller_object::DeviceObject::MAX_STRUCTURE_AND_LOCALIZATION_LABEL_LENGTH> get_localization_label() const;
+
+		/// @brief Looks up the object ID of a process data object by the element number and DDI used to address it
+		/// @param[in] elementNumber The element number of the device element that owns the process data
+		/// @param[in] ddi The DDI of the process data
+		/// @param[out] objectID The object ID of the process data object, if it was found
+		/// @returns true if the process data was found, otherwise false
+		bool get_process_data_object_id(std::uint16_t elementNumber, std::uint16_t ddi, std::uint16_t &objectID) const;
+
+		/// @brief Returns the number of entries in the process data table
+		/// @returns The number of entries in the process data table
+		std::size_t get_number_process_data() const;
+
+		/// @brief Returns an entry of the process data table
+		/// @param[in] index The index of the entry, which must be less than get_number_process_data()
+		/// @returns The entry at the index
+		const static_ddop::ProcessDataEntry &get_process_data(std::size_t index) const;
+
+	private:
+		const std::uint8_t *binaryPool; ///< The binary DDOP
+		std::uint32_t binaryPoolSize; ///< The number of bytes in the binary DDOP
+		const static_ddop::ProcessDataEntry *processData; ///< The process data table
+		std::size_t numberOfProcessData; ///< The number of entries in the process data table
+		std::size_t structureLabelOffset; ///< The offset of the device object's structure label in the binary DDOP
+	};
+} // namespace isobus
+
+#endif // ISOBUS_STATIC_DEVICE_DESCRIPTOR_OBJECT_POOL_HPP
@@ -9,13 +9,16 @@
 #ifndef ISOBUS_TASK_CONTROLLER_CLIENT_HPP
 #define ISOBUS_TASK_CONTROLLER_CLIENT_HPP
 
+#include "isobus/isobus/can_callbacks.hpp"
 #include "isobus/isobus/can_internal_control_function.hpp"
 #include "isobus/isobus/can_partnered_control_function.hpp"
 #include "isobus/isobus/isobus_device_descriptor_object_pool.hpp"
 #include "isobus/isobus/isobus_language_command_interface.hpp"
+#include "isobus/isobus/isobus_static_device_descriptor_object_pool.hpp"
 #include "isobus/utility/processing_flags.hpp"
 
 #include <list>
+#include <map>
 #if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
 #include <thread>
 #endif
@@ -127,6 +130,27 @@ namespace isobus
 		/// @param[in] parentPointer A generic context variable that will be passed into the associated callback when it gets called
 		void add_value_command_callback(ValueCommandCallback callback, void *parentPointer);
 
+		/// @brief Routes value commands for one element number and DDI to a dedicated callback.
+		/// @details Commands for a routed element and DDI go only to that callback instead of
+		/// to every callback added with `add_value_command_callback`. This is intended for
+		/// peer control assignments and high rate setpoints.
+		/// When `immediate` is true, the callback is called from the CAN receive path as soon as the command
+		/// arrives (and the PDACK is sent right away if the TC asked for one), instead of on the next `update`.
+		/// The callback must be quick and must not block when this is used.
+		/// Other commands wait in a fixed size queue until the next `update`, and are dropped with a warning if the queue is full.
+		/// Adding a handler for an element number and DDI that already has one replaces it.
+		/// @param[in] elementNumber The element number to route
+		/// @param[in] DDI The DDI to route
+		/// @param[in] callback The callback to call with the commanded value
+		/// @param[in] parentPointer A generic context variable that will be passed into the callback when it gets called
+		/// @param[in] immediate Set to true to call the callback from the receive path instead of from `update`
+		void add_value_command_handler(std::uint16_t elementNumber, std::uint16_t DDI, ValueCommandCallback callback, void *parentPointer, bool immediate);
+
+		/// @brief Stops routing value commands for an element number and DDI to a dedicated callback
+		/// @param[in] elementNumber The element number of the handler to remove
+		/// @param[in] DDI The DDI of the handler to remove
+		void remove_value_command_handler(std::uint16_t elementNumber, std::uint16_t DDI);
+
 		/// @brief Removes the specified callback from the list of value request callbacks
 		/// @param[in] callback The callback to remove
 		/// @param[in] parentPointer parent pointer associated to the callback being removed
@@ -187,6 +211,31 @@ namespace isobus
 		               bool reportToTCSupportsPeerControlAssignment,
 		               bool reportToTCSupportsImplementSectionControl);
 
+		/// @brief A convenient way to set all client options at once instead of calling the individual setters
+		/// @details This function sets up the parameters that the client will report to the TC server.
+		/// These parameters should be tailored to your specific application.
+		/// @note This version of the configure function takes a DDOP that was serialized at compile time.
+		/// The binary pool is uploaded in place, and its labels are taken from the pool without parsing it.
+		/// The other versions of the configure function take various other kinds of DDOP.
+		/// @param[in] DDOP The device descriptor object pool to upload to the TC. The binary pool it refers to must outlive the client.
+		/// @param[in] maxNumberBoomsSupported Configures the max number of booms the client supports
+		/// @param[in] maxNumberSectionsSupported Configures the max number of sections supported by the client for section control
+		/// @param[in] maxNumberChannelsSupportedForPositionBasedControl Configures the max number of channels supported by the client for position based control
+		/// @param[in] reportToTCSupportsDocumentation Denotes if your app supports documentation
+		/// @param[in] reportToTCSupportsTCGEOWithoutPositionBasedControl Denotes if your app supports TC-GEO without position based control
+		/// @param[in] reportToTCSupportsTCGEOWithPositionBasedControl Denotes if your app supports TC-GEO with position based control
+		/// @param[in] reportToTCSupportsPeerControlAssignment Denotes if your app supports peer control assignment
+		/// @param[in] reportToTCSupportsImplementSectionControl Denotes if your app supports implement section control
+		void configure(const StaticDeviceDescriptorObjectPool &DDOP,
+		               std::uint8_t maxNumberBoomsSupported,
+		               std::uint8_t maxNumberSectionsSupported,
+		               std::uint8_t maxNumberChannelsSupportedForPositionBasedControl,
+		               bool reportToTCSupportsDocumentation,
+		               bool reportToTCSupportsTCGEOWithoutPositionBasedControl,
+		               bool reportToTCSupportsTCGEOWithPositionBasedControl,
+		               bool reportToTCSupportsPeerControlAssignment,
+		               bool reportToTCSupportsImplementSectionControl);
+
 		/// @brief A convenient way to set all client options at once instead of calling the individual setters
 		/// @details This function sets up the parameters that the client will report to the TC server.
 		/// These parameters should be tailored to your specific application.
@@ -211,6 +260,35 @@ namespace isobus
 		               bool reportToTCSupportsPeerControlAssignment,
 		               bool reportToTCSupportsImplementSectionControl);
 
+		/// @brief A convenient way to set all client options at once instead of calling the individual setters
+		/// @details This function sets up the parameters that the client will report to the TC server.
+		/// These parameters should be tailored to your specific application.
+		/// @note This version of the configure function streams the DDOP from a callback, so the pool
+		/// can be read from flash or a file as it is uploaded instead of being held in RAM.
+		/// The callback's parent pointer will be this client. The structure and localization labels are
+		/// located once, the first time the client connects, and are reused after that.
+		/// The other versions of the configure function take various other kinds of DDOP.
+		/// @param[in] ddopChunkCallback A callback that returns a range of bytes from the binary DDOP
+		/// @param[in] DDOPSize The number of bytes in the binary DDOP that will be uploaded
+		/// @param[in] maxNumberBoomsSupported Configures the max number of booms the client supports
+		/// @param[in] maxNumberSectionsSupported Configures the max number of sections supported by the client for section control
+		/// @param[in] maxNumberChannelsSupportedForPositionBasedControl Configures the max number of channels supported by the client for position based control
+		/// @param[in] reportToTCSupportsDocumentation Denotes if your app supports documentation
+		/// @param[in] reportToTCSupportsTCGEOWithoutPositionBasedControl Denotes if your app supports TC-GEO without position based control
+		/// @param[in] reportToTCSupportsTCGEOWithPositionBasedControl Denotes if your app supports TC-GEO with position based control
+		/// @param[in] reportToTCSupportsPeerControlAssignment Denotes if your app supports peer control assignment
+		/// @param[in] reportToTCSupportsImplementSectionControl Denotes if your app supports implement section control
+		void configure_streamed_ddop(DataChunkCallback ddopChunkCallback,
+		                           std::uint32_t DDOPSize,
+		                           std::uint8_t maxNumberBoomsSupported,
+		                           std::uint8_t maxNumberSectionsSupported,
+		                           std::uint8_t maxNumberChannelsSupportedForPositionBasedControl,
+		                           bool reportToTCSupportsDocumentation,
+		                           bool reportToTCSupportsTCGEOWithoutPositionBasedControl,
+		                           bool reportToTCSupportsTCGEOWithPositionBasedControl,
+		                           bool reportToTCSupportsPeerControlAssignment,
+		                           bool reportToTCSupportsImplementSectionControl);
+
 		/// @brief Calling this function will reset the task controller client's connection
 		/// with the TC server, and cause it to reconnect after a short delay.
 		void restart();
@@ -312,6 +390,32 @@ namespace isobus
 		/// @param[in] DDI The DDI of the process data variable that changed
 		void on_value_changed_trigger(std::uint16_t elementNumber, std::uint16_t DDI);
 
+		/// @brief Pushes the current value of a process data variable to the TC client
+		/// @details Values pushed this way are cached, and used instead of calling the request value callbacks
+		/// for that element/DDI pair. Threshold and on-change measurements for the pair are only evaluated when a new
+		/// value is pushed, and any value that meets a measurement's condition is queued for transmission to the TC.
+		/// This function doesn't take any locks or allocate, so it is safe to call from a single producer such as an interrupt
+		/// or a dedicated sensor thread, with or without CAN_STACK_DISABLE_THREADS. The pushed values are processed,
+		/// and any resulting measurements queued, the next time `update` is called.
+		/// @param[in] elementNumber The element number of the process data variable
+		/// @param[in] DDI The DDI of the process data variable
+		/// @param[in] value The new value of the process data variable
+		/// @returns true if the value was queued, or false if too many values were pushed since the last update
+		bool set_process_data_value(std::uint16_t elementNumber, std::uint16_t DDI, std::int32_t value);
+
+		/// @brief Limits how many time interval measurement messages the client sends per second
+		/// @details When many measurements are due at once, the client sends section control work state
+		/// DDIs first, followed by the rest in the order they became due. Any measurement that doesn't fit within
+		/// the limit is sent on a later update. New measurements are staggered across their interval so that
+		/// measurements requested with the same interval don't all come due in the same update. While the bus load
+		/// is high, measurements other than section control work states are held back until they are half an interval late.
+		/// @param[in] messagesPerSecond The maximum number of measurement messages per second, or 0 for no limit
+		void set_measurement_transmit_rate_limit(std::uint16_t messagesPerSecond);
+
+		/// @brief Returns the maximum number of time interval measurement messages the client sends per second
+		/// @returns The maximum number of measurement messages per second, or 0 if there is no limit
+		std::uint16_t get_measurement_transmit_rate_limit() const;
+
 		/// @brief Sends a broadcast request to TCs to identify themseleves.
 		/// @details Upon receipt of this message, the TC shall display, for a period of 3 s, the TC Number
 		/// @returns `true` if the message was sent, otherwise `false`
@@ -345,6 +449,16 @@ namespace isobus
 		/// @returns true if the interface accepted the command to reupload the pool, or false if the command cannot be handled right now
 		bool reupload_device_descriptor_object_pool(std::shared_ptr<DeviceDescriptorObjectPool> DDOP);
 
+		/// @brief If the TC client is connected to a TC, calling this function will
+		/// cause the TC client interface to delete the currently active DDOP, reupload it,
+		/// then reactivate it using the pool passed into the parameter of this function.
+		/// This process is faster than restarting the whole interface, and you have to
+		/// call it if you change certain things in your DDOP at runtime after the DDOP has already been activated.
+		/// @param[in] ddopChunkCallback A callback that returns a range of bytes from the updated binary DDOP
+		/// @param[in] DDOPSize The number of bytes in the binary DDOP that will be uploaded
+		/// @returns true if the interface accepted the command to reupload the pool, or false if the command cannot be handled right now
+		bool reupload_streamed_device_descriptor_object_pool(DataChunkCallback ddopChunkCallback, std::uint32_t DDOPSize);
+
 		/// @brief The cyclic update function for this interface.
 		/// @note This function may be called by the TC worker thread if you called
 		/// initialize with a parameter of `true`, otherwise you must call it
@@ -425,6 +539,18 @@ namespace isobus
 		/// @returns true if a DDOP was provided, otherwise false
 		bool get_was_ddop_supplied() const;
 
+		/// @brief Returns the size of the binary DDOP that will be uploaded, not counting the mux byte
+		/// @returns The number of bytes in the binary DDOP, or 0 if there isn't one
+		std::uint32_t get_binary_ddop_size() const;
+
+		/// @brief Copies a range of bytes out of the binary DDOP, whichever way it was supplied
+		/// @param[in] callbackIndex The number of times the DDOP has been read during the current operation
+		/// @param[in] bytesOffset The offset into the binary DDOP to read from
+		/// @param[in] numberOfBytes The number of bytes to read
+		/// @param[out] chunkBuffer The buffer to copy the bytes into
+		/// @returns true if the bytes were read, otherwise false
+		bool get_binary_ddop_chunk(std::uint32_t callbackIndex, std::uint32_t bytesOffset, std::uint32_t numberOfBytes, std::uint8_t *chunkBuffer);
+
 		/// @brief Searches the DDOP for a device object and stores that object's structure and localization labels
 		void process_labels_from_ddop();
 
@@ -434,6 +560,26 @@ namespace isobus
 		/// @brief Processes measurement threshold/interval commands
 		void process_queued_threshold_commands();
 
+		/// @brief Moves values pushed with `set_process_data_value` into the value cache, and evaluates
+		/// the threshold and on-change measurements of each pushed element/DDI pair
+		void process_pushed_process_data_values();
+
+		/// @brief Checks a new value against the threshold and on-change measurements for an element/DDI pair,
+		/// and queues the value for transmission if any of them are met
+		/// @param[in] elementNumber The element number of the process data variable
+		/// @param[in] ddi The DDI of the process data variable
+		/// @param[in] value The new value of the process data variable
+		void evaluate_threshold_measurements(std::uint16_t elementNumber, std::uint16_t ddi, std::int32_t value);
+
+		/// @brief Gets the current value of a process data variable from the application
+		/// @details Values pushed with `set_process_data_value` are used if there are any. Otherwise, the first request value callback that provides a value for an element/DDI pair is remembered,
+		/// so later lookups for the same pair call only that callback instead of trying every callback.
+		/// @param[in] elementNumber The element number of the process data variable
+		/// @param[in] ddi The DDI of the process data variable
+		/// @param[out] value The current value of the process data variable
+		/// @returns true if a callback provided the value, otherwise false
+		bool get_process_data_value(std::uint16_t elementNumber, std::uint16_t ddi, std::int32_t &value);
+
 		/// @brief Processes a CAN message destined for any TC client
 		/// @param[in] message The CAN message being received
 		/// @param[in] parentPointer A context variable to find the relevant TC client class
@@ -566,6 +712,10 @@ namespace isobus
 
 		static constexpr std::uint32_t SIX_SECOND_TIMEOUT_MS = 6000; ///< The startup delay time defined in the standard
 		static constexpr std::uint16_t TWO_SECOND_TIMEOUT_MS = 2000; ///< Used for sending the status message to the TC
+		static constexpr std::size_t PUSHED_VALUE_QUEUE_SIZE = 128; ///< The number of pushed process data values that can be waiting for an update
+		static constexpr std::size_t VALUE_COMMAND_QUEUE_SIZE = 64; ///< The number of value commands from the TC that can be waiting for an update
+		static constexpr std::uint16_t DEFAULT_MEASUREMENT_MESSAGES_PER_SECOND = 500; ///< The default limit on time interval measurement messages per second
+		static constexpr float HIGH_BUSLOAD_PERCENT = 70.0f; ///< Above this bus load, measurements that aren't section control are held back
 
 	private:
 		/// @brief Stores data related to requests and commands from the TC
@@ -583,6 +733,45 @@ namespace isobus
 			bool thresholdPassed; ///< Used when the structure is being used to track measurement command thresholds to know if the threshold has been passed
 		};
 
+		/// @brief Stores a time interval measurement command
+		struct TimeIntervalMeasurement
+		{
+			std::uint32_t lastTransmitTimestamp_ms; ///< The last time the value was sent to the TC (in milliseconds)
+			std::uint32_t interval_ms; ///< The requested interval between values (in milliseconds)
+			std::uint16_t elementNumber; ///< The element number for the command
+			std::uint16_t ddi; ///< The DDI for the command
+			bool highPriority; ///< Set for section control DDIs, which are sent before other measurements
+		};
+
+		/// @brief Orders time interval measurements so that the one that is due next is at the front of a heap
+		/// @param[in] lhs The first measurement to compare
+		/// @param[in] rhs The second measurement to compare
+		/// @returns true if lhs is due after rhs, otherwise false
+		static bool is_measurement_due_after(const TimeIntervalMeasurement &lhs, const TimeIntervalMeasurement &rhs);
+
+		/// @brief Returns if a DDI is one of the work state DDIs used for section control, which are sent before other measurements
+		/// @param[in] ddi The DDI to check
+		/// @returns true if the DDI is a section control work state DDI, otherwise false
+		static bool get_is_section_control_ddi(std::uint16_t ddi);
+
+		/// @brief Stores a process data value pushed by the application until the next update
+		struct PushedProcessDataValue
+		{
+			std::int32_t value; ///< The new value
+			std::uint16_t elementNumber; ///< The element number of the value
+			std::uint16_t ddi; ///< The DDI of the value
+		};
+
+		/// @brief Combines an element number and DDI into a single key
+		/// @param[in] elementNumber The element number to use
+		/// @param[in] ddi The DDI to use
+		/// @returns A key that is unique to the element number and DDI pair
+		static std::uint32_t get_process_data_key(std::uint16_t elementNumber, std::uint16_t ddi);
+
+		/// @brief Delivers a value command from the TC to an immediate handler, or queues it for the next update
+		/// @param[in] valueCommand The value command that was received
+		void process_value_command(const ProcessDataCallbackInfo &valueCommand);
+
 		/// @brief Stores a TC value command callback along with its parent pointer
 		struct RequestValueCommandCallbackInfo
 		{
@@ -605,12 +794,21 @@ namespace isobus
 			void *parent; ///< The parent pointer, generic context value
 		};
 
+		/// @brief Stores a value command callback that handles one element number and DDI
+		struct ValueCommandHandler
+		{
+			ValueCommandCallback callback; ///< The callback itself
+			void *parent; ///< The parent pointer, generic context value
+			bool immediate; ///< Set if the callback is called from the receive path instead of from update
+		};
+
 		/// @brief Enumerates the modes that the client may use when dealing with a DDOP
 		enum class DDOPUploadType
 		{
 			ProgramaticallyGenerated, ///< Using the AgIsoStack++ DeviceDescriptorObjectPool class
 			UserProvidedBinaryPointer, ///< Using a raw pointer to a binary DDOP
-			UserProvidedVector ///< Uses a vector of bytes that comprise a binary DDOP
+			UserProvidedVector, ///< Uses a vector of bytes that comprise a binary DDOP
+			UserProvidedChunkCallback ///< Streams a binary DDOP from a callback, such as from flash or a file
 		};
 
 		std::shared_ptr<PartneredControlFunction> partnerControlFunction; ///< The partner control function this client will send to
@@ -619,15 +817,22 @@ namespace isobus
 		std::shared_ptr<DeviceDescriptorObjectPool> clientDDOP; ///< Stores the DDOP for upload to the TC (if needed)
 		std::uint8_t const *userSuppliedBinaryDDOP = nullptr; ///< Stores a client-provided DDOP if one was provided
 		std::shared_ptr<std::vector<std::uint8_t>> userSuppliedVectorDDOP; ///< Stores a client-provided DDOP if one was provided
+		DataChunkCallback userSuppliedDDOPChunkCallback = nullptr; ///< Reads a client-provided DDOP in chunks if one was provided
 		std::vector<std::uint8_t> generatedBinaryDDOP; ///< Stores the DDOP in binary form after it has been generated
 		std::vector<RequestValueCommandCallbackInfo> requestValueCallbacks; ///< A list of callbacks that will be called when the TC requests a process data value
 		std::vector<ValueCommandCallbackInfo> valueCommandsCallbacks; ///< A list of callbacks that will be called when the TC sets a process data value
 		std::list<ProcessDataCallbackInfo> queuedValueRequests; ///< A list of queued value requests that will be processed on the next update
-		std::list<ProcessDataCallbackInfo> queuedValueCommands; ///< A list of queued value commands that will be processed on the next update
-		std::list<ProcessDataCallbackInfo> measurementTimeIntervalCommands; ///< A list of measurement commands that will be processed on a time interval
-		std::list<ProcessDataCallbackInfo> measurementMinimumThresholdCommands; ///< A list of measurement commands that will be processed when the value drops below a threshold
-		std::list<ProcessDataCallbackInfo> measurementMaximumThresholdCommands; ///< A list of measurement commands that will be processed when the value above a threshold
-		std::list<ProcessDataCallbackInfo> measurementOnChangeThresholdCommands; ///< A list of measurement commands that will be processed when the value changes by the specified amount
+		FixedSizeLockFreeQueue<ProcessDataCallbackInfo, VALUE_COMMAND_QUEUE_SIZE> queuedValueCommands; ///< Value commands that will be processed on the next update
+		std::map<std::uint32_t, ValueCommandHandler> valueCommandHandlers; ///< Maps an element number and DDI pair to the callback that handles its value commands
+		std::vector<TimeIntervalMeasurement> measurementTimeIntervalCommands; ///< A heap of measurement commands that will be processed on a time interval, ordered by when each is next due
+		std::vector<TimeIntervalMeasurement> dueMeasurements; ///< Scratch space for the measurements that are due in the current update
+		std::map<std::uint32_t, RequestValueCommandCallbackInfo> valueProviders; ///< Maps an element number and DDI pair to the request value callback that provides its value
+		std::map<std::uint32_t, ProcessDataCallbackInfo> measurementMinimumThresholdCommands; ///< Measurement commands that will be processed when the value drops below a threshold, by element/DDI key
+		std::map<std::uint32_t, ProcessDataCallbackInfo> measurementMaximumThresholdCommands; ///< Measurement commands that will be processed when the value above a threshold, by element/DDI key
+		std::map<std::uint32_t, ProcessDataCallbackInfo> measurementOnChangeThresholdCommands; ///< Measurement commands that will be processed when the value changes by the specified amount, by element/DDI key
+		std::list<ProcessDataCallbackInfo> queuedMeasurementValues; ///< Values that met a threshold or on-change measurement and are waiting to be sent to the TC
+		std::map<std::uint32_t, std::int32_t> pushedProcessDataValues; ///< The latest value pushed by the application for each element/DDI key
+		FixedSizeLockFreeQueue<PushedProcessDataValue, PUSHED_VALUE_QUEUE_SIZE> pushedProcessDataValueQueue; ///< Values pushed by the application that haven't been processed yet
 		Mutex clientMutex; ///< A general mutex to protect data in the worker thread against data accessed by the app or the network manager
 #if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
 		std::thread *workerThread = nullptr; ///< The worker thread that updates this interface
@@ -642,6 +847,9 @@ namespace isobus
 		std::uint32_t serverStatusMessageTimestamp_ms = 0; ///< Timestamp corresponding to the last time we received a status message from the TC
 		std::uint32_t userSuppliedBinaryDDOPSize_bytes = 0; ///< The number of bytes in the user provided binary DDOP (if one was provided)
 		std::uint32_t languageCommandWaitingTimestamp_ms = 0; ///< Timestamp used to determine when to give up on waiting for a language command response
+		std::uint32_t measurementTransmitTimestamp_ms = 0; ///< Timestamp of the last time the measurement transmit budget was refilled
+		float measurementTransmitBudget = 0.0f; ///< The number of measurement messages that can currently be sent without exceeding the rate limit
+		std::uint16_t measurementMessagesPerSecond = DEFAULT_MEASUREMENT_MESSAGES_PER_SECOND; ///< The limit on measurement messages per second, or 0 for no limit
 		std::uint8_t numberOfWorkingSetMembers = 1; ///< The number of working set members that will be reported in the working set master message
 		std::uint8_t tcStatusBitfield = 0; ///< The last received TC/DL status from the status message
 		std::uint8_t sourceAddressOfCommandBeingExecuted = 0; ///< Source address of client for which the current command is being executed
@@ -15,6 +15,10 @@
 #include "isobus/isobus/isobus_task_controller_server_options.hpp"
 
 #include <deque>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <condition_variable>
 
@@ -117,6 +121,43 @@ namespace isobus
 			Unknown = 0xFF
 		};
 
+		struct ProcessDataRoute;
+
+		/// @brief A function that handles value commands for one DDI, with the routing information for the element it was sent to.
+		/// @param[in] clientControlFunction The control function which sent the value command.
+		/// @param[in] route The routing table entry for the element and DDI of the value command.
+		/// @param[in] processDataValue The value of the process data.
+		/// @param[out] errorCodes Set this to the error codes from ProcessDataAcknowledgeErrorCodes if the command failed.
+		/// @returns true if the command was handled successfully, otherwise false
+		using ProcessDataHandler = std::function<bool(std::shared_ptr<ControlFunction> clientControlFunction, const ProcessDataRoute &route, std::int32_t processDataValue, std::uint8_t &errorCodes)>;
+
+		/// @brief An entry in a client's process data routing table, which is built from the client's DDOP when it is activated.
+		/// @details The scale, offset and unit come from the process data's value presentation object if it has one,
+		/// otherwise from the data dictionary.
+		struct ProcessDataRoute
+		{
+			std::string designator; ///< The designator of the process data object.
+			std::string unit; ///< The unit to present values in.
+			ProcessDataHandler handler; ///< The handler registered for the DDI when the route was built, if any.
+			std::int32_t offset = 0; ///< The offset to apply to values before scaling them for presentation.
+			float scale = 1.0f; ///< The scale to apply to values for presentation.
+			std::uint16_t elementNumber = 0; ///< The element number of the device element the process data belongs to.
+			std::uint16_t dataDescriptionIndex = 0; ///< The DDI of the process data.
+			std::uint16_t processDataObjectID = NULL_OBJECT_ID; ///< The object ID of the process data object.
+			std::uint16_t elementObjectID = NULL_OBJECT_ID; ///< The object ID of the device element object.
+			std::uint8_t numberOfDecimals = 0; ///< The number of decimals to present values with.
+		};
+
+		/// @brief Message statistics for a client, see get_client_statistics.
+		struct ClientStatistics
+		{
+			std::uint32_t processDataMessagesReceived = 0; ///< The number of process data messages received from the client.
+			std::uint32_t valueCommandsReceived = 0; ///< The number of value commands received from the client.
+			std::uint32_t routedValueCommands = 0; ///< The number of value commands that were dispatched to a handler through the routing table.
+			std::uint32_t processDataMessagesPerSecond = 0; ///< The process data message rate measured over the most recent statistics window.
+			std::uint32_t peakProcessDataMessagesPerSecond = 0; ///< The highest process data message rate measured so far.
+		};
+
 		/// @brief Constructor for a TC server.
 		/// @param[in] internalControlFunction The control function to use to communicate with the clients.
 		/// @param[in] numberBoomsSupported The number of booms to report as supported by the TC.
@@ -248,6 +289,39 @@ namespace isobus
 		/// @returns Whether or not the save was successful.
 		virtual bool store_device_descriptor_object_pool(std::shared_ptr<ControlFunction> clientControlFunction, const std::vector<std::uint8_t> &objectPoolData, bool appendToPool) = 0;
 
+		// **** Functions used to route process data ****
+
+		/// @brief Registers a handler for value commands of a DDI, which is used instead of on_value_command for that DDI.
+		/// @details Handlers are bound into each client's routing table when its DDOP is activated, so value commands
+		/// are dispatched with a single table lookup. Value commands for elements and DDIs that are not in the client's
+		/// DDOP, or that have no handler, still go to on_value_command.
+		/// @param[in] dataDescriptionIndex The DDI to handle
+		/// @param[in] handler The function to call for value commands of the DDI
+		void add_process_data_handler(std::uint16_t dataDescriptionIndex, ProcessDataHandler handler);
+
+		/// @brief Removes a handler added with add_process_data_handler, so that the DDI goes to on_value_command again.
+		/// @param[in] dataDescriptionIndex The DDI to stop handling
+		void remove_process_data_handler(std::uint16_t dataDescriptionIndex);
+
+		/// @brief Looks up an entry in a client's process data routing table.
+		/// @param[in] clientControlFunction The client to look up the route for
+		/// @param[in] elementNumber The element number of the process data
+		/// @param[in] dataDescriptionIndex The DDI of the process data
+		/// @param[out] route The routing table entry, if it was found
+		/// @returns true if the route was found, otherwise false
+		bool get_process_data_route(std::shared_ptr<ControlFunction> clientControlFunction, std::uint16_t elementNumber, std::uint16_t dataDescriptionIndex, ProcessDataRoute &route) const;
+
+		/// @brief Returns the number of entries in a client's process data routing table.
+		/// @param[in] clientControlFunction The client to check
+		/// @returns The number of routes, or 0 if the client is not active
+		std::size_t get_number_process_data_routes(std::shared_ptr<ControlFunction> clientControlFunction) const;
+
+		/// @brief Returns the message statistics for a client.
+		/// @param[in] clientControlFunction The client to get the statistics for
+		/// @param[out] statistics The client's statistics, if it is active
+		/// @returns true if the client is active and the statistics were returned, otherwise false
+		bool get_client_statistics(std::shared_ptr<ControlFunction> clientControlFunction, ClientStatistics &statistics) const;
+
 		// **** Functions used to communicate with the client ****
 
 		/// @brief Sends a request to a client for an element's value of a particular DDI.
@@ -428,10 +502,23 @@ namespace isobus
 			std::uint32_t clientDDOPsize_bytes = 0; ///< The size of the client's DDOP in bytes.
 			std::uint32_t statusBitfield = 0; ///< The status bitfield that the client is reporting to us.
 			std::uint16_t numberOfObjectPoolSegments = 0; ///< The number of object pool segments that have been sent to the client.
+			std::vector<std::uint8_t> transferredObjectPool; ///< The DDOP segments the client has transferred, used to build the routing table.
+			std::unordered_map<std::uint32_t, ProcessDataRoute> processDataRoutes; ///< The client's process data routing table, keyed by element number and DDI.
+			ClientStatistics statistics; ///< The client's message statistics.
+			std::uint32_t statisticsWindowStartTimestamp_ms = 0; ///< The timestamp of the start of the current statistics window.
+			std::uint32_t processDataMessagesInWindow = 0; ///< The number of process data messages received in the current statistics window.
 			std::uint8_t reportedVersion = 0; ///< The value representing a version reported by the client.
 			bool isDDOPActive = false; ///< Whether or not the client's DDOP is active.
 		};
 
+		/// @brief Builds a client's process data routing table from a binary DDOP.
+		/// @details This is done automatically with the DDOP the client transferred when it is activated.
+		/// If your server activates a DDOP that was stored in NVM instead, you can call this from activate_object_pool with the stored DDOP.
+		/// @param[in] clientControlFunction The client to build the routing table for
+		/// @param[in] binaryDDOP The client's DDOP
+		/// @returns true if the DDOP was parsed and the table was built, otherwise false
+		bool build_process_data_routes(std::shared_ptr<ControlFunction> clientControlFunction, const std::vector<std::uint8_t> &binaryDDOP);
+
 		/// @brief Stores messages received from task controller clients for processing later.
 		/// @details This is used to avoid processing messages on the CAN stack's thread.
 		/// Messages are actually processed in process_rx_messages which is called by update().
@@ -559,12 +646,27 @@ namespace isobus
 		                                 std::uint32_t dataLength,
 		                                 CANIdentifier::CANPriority priority = CANIdentifier::CANPriority::Priority5) const;
 
+		/// @brief Returns the key of a process data routing table entry
+		/// @param[in] elementNumber The element number of the process data
+		/// @param[in] dataDescriptionIndex The DDI of the process data
+		/// @returns The key for the routing table
+		static std::uint32_t get_process_data_route_key(std::uint16_t elementNumber, std::uint16_t dataDescriptionIndex);
+
+		/// @brief Binds the registered handlers to the routes in a client's routing table
+		/// @param[in] client The client whose routes to update
+		void bind_process_data_handlers(ActiveClient &client) const;
+
+		/// @brief Updates the message rate statistics of the active clients
+		void update_client_statistics();
+
 		static constexpr std::uint32_t STATUS_MESSAGE_RATE_MS = 2000; ///< The rate at which status messages are sent to the clients in milliseconds.
+		static constexpr std::uint32_t STATISTICS_WINDOW_MS = 1000; ///< The length of the window that client message rates are measured over in milliseconds.
 
 		LanguageCommandInterface languageCommandInterface; ///< The language command interface used to communicate with the client which language/units are in use.
 		std::shared_ptr<InternalControlFunction> serverControlFunction; ///< The control function used to communicate with the clients.
 		std::deque<CANMessage> rxMessageQueue; ///< A queue of messages received from the clients which will be processed when update is called.
 		std::deque<std::shared_ptr<ActiveClient>> activeClients; ///< A list of clients that are currently being communicated with.
+		std::unordered_map<std::uint16_t, ProcessDataHandler> processDataHandlers; ///< The value command handlers registered for each DDI.
 #if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
 		std::condition_variable updateWakeupCondition; ///< A condition variable you can optionally use to update the interface when messages are received
 		std::mutex messagesMutex; ///< A mutex used to protect the rxMessageQueue.
@@ -202,6 +202,17 @@ namespace isobus
 		/// @returns The requested object pool associated with the version label.
 		virtual bool save_version(const std::vector<std::uint8_t> &objectPool, const std::vector<std::uint8_t> &versionLabel, NAME clientNAME) = 0;
 
+		/// @brief This function is called when the client wants the server to save an object pool
+		/// to the VT's non-volatile memory, and passes the server's own shared copy of the object pool data.
+		/// @details Override this if you want to keep the object pool data around (for example, to write it out
+		/// to storage later) without copying it. The data is immutable, and stays valid for as long as you hold the reference.
+		/// By default this calls the overload that takes the object pool by reference.
+		/// @param[in] objectPool The object pool data to save
+		/// @param[in] versionLabel The object pool version to save for the given client NAME
+		/// @param[in] clientNAME The client requesting the object pool
+		/// @returns true if the object pool was saved, otherwise false
+		virtual bool save_version(std::shared_ptr<const std::vector<std::uint8_t>> objectPool, const std::vector<std::uint8_t> &versionLabel, NAME clientNAME);
+
 		/// @brief This function is called when the client wants the server to delete a stored object pool.
 		/// All object pool files matching the specified version label should then be deleted from the VT's
 		/// non-volatile storage.
@@ -260,9 +271,19 @@ namespace isobus
 		//-------------- Callbacks/Event driven interface ---------------------
 
 		/// @brief Returns the event dispatcher for repaint events
+		/// @details Changes to a working set's objects are accumulated and this event is called from the server's
+		/// update function, at most once per repaint frame interval (see set_repaint_frame_interval).
 		/// @returns The event dispatcher for repaint events
 		EventDispatcher<std::shared_ptr<VirtualTerminalServerManagedWorkingSet>> &get_on_repaint_event_dispatcher();
 
+		/// @brief Returns the event dispatcher for partial repaint events
+		/// @details This is called together with the repaint event, and contains the coalesced list of areas
+		/// in the working set's active data or alarm mask that changed since the last repaint.
+		/// This can be used to redraw only the affected parts of the mask instead of the whole working set.
+		/// Changes to objects outside of the active mask, such as soft keys, do not produce a region.
+		/// @returns The event dispatcher for partial repaint events
+		EventDispatcher<std::shared_ptr<VirtualTerminalServerManagedWorkingSet>, std::vector<VirtualTerminalServerManagedWorkingSet::DirtyRegion>> &get_on_repaint_regions_event_dispatcher();
+
 		/// @brief Returns the event dispatcher for change active data/alarm mask events
 		/// @returns The event dispatcher for change active data/alarm mask events
 		EventDispatcher<std::shared_ptr<VirtualTerminalServerManagedWorkingSet>, std::uint16_t, std::uint16_t> &get_on_change_active_mask_event_dispatcher();
@@ -277,6 +298,16 @@ namespace isobus
 
 		//----------------- Other Server Settings -----------------------------
 
+		/// @brief Sets the minimum time between two repaint events for the same working set
+		/// @details Object changes received within one interval are coalesced into a single repaint.
+		/// Defaults to 0, which delivers a repaint on every call to update if anything changed.
+		/// @param[in] interval_ms The minimum time between repaints in milliseconds
+		void set_repaint_frame_interval(std::uint32_t interval_ms);
+
+		/// @brief Returns the minimum time between two repaint events for the same working set
+		/// @returns The repaint frame interval in milliseconds
+		std::uint32_t get_repaint_frame_interval() const;
+
 		/// @brief Returns the language command interface for the server, which
 		/// can be used to inform clients of the current unit systems, language, and country code
 		/// @returns The language command interface for the server
@@ -509,6 +540,35 @@ namespace isobus
 			AnyOtherError = 32
 		};
 
+		/// @brief Enumerates the ways a compiled macro command can be executed
+		enum class CompiledMacroOperation : std::uint8_t
+		{
+			ChangeNumericValue, ///< Executed directly on the resolved target object
+			HideShowObject, ///< Executed directly on the resolved target object
+			EnableDisableObject, ///< Executed directly on the resolved target object
+			ChangeAttribute, ///< Executed directly on the resolved target object
+			ChangeBackgroundColour, ///< Executed directly on the resolved target object
+			ProcessAsMessage ///< Any other command, which is processed as if it were received from the working set
+		};
+
+		/// @brief A macro command that was decoded when the object pool was activated
+		struct CompiledMacroCommand
+		{
+			std::shared_ptr<VTObject> targetObject; ///< The object the command affects, or nullptr if it didn't exist when the macro was compiled
+			std::array<std::uint8_t, CAN_DATA_LENGTH> commandPacket; ///< The raw command, used for ProcessAsMessage
+			std::uint32_t value; ///< The command's numeric value or attribute data, if applicable
+			std::uint16_t objectID; ///< The ID of the object the command affects
+			std::uint8_t argument; ///< The command's single byte argument (show, enable, attribute ID, or colour), if applicable
+			CompiledMacroOperation operation; ///< How the command is executed
+		};
+
+		/// @brief A macro that was compiled when the object pool was activated
+		struct CompiledMacro
+		{
+			std::shared_ptr<Macro> macro; ///< The macro object this was compiled from, used to detect stale compiled macros
+			std::vector<CompiledMacroCommand> commands; ///< The macro's commands in execution order
+		};
+
 		/// @brief Checks to see if the message should be listened to based on
 		/// what the message is, and if the client has sent the proper working set master message
 		/// @param[in] message The CAN message to check
@@ -523,11 +583,60 @@ namespace isobus
 		void execute_macro_as_rx_message(const CANMessage &message);
 
 		/// @brief Executes a macro synchronously by object ID.
+		/// @details If the macro was compiled when the pool was activated, the compiled form is used.
+		/// Otherwise each command is processed as if it were a CAN message.
 		/// @param[in] objectIDOfMacro The object ID of the macro to execute
 		/// @param[in] workingSet The working set to execute the macro on
 		/// @returns true if the macro was executed, otherwise false
 		bool execute_macro(std::uint16_t objectIDOfMacro, std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet);
 
+		/// @brief Decodes all macros in a working set's object pool, resolving the objects each command targets.
+		/// @details Call this whenever the working set's object pool changes, since compiled macros
+		/// hold on to the objects that were in the pool when they were compiled.
+		/// @param[in] workingSet The working set whose macros should be compiled
+		void compile_macros(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet);
+
+		/// @brief Executes a compiled macro without building CAN messages for the commands that support it
+		/// @param[in] compiledMacro The macro to execute
+		/// @param[in] workingSet The working set to execute the macro on
+		void execute_compiled_macro(const CompiledMacro &compiledMacro, std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet);
+
+		/// @brief Processes a change numeric value command, from a client or a macro
+		/// @param[in] workingSet The working set that sent the command
+		/// @param[in] targetObject The object to change, or nullptr if it doesn't exist
+		/// @param[in] objectID The ID of the object to change
+		/// @param[in] value The new value
+		void process_change_numeric_value_command(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::shared_ptr<VTObject> targetObject, std::uint16_t objectID, std::uint32_t value);
+
+		/// @brief Processes a hide/show object command, from a client or a macro
+		/// @param[in] workingSet The working set that sent the command
+		/// @param[in] targetObject The object to change, or nullptr if it doesn't exist
+		/// @param[in] objectID The ID of the object to change
+		/// @param[in] show 0 to hide the object, otherwise the object is shown
+		void process_hide_show_object_command(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::shared_ptr<VTObject> targetObject, std::uint16_t objectID, std::uint8_t show);
+
+		/// @brief Processes an enable/disable object command, from a client or a macro
+		/// @param[in] workingSet The working set that sent the command
+		/// @param[in] targetObject The object to change, or nullptr if it doesn't exist
+		/// @param[in] objectID The ID of the object to change
+		/// @param[in] enable 0 to disable the object, 1 to enable it. Other values are rejected.
+		void process_enable_disable_object_command(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::shared_ptr<VTObject> targetObject, std::uint16_t objectID, std::uint8_t enable);
+
+		/// @brief Processes a change attribute command, from a client or a macro
+		/// @param[in] workingSet The working set that sent the command
+		/// @param[in] targetObject The object to change, or nullptr if it doesn't exist
+		/// @param[in] objectID The ID of the object to change
+		/// @param[in] attributeID The ID of the attribute to change
+		/// @param[in] attributeData The new attribute value
+		void process_change_attribute_command(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::shared_ptr<VTObject> targetObject, std::uint16_t objectID, std::uint8_t attributeID, std::uint32_t attributeData);
+
+		/// @brief Processes a change background colour command, from a client or a macro
+		/// @param[in] workingSet The working set that sent the command
+		/// @param[in] targetObject The object to change, or nullptr if it doesn't exist
+		/// @param[in] objectID The ID of the object to change
+		/// @param[in] backgroundColour The new background colour
+		void process_change_background_colour_command(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::shared_ptr<VTObject> targetObject, std::uint16_t objectID, std::uint8_t backgroundColour);
+
 		/// @brief Returns the priority to use, depending on the VT version
 		/// @returns The priority to use, depending on the VT version
 		CANIdentifier::CANPriority get_priority() const;
@@ -756,6 +865,7 @@ namespace isobus
 		static constexpr std::uint8_t VERSION_LABEL_LENGTH = 7; ///< The length of a standard object pool version label
 
 		EventDispatcher<std::shared_ptr<VirtualTerminalServerManagedWorkingSet>> onRepaintEventDispatcher; ///< Event dispatcher for repaint events
+		EventDispatcher<std::shared_ptr<VirtualTerminalServerManagedWorkingSet>, std::vector<VirtualTerminalServerManagedWorkingSet::DirtyRegion>> onRepaintRegionsEventDispatcher; ///< Event dispatcher for partial repaint events
 		EventDispatcher<std::shared_ptr<VirtualTerminalServerManagedWorkingSet>, std::uint16_t, std::uint16_t> onChangeActiveMaskEventDispatcher; ///< Event dispatcher for active data/alarm mask change events
 		EventDispatcher<std::shared_ptr<VirtualTerminalServerManagedWorkingSet>, std::uint16_t, std::uint16_t> onChangeActiveSoftKeyMaskEventDispatcher; ///< Event dispatcher for active softkey mask change events
 		EventDispatcher<std::shared_ptr<VirtualTerminalServerManagedWorkingSet>, std::uint16_t, bool> onFocusObjectEventDispatcher; ///< Event dispatcher for focus object events
@@ -763,8 +873,10 @@ namespace isobus
 		std::shared_ptr<InternalControlFunction> serverInternalControlFunction; ///< The internal control function for the server
 		std::vector<std::shared_ptr<VirtualTerminalServerManagedWorkingSet>> managedWorkingSetList; ///< The list of managed working sets
 		std::map<std::shared_ptr<VirtualTerminalServerManagedWorkingSet>, bool> managedWorkingSetIopLoadStateMap; ///< A map to hold the IOP load state per session
+		std::map<std::shared_ptr<VirtualTerminalServerManagedWorkingSet>, std::map<std::uint16_t, CompiledMacro>> compiledMacros; ///< Compiled macros per working set, by macro object ID
 		std::shared_ptr<VirtualTerminalServerManagedWorkingSet> activeWorkingSet; ///< The active working set
 		std::uint32_t statusMessageTimestamp_ms = 0; ///< The timestamp of the last status message sent
+		std::uint32_t repaintFrameInterval_ms = 0; ///< The minimum time between repaints of a working set
 		std::uint16_t activeWorkingSetDataMaskObjectID = NULL_OBJECT_ID; ///< The object ID of the active working set's data mask
 		std::uint16_t activeWorkingSetSoftkeyMaskObjectID = NULL_OBJECT_ID; ///< The object ID of the active working set's soft key mask
 		std::uint8_t activeWorkingSetMasterAddress = NULL_CAN_ADDRESS; ///< The address of the active working set's master
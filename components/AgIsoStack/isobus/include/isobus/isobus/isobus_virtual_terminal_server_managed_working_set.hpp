@@ -13,6 +13,7 @@
 #include <map>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 #include "isobus/isobus/can_badge.hpp"
 #include "isobus/isobus/can_control_function.hpp"
@@ -40,6 +41,18 @@ namespace isobus
 			Joined ///< We have sent our response to the working set master and are done parsing
 		};
 
+		/// @brief Describes an area of a mask that needs to be redrawn because an object changed
+		/// @details Coordinates are relative to the top left corner of the mask that was used to
+		/// compute the region. An object that appears more than once in the mask produces one region per instance.
+		struct DirtyRegion
+		{
+			std::uint16_t objectID; ///< The object that is drawn in this region
+			std::int32_t xPosition; ///< X position of the region's top left corner, in px relative to the mask
+			std::int32_t yPosition; ///< Y position of the region's top left corner, in px relative to the mask
+			std::uint16_t width; ///< The width of the region in px
+			std::uint16_t height; ///< The height of the region in px
+		};
+
 		/// @brief Default constructor
 		VirtualTerminalServerManagedWorkingSet();
 
@@ -133,7 +146,61 @@ namespace isobus
 		/// @returns returns true if the IOP size is known but the transfer is not finished
 		bool is_object_pool_transfer_in_progress() const;
 
+		/// @brief Marks an object as changed since the last repaint of this working set
+		/// @details The server calls this whenever a command alters an object in a way that affects what is drawn,
+		/// such as attribute, value, size, hide/show, or child position changes. The object's current size is remembered,
+		/// so calling this before shrinking an object ensures the area it used to cover is also redrawn.
+		/// @param[in] objectID The object ID of the object that changed
+		void mark_object_dirty(std::uint16_t objectID);
+
+		/// @brief Returns if any object has changed since the last time the dirty objects were cleared
+		/// @returns true if at least one object is dirty, otherwise false
+		bool get_any_objects_dirty();
+
+		/// @brief Returns the list of objects that changed since the dirty objects were last cleared
+		/// @returns The object IDs of all dirty objects, each listed once
+		std::vector<std::uint16_t> get_dirty_objects();
+
+		/// @brief Clears the list of dirty objects, usually after a repaint has been done
+		void clear_dirty_objects();
+
+		/// @brief Computes the screen areas affected by the current dirty objects
+		/// @details Walks the object tree starting at the supplied mask and accumulates child offsets to find every
+		/// visible instance of a dirty object, or of an object that references a dirty object (for example an output number
+		/// that uses a dirty number variable or font attributes object). Regions fully contained in another region are dropped.
+		/// If the mask itself is dirty, a single region covering the whole mask is returned.
+		/// @param[in] maskObjectID The object ID of the data or alarm mask to compute regions for
+		/// @param[in] maskWidth The width of the mask area in px, used when the whole mask is dirty
+		/// @param[in] maskHeight The height of the mask area in px, used when the whole mask is dirty
+		/// @returns The list of coalesced dirty regions in the mask
+		std::vector<DirtyRegion> get_dirty_regions(std::uint16_t maskObjectID, std::uint16_t maskWidth, std::uint16_t maskHeight);
+
+		/// @brief Returns the timestamp of the last time the server delivered a repaint for this working set
+		/// @returns The timestamp of the last repaint in milliseconds
+		std::uint32_t get_last_repaint_timestamp_ms() const;
+
+		/// @brief Sets the timestamp of the last time the server delivered a repaint for this working set
+		/// @param[in] value The timestamp of the repaint in milliseconds
+		void set_last_repaint_timestamp_ms(std::uint32_t value);
+
 	private:
+		/// @brief Stores an object that changed since the last repaint along with the largest size it had while dirty
+		struct DirtyObject
+		{
+			std::uint16_t objectID; ///< The object ID of the dirty object
+			std::uint16_t width; ///< The largest width of the object since it was marked dirty
+			std::uint16_t height; ///< The largest height of the object since it was marked dirty
+		};
+
+		/// @brief Recursively collects dirty regions for an object and its children
+		/// @param[in] objectID The object to check
+		/// @param[in] xPosition The absolute X position of the object in the mask
+		/// @param[in] yPosition The absolute Y position of the object in the mask
+		/// @param[in] depth The current recursion depth, used to guard against malformed pools with cyclic references
+		/// @param[in] affectedObjects Sorted IDs of the dirty objects and the objects that draw using them
+		/// @param[out] regions The list to add regions to
+		void collect_dirty_regions(std::uint16_t objectID, std::int32_t xPosition, std::int32_t yPosition, std::uint8_t depth, const std::vector<std::uint16_t> &affectedObjects, std::vector<DirtyRegion> &regions);
+
 		/// @brief Sets the object pool processing state to a new value
 		/// @param[in] value The new state of processing the object pool
 		void set_object_pool_processing_state(ObjectPoolProcessingThreadState value);
@@ -144,9 +211,11 @@ namespace isobus
 		std::unique_ptr<std::thread> objectPoolProcessingThread = nullptr; ///< A thread to process the object pool with, since that can be fairly time consuming.
 		std::shared_ptr<ControlFunction> workingSetControlFunction = nullptr; ///< Stores the control function associated with this working set
 		std::vector<isobus::EventCallbackHandle> callbackHandles; ///< A convenient way to associate callback handles to a working set
+		std::vector<DirtyObject> dirtyObjects; ///< Objects that changed since the last repaint
 		ObjectPoolProcessingThreadState processingState = ObjectPoolProcessingThreadState::None; ///< Stores the state of processing the object pool
 		std::uint32_t workingSetMaintenanceMessageTimestamp_ms = 0; ///< A timestamp (in ms) to track sending of the maintenance message
 		std::uint32_t auxiliaryInputMaintenanceMessageTimestamp_ms = 0; ///< A timestamp (in ms) to track if/when the working set sent an auxiliary input maintenance message
+		std::uint32_t lastRepaintTimestamp_ms = 0; ///< A timestamp (in ms) of the last repaint delivered by the server for this working set
 		std::uint16_t focusedObject = NULL_OBJECT_ID; ///< Stores the object ID of the currently focused object
 		bool wasLoadedFromNonVolatileMemory = false; ///< Used to tell the server how this object pool was obtained
 		bool workingSetDeletionRequested = false; ///< Used to tell the server to delete this working set
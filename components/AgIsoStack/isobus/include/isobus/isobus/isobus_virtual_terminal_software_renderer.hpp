@@ -0,0 +1,303 @@
+//================================================================================================
+/// @file isobus_virtual_terminal_software_renderer.hpp
+///
+/// @brief Defines a software rasterizer that draws VT server masks into an RGB framebuffer.
+/// @author The Little Dawn Developers
+///
+/// @copyright 2026 The Little Dawn Developers
+//================================================================================================
+#ifndef ISOBUS_VIRTUAL_TERMINAL_SOFTWARE_RENDERER_HPP
+#define ISOBUS_VIRTUAL_TERMINAL_SOFTWARE_RENDERER_HPP
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "isobus/isobus/isobus_virtual_terminal_objects.hpp"
+#include "isobus/isobus/isobus_virtual_terminal_server_managed_working_set.hpp"
+
+namespace isobus
+{
+	/// @brief A software rasterizer for VT server object pools
+	/// @details This class draws a data mask or alarm mask, and the objects it contains, into a
+	/// 24 bit RGB framebuffer without any graphics library. It's meant for headless VT servers,
+	/// embedded displays that take a raw framebuffer, and golden-image tests, since a frame can
+	/// be written out as a PNG file.
+	///
+	/// Containers, object pointers, output numbers, output strings, picture graphics, output lines,
+	/// output rectangles and output ellipses are drawn. Other object types are skipped.
+	/// Text uses a built-in 5x7 bitmap font scaled to the font attributes' size, without font styles
+	/// or auto-wrapping, and ellipses are always drawn closed.
+	///
+	/// Each drawable leaf object is rasterized once into a cached bitmap, which is blitted into the
+	/// framebuffer on later renders. A cached bitmap stays valid until invalidate_object is called for
+	/// it, or for any object it was drawn with (like its font, variable, or line attributes). The easiest way
+	/// to keep the cache coherent is to pass the working set's dirty objects to invalidate_objects
+	/// from the VT server's repaint event, then call render_regions with the dirty regions.
+	///
+	/// This class is not thread safe. Render from the same thread that updates the VT server.
+	class VirtualTerminalSoftwareRenderer
+	{
+	public:
+		/// @brief Constructor for a software renderer
+		/// @param[in] width The width of the framebuffer in px, normally the VT's data mask width
+		/// @param[in] height The height of the framebuffer in px, normally the VT's data mask height
+		VirtualTerminalSoftwareRenderer(std::uint16_t width, std::uint16_t height);
+
+		/// @brief Draws an entire mask into the framebuffer
+		/// @param[in] workingSet The working set that owns the mask
+		/// @param[in] maskObjectID The object ID of a data mask or alarm mask to draw
+		/// @returns true if the mask was drawn, otherwise false if the mask doesn't exist or isn't a mask
+		bool render(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::uint16_t maskObjectID);
+
+		/// @brief Redraws only the parts of the framebuffer covered by the supplied regions
+		/// @details Use this with the regions provided by the VT server's repaint regions event
+		/// to avoid redrawing parts of the mask that didn't change.
+		/// @param[in] workingSet The working set that owns the mask
+		/// @param[in] maskObjectID The object ID of a data mask or alarm mask to draw
+		/// @param[in] regions The areas of the mask to redraw, relative to the mask
+		/// @returns true if the mask was drawn, otherwise false if the mask doesn't exist or isn't a mask
+		bool render_regions(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet,
+		                    std::uint16_t maskObjectID,
+		                    const std::vector<VirtualTerminalServerManagedWorkingSet::DirtyRegion> &regions);
+
+		/// @brief Drops the cached bitmap of an object, and of any object that was drawn using it
+		/// @param[in] objectID The object that changed
+		void invalidate_object(std::uint16_t objectID);
+
+		/// @brief Drops the cached bitmaps of several objects, and of any object that was drawn using them
+		/// @param[in] objectIDs The objects that changed
+		void invalidate_objects(const std::vector<std::uint16_t> &objectIDs);
+
+		/// @brief Drops all cached bitmaps, for example if the colour table changed
+		void invalidate_all();
+
+		/// @brief Returns the number of cached bitmaps
+		/// @returns The number of cached bitmaps
+		std::size_t get_number_of_cached_objects() const;
+
+		/// @brief Returns how many times a cached bitmap was reused since construction
+		/// @returns The number of cache hits
+		std::uint32_t get_cache_hits() const;
+
+		/// @brief Returns how many times an object had to be rasterized since construction
+		/// @returns The number of cache misses
+		std::uint32_t get_cache_misses() const;
+
+		/// @brief Returns the width of the framebuffer
+		/// @returns The width of the framebuffer in px
+		std::uint16_t get_width() const;
+
+		/// @brief Returns the height of the framebuffer
+		/// @returns The height of the framebuffer in px
+		std::uint16_t get_height() const;
+
+		/// @brief Returns the framebuffer, as tightly packed rows of 8 bit R, G, B triplets starting at the top left
+		/// @returns The framebuffer
+		const std::vector<std::uint8_t> &get_framebuffer() const;
+
+		/// @brief Returns the colour of one pixel in the framebuffer
+		/// @param[in] x The X position of the pixel
+		/// @param[in] y The Y position of the pixel
+		/// @returns The pixel's colour as 0xRRGGBB, or 0 if the position is out of range
+		std::uint32_t get_pixel(std::uint16_t x, std::uint16_t y) const;
+
+		/// @brief Encodes the framebuffer as a PNG image
+		/// @details The image data is stored uncompressed, so no compression library is needed.
+		/// @returns The PNG file contents
+		std::vector<std::uint8_t> encode_png() const;
+
+		/// @brief Writes the framebuffer to a PNG file
+		/// @param[in] filePath The path of the file to write
+		/// @returns true if the file was written, otherwise false
+		bool save_png(const std::string &filePath) const;
+
+	private:
+		/// @brief A rectangle used to clip drawing, in framebuffer coordinates
+		struct ClipRectangle
+		{
+			std::int32_t left; ///< The leftmost column that can be drawn
+			std::int32_t top; ///< The topmost row that can be drawn
+			std::int32_t right; ///< One past the rightmost column that can be drawn
+			std::int32_t bottom; ///< One past the bottom row that can be drawn
+		};
+
+		/// @brief A rasterized object, ready to be blitted into the framebuffer
+		struct CachedBitmap
+		{
+			std::uint16_t width = 0; ///< The width of the bitmap in px
+			std::uint16_t height = 0; ///< The height of the bitmap in px
+			std::vector<std::uint8_t> pixels; ///< RGB triplets for each pixel
+			std::vector<bool> opaque; ///< Which pixels are drawn. Unset pixels let whatever is under the object show through.
+			std::vector<std::uint16_t> dependencies; ///< Other objects that were used to draw this one
+		};
+
+		static constexpr std::uint8_t MAX_DRAW_DEPTH = 32; ///< Limits recursion for malformed pools that contain a cycle
+		static constexpr std::uint8_t GLYPH_WIDTH = 5; ///< The width of a built-in font glyph in px
+		static constexpr std::uint8_t GLYPH_HEIGHT = 7; ///< The height of a built-in font glyph in px
+		static constexpr std::uint8_t GLYPH_CELL_WIDTH = 6; ///< The width of a built-in font character cell in px
+		static constexpr std::uint8_t GLYPH_CELL_HEIGHT = 8; ///< The height of a built-in font character cell in px
+
+		/// @brief Draws a mask, clipped to the supplied rectangle
+		/// @param[in] workingSet The working set that owns the mask
+		/// @param[in] maskObjectID The mask to draw
+		/// @param[in] clip The area of the framebuffer to draw
+		/// @returns true if the mask was drawn, otherwise false
+		bool draw_mask(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::uint16_t maskObjectID, const ClipRectangle &clip);
+
+		/// @brief Draws an object and its children at the specified position
+		/// @param[in] workingSet The working set that owns the object
+		/// @param[in] objectID The object to draw
+		/// @param[in] x The X position of the object in the framebuffer
+		/// @param[in] y The Y position of the object in the framebuffer
+		/// @param[in] clip The area of the framebuffer to draw
+		/// @param[in] depth How deep we are in the object tree
+		void draw_object(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet,
+		                 std::uint16_t objectID,
+		                 std::int32_t x,
+		                 std::int32_t y,
+		                 const ClipRectangle &clip,
+		                 std::uint8_t depth);
+
+		/// @brief Returns the cached bitmap for an object, rasterizing it first if needed
+		/// @param[in] workingSet The working set that owns the object
+		/// @param[in] object The object to get the bitmap for
+		/// @returns The object's bitmap, or nullptr if the object type can't be rasterized
+		const CachedBitmap *get_bitmap(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::shared_ptr<VTObject> object);
+
+		/// @brief Copies a bitmap's drawn pixels into the framebuffer
+		/// @param[in] bitmap The bitmap to copy
+		/// @param[in] x The X position of the bitmap in the framebuffer
+		/// @param[in] y The Y position of the bitmap in the framebuffer
+		/// @param[in] clip The area of the framebuffer to draw
+		void blit(const CachedBitmap &bitmap, std::int32_t x, std::int32_t y, const ClipRectangle &clip);
+
+		/// @brief Fills a rectangle in the framebuffer with a solid colour
+		/// @param[in] left The X position of the rectangle
+		/// @param[in] top The Y position of the rectangle
+		/// @param[in] width The width of the rectangle
+		/// @param[in] height The height of the rectangle
+		/// @param[in] colour The colour to fill with, as 0xRRGGBB
+		/// @param[in] clip The area of the framebuffer to draw
+		void fill_framebuffer(std::int32_t left, std::int32_t top, std::int32_t width, std::int32_t height, std::uint32_t colour, const ClipRectangle &clip);
+
+		/// @brief Rasterizes an output number or output string
+		/// @param[in] workingSet The working set that owns the object
+		/// @param[in] object The object to rasterize
+		/// @param[in] text The text to draw
+		/// @param[in] transparent If the object's background should be left undrawn
+		/// @param[out] bitmap The bitmap to draw into
+		static void rasterize_text(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet,
+		                           std::shared_ptr<TextualVTObject> object,
+		                           const std::string &text,
+		                           bool transparent,
+		                           CachedBitmap &bitmap);
+
+		/// @brief Rasterizes an output line
+		/// @param[in] workingSet The working set that owns the object
+		/// @param[in] line The line to rasterize
+		/// @param[out] bitmap The bitmap to draw into
+		static void rasterize_line(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::shared_ptr<OutputLine> line, CachedBitmap &bitmap);
+
+		/// @brief Rasterizes an output rectangle
+		/// @param[in] workingSet The working set that owns the object
+		/// @param[in] rectangle The rectangle to rasterize
+		/// @param[out] bitmap The bitmap to draw into
+		static void rasterize_rectangle(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::shared_ptr<OutputRectangle> rectangle, CachedBitmap &bitmap);
+
+		/// @brief Rasterizes an output ellipse
+		/// @param[in] workingSet The working set that owns the object
+		/// @param[in] ellipse The ellipse to rasterize
+		/// @param[out] bitmap The bitmap to draw into
+		static void rasterize_ellipse(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::shared_ptr<OutputEllipse> ellipse, CachedBitmap &bitmap);
+
+		/// @brief Rasterizes a picture graphic, scaled to the object's width
+		/// @param[in] workingSet The working set that owns the object
+		/// @param[in] picture The picture graphic to rasterize
+		/// @param[out] bitmap The bitmap to draw into
+		static void rasterize_picture(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::shared_ptr<PictureGraphic> picture, CachedBitmap &bitmap);
+
+		/// @brief Fills the interior of a shape in a bitmap according to a fill attributes object
+		/// @param[in] workingSet The working set that owns the shape
+		/// @param[in] fillAttributesID The fill attributes object to use
+		/// @param[in] lineColour The colour of the shape's outline as 0xRRGGBB, used for FillWithLineColor
+		/// @param[in] interior Which pixels of the bitmap are inside the shape
+		/// @param[in,out] bitmap The bitmap to draw into
+		static void fill_shape(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet,
+		                       std::uint16_t fillAttributesID,
+		                       std::uint32_t lineColour,
+		                       const std::vector<bool> &interior,
+		                       CachedBitmap &bitmap);
+
+		/// @brief Returns the VT colour index of one pixel of a picture graphic, at its actual size
+		/// @param[in] picture The picture graphic to sample
+		/// @param[in] x The X position of the pixel in the picture
+		/// @param[in] y The Y position of the pixel in the picture
+		/// @returns The colour index of the pixel, or 0 if the picture has no data for it
+		static std::uint8_t get_picture_pixel(std::shared_ptr<PictureGraphic> picture, std::uint32_t x, std::uint32_t y);
+
+		/// @brief Formats an output number's value the way it should be displayed
+		/// @param[in] workingSet The working set that owns the object
+		/// @param[in] number The output number to format
+		/// @returns The text to display
+		static std::string format_number(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::shared_ptr<OutputNumber> number);
+
+		/// @brief Converts a VT colour index to a packed RGB value
+		/// @param[in] workingSet The working set whose colour table should be used
+		/// @param[in] colourIndex The VT colour index
+		/// @returns The colour as 0xRRGGBB
+		static std::uint32_t get_rgb(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::uint8_t colourIndex);
+
+		/// @brief Gets the colour, width and line art of a line attributes object
+		/// @param[in] workingSet The working set that owns the object
+		/// @param[in] lineAttributesID The line attributes object
+		/// @param[out] colour The line colour as 0xRRGGBB
+		/// @param[out] width The line width in px, or 0 if the object doesn't exist
+		/// @param[out] lineArt The line art bit pattern
+		static void get_line_style(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet,
+		                           std::uint16_t lineAttributesID,
+		                           std::uint32_t &colour,
+		                           std::uint16_t &width,
+		                           std::uint16_t &lineArt);
+
+		/// @brief Sizes a bitmap and clears it to fully transparent
+		/// @param[out] bitmap The bitmap to initialize
+		/// @param[in] width The new width of the bitmap in px
+		/// @param[in] height The new height of the bitmap in px
+		static void initialize_bitmap(CachedBitmap &bitmap, std::uint16_t width, std::uint16_t height);
+
+		/// @brief Sets one pixel of a bitmap if it is within bounds
+		/// @param[in,out] bitmap The bitmap to draw into
+		/// @param[in] x The X position of the pixel
+		/// @param[in] y The Y position of the pixel
+		/// @param[in] colour The colour of the pixel as 0xRRGGBB
+		static void set_bitmap_pixel(CachedBitmap &bitmap, std::int32_t x, std::int32_t y, std::uint32_t colour);
+
+		/// @brief Returns the rows of the built-in font glyph for a character
+		/// @param[in] character The character to look up. Unprintable characters return the glyph for '?'.
+		/// @returns GLYPH_WIDTH columns of GLYPH_HEIGHT bits each, least significant bit at the top
+		static const std::uint8_t *get_glyph(char character);
+
+		/// @brief Computes the CRC-32 used by PNG chunks
+		/// @param[in] data The data to checksum
+		/// @param[in] length The number of bytes to checksum
+		/// @returns The CRC of the data
+		static std::uint32_t crc32(const std::uint8_t *data, std::size_t length);
+
+		/// @brief Appends a PNG chunk to a buffer
+		/// @param[in,out] png The buffer to append to
+		/// @param[in] type The four character chunk type
+		/// @param[in] data The chunk's payload
+		static void append_png_chunk(std::vector<std::uint8_t> &png, const char *type, const std::vector<std::uint8_t> &data);
+
+		std::map<std::uint16_t, CachedBitmap> bitmapCache; ///< Rasterized leaf objects, by object ID
+		std::vector<std::uint8_t> framebuffer; ///< RGB triplets for each pixel
+		std::uint32_t cacheHits = 0; ///< The number of times a cached bitmap was reused
+		std::uint32_t cacheMisses = 0; ///< The number of times an object had to be rasterized
+		const std::uint16_t frameWidth; ///< The width of the framebuffer in px
+		const std::uint16_t frameHeight; ///< The height of the framebuffer in px
+	};
+} // namespace isobus
+
+#endif // ISOBUS_VIRTUAL_TERMINAL_SOFTWARE_RENDERER_HPP
@@ -25,7 +25,7 @@ namespace isobus
 		/// @param[in] iopData A pointer to the raw IOP data
 		/// @param[in] iopLength The length of the raw IOP data
 		/// @returns true if the IOP data was parsed successfully, otherwise false
-		bool parse_iop_into_objects(std::uint8_t *iopData, std::uint32_t iopLength);
+		bool parse_iop_into_objects(const std::uint8_t *iopData, std::uint32_t iopLength);
 
 		/// @brief Returns a colour from this working set's current colour table, by index
 		/// @param[in] colourIndex The index into the VT's colour table to retrieve
@@ -46,8 +46,9 @@ namespace isobus
 		std::shared_ptr<VTObject> get_working_set_object();
 
 		/// @brief Appends raw IOP data to the working set's IOP file data
+		/// @details The working set takes ownership of the data, so pass an rvalue to avoid copying large object pools.
 		/// @param[in] dataToAdd The raw IOP data to add to the working set
-		void add_iop_raw_data(const std::vector<std::uint8_t> &dataToAdd);
+		void add_iop_raw_data(std::vector<std::uint8_t> dataToAdd);
 
 		/// @brief Returns the number of discrete IOP file chunks that have been added to the object pool
 		/// @returns The number of discrete IOP file chunks that have been added to the object pool
@@ -56,13 +57,64 @@ namespace isobus
 		/// @brief Returns IOP file data by index of IOP file
 		/// @param[in] index The index of the IOP file to retrieve
 		/// @returns The IOP file data by index of IOP file
-		std::vector<std::uint8_t> &get_iop_raw_data(std::size_t index);
+		const std::vector<std::uint8_t> &get_iop_raw_data(std::size_t index) const;
+
+		/// @brief Returns a shared reference to IOP file data by index of IOP file
+		/// @details The data is immutable once added, so it can be kept (for example by a version store) without copying it.
+		/// @param[in] index The index of the IOP file to retrieve
+		/// @returns A shared reference to the IOP file data by index of IOP file
+		std::shared_ptr<const std::vector<std::uint8_t>> get_shared_iop_raw_data(std::size_t index) const;
 
 		/// @brief Returns the object ID of the the faulting object if parsing the object pool failed
 		/// @returns The object ID of the faulting object if parsing the object pool failed
 		std::uint16_t get_object_pool_faulting_object_id();
 
+		/// @brief Re-indexes the references an object makes to other objects
+		/// @details The reference index is kept up to date as objects are added to the pool, but commands that change
+		/// an object's references at runtime (such as changing a font attributes attribute, an object pointer's value,
+		/// or a list item) must call this so that lookups of parents and referencing objects stay correct.
+		/// @param[in] objectID The object ID of the object whose references changed
+		void update_object_references(std::uint16_t objectID);
+
+		/// @brief Returns the objects that have the supplied object as a child
+		/// @details Object pointers are treated as the parent of the object they point to.
+		/// @param[in] objectID The object ID to find the parents of
+		/// @returns The object IDs of every object that has the supplied object as a child, each listed once
+		std::vector<std::uint16_t> get_parent_object_ids(std::uint16_t objectID) const;
+
+		/// @brief Returns the objects that reference the supplied object in a way that affects how they are drawn
+		/// @details For example, this returns the output numbers that use a number variable or font attributes object.
+		/// Child relationships are not included, use get_parent_object_ids for those.
+		/// @param[in] objectID The object ID to find the referencing objects of
+		/// @returns The object IDs of every object that draws using the supplied object, each listed once
+		std::vector<std::uint16_t> get_referencing_object_ids(std::uint16_t objectID) const;
+
+		/// @brief Checks if an object is a child of another object using the reference index
+		/// @param[in] parentObjectID The object ID of the possible parent
+		/// @param[in] childObjectID The object ID of the possible child
+		/// @returns true if the parent object has the child object as a child, otherwise false
+		bool get_is_parent_of(std::uint16_t parentObjectID, std::uint16_t childObjectID) const;
+
+		/// @brief Validates an object and every object that references it
+		/// @details This is meant for validating runtime changes to a pool that was already validated, since only the
+		/// changed object and the objects that refer to it can have become invalid.
+		/// @param[in] objectID The object ID of the object that changed
+		/// @returns true if the object and every object referencing it are valid, otherwise false
+		bool get_is_object_neighbourhood_valid(std::uint16_t objectID) const;
+
 	protected:
+		/// @brief Stores the object IDs that an object refers to
+		struct ObjectReferences
+		{
+			std::vector<std::uint16_t> children; ///< Child objects, including the object an object pointer points to
+			std::vector<std::uint16_t> attributes; ///< Objects referenced by attributes that affect how the object is drawn
+		};
+
+		/// @brief Collects the object IDs that an object refers to
+		/// @param[in] object The object to collect the references of
+		/// @param[out] references The references of the object, each listed once and never NULL_OBJECT_ID
+		static void get_object_references(const VTObject &object, ObjectReferences &references);
+
 		/// @brief Adds an object to the object tree, and replaces an object
 		/// if there's already one in the tree with the same ID.
 		/// @param[in] objectToAdd The object to add to the object tree
@@ -73,7 +125,7 @@ namespace isobus
 		/// @param[in,out] iopData A pointer to some object pool data
 		/// @param[in,out] iopLength The number of bytes remaining in the object pool
 		/// @returns true if an object was parsed
-		bool parse_next_object(std::uint8_t *&iopData, std::uint32_t &iopLength);
+		bool parse_next_object(const std::uint8_t *&iopData, std::uint32_t &iopLength);
 
 		/// @brief Checks if the object pool contains an object with the supplied object ID
 		/// @param[in] objectID The object ID to check for in the object pool
@@ -98,7 +150,7 @@ namespace isobus
 		/// @returns True if the macro reference parsing is successful otherwise returns false
 		bool parse_object_macro_reference(std::shared_ptr<VTObject> object,
 		                                  const std::uint8_t numberOfMacrosToFollow,
-		                                  std::uint8_t *&iopData,
+		                                  const std::uint8_t *&iopData,
 		                                  std::uint32_t &iopLength) const;
 
 		std::mutex managedWorkingSetMutex; ///< A mutex to protect the interface of the managed working set
@@ -106,9 +158,18 @@ namespace isobus
 		std::uint32_t iopSize = 0; ///< Total size of the IOP in bytes
 		std::uint32_t transferredIopSize = 0; ///< Total number of IOP bytes transferred
 		std::map<std::uint16_t, std::shared_ptr<VTObject>> vtObjectTree; ///< The C++ object representation (deserialized) of the object pool being managed
-		std::vector<std::vector<std::uint8_t>> iopFilesRawData; ///< Raw IOP File data from the client
+		std::vector<std::shared_ptr<const std::vector<std::uint8_t>>> iopFilesRawData; ///< Raw IOP File data from the client, shared and immutable once added
 		std::uint16_t workingSetID = NULL_OBJECT_ID; ///< Stores the object ID of the working set object itself
 		std::uint16_t faultingObjectID = NULL_OBJECT_ID; ///< Stores the faulting object ID to send to a client when parsing the pool fails
+
+	private:
+		/// @brief Removes an object's current entries from the reverse reference indexes
+		/// @param[in] objectID The object ID of the object to remove the references of
+		void remove_object_references(std::uint16_t objectID);
+
+		std::map<std::uint16_t, ObjectReferences> objectReferences; ///< The references each object makes, used to update the reverse indexes incrementally
+		std::map<std::uint16_t, std::vector<std::uint16_t>> parentObjects; ///< Maps an object ID to the objects that have it as a child
+		std::map<std::uint16_t, std::vector<std::uint16_t>> referencingObjects; ///< Maps an object ID to the objects that draw using it
 	};
 } // namespace isobus
 #endif // ISOBUS_VIRTUAL_TERMINAL_WORKING_SET_BASE_HPP
@@ -31,12 +31,53 @@
 #include "isobus/utility/event_dispatcher.hpp"
 #include "isobus/utility/thread_synchronization.hpp"
 
+#include <array>
+#include <unordered_map>
+
 namespace isobus
 {
 	/// @brief A protocol that handles the NMEA 2000 fast packet protocol.
 	class FastPacketProtocol
 	{
 	public:
+		/// @brief A data buffer that can hold the largest fast packet message inline, so sessions can reuse it without allocating
+		class FastPacketProtocolData : public CANMessageData
+		{
+		public:
+			static constexpr std::uint8_t MAX_LENGTH = 223; ///< The most bytes a fast packet message can carry
+
+			/// @brief Get the size of the data.
+			/// @return The size of the data.
+			std::size_t size() const override;
+
+			/// @brief Get the byte at the given index.
+			/// @param[in] index The index of the byte to get.
+			/// @return The byte at the given index.
+			std::uint8_t get_byte(std::size_t index) override;
+
+			/// @brief Set the byte at the given index.
+			/// @param[in] index The index of the byte to set.
+			/// @param[in] value The value to set the byte to.
+			void set_byte(std::size_t index, std::uint8_t value);
+
+			/// @brief Sets the number of bytes in use, up to MAX_LENGTH
+			/// @param[in] newLength The new size of the data
+			void set_size(std::uint8_t newLength);
+
+			/// @brief Get a pointer to the start of the data.
+			/// @return A pointer to the start of the data.
+			std::uint8_t *data();
+
+			/// @brief The data is always owned by this class, so this returns itself.
+			/// @param[in] self A pointer to this object.
+			/// @return A moved pointer to this object.
+			std::unique_ptr<CANMessageData> copy_if_not_owned(std::unique_ptr<CANMessageData> self) const override;
+
+		private:
+			std::array<std::uint8_t, MAX_LENGTH> buffer = {}; ///< The inline storage for the message
+			std::uint8_t length = 0; ///< The number of bytes of the buffer in use
+		};
+
 		/// @brief An object for tracking fast packet session state
 		class FastPacketProtocolSession : public TransportProtocolSessionBase
 		{
@@ -96,20 +137,32 @@ namespace isobus
 			/// @param[in] bytes The number of bytes to add to the total
 			void add_number_of_bytes_transferred(std::uint8_t bytes);
 
+			/// @brief Reinitializes the session for a new message, keeping its data buffer
+			/// @param[in] sessionDirection The direction of the session
+			/// @param[in] sessionParameterGroupNumber The PGN of the message
+			/// @param[in] sessionTotalMessageSize The total size of the message in bytes
+			/// @param[in] sessionSequenceNumber The sequence number for this PGN
+			/// @param[in] sessionPriority The priority to encode in the IDs of the component CAN messages
+			/// @param[in] sessionSource The source control function
+			/// @param[in] sessionDestination The destination control function
+			/// @param[in] completeCallback A callback for when the session completes
+			/// @param[in] parentPointer A generic context object for the tx complete callback
+			void reset(TransportProtocolSessionBase::Direction sessionDirection,
+			           std::uint32_t sessionParameterGroupNumber,
+			           std::uint16_t sessionTotalMessageSize,
+			           std::uint8_t sessionSequenceNumber,
+			           CANIdentifier::CANPriority sessionPriority,
+			           std::shared_ptr<ControlFunction> sessionSource,
+			           std::shared_ptr<ControlFunction> sessionDestination,
+			           TransmitCompleteCallback completeCallback,
+			           void *parentPointer);
+
 		private:
 			std::uint8_t numberOfBytesTransferred = 0; ///< The total number of bytes that have been processed in this session
 			std::uint8_t sequenceNumber; ///< The sequence number for this PGN
 			CANIdentifier::CANPriority priority; ///< The priority to encode in the IDs of the component CAN messages
 		};
 
-		/// @brief A structure for keeping track of past sessions so we can resume with the right session number
-		struct FastPacketHistory
-		{
-			NAME isoName; ///< The ISO name of the internal control function used in a session
-			std::uint32_t parameterGroupNumber; ///< The PGN of the session being saved
-			std::uint8_t sequenceNumber; ///< The sequence number to use in the next matching session
-		};
-
 		/// @brief The constructor for the FastPacketProtocol, for advanced use only.
 		/// In most cases, you should use the CANNetworkManager::get_fast_packet_protocol().send_message() function to transmit messages.
 		/// @param[in] sendCANFrameCallback A callback for sending a CAN frame to hardware
@@ -174,10 +227,27 @@ namespace isobus
 		static std::uint8_t calculate_number_of_frames(std::uint8_t messageLength);
 
 	private:
+		/// @brief The key of the session history, which is the ISO NAME of the source and the PGN of a session
+		using SessionHistoryKey = std::pair<std::uint64_t, std::uint32_t>;
+
+		/// @brief Hashes a session history key for the session history table
+		struct SessionHistoryHash
+		{
+			/// @brief Combines the NAME and PGN of a session history key into a hash
+			/// @param[in] key The key to hash
+			/// @returns The hash of the key
+			std::size_t operator()(const SessionHistoryKey &key) const;
+		};
+
 		/// @brief Adds a session's info to the history so that we can continue the sequence number later
 		/// @param[in] session The session to add to the history
 		void add_session_history(const std::shared_ptr<FastPacketProtocolSession> &session);
 
+		/// @brief Takes a session out of the pool of unused sessions, or creates one if they're all in use
+		/// @note The session mutex must be locked when calling this
+		/// @returns A session that isn't in use, to be set up with FastPacketProtocolSession::reset
+		std::shared_ptr<FastPacketProtocolSession> get_unused_session();
+
 		/// @brief Gracefully closes a session to prepare for a new session
 		/// @param[in] session The session to close
 		/// @param[in] successful Denotes if the session was successful
@@ -217,8 +287,9 @@ namespace isobus
 		static constexpr std::uint8_t PROTOCOL_BYTES_PER_FRAME = 7; ///< The number of payload bytes per frame for all but the first message, which has 6
 
 		std::vector<std::shared_ptr<FastPacketProtocolSession>> activeSessions; ///< A list of all active TP sessions
+		std::vector<std::shared_ptr<FastPacketProtocolSession>> unusedSessions; ///< Sessions that have closed and are kept to be reused, so starting a session doesn't allocate
 		Mutex sessionMutex; ///< A mutex to lock the sessions list in case someone starts a Tx while the stack is processing sessions
-		std::vector<FastPacketHistory> sessionHistory; ///< Used to keep track of sequence numbers for future sessions
+		std::unordered_map<SessionHistoryKey, std::uint8_t, SessionHistoryHash> sessionHistory; ///< The last sequence number used by each NAME and PGN, to continue the sequence in future sessions
 		std::vector<ParameterGroupNumberCallbackData> parameterGroupNumberCallbacks; ///< A list of all parameter group number callbacks that will be parsed as fast packet messages
 		bool allowAnyControlFunction = false; ///< Denotes if messages for non-internal control functions should be parsed by this protocol
 		const CANMessageFrameCallback sendCANFrameCallback; ///< A callback for sending a CAN frame
@@ -17,6 +17,7 @@
 
 #include "isobus/isobus/can_internal_control_function.hpp"
 
+#include <array>
 #include <string>
 
 namespace isobus
@@ -113,6 +114,10 @@ namespace isobus
 			/// @returns true if the value that was set was different from the stored value
 			bool set_sensor_reference(HeadingSensorReference reference);
 
+			/// @brief Serializes the current state of the object into a single CAN frame without allocating memory.
+			/// @param[out] buffer The frame data to populate with the message data
+			void serialize(std::array<std::uint8_t, CAN_DATA_LENGTH> &buffer) const;
+
 			/// @brief Takes the current state of the object and serializes it into a buffer to be sent.
 			/// @param[in] buffer A vector to populate with the message data
 			void serialize(std::vector<std::uint8_t> &buffer) const;
@@ -181,6 +186,10 @@ namespace isobus
 			/// @returns true if the value that was set was different from the stored value
 			bool set_sequence_id(std::uint8_t sequenceNumber);
 
+			/// @brief Serializes the current state of the object into a single CAN frame without allocating memory.
+			/// @param[out] buffer The frame data to populate with the message data
+			void serialize(std::array<std::uint8_t, CAN_DATA_LENGTH> &buffer) const;
+
 			/// @brief Serializes the current state of this object into a buffer to be sent on the CAN bus
 			/// @param[in] buffer A buffer to serialize the message data into
 			void serialize(std::vector<std::uint8_t> &buffer) const;
@@ -252,6 +261,10 @@ namespace isobus
 			/// @returns true if the value that was set was different from the stored value
 			bool set_longitude(std::int32_t longitudeToSet);
 
+			/// @brief Serializes the current state of the object into a single CAN frame without allocating memory.
+			/// @param[out] buffer The frame data to populate with the message data
+			void serialize(std::array<std::uint8_t, CAN_DATA_LENGTH> &buffer) const;
+
 			/// @brief Serializes the current state of this object into a buffer to be sent on the CAN bus
 			/// @param[in] buffer A buffer to serialize the message data into
 			void serialize(std::vector<std::uint8_t> &buffer) const;
@@ -348,6 +361,10 @@ namespace isobus
 			/// @returns True if the value that was set differed from the stored value, otherwise false
 			bool set_course_over_ground_reference(CourseOverGroundReference reference);
 
+			/// @brief Serializes the current state of the object into a single CAN frame without allocating memory.
+			/// @param[out] buffer The frame data to populate with the message data
+			void serialize(std::array<std::uint8_t, CAN_DATA_LENGTH> &buffer) const;
+
 			/// @brief Serializes the current state of this object into a buffer to be sent on the CAN bus
 			/// @param[in] buffer A buffer to serialize the message data into
 			void serialize(std::vector<std::uint8_t> &buffer) const;
@@ -443,6 +460,10 @@ namespace isobus
 			/// @returns True if the value that was set differed from the stored value, otherwise false
 			bool set_time_delta(std::uint8_t delta);
 
+			/// @brief Serializes the current state of the object into a single CAN frame without allocating memory.
+			/// @param[out] buffer The frame data to populate with the message data
+			void serialize(std::array<std::uint8_t, CAN_DATA_LENGTH> &buffer) const;
+
 			/// @brief Serializes the current state of this object into a buffer to be sent on the CAN bus
 			/// @param[in] buffer A buffer to serialize the message data into
 			void serialize(std::vector<std::uint8_t> &buffer) const;
@@ -23,6 +23,8 @@
 #include "isobus/utility/event_dispatcher.hpp"
 #include "isobus/utility/processing_flags.hpp"
 
+#include <array>
+
 namespace isobus
 {
 	/// @brief An interface for sending and receiving common NMEA2000 messages on an ISO11783 network
@@ -288,6 +290,55 @@ namespace isobus
 			NumberOfFlags
 		};
 
+		/// @brief Stores every source of one received NMEA2000 message, indexed by CAN port and source address
+		/// @details Each message is deserialized in place into the object for its source, so a message from a
+		/// known source costs one table lookup and no allocations. The table also remembers the oldest timestamp
+		/// of its sources, which is the earliest time any of them can time out, so the sources are only checked
+		/// for timeouts once that deadline has passed.
+		/// @tparam T The NMEA2000Messages class that stores the message's content
+		template<typename T>
+		class ReceivedMessageTable
+		{
+		public:
+			/// @brief Constructor for a ReceivedMessageTable
+			/// @param[in] messageName The name of the message, used when logging timeouts
+			explicit ReceivedMessageTable(const char *messageName);
+
+			/// @brief Deserializes a message into the object for its source, adding the source if it's new
+			/// @param[in] message The message to deserialize
+			/// @param[out] anySignalChanged Set to true if any of the message's signals changed
+			/// @returns The object for the message's source, or nullptr if the message couldn't be stored
+			std::shared_ptr<T> process_message(const CANMessage &message, bool &anySignalChanged);
+
+			/// @brief Returns the number of sources in the table
+			/// @returns The number of sources that have sent the message and not timed out
+			std::size_t size() const;
+
+			/// @brief Returns the content of the message from one source
+			/// @param[in] index The index of the source, in the order the sources were first received
+			/// @returns The content of the message, or nullptr if the index is out of range
+			std::shared_ptr<T> get(std::size_t index) const;
+
+			/// @brief Removes the sources that have timed out, if the earliest timeout deadline has passed
+			void check_timeouts();
+
+		private:
+			static constexpr std::size_t NUMBER_OF_KEYS = CAN_PORT_MAXIMUM * 256; ///< One key for each address on each CAN port
+			static constexpr std::size_t MAX_NUMBER_OF_SOURCES = 255; ///< The most sources that fit the 8 bit source indices
+
+			/// @brief Combines a CAN port and source address into a single key
+			/// @param[in] canPortIndex The CAN port of the source
+			/// @param[in] sourceAddress The address of the source
+			/// @returns A key that is unique to the port and address
+			static std::size_t get_key(std::uint8_t canPortIndex, std::uint8_t sourceAddress);
+
+			std::vector<std::shared_ptr<T>> sources; ///< The sources of the message, in the order they were first received
+			std::vector<std::uint16_t> sourceKeys; ///< The port and address key of each source
+			std::array<std::uint8_t, NUMBER_OF_KEYS> sourceIndices; ///< Maps a port and address key to one more than the index of its source, or 0 if none
+			std::uint32_t oldestTimestamp_ms = 0; ///< No source was received before this time, so none can time out until this plus the timeout
+			const char *name; ///< The name of the message, used when logging timeouts
+		};
+
 		/// @brief A generic callback for a the class to process flags from the `ProcessingFlags`
 		/// @param[in] flag The flag to process
 		/// @param[in] parentPointer A generic context pointer to reference a specific instance of this protocol in the callback
@@ -312,13 +363,14 @@ namespace isobus
 		NMEA2000Messages::PositionRapidUpdate positionRapidUpdateTransmitMessage; ///< Stores a set of data specifically for transmitting the PGN 129025 (0x1F801) if enabled
 		NMEA2000Messages::RateOfTurn rateOfTurnTransmitMessage; ///< Stores a set of data specifically for transmitting the PGN 127251 (0x1F113) if enabled
 		NMEA2000Messages::VesselHeading vesselHeadingTransmitMessage; ///< Stores a set of data specifically for transmitting the PGN 127250 (0x1F112) if enabled
-		std::vector<std::shared_ptr<NMEA2000Messages::CourseOverGroundSpeedOverGroundRapidUpdate>> receivedCogSogMessages; ///< Stores all received (and not timed out) sources of the COG & SOG message
-		std::vector<std::shared_ptr<NMEA2000Messages::Datum>> receivedDatumMessages; ///< Stores all received (and not timed out) sources of the Datum message
-		std::vector<std::shared_ptr<NMEA2000Messages::GNSSPositionData>> receivedGNSSPositionDataMessages; ///< Stores all received (and not timed out) sources of the GNSS position data message
-		std::vector<std::shared_ptr<NMEA2000Messages::PositionDeltaHighPrecisionRapidUpdate>> receivedPositionDeltaHighPrecisionRapidUpdateMessages; ///< Stores all received (and not timed out) sources of the position delta message
-		std::vector<std::shared_ptr<NMEA2000Messages::PositionRapidUpdate>> receivedPositionRapidUpdateMessages; ///< Stores all received (and not timed out) sources of the position rapid update message
-		std::vector<std::shared_ptr<NMEA2000Messages::RateOfTurn>> receivedRateOfTurnMessages; ///< Stores all received (and not timed out) sources of the rate of turn message
-		std::vector<std::shared_ptr<NMEA2000Messages::VesselHeading>> receivedVesselHeadingMessages; ///< Stores all received (and not timed out) sources of the vessel heading message
+		std::vector<std::uint8_t> fastPacketTransmitBuffer; ///< Reused for serializing the fast packet messages, so it only allocates when one of them grows
+		ReceivedMessageTable<NMEA2000Messages::CourseOverGroundSpeedOverGroundRapidUpdate> receivedCogSogMessages; ///< Stores all received (and not timed out) sources of the COG & SOG message
+		ReceivedMessageTable<NMEA2000Messages::Datum> receivedDatumMessages; ///< Stores all received (and not timed out) sources of the Datum message
+		ReceivedMessageTable<NMEA2000Messages::GNSSPositionData> receivedGNSSPositionDataMessages; ///< Stores all received (and not timed out) sources of the GNSS position data message
+		ReceivedMessageTable<NMEA2000Messages::PositionDeltaHighPrecisionRapidUpdate> receivedPositionDeltaHighPrecisionRapidUpdateMessages; ///< Stores all received (and not timed out) sources of the position delta message
+		ReceivedMessageTable<NMEA2000Messages::PositionRapidUpdate> receivedPositionRapidUpdateMessages; ///< Stores all received (and not timed out) sources of the position rapid update message
+		ReceivedMessageTable<NMEA2000Messages::RateOfTurn> receivedRateOfTurnMessages; ///< Stores all received (and not timed out) sources of the rate of turn message
+		ReceivedMessageTable<NMEA2000Messages::VesselHeading> receivedVesselHeadingMessages; ///< Stores all received (and not timed out) sources of the vessel heading message
 		EventDispatcher<const std::shared_ptr<NMEA2000Messages::CourseOverGroundSpeedOverGroundRapidUpdate>, bool> cogSogEventPublisher; ///< An event dispatcher for notifying when new guidance machine info messages are received
 		EventDispatcher<const std::shared_ptr<NMEA2000Messages::Datum>, bool> datumEventPublisher; ///< An event dispatcher for notifying when new guidance machine info messages are received
 		EventDispatcher<const std::shared_ptr<NMEA2000Messages::GNSSPositionData>, bool> gnssPositionDataEventPublisher; ///< An event dispatcher for notifying when new guidance machine info messages are received
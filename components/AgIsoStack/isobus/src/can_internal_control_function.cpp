@@ -110,6 +110,45 @@ namespace isobus
 			{
 				if (SystemTiming::time_expired_ms(stateChangeTimestamp_ms, randomClaimDelay_ms))
 				{
+					if (NULL_CAN_ADDRESS != rememberedAddress)
+					{
+						set_current_state(State::SendRememberedAddressClaim);
+					}
+					else
+					{
+						set_current_state(State::SendRequestForClaim);
+					}
+				}
+			}
+			break;
+
+			case State::SendRememberedAddressClaim:
+			{
+				std::uint8_t addressToClaim = rememberedAddress;
+				std::shared_ptr<ControlFunction> deviceAtRememberedAddress = CANNetworkManager::CANNetwork.get_control_function(get_can_port(), addressToClaim);
+				rememberedAddress = NULL_CAN_ADDRESS;
+
+				if (((nullptr == deviceAtRememberedAddress) ||
+				     (deviceAtRememberedAddress->get_NAME().get_full_name() > get_NAME().get_full_name())) &&
+				    (send_address_claim(addressToClaim)))
+				{
+					if (NULL_CAN_ADDRESS == get_preferred_address())
+					{
+						preferredAddress = addressToClaim;
+					}
+					LOG_DEBUG("[AC]: Internal control function %016llx has claimed its remembered address %u on channel %u",
+					          get_NAME().get_full_name(),
+					          addressToClaim,
+					          get_can_port());
+
+					// We still need everyone else's claims, and this tells anyone with a better claim to our address to contend it
+					send_request_to_claim();
+					hasClaimedAddress = true;
+					set_current_state(State::AddressClaimingComplete);
+				}
+				else
+				{
+					// Someone with a better claim already has it, or the bus is down, so claim the usual way
 					set_current_state(State::SendRequestForClaim);
 				}
 			}
@@ -288,6 +327,20 @@ namespace isobus
 		return preferredAddress;
 	}
 
+	bool InternalControlFunction::set_remembered_address(std::uint8_t address)
+	{
+		bool retVal = false;
+
+		if ((State::None == get_current_state()) &&
+		    (address < NULL_CAN_ADDRESS) &&
+		    ((get_NAME().get_arbitrary_address_capable()) || (address == preferredAddress)))
+		{
+			rememberedAddress = address;
+			retVal = true;
+		}
+		return retVal;
+	}
+
 	EventDispatcher<std::uint8_t> &InternalControlFunction::get_address_claimed_event_dispatcher()
 	{
 		return addressClaimedDispatcher;
@@ -120,6 +120,16 @@ namespace isobus
 		return CANPortIndex;
 	}
 
+	std::uint64_t CANMessage::get_timestamp_us() const
+	{
+		return timestamp_us;
+	}
+
+	void CANMessage::set_timestamp_us(std::uint64_t timestamp)
+	{
+		timestamp_us = timestamp;
+	}
+
 	void CANMessage::set_data(const std::uint8_t *dataBuffer, std::uint32_t length)
 	{
 		assert(length <= ABSOLUTE_MAX_MESSAGE_LENGTH && "CANMessage::set_data() called with length greater than maximum supported");
@@ -75,6 +75,56 @@ namespace isobus
 		deactivate_control_function(std::static_pointer_cast<ControlFunction>(controlFunction));
 	}
 
+	bool CANNetworkManager::add_known_control_function(NAME controlFunctionNAME, std::uint8_t address, std::uint8_t CANPort)
+	{
+		bool retVal = false;
+
+		if ((CANPort < CAN_PORT_MAXIMUM) && (address < NULL_CAN_ADDRESS))
+		{
+			auto &processingMutex = ControlFunction::controlFunctionProcessingMutex;
+			LOCK_GUARD(Mutex, processingMutex);
+
+			if ((nullptr == controlFunctionTable[CANPort][address]) &&
+			    (nullptr == find_control_function_by_NAME(controlFunctionNAME.get_full_name(), CANPort)))
+			{
+				std::shared_ptr<ControlFunction> knownControlFunction = nullptr;
+
+				for (const auto &partner : partneredControlFunctions)
+				{
+					if ((partner->get_can_port() == CANPort) &&
+					    (partner->check_matches_name(controlFunctionNAME)) &&
+					    (0 == partner->get_NAME().get_full_name()))
+					{
+						partner->controlFunctionNAME = controlFunctionNAME;
+						partner->address = address;
+						controlFunctionTable[CANPort][address] = partner;
+						index_control_function_NAME(partner);
+						knownControlFunction = partner;
+						break;
+					}
+				}
+
+				if (nullptr == knownControlFunction)
+				{
+					knownControlFunction = create_external_control_function(controlFunctionNAME, address, CANPort);
+				}
+
+				// Until it claims, treat it the same as a CF that has been asked to claim but hasn't yet
+				knownControlFunction->claimedAddressSinceLastAddressClaimRequest = false;
+				lastAddressClaimRequestTimestamp_ms.at(CANPort) = SystemTiming::get_timestamp_ms();
+				process_control_function_state_change_callback(knownControlFunction, ControlFunctionState::Online);
+
+				LOG_DEBUG("[NM]: Known %s CF '%016llx' is expected at address %u on channel %u.",
+				          knownControlFunction->get_type_string().c_str(),
+				          controlFunctionNAME.get_full_name(),
+				          address,
+				          CANPort);
+				retVal = true;
+			}
+		}
+		return retVal;
+	}
+
 	void CANNetworkManager::add_global_parameter_group_number_callback(std::uint32_t parameterGroupNumber, CANLibCallback callback, void *parent)
 	{
 		globalParameterGroupNumberCallbacks.emplace_back(parameterGroupNumber, callback, parent, nullptr);
@@ -164,34 +214,40 @@ namespace isobus
 		    ((parameterGroupNumber == static_cast<std::uint32_t>(CANLibParameterGroupNumber::AddressClaim)) ||
 		     (sourceControlFunction->get_address_valid())))
 		{
-			std::unique_ptr<CANMessageData> messageData;
-			if (nullptr != frameChunkCallback)
-			{
-				messageData.reset(new CANMessageDataCallback(dataLength, frameChunkCallback, parentPointer));
-			}
-			else
-			{
-				messageData.reset(new CANMessageDataView(dataBuffer, dataLength));
-			}
-			if (transportProtocols[sourceControlFunction->get_can_port()]->protocol_transmit_message(parameterGroupNumber,
-			                                                                                         messageData,
-			                                                                                         sourceControlFunction,
-			                                                                                         destinationControlFunction,
-			                                                                                         transmitCompleteCallback,
-			                                                                                         parentPointer))
-			{
-				// Successfully sent via the transport protocol
-				retVal = true;
-			}
-			else if (extendedTransportProtocols[sourceControlFunction->get_can_port()]->protocol_transmit_message(parameterGroupNumber,
-			                                                                                                      messageData,
-			                                                                                                      sourceControlFunction,
-			                                                                                                      destinationControlFunction,
-			                                                                                                      transmitCompleteCallback,
-			                                                                                                      parentPointer))
+			// Single frame messages never need a transport protocol, so skip wrapping their data
+			// in a heap allocated CANMessageData to keep periodic broadcasts allocation free.
+			if ((nullptr != frameChunkCallback) ||
+			    (dataLength > CAN_DATA_LENGTH))
 			{
-				// Successfully sent via the extended transport protocol
-				retVal = true;
+				std::unique_ptr<CANMessageData> messageData;
+				if (nullptr != frameChunkCallback)
+				{
+					messageData.reset(new CANMessageDataCallback(dataLength, frameChunkCallback, parentPointer));
+				}
+				else
+				{
+					messageData.reset(new CANMessageDataView(dataBuffer, dataLength));
+				}
+				if (transportProtocols[sourceControlFunction->get_can_port()]->protocol_transmit_message(parameterGroupNumber,
+				                                                                                         messageData,
+				                                                                                         sourceControlFunction,
+				                                                                                         destinationControlFunction,
+				                                                                                         transmitCompleteCallback,
+				                                                                                         parentPointer))
+				{
+					// Successfully sent via the transport protocol
+					retVal = true;
+				}
+				else if (extendedTransportProtocols[sourceControlFunction->get_can_port()]->protocol_transmit_message(parameterGroupNumber,
+				                                                                                                      messageData,
+				                                                                                                      sourceControlFunction,
+				                                                                                                      destinationControlFunction,
+				                                                                                                      transmitCompleteCallback,
+				                                                                                                      parentPointer))
+				{
+					// Successfully sent via the extended transport protocol
+					retVal = true;
+				}
 			}
 
 			//! @todo Allow sending 8 byte message with the frameChunkCallback
@@ -295,6 +351,16 @@ namespace isobus
 		CANNetworkManager::CANNetwork.update();
 	}
 
+	void deadline_update_from_hardware()
+	{
+		CANNetworkManager::CANNetwork.get_deadline_event_dispatcher().invoke();
+	}
+
+	void register_deadline_request_handler_from_hardware(DeadlineRequestHandler handler)
+	{
+		CANNetworkManager::CANNetwork.deadlineRequestHandler = handler;
+	}
+
 	void CANNetworkManager::process_receive_can_message_frame(const CANMessageFrame &rxFrame)
 	{
 		update_control_functions(rxFrame);
@@ -307,6 +373,7 @@ namespace isobus
 		                   get_control_function(rxFrame.channel, identifier.get_source_address()),
 		                   get_control_function(rxFrame.channel, identifier.get_destination_address()),
 		                   rxFrame.channel);
+		message.set_timestamp_us(rxFrame.timestamp_us);
 
 		update_busload(rxFrame.channel, rxFrame.get_number_bits_in_message());
 
@@ -329,6 +396,7 @@ namespace isobus
 		                   get_control_function(txFrame.channel, identifier.get_source_address()),
 		                   get_control_function(txFrame.channel, identifier.get_destination_address()),
 		                   txFrame.channel);
+		message.set_timestamp_us(txFrame.timestamp_us);
 
 		if (initialized)
 		{
@@ -357,6 +425,16 @@ namespace isobus
 			inactiveControlFunctions.erase(result);
 		}
 
+		if (controlFunction->get_can_port() < CAN_PORT_MAXIMUM)
+		{
+			auto &NAMEIndex = controlFunctionNAMEIndex[controlFunction->get_can_port()];
+			auto indexEntry = NAMEIndex.find(controlFunction->get_NAME().get_full_name());
+			if ((NAMEIndex.end() != indexEntry) && (indexEntry->second.lock() == controlFunction))
+			{
+				NAMEIndex.erase(indexEntry);
+			}
+		}
+
 		for (std::uint8_t i = 0; i < NULL_CAN_ADDRESS; i++)
 		{
 			if (controlFunctionTable[controlFunction->get_can_port()][i] == controlFunction)
@@ -469,6 +547,24 @@ namespace isobus
 		return addressViolationEventDispatcher;
 	}
 
+	EventDispatcher<> &CANNetworkManager::get_deadline_event_dispatcher()
+	{
+		return deadlineEventDispatcher;
+	}
+
+	bool CANNetworkManager::request_deadline_update(std::uint64_t deadline_us) const
+	{
+		bool retVal = false;
+		DeadlineRequestHandler handler = deadlineRequestHandler;
+
+		if (nullptr != handler)
+		{
+			handler(deadline_us);
+			retVal = true;
+		}
+		return retVal;
+	}
+
 	bool CANNetworkManager::send_request_for_address_claim(std::uint8_t canPortIndex) const
 	{
 		const auto parameterGroupNumber = static_cast<std::uint32_t>(CANLibParameterGroupNumber::AddressClaim);
@@ -560,6 +656,7 @@ namespace isobus
 		if ((CANPort < CAN_PORT_MAXIMUM) && (address < NULL_CAN_ADDRESS))
 		{
 			controlFunctionTable[CANPort][address] = controlFunction;
+			index_control_function_NAME(controlFunction);
 		}
 		return controlFunction;
 	}
@@ -670,6 +767,7 @@ namespace isobus
 
 				// ECU has claimed since the last update, add it to the table
 				controlFunctionTable[channelIndex][claimedAddress] = currentInternalControlFunction;
+				index_control_function_NAME(currentInternalControlFunction);
 			}
 		}
 	}
@@ -727,27 +825,7 @@ namespace isobus
 			claimedNAME |= (static_cast<std::uint64_t>(rxFrame.data[7]) << 56);
 
 			// Check if the claimed NAME is someone we already know about
-			auto activeResult = std::find_if(controlFunctionTable[rxFrame.channel].begin(),
-			                                 controlFunctionTable[rxFrame.channel].end(),
-			                                 [claimedNAME](const std::shared_ptr<ControlFunction> &cf) {
-				                                 return (nullptr != cf) && (cf->get_NAME().get_full_name() == claimedNAME);
-			                                 });
-			if (activeResult != controlFunctionTable[rxFrame.channel].end())
-			{
-				foundControlFunction = *activeResult;
-			}
-			else
-			{
-				auto inActiveResult = std::find_if(inactiveControlFunctions.begin(),
-				                                   inactiveControlFunctions.end(),
-				                                   [claimedNAME, &rxFrame](const std::shared_ptr<ControlFunction> &cf) {
-					                                   return (cf->get_NAME().get_full_name() == claimedNAME) && (cf->get_can_port() == rxFrame.channel);
-				                                   });
-				if (inActiveResult != inactiveControlFunctions.end())
-				{
-					foundControlFunction = *inActiveResult;
-				}
-			}
+			foundControlFunction = find_control_function_by_NAME(claimedNAME, rxFrame.channel);
 
 			if (nullptr == foundControlFunction)
 			{
@@ -761,6 +839,7 @@ namespace isobus
 						partner->controlFunctionNAME = NAME(claimedNAME);
 						foundControlFunction = partner;
 						controlFunctionTable[rxFrame.channel][claimedAddress] = foundControlFunction;
+						index_control_function_NAME(foundControlFunction);
 						break;
 					}
 				}
@@ -897,6 +976,7 @@ namespace isobus
 						partner->controlFunctionNAME = currentActiveControlFunction->get_NAME();
 						partner->initialized = true;
 						controlFunctionTable[partner->get_can_port()][partner->address] = std::shared_ptr<ControlFunction>(partner);
+						index_control_function_NAME(partner);
 						process_control_function_state_change_callback(partner, ControlFunctionState::Online);
 
 						LOG_INFO("[NM]: A partner with name %016llx has claimed address %u on channel %u.",
@@ -911,6 +991,76 @@ namespace isobus
 		}
 	}
 
+	std::shared_ptr<ControlFunction> CANNetworkManager::find_control_function_by_NAME(std::uint64_t NAMEValue, std::uint8_t channelIndex)
+	{
+		std::shared_ptr<ControlFunction> retVal = nullptr;
+		auto &NAMEIndex = controlFunctionNAMEIndex[channelIndex];
+		auto indexEntry = NAMEIndex.find(NAMEValue);
+
+		// Every control function in the table or inactive list was indexed when it was put in the table,
+		// so a NAME that isn't in the index is not known, which is the usual case for a burst of claims at power up.
+		if (NAMEIndex.end() != indexEntry)
+		{
+			auto controlFunction = indexEntry->second.lock();
+
+			if ((nullptr != controlFunction) &&
+			    (controlFunction->get_NAME().get_full_name() == NAMEValue))
+			{
+				if ((controlFunction->get_address() < NULL_CAN_ADDRESS) &&
+				    (controlFunctionTable[channelIndex][controlFunction->get_address()] == controlFunction))
+				{
+					retVal = controlFunction;
+				}
+				else if (inactiveControlFunctions.end() != std::find(inactiveControlFunctions.begin(), inactiveControlFunctions.end(), controlFunction))
+				{
+					retVal = controlFunction;
+				}
+			}
+
+			if (nullptr == retVal)
+			{
+				// The indexed control function is somewhere unexpected, or was dropped from the table. Fall back to searching everything.
+				NAMEIndex.erase(indexEntry);
+
+				auto activeResult = std::find_if(controlFunctionTable[channelIndex].begin(),
+				                                 controlFunctionTable[channelIndex].end(),
+				                                 [NAMEValue](const std::shared_ptr<ControlFunction> &cf) {
+					                                 return (nullptr != cf) && (cf->get_NAME().get_full_name() == NAMEValue);
+				                                 });
+				if (activeResult != controlFunctionTable[channelIndex].end())
+				{
+					retVal = *activeResult;
+				}
+				else
+				{
+					auto inActiveResult = std::find_if(inactiveControlFunctions.begin(),
+					                                   inactiveControlFunctions.end(),
+					                                   [NAMEValue, channelIndex](const std::shared_ptr<ControlFunction> &cf) {
+						                                   return (cf->get_NAME().get_full_name() == NAMEValue) && (cf->get_can_port() == channelIndex);
+					                                   });
+					if (inActiveResult != inactiveControlFunctions.end())
+					{
+						retVal = *inActiveResult;
+					}
+				}
+
+				if (nullptr != retVal)
+				{
+					NAMEIndex[NAMEValue] = retVal;
+				}
+			}
+		}
+		return retVal;
+	}
+
+	void CANNetworkManager::index_control_function_NAME(const std::shared_ptr<ControlFunction> &controlFunction)
+	{
+		if (controlFunction->get_can_port() < CAN_PORT_MAXIMUM)
+		{
+			controlFunctionNAMEIndex[controlFunction->get_can_port()][controlFunction->get_NAME().get_full_name()] = controlFunction;
+		}
+	}
+
 	CANMessageFrame CANNetworkManager::construct_frame(std::uint32_t portIndex,
 	                                                   std::uint8_t sourceAddress,
 	                                                   std::uint8_t destAddress,
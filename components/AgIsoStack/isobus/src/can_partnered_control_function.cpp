@@ -23,6 +23,24 @@ namespace isobus
 	{
 		auto &processingMutex = ControlFunction::controlFunctionProcessingMutex;
 		LOCK_GUARD(Mutex, processingMutex);
+
+		// Combine the filters into a single mask and value, so a NAME can be checked against all of them at once
+		NAMEFiltersCanMatch = (0 != NAMEFilterList.size());
+		for (const auto &filter : NAMEFilterList)
+		{
+			std::uint64_t filterMask = 0;
+			std::uint64_t filterValue = 0;
+
+			if ((!filter.get_name_mask(filterMask, filterValue)) ||
+			    ((NAMEFilterValue & filterMask) != (filterValue & NAMEFilterMask)))
+			{
+				// Either this filter can never match, or it wants a different value than a previous filter for the same component
+				NAMEFiltersCanMatch = false;
+				break;
+			}
+			NAMEFilterMask |= filterMask;
+			NAMEFilterValue |= filterValue;
+		}
 	}
 
 	void PartneredControlFunction::add_parameter_group_number_callback(std::uint32_t parameterGroupNumber, CANLibCallback callback, void *parent, std::shared_ptr<InternalControlFunction> internalControlFunction)
@@ -79,88 +97,7 @@ namespace isobus
 
 	bool PartneredControlFunction::check_matches_name(NAME NAMEToCheck) const
 	{
-		std::uint32_t currentFilterValue;
-		NAME::NAMEParameters currentFilterParameter;
-		bool retVal = true;
-
-		if (0 == get_number_name_filters())
-		{
-			retVal = false;
-		}
-
-		for (std::uint32_t i = 0; i < get_number_name_filters(); i++)
-		{
-			get_name_filter_parameter(i, currentFilterParameter, currentFilterValue);
-
-			switch (currentFilterParameter)
-			{
-				case NAME::NAMEParameters::IdentityNumber:
-				{
-					retVal = (currentFilterValue == NAMEToCheck.get_identity_number());
-				}
-				break;
-
-				case NAME::NAMEParameters::ManufacturerCode:
-				{
-					retVal = (currentFilterValue == NAMEToCheck.get_manufacturer_code());
-				}
-				break;
-
-				case NAME::NAMEParameters::EcuInstance:
-				{
-					retVal = (currentFilterValue == NAMEToCheck.get_ecu_instance());
-				}
-				break;
-
-				case NAME::NAMEParameters::FunctionInstance:
-				{
-					retVal = (currentFilterValue == NAMEToCheck.get_function_instance());
-				}
-				break;
-
-				case NAME::NAMEParameters::FunctionCode:
-				{
-					retVal = (currentFilterValue == NAMEToCheck.get_function_code());
-				}
-				break;
-
-				case NAME::NAMEParameters::DeviceClass:
-				{
-					retVal = (currentFilterValue == NAMEToCheck.get_device_class());
-				}
-				break;
-
-				case NAME::NAMEParameters::DeviceClassInstance:
-				{
-					retVal = (currentFilterValue == NAMEToCheck.get_device_class_instance());
-				}
-				break;
-
-				case NAME::NAMEParameters::IndustryGroup:
-				{
-					retVal = (currentFilterValue == NAMEToCheck.get_industry_group());
-				}
-				break;
-
-				case NAME::NAMEParameters::ArbitraryAddressCapable:
-				{
-					retVal = ((0 != currentFilterValue) == NAMEToCheck.get_arbitrary_address_capable());
-				}
-				break;
-
-				default:
-				{
-					retVal = false;
-				}
-				break;
-			}
-
-			if (false == retVal)
-			{
-				break;
-			}
-		}
-		return retVal;
+		return (NAMEFiltersCanMatch && ((NAMEToCheck.get_full_name() & NAMEFilterMask) == NAMEFilterValue));
 	}
 
 	ParameterGroupNumberCallbackData &PartneredControlFunction::get_parameter_group_number_callback(std::size_t index)
@@ -103,4 +103,22 @@ namespace isobus
 			                        parent);
 		}
 	}
+
+	void TransportProtocolSessionBase::reset(Direction sessionDirection,
+	                                         std::uint32_t sessionParameterGroupNumber,
+	                                         std::uint32_t sessionTotalMessageSize,
+	                                         std::shared_ptr<ControlFunction> sessionSource,
+	                                         std::shared_ptr<ControlFunction> sessionDestination,
+	                                         TransmitCompleteCallback completeCallback,
+	                                         void *parentPointer)
+	{
+		direction = sessionDirection;
+		parameterGroupNumber = sessionParameterGroupNumber;
+		totalMessageSize = sessionTotalMessageSize;
+		source = sessionSource;
+		destination = sessionDestination;
+		sessionCompleteCallback = completeCallback;
+		parent = parentPointer;
+		timestamp_ms = 0;
+	}
 }
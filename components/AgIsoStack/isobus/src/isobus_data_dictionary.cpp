@@ -13,6 +13,8 @@
 
 #include "isobus/isobus/isobus_standard_data_description_indices.hpp"
 
+#include <algorithm>
+#include <cstdio>
 #include <limits>
 #include <map>
 #include <sstream>
@@ -22,12 +24,12 @@ namespace isobus
 	const DataDictionary::Entry &DataDictionary::get_entry(std::uint16_t dataDictionaryIdentifier)
 	{
 #ifndef DISABLE_ISOBUS_DATA_DICTIONARY
-		for (std::uint_fast16_t i = 0; i < sizeof(DDI_ENTRIES) / sizeof(DataDictionary::Entry); i++)
+		const Entry *end = DDI_ENTRIES + (sizeof(DDI_ENTRIES) / sizeof(DataDictionary::Entry));
+		const Entry *entry = std::lower_bound(DDI_ENTRIES, end, dataDictionaryIdentifier, [](const Entry &candidate, std::uint16_t ddi) { return candidate.ddi < ddi; });
+
+		if ((end != entry) && (entry->ddi == dataDictionaryIdentifier))
 		{
-			if (DDI_ENTRIES[i].ddi == dataDictionaryIdentifier)
-			{
-				return DDI_ENTRIES[i];
-			}
+			return *entry;
 		}
 #endif
 		return DEFAULT_ENTRY;
@@ -39,6 +41,40 @@ namespace isobus
 	}
 
 	std::string DataDictionary::Entry::format_value(const std::int32_t value) const
+	{
+		std::string retVal = format_enumerated_value(ddi, value);
+
+		if (retVal.empty())
+		{
+			retVal = format_scaled_value(static_cast<double>(value) * resolution + get_offset(*this), unitSymbol);
+		}
+		return retVal;
+	}
+
+	DataDictionary::Formatter::Formatter(std::uint16_t ddi) :
+	  entry(&DataDictionary::get_entry(ddi)),
+	  resolution(entry->resolution),
+	  offset(DataDictionary::get_offset(*entry))
+	{
+	}
+
+	std::string DataDictionary::Formatter::format_value(std::int32_t value) const
+	{
+		std::string retVal = format_enumerated_value(entry->ddi, value);
+
+		if (retVal.empty())
+		{
+			retVal = format_scaled_value(static_cast<double>(value) * resolution + offset, entry->unitSymbol);
+		}
+		return retVal;
+	}
+
+	const DataDictionary::Entry &DataDictionary::Formatter::get_entry() const
+	{
+		return *entry;
+	}
+
+	std::string DataDictionary::format_enumerated_value(std::uint16_t ddi, std::int32_t value)
 	{
 #ifndef DISABLE_ISOBUS_DATA_DICTIONARY
 		switch (ddi)
@@ -912,18 +948,51 @@ namespace isobus
 			default:
 				break;
 		}
+#else
+		(void)ddi;
+		(void)value;
 #endif
+		// No special formatting, the caller should apply offset, resolution and units
+		return std::string();
+	}
+
+	std::string DataDictionary::format_scaled_value(double scaledValue, const std::string &unitSymbol)
+	{
+		// Formatted the same way as std::to_string, but without the intermediate strings
+		char valueString[64];
+		int length = std::snprintf(valueString, sizeof(valueString), "%f", scaledValue);
+
+		if ((length <= 0) || (static_cast<std::size_t>(length) >= sizeof(valueString)))
+		{
+			std::string fallbackString = std::to_string(scaledValue);
+			std::size_t end = fallbackString.find_last_not_of('0'); // Find the last non-zero character
+			if (fallbackString[end] == '.')
+			{
+				--end; // Avoid leaving a dangling decimal point
+			}
+			return fallbackString.substr(0, end + 1) + unitSymbol;
+		}
 
-		// No special formatting, apply offset, resolution and units
-		double offset = displayRange.first - (static_cast<double>(std::numeric_limits<std::int32_t>::min()) * resolution);
-		double scaledValue = static_cast<double>(value) * resolution + offset;
-		std::string valueString = std::to_string(scaledValue);
-		size_t end = valueString.find_last_not_of('0'); // Find the last non-zero character
-		if (valueString[end] == '.')
+		std::size_t end = static_cast<std::size_t>(length) - 1;
+		while ((end > 0) && ('0' == valueString[end]))
+		{
+			--end; // Find the last non-zero character
+		}
+		if ('.' == valueString[end])
 		{
 			--end; // Avoid leaving a dangling decimal point
 		}
-		return valueString.substr(0, end + 1) + unitSymbol;
+
+		std::string retVal;
+		retVal.reserve(end + 1 + unitSymbol.size());
+		retVal.append(valueString, end + 1);
+		retVal.append(unitSymbol);
+		return retVal;
+	}
+
+	double DataDictionary::get_offset(const Entry &entry)
+	{
+		return entry.displayRange.first - (static_cast<double>(std::numeric_limits<std::int32_t>::min()) * entry.resolution);
 	}
 
 	std::string DataDictionary::ddi_to_string(std::uint16_t ddi)
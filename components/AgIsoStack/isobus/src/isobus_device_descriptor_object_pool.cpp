@@ -125,6 +125,7 @@ namespace isobus
 			                                                                 deviceExtendedStructureLabel,
 			                                                                 clientIsoNAME,
 			                                                                 (taskControllerCompatibilityLevel >= 4)));
+			index_last_object();
 		}
 		else
 		{
@@ -167,6 +168,7 @@ namespace isobus
 			                                                                        parentObjectID,
 			                                                                        deviceElementType,
 			                                                                        uniqueID));
+			index_last_object();
 		}
 		else
 		{
@@ -229,6 +231,7 @@ namespace isobus
 			                                                                            processDataProperties,
 			                                                                            processDataTriggerMethods,
 			                                                                            uniqueID));
+			index_last_object();
 		}
 		else
 		{
@@ -282,6 +285,7 @@ namespace isobus
 			                                                                         propertyDDI,
 			                                                                         valuePresentationObject,
 			                                                                         uniqueID));
+			index_last_object();
 		}
 		else
 		{
@@ -335,6 +339,7 @@ namespace isobus
 			                                                                                  scaleFactor,
 			                                                                                  numberDecimals,
 			                                                                                  uniqueID));
+			index_last_object();
 		}
 		else
 		{
@@ -352,7 +357,15 @@ namespace isobus
 
 	bool DeviceDescriptorObjectPool::remove_object_with_id(std::uint16_t objectID)
 	{
-		return remove_where([objectID](const task_controller_object::Object &object) { return object.get_object_id() == objectID; });
+		bool retVal = false;
+
+		// Object IDs are unique in the DDOP, so the index can rule out most calls without scanning the pool,
+		// which keeps deserialization linear since it removes each object's ID before adding it
+		if (objectIDIndex.end() != objectIDIndex.find(objectID))
+		{
+			retVal = remove_where([objectID](const task_controller_object::Object &object) { return object.get_object_id() == objectID; });
+		}
+		return retVal;
 	}
 
 	bool DeviceDescriptorObjectPool::remove_where(std::function<bool(const task_controller_object::Object &)> predicate)
@@ -363,6 +376,7 @@ namespace isobus
 		{
 			if (predicate(*(*it)))
 			{
+				remove_object_from_index(*it);
 				it = objectList.erase(it);
 				retVal = true;
 			}
@@ -1018,13 +1032,62 @@ namespace isobus
 	std::shared_ptr<task_controller_object::Object> DeviceDescriptorObjectPool::get_object_by_id(std::uint16_t objectID)
 	{
 		std::shared_ptr<task_controller_object::Object> retVal;
+		auto indexedObject = objectIDIndex.find(objectID);
 
-		for (const auto &currentObject : objectList)
+		if ((objectIDIndex.end() != indexedObject) && (objectID == indexedObject->second->get_object_id()))
 		{
-			if (currentObject->get_object_id() == objectID)
+			retVal = indexedObject->second;
+		}
+		else
+		{
+			// The object's ID may have been changed through its setter since it was indexed
+			for (const auto &currentObject : objectList)
 			{
-				retVal = currentObject;
-				break;
+				if (currentObject->get_object_id() == objectID)
+				{
+					retVal = currentObject;
+					break;
+				}
+			}
+
+			if ((nullptr != retVal) || (objectIDIndex.end() != indexedObject))
+			{
+				rebuild_object_id_index();
+			}
+		}
+		return retVal;
+	}
+
+	std::shared_ptr<task_controller_object::DeviceProcessDataObject> DeviceDescriptorObjectPool::get_process_data_object(std::uint16_t elementNumber, std::uint16_t ddi)
+	{
+		std::shared_ptr<task_controller_object::DeviceProcessDataObject> retVal;
+
+		if (!processDataIndexValid)
+		{
+			rebuild_process_data_index();
+		}
+
+		auto indexedProcessData = processDataIndex.find(get_process_data_key(elementNumber, ddi));
+
+		if (processDataIndex.end() != indexedProcessData)
+		{
+			const auto &entry = indexedProcessData->second;
+
+			if ((elementNumber == entry.element->get_element_number()) &&
+			    (ddi == entry.processData->get_ddi()))
+			{
+				retVal = entry.processData;
+			}
+			else
+			{
+				// Something was changed through an object's setters, so the index is rebuilt and the lookup retried
+				rebuild_process_data_index();
+				indexedProcessData = processDataIndex.find(get_process_data_key(elementNumber, ddi));
+
+				if (processDataIndex.end() != indexedProcessData)
+				{
+					retVal = indexedProcessData->second.processData;
+				}
 			}
 		}
 		return retVal;
@@ -1049,6 +1112,7 @@ namespace isobus
 		{
 			if ((nullptr != *object) && (*object)->get_object_id() == objectID)
 			{
+				remove_object_from_index(*object);
 				objectList.erase(object);
 				retVal = true;
 				break;
@@ -1084,6 +1148,9 @@ namespace isobus
 	void DeviceDescriptorObjectPool::clear()
 	{
 		objectList.clear();
+		objectIDIndex.clear();
+		processDataIndex.clear();
+		processDataIndexValid = false;
 	}
 
 	std::uint16_t DeviceDescriptorObjectPool::size() const
@@ -1250,20 +1317,88 @@ namespace isobus
 
 		if ((0 != uniqueID) && (NULL_OBJECT_ID != uniqueID))
 		{
-			for (const auto &currentObject : objectList)
+			auto indexedObject = objectIDIndex.find(uniqueID);
+			retVal = ((objectIDIndex.end() == indexedObject) || (uniqueID != indexedObject->second->get_object_id()));
+		}
+		else
+		{
+			retVal = false;
+		}
+		return retVal;
+	}
+
+	void DeviceDescriptorObjectPool::index_last_object()
+	{
+		objectIDIndex[objectList.back()->get_object_id()] = objectList.back();
+		processDataIndexValid = false;
+	}
+
+	void DeviceDescriptorObjectPool::remove_object_from_index(const std::shared_ptr<task_controller_object::Object> &object)
+	{
+		auto indexedObject = objectIDIndex.find(object->get_object_id());
+
+		if ((objectIDIndex.end() != indexedObject) && (object == indexedObject->second))
+		{
+			objectIDIndex.erase(indexedObject);
+		}
+		else
+		{
+			// The object's ID was changed through its setter since it was indexed
+			for (auto it = objectIDIndex.begin(); it != objectIDIndex.end(); it++)
 			{
-				if (uniqueID == currentObject->get_object_id())
+				if (object == it->second)
 				{
-					retVal = false;
+					objectIDIndex.erase(it);
 					break;
 				}
 			}
 		}
-		else
+		processDataIndexValid = false;
+	}
+
+	void DeviceDescriptorObjectPool::rebuild_object_id_index()
+	{
+		objectIDIndex.clear();
+		objectIDIndex.reserve(objectList.size());
+
+		for (const auto &currentObject : objectList)
 		{
-			retVal = false;
+			// Matches the linear search this replaces, where the first object with an ID wins
+			objectIDIndex.insert(std::make_pair(currentObject->get_object_id(), currentObject));
 		}
-		return retVal;
+	}
+
+	void DeviceDescriptorObjectPool::rebuild_process_data_index()
+	{
+		processDataIndex.clear();
+
+		for (const auto &currentObject : objectList)
+		{
+			if (task_controller_object::ObjectTypes::DeviceElement == currentObject->get_object_type())
+			{
+				auto element = std::static_pointer_cast<task_controller_object::DeviceElementObject>(currentObject);
+
+				for (std::uint16_t i = 0; i < element->get_number_child_objects(); i++)
+				{
+					auto child = get_object_by_id(element->get_child_object_id(i));
+
+					if ((nullptr != child) &&
+					    (task_controller_object::ObjectTypes::DeviceProcessData == child->get_object_type()))
+					{
+						ProcessDataIndexEntry entry;
+						entry.element = element;
+						entry.processData = std::static_pointer_cast<task_controller_object::DeviceProcessDataObject>(child);
+						processDataIndex.insert(std::make_pair(get_process_data_key(element->get_element_number(), entry.processData->get_ddi()), entry));
+					}
+				}
+			}
+		}
+		processDataIndexValid = true;
+	}
+
+	std::uint32_t DeviceDescriptorObjectPool::get_process_data_key(std::uint16_t elementNumber, std::uint16_t ddi)
+	{
+		return (static_cast<std::uint32_t>(elementNumber) << 16) | ddi;
 	}
 
 } // namespace isobus
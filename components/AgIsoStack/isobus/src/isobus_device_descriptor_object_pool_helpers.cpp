@@ -51,6 +51,8 @@ namespace isobus
 			return retVal; // Return empty object
 		}
 
+		const ChildElementMap childElements = get_child_elements(ddop);
+
 		// First, find the device object
 		for (std::uint16_t i = 0; i < ddop.size(); i++)
 		{
@@ -63,32 +65,26 @@ namespace isobus
 				bool foundFunction = false;
 				std::shared_ptr<task_controller_object::DeviceElementObject> deviceElementObject;
 
-				// Next, iterate through all elements whose parent is the device object
-				for (std::uint16_t j = 0; j < ddop.size(); j++)
+				// Next, find the first element whose parent is the device object
+				auto deviceChildren = childElements.find(deviceObject->get_object_id());
+
+				if ((childElements.end() != deviceChildren) && (!deviceChildren->second.empty()))
 				{
-					auto currentElementObject = ddop.get_object_by_index(j);
+					deviceElementObject = deviceChildren->second.front();
 
-					if ((nullptr != currentElementObject) &&
-					    (task_controller_object::ObjectTypes::DeviceElement == currentElementObject->get_object_type()) &&
-					    (std::static_pointer_cast<task_controller_object::DeviceElementObject>(currentElementObject)->get_parent_object() == deviceObject->get_object_id()))
-					{
-						deviceElementObject = std::static_pointer_cast<task_controller_object::DeviceElementObject>(currentElementObject);
+					// All the things we care about are likely in here, under the device element.
+					auto deviceElementChildren = childElements.find(deviceElementObject->get_object_id());
 
-						// All the things we care about are likely in here, under the device element.
-						for (std::uint16_t k = 0; k < ddop.size(); k++)
+					if (childElements.end() != deviceElementChildren)
+					{
+						for (const auto &potentialFunction : deviceElementChildren->second)
 						{
-							auto potentialFunction = ddop.get_object_by_index(k);
-
-							if ((nullptr != potentialFunction) &&
-							    (task_controller_object::ObjectTypes::DeviceElement == potentialFunction->get_object_type()) &&
-							    (std::static_pointer_cast<task_controller_object::DeviceElementObject>(potentialFunction)->get_parent_object() == currentElementObject->get_object_id()) &&
-							    (task_controller_object::DeviceElementObject::Type::Function == std::static_pointer_cast<task_controller_object::DeviceElementObject>(potentialFunction)->get_type()))
+							if (task_controller_object::DeviceElementObject::Type::Function == potentialFunction->get_type())
 							{
-								parse_element(ddop, std::static_pointer_cast<task_controller_object::DeviceElementObject>(potentialFunction), retVal);
+								parse_element(ddop, childElements, potentialFunction, retVal);
 								foundFunction = true;
 							}
 						}
-						break;
 					}
 				}
 
@@ -96,24 +92,24 @@ namespace isobus
 				{
 					// If we didn't find a function, the device element object is the root of the boom.
 					// So we'll reparse the device element object to get the sections and properties we care about.
-					parse_element(ddop, deviceElementObject, retVal);
+					parse_element(ddop, childElements, deviceElementObject, retVal);
 
 					// Search all elements whose parent is the device element object
 					// To look for bins as well, since we didn't find any functions.
-					for (std::uint16_t k = 0; k < ddop.size(); k++)
-					{
-						auto potentialBin = ddop.get_object_by_index(k);
+					auto deviceElementChildren = childElements.find(deviceElementObject->get_object_id());
 
-						if ((nullptr != potentialBin) &&
-						    (task_controller_object::ObjectTypes::DeviceElement == potentialBin->get_object_type()) &&
-						    (std::static_pointer_cast<task_controller_object::DeviceElementObject>(potentialBin)->get_parent_object() == deviceElementObject->get_object_id()) &&
-						    (task_controller_object::DeviceElementObject::Type::Bin == std::static_pointer_cast<task_controller_object::DeviceElementObject>(potentialBin)->get_type()))
+					if (childElements.end() != deviceElementChildren)
+					{
+						for (const auto &potentialBin : deviceElementChildren->second)
 						{
-							auto binInfo = parse_bin(ddop, std::static_pointer_cast<task_controller_object::DeviceElementObject>(potentialBin));
-
-							if (binInfo.is_valid() && !retVal.booms.empty())
+							if (task_controller_object::DeviceElementObject::Type::Bin == potentialBin->get_type())
 							{
-								retVal.booms[0].rates.push_back(binInfo);
+								auto binInfo = parse_bin(ddop, potentialBin);
+
+								if (binInfo.is_valid() && !retVal.booms.empty())
+								{
+									retVal.booms[0].rates.push_back(binInfo);
+								}
 							}
 						}
 					}
@@ -125,37 +121,50 @@ namespace isobus
 		return retVal; // If we got here, we didn't find a device object? Return empty object
 	}
 
+	DeviceDescriptorObjectPoolHelper::ChildElementMap DeviceDescriptorObjectPoolHelper::get_child_elements(DeviceDescriptorObjectPool &ddop)
+	{
+		ChildElementMap retVal;
+
+		for (std::uint16_t i = 0; i < ddop.size(); i++)
+		{
+			auto object = ddop.get_object_by_index(i);
+
+			if ((nullptr != object) &&
+			    (task_controller_object::ObjectTypes::DeviceElement == object->get_object_type()))
+			{
+				auto element = std::static_pointer_cast<task_controller_object::DeviceElementObject>(object);
+				retVal[element->get_parent_object()].push_back(element);
+			}
+		}
+		return retVal;
+	}
+
 	void DeviceDescriptorObjectPoolHelper::parse_element(DeviceDescriptorObjectPool &ddop,
+	                                                     const ChildElementMap &childElements,
 	                                                     std::shared_ptr<task_controller_object::DeviceElementObject> elementObject,
 	                                                     Implement &implementToPopulate)
 	{
 		Boom boomToPopulate;
 		boomToPopulate.elementNumber = elementObject->get_element_number();
+		auto children = childElements.find(elementObject->get_object_id());
 
-		if (task_controller_object::DeviceElementObject::Type::Function == elementObject->get_type())
+		if ((task_controller_object::DeviceElementObject::Type::Function == elementObject->get_type()) &&
+		    (childElements.end() != children))
 		{
 			// Accumulate the number of functions under this function.
-			// Need to search the whole pool because elements have parent links, not child links, which is not very efficient.
-			for (std::uint16_t i = 0; i < ddop.size(); i++)
+			for (const auto &element : children->second)
 			{
-				auto element = ddop.get_object_by_index(i);
-
-				if ((nullptr != element) &&
-				    (task_controller_object::ObjectTypes::DeviceElement == element->get_object_type()) &&
-				    (std::static_pointer_cast<task_controller_object::DeviceElementObject>(element)->get_parent_object() == elementObject->get_object_id()))
+				if (task_controller_object::DeviceElementObject::Type::Function == element->get_type())
 				{
-					if (task_controller_object::DeviceElementObject::Type::Function == std::static_pointer_cast<task_controller_object::DeviceElementObject>(element)->get_type())
-					{
-						boomToPopulate.subBooms.push_back(parse_sub_boom(ddop, std::static_pointer_cast<task_controller_object::DeviceElementObject>(element)));
-					}
-					else if (task_controller_object::DeviceElementObject::Type::Bin == std::static_pointer_cast<task_controller_object::DeviceElementObject>(element)->get_type())
-					{
-						auto binInfo = parse_bin(ddop, std::static_pointer_cast<task_controller_object::DeviceElementObject>(element));
+					boomToPopulate.subBooms.push_back(parse_sub_boom(ddop, childElements, element));
+				}
+				else if (task_controller_object::DeviceElementObject::Type::Bin == element->get_type())
+				{
+					auto binInfo = parse_bin(ddop, element);
 
-						if (binInfo.is_valid())
-						{
-							boomToPopulate.rates.push_back(binInfo);
-						}
+					if (binInfo.is_valid())
+					{
+						boomToPopulate.rates.push_back(binInfo);
 					}
 				}
 			}
@@ -164,16 +173,14 @@ namespace isobus
 		if (boomToPopulate.subBooms.empty())
 		{
 			// Find all sections in this boom
-			for (std::uint16_t i = 0; i < ddop.size(); i++)
+			if (childElements.end() != children)
 			{
-				auto section = ddop.get_object_by_index(i);
-
-				if ((nullptr != section) &&
-				    (task_controller_object::ObjectTypes::DeviceElement == section->get_object_type()) &&
-				    (task_controller_object::DeviceElementObject::Type::Section == std::static_pointer_cast<task_controller_object::DeviceElementObject>(section)->get_type()) &&
-				    (std::static_pointer_cast<task_controller_object::DeviceElementObject>(section)->get_parent_object() == elementObject->get_object_id()))
+				for (const auto &section : children->second)
 				{
-					boomToPopulate.sections.push_back(parse_section(ddop, std::static_pointer_cast<task_controller_object::DeviceElementObject>(section)));
+					if (task_controller_object::DeviceElementObject::Type::Section == section->get_type())
+					{
+						boomToPopulate.sections.push_back(parse_section(ddop, section));
+					}
 				}
 			}
 
@@ -262,23 +269,23 @@ namespace isobus
 	}
 
 	DeviceDescriptorObjectPoolHelper::SubBoom DeviceDescriptorObjectPoolHelper::parse_sub_boom(DeviceDescriptorObjectPool &ddop,
+	                                                                                           const ChildElementMap &childElements,
 	                                                                                           std::shared_ptr<task_controller_object::DeviceElementObject> elementObject)
 	{
 		SubBoom retVal;
 		retVal.elementNumber = elementObject->get_element_number();
 
 		// Find all sections in this sub boom
-		// We again have to search the whole pool because elements have parent links, not child links
-		for (std::uint16_t i = 0; i < ddop.size(); i++)
-		{
-			auto section = ddop.get_object_by_index(i);
+		auto children = childElements.find(elementObject->get_object_id());
 
-			if ((nullptr != section) &&
-			    (task_controller_object::ObjectTypes::DeviceElement == section->get_object_type()) &&
-			    (task_controller_object::DeviceElementObject::Type::Section == std::static_pointer_cast<task_controller_object::DeviceElementObject>(section)->get_type()) &&
-			    (std::static_pointer_cast<task_controller_object::DeviceElementObject>(section)->get_parent_object() == elementObject->get_object_id()))
+		if (childElements.end() != children)
+		{
+			for (const auto &section : children->second)
 			{
-				retVal.sections.push_back(parse_section(ddop, std::static_pointer_cast<task_controller_object::DeviceElementObject>(section)));
+				if (task_controller_object::DeviceElementObject::Type::Section == section->get_type())
+				{
+					retVal.sections.push_back(parse_section(ddop, section));
+				}
 			}
 		}
 
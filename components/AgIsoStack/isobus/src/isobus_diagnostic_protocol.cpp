@@ -180,7 +180,7 @@ namespace isobus
 			}
 			else
 			{
-				if ((!activeDTCList.empty()) &&
+				if ((0 != numberOfActiveDTCs) &&
 				    (SystemTiming::time_expired_ms(lastDM1SentTimestamp, DM_MAX_FREQUENCY_MS)))
 				{
 					txFlags.set_flag(static_cast<std::uint32_t>(TransmitFlags::DM1));
@@ -194,6 +194,12 @@ namespace isobus
 
 	void DiagnosticProtocol::set_j1939_mode(bool value)
 	{
+		if (value != j1939Mode)
+		{
+			// The lamp bytes depend on the mode
+			dm1PayloadDirty = true;
+			dm2PayloadDirty = true;
+		}
 		j1939Mode = value;
 	}
 
@@ -204,8 +210,13 @@ namespace isobus
 
 	void DiagnosticProtocol::clear_active_diagnostic_trouble_codes()
 	{
-		inactiveDTCList.insert(std::end(inactiveDTCList), std::begin(activeDTCList), std::end(activeDTCList));
-		activeDTCList.clear();
+		for (auto &dtc : diagnosticTroubleCodes)
+		{
+			if (dtc.active)
+			{
+				set_diagnostic_trouble_code_state(dtc, false);
+			}
+		}
 
 		if (broadcastState)
 		{
@@ -215,7 +226,13 @@ namespace isobus
 
 	void DiagnosticProtocol::clear_inactive_diagnostic_trouble_codes()
 	{
-		inactiveDTCList.clear();
+		diagnosticTroubleCodes.erase(std::remove_if(diagnosticTroubleCodes.begin(),
+		                                            diagnosticTroubleCodes.end(),
+		                                            [](const DiagnosticTroubleCode &dtc) { return !dtc.active; }),
+		                             diagnosticTroubleCodes.end());
+		numberOfInactiveDTCs = 0;
+		dm2PayloadDirty = true;
+		rebuild_diagnostic_trouble_code_indices();
 	}
 
 	void DiagnosticProtocol::clear_software_id_fields()
@@ -234,78 +251,63 @@ namespace isobus
 	bool DiagnosticProtocol::set_diagnostic_trouble_code_active(const DiagnosticTroubleCode &dtc, bool active)
 	{
 		bool retVal = false;
+		DiagnosticTroubleCode *existingDTC = find_diagnostic_trouble_code(dtc.suspectParameterNumber, static_cast<std::uint8_t>(dtc.failureModeIdentifier));
 
 		if (active)
 		{
-			// First check to see if it's already active
-			auto activeLocation = std::find(activeDTCList.begin(), activeDTCList.end(), dtc);
-
-			if (activeDTCList.end() == activeLocation)
+			if (nullptr == existingDTC)
 			{
-				// Not already active. This is valid
+				// Never seen before. This is valid
 				retVal = true;
-				auto inactiveLocation = std::find(inactiveDTCList.begin(), inactiveDTCList.end(), dtc);
-
-				if (inactiveDTCList.end() != inactiveLocation)
+				diagnosticTroubleCodeIndices[get_diagnostic_trouble_code_key(dtc.suspectParameterNumber, static_cast<std::uint8_t>(dtc.failureModeIdentifier))] = diagnosticTroubleCodes.size();
+				diagnosticTroubleCodes.push_back(dtc);
+				diagnosticTroubleCodes.back().occurrenceCount = 1;
+				diagnosticTroubleCodes.back().active = true;
+				numberOfActiveDTCs++;
+				dm1PayloadDirty = true;
+
+				if ((SystemTiming::get_time_elapsed_ms(lastDM1SentTimestamp) > DM_MAX_FREQUENCY_MS) &&
+				    broadcastState)
 				{
-					inactiveLocation->occurrenceCount++;
-					activeDTCList.push_back(*inactiveLocation);
-					inactiveDTCList.erase(inactiveLocation);
-				}
-				else
-				{
-					activeDTCList.push_back(dtc);
-					activeDTCList[activeDTCList.size() - 1].occurrenceCount = 1;
-
-					if ((SystemTiming::get_time_elapsed_ms(lastDM1SentTimestamp) > DM_MAX_FREQUENCY_MS) &&
-					    broadcastState)
-					{
-						txFlags.set_flag(static_cast<std::uint32_t>(TransmitFlags::DM1));
-						lastDM1SentTimestamp = SystemTiming::get_timestamp_ms();
-					}
+					txFlags.set_flag(static_cast<std::uint32_t>(TransmitFlags::DM1));
+					lastDM1SentTimestamp = SystemTiming::get_timestamp_ms();
 				}
 			}
-			else
+			else if (!existingDTC->active)
 			{
-				// Already active!
-				retVal = false;
+				// Previously active. This is valid
+				retVal = true;
+				existingDTC->occurrenceCount++;
+				existingDTC->lampState = dtc.lampState;
+				set_diagnostic_trouble_code_state(*existingDTC, true);
+			}
+			else if (existingDTC->lampState != dtc.lampState)
+			{
+				// Already active, but the lamp may still need to be updated
+				existingDTC->lampState = dtc.lampState;
+				dm1PayloadDirty = true;
 			}
 		}
 		else
 		{
-			/// First check to see if it's already in the inactive list
-			auto inactiveLocation = std::find(inactiveDTCList.begin(), inactiveDTCList.end(), dtc);
-
-			if (inactiveDTCList.end() == inactiveLocation)
+			// Only invalid if it's already inactive
+			if ((nullptr == existingDTC) || existingDTC->active)
 			{
 				retVal = true;
-				auto activeLocation = std::find(activeDTCList.begin(), activeDTCList.end(), dtc);
 
-				if (activeDTCList.end() != activeLocation)
+				if (nullptr != existingDTC)
 				{
-					inactiveDTCList.push_back(*activeLocation);
-					activeDTCList.erase(activeLocation);
+					set_diagnostic_trouble_code_state(*existingDTC, false);
 				}
 			}
-			else
-			{
-				// Already inactive!
-				retVal = false;
-			}
 		}
 		return retVal;
 	}
 
 	bool DiagnosticProtocol::get_diagnostic_trouble_code_active(const DiagnosticTroubleCode &dtc)
 	{
-		auto activeLocation = std::find(activeDTCList.begin(), activeDTCList.end(), dtc);
-		bool retVal = false;
-
-		if (activeDTCList.end() != activeLocation)
-		{
-			retVal = true;
-		}
-		return retVal;
+		const DiagnosticTroubleCode *existingDTC = find_diagnostic_trouble_code(dtc.suspectParameterNumber, static_cast<std::uint8_t>(dtc.failureModeIdentifier));
+		return ((nullptr != existingDTC) && existingDTC->active);
 	}
 
 	bool DiagnosticProtocol::set_product_identification_code(const std::string &value)
@@ -401,116 +403,18 @@ namespace isobus
 		return retVal;
 	}
 
-	void DiagnosticProtocol::get_active_list_lamp_state_and_flash_state(Lamps targetLamp, FlashState &flash, bool &lampOn) const
+	void DiagnosticProtocol::get_lamp_state_and_flash_state(Lamps targetLamp, bool activeCodes, FlashState &flash, bool &lampOn) const
 	{
 		flash = FlashState::Solid;
 		lampOn = false;
 
-		for (auto &dtc : activeDTCList)
+		for (auto &dtc : diagnosticTroubleCodes)
 		{
-			switch (targetLamp)
+			if (activeCodes != dtc.active)
 			{
-				case Lamps::AmberWarningLamp:
-				{
-					if (dtc.lampState == LampStatus::AmberWarningLampSolid)
-					{
-						lampOn = true;
-					}
-					else if (dtc.lampState == LampStatus::AmberWarningLampSlowFlash)
-					{
-						lampOn = true;
-						if (flash != FlashState::Fast)
-						{
-							flash = FlashState::Slow;
-						}
-					}
-					else if (dtc.lampState == LampStatus::AmberWarningLampFastFlash)
-					{
-						lampOn = true;
-						flash = FlashState::Fast;
-					}
-				}
-				break;
-
-				case Lamps::MalfunctionIndicatorLamp:
-				{
-					if (dtc.lampState == LampStatus::MalfunctionIndicatorLampSolid)
-					{
-						lampOn = true;
-					}
-					else if (dtc.lampState == LampStatus::MalfunctionIndicatorLampSlowFlash)
-					{
-						lampOn = true;
-						if (flash != FlashState::Fast)
-						{
-							flash = FlashState::Slow;
-						}
-					}
-					else if (dtc.lampState == LampStatus::MalfunctionIndicatorLampFastFlash)
-					{
-						lampOn = true;
-						flash = FlashState::Fast;
-					}
-				}
-				break;
-
-				case Lamps::ProtectLamp:
-				{
-					if (dtc.lampState == LampStatus::EngineProtectLampSolid)
-					{
-						lampOn = true;
-					}
-					else if (dtc.lampState == LampStatus::EngineProtectLampSlowFlash)
-					{
-						lampOn = true;
-						if (flash != FlashState::Fast)
-						{
-							flash = FlashState::Slow;
-						}
-					}
-					else if (dtc.lampState == LampStatus::EngineProtectLampFastFlash)
-					{
-						lampOn = true;
-						flash = FlashState::Fast;
-					}
-				}
-				break;
-
-				case Lamps::RedStopLamp:
-				{
-					if (dtc.lampState == LampStatus::RedStopLampSolid)
-					{
-						lampOn = true;
-					}
-					else if (dtc.lampState == LampStatus::RedStopLampSlowFlash)
-					{
-						lampOn = true;
-						if (flash != FlashState::Fast)
-						{
-							flash = FlashState::Slow;
-						}
-					}
-					else if (dtc.lampState == LampStatus::RedStopLampFastFlash)
-					{
-						lampOn = true;
-						flash = FlashState::Fast;
-					}
-				}
-				break;
-
-				default:
-					break;
+				continue;
 			}
-		}
-	}
 
-	void DiagnosticProtocol::get_inactive_list_lamp_state_and_flash_state(Lamps targetLamp, FlashState &flash, bool &lampOn) const
-	{
-		flash = FlashState::Solid;
-		lampOn = false;
-
-		for (auto &dtc : inactiveDTCList)
-		{
 			switch (targetLamp)
 			{
 				case Lamps::AmberWarningLamp:
@@ -623,177 +527,191 @@ namespace isobus
 		}
 	}
 
-	bool DiagnosticProtocol::send_diagnostic_message_1() const
+	void DiagnosticProtocol::build_diagnostic_message_payload(bool activeCodes, std::vector<std::uint8_t> &payload) const
 	{
-		bool retVal = false;
+		const std::size_t numberOfCodes = activeCodes ? numberOfActiveDTCs : numberOfInactiveDTCs;
+		const std::size_t payloadSize = (numberOfCodes * DM_PAYLOAD_BYTES_PER_DTC) + 2; // 2 Bytes (0 and 1) are reserved or used for lamp + flash
 
-		if (nullptr != myControlFunction)
+		payload.clear();
+
+		if (payloadSize <= MAX_PAYLOAD_SIZE_BYTES)
 		{
-			std::uint16_t payloadSize = static_cast<std::uint16_t>(activeDTCList.size() * DM_PAYLOAD_BYTES_PER_DTC) + 2; // 2 Bytes (0 and 1) are reserved
+			// Anything shorter than a frame is padded with 0xFF
+			payload.resize(payloadSize < CAN_DATA_LENGTH ? CAN_DATA_LENGTH : payloadSize, 0xFF);
 
-			if (payloadSize <= MAX_PAYLOAD_SIZE_BYTES)
+			if (get_j1939_mode())
 			{
-				std::vector<std::uint8_t> buffer;
-				buffer.resize(payloadSize < CAN_DATA_LENGTH ? CAN_DATA_LENGTH : payloadSize);
+				bool tempLampState = false;
+				FlashState tempLampFlashState = FlashState::Solid;
+				get_lamp_state_and_flash_state(Lamps::ProtectLamp, activeCodes, tempLampFlashState, tempLampState);
 
-				if (get_j1939_mode())
-				{
-					bool tempLampState = false;
-					FlashState tempLampFlashState = FlashState::Solid;
-					get_active_list_lamp_state_and_flash_state(Lamps::ProtectLamp, tempLampFlashState, tempLampState);
+				/// Encode Protect state and flash
+				payload[0] = tempLampState;
+				payload[1] = convert_flash_state_to_byte(tempLampFlashState);
 
-					/// Encode Protect state and flash
-					buffer[0] = tempLampState;
-					buffer[1] = convert_flash_state_to_byte(tempLampFlashState);
+				get_lamp_state_and_flash_state(Lamps::AmberWarningLamp, activeCodes, tempLampFlashState, tempLampState);
 
-					get_active_list_lamp_state_and_flash_state(Lamps::AmberWarningLamp, tempLampFlashState, tempLampState);
+				/// Encode amber warning lamp state and flash
+				payload[0] |= (static_cast<std::uint8_t>(tempLampState) << 2);
+				payload[1] |= (convert_flash_state_to_byte(tempLampFlashState) << 2);
 
-					/// Encode amber warning lamp state and flash
-					buffer[0] |= (static_cast<std::uint8_t>(tempLampState) << 2);
-					buffer[1] |= (convert_flash_state_to_byte(tempLampFlashState) << 2);
+				get_lamp_state_and_flash_state(Lamps::RedStopLamp, activeCodes, tempLampFlashState, tempLampState);
 
-					get_active_list_lamp_state_and_flash_state(Lamps::RedStopLamp, tempLampFlashState, tempLampState);
+				/// Encode red stop lamp state and flash
+				payload[0] |= (static_cast<std::uint8_t>(tempLampState) << 4);
+				payload[1] |= (convert_flash_state_to_byte(tempLampFlashState) << 4);
 
-					/// Encode red stop lamp state and flash
-					buffer[0] |= (static_cast<std::uint8_t>(tempLampState) << 4);
-					buffer[1] |= (convert_flash_state_to_byte(tempLampFlashState) << 4);
+				get_lamp_state_and_flash_state(Lamps::MalfunctionIndicatorLamp, activeCodes, tempLampFlashState, tempLampState);
 
-					get_active_list_lamp_state_and_flash_state(Lamps::MalfunctionIndicatorLamp, tempLampFlashState, tempLampState);
+				/// Encode malfunction indicator lamp state and flash
+				payload[0] |= (static_cast<std::uint8_t>(tempLampState) << 6);
+				payload[1] |= (convert_flash_state_to_byte(tempLampFlashState) << 6);
+			}
+			else
+			{
+				// ISO 11783 does not use lamp state or lamp flash bytes
+				payload[0] = 0xFF;
+				payload[1] = 0xFF;
+			}
 
-					/// Encode malfunction indicator lamp state and flash
-					buffer[0] |= (static_cast<std::uint8_t>(tempLampState) << 6);
-					buffer[1] |= (convert_flash_state_to_byte(tempLampFlashState) << 6);
-				}
-				else
-				{
-					// ISO 11783 does not use lamp state or lamp flash bytes
-					buffer[0] = 0xFF;
-					buffer[1] = 0xFF;
-				}
+			if (0 == numberOfCodes)
+			{
+				payload[2] = 0x00;
+				payload[3] = 0x00;
+				payload[4] = 0x00;
+				payload[5] = 0x00;
+			}
+			else
+			{
+				std::size_t i = 0;
 
-				if (activeDTCList.empty())
-				{
-					buffer[2] = 0x00;
-					buffer[3] = 0x00;
-					buffer[4] = 0x00;
-					buffer[5] = 0x00;
-					buffer[6] = 0xFF;
-					buffer[7] = 0xFF;
-					retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage1),
-					                                                        buffer.data(),
-					                                                        CAN_DATA_LENGTH,
-					                                                        myControlFunction);
-				}
-				else
+				for (const auto &dtc : diagnosticTroubleCodes)
 				{
-					for (std::size_t i = 0; i < activeDTCList.size(); i++)
-					{
-						buffer[2 + (DM_PAYLOAD_BYTES_PER_DTC * i)] = static_cast<std::uint8_t>(activeDTCList[i].suspectParameterNumber & 0xFF);
-						buffer[3 + (DM_PAYLOAD_BYTES_PER_DTC * i)] = static_cast<std::uint8_t>((activeDTCList[i].suspectParameterNumber >> 8) & 0xFF);
-						buffer[4 + (DM_PAYLOAD_BYTES_PER_DTC * i)] = (static_cast<std::uint8_t>(((activeDTCList[i].suspectParameterNumber >> 16) & 0xFF) << 5) | (static_cast<std::uint8_t>(activeDTCList[i].failureModeIdentifier) & 0x1F));
-						buffer[5 + (DM_PAYLOAD_BYTES_PER_DTC * i)] = (activeDTCList[i].occurrenceCount & 0x7F);
-					}
-
-					if (payloadSize < CAN_DATA_LENGTH)
+					if (activeCodes == dtc.active)
 					{
-						buffer[6] = 0xFF;
-						buffer[7] = 0xFF;
-						payloadSize = CAN_DATA_LENGTH;
+						payload[2 + (DM_PAYLOAD_BYTES_PER_DTC * i)] = static_cast<std::uint8_t>(dtc.suspectParameterNumber & 0xFF);
+						payload[3 + (DM_PAYLOAD_BYTES_PER_DTC * i)] = static_cast<std::uint8_t>((dtc.suspectParameterNumber >> 8) & 0xFF);
+						payload[4 + (DM_PAYLOAD_BYTES_PER_DTC * i)] = (static_cast<std::uint8_t>(((dtc.suspectParameterNumber >> 16) & 0xFF) << 5) | (static_cast<std::uint8_t>(dtc.failureModeIdentifier) & 0x1F));
+						payload[5 + (DM_PAYLOAD_BYTES_PER_DTC * i)] = (dtc.occurrenceCount & 0x7F);
+						i++;
 					}
-
-					retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage1),
-					                                                        buffer.data(),
-					                                                        payloadSize,
-					                                                        myControlFunction);
 				}
 			}
 		}
-		return retVal;
 	}
 
-	bool DiagnosticProtocol::send_diagnostic_message_2() const
+	std::uint32_t DiagnosticProtocol::get_diagnostic_trouble_code_key(std::uint32_t suspectParameterNumber, std::uint8_t failureModeIdentifier)
 	{
-		bool retVal = false;
+		return ((suspectParameterNumber & 0x7FFFF) << 5) | (failureModeIdentifier & 0x1F);
+	}
 
-		if (nullptr != myControlFunction)
+	DiagnosticProtocol::DiagnosticTroubleCode *DiagnosticProtocol::find_diagnostic_trouble_code(std::uint32_t suspectParameterNumber, std::uint8_t failureModeIdentifier)
+	{
+		DiagnosticTroubleCode *retVal = nullptr;
+		auto index = diagnosticTroubleCodeIndices.find(get_diagnostic_trouble_code_key(suspectParameterNumber, failureModeIdentifier));
+
+		if (diagnosticTroubleCodeIndices.end() != index)
 		{
-			std::uint16_t payloadSize = static_cast<std::uint8_t>(inactiveDTCList.size() * DM_PAYLOAD_BYTES_PER_DTC) + 2; // 2 Bytes (0 and 1) are reserved or used for lamp + flash
+			retVal = &diagnosticTroubleCodes[index->second];
+		}
+		return retVal;
+	}
 
-			if (payloadSize <= MAX_PAYLOAD_SIZE_BYTES)
+	void DiagnosticProtocol::set_diagnostic_trouble_code_state(DiagnosticTroubleCode &dtc, bool active)
+	{
+		if (active != dtc.active)
+		{
+			dtc.active = active;
+
+			if (active)
+			{
+				numberOfActiveDTCs++;
+				numberOfInactiveDTCs--;
+			}
+			else
 			{
-				std::vector<std::uint8_t> buffer;
-				buffer.resize(payloadSize < CAN_DATA_LENGTH ? CAN_DATA_LENGTH : payloadSize);
+				numberOfActiveDTCs--;
+				numberOfInactiveDTCs++;
+			}
+			dm1PayloadDirty = true;
+			dm2PayloadDirty = true;
+		}
+	}
 
-				if (get_j1939_mode())
-				{
-					bool tempLampState = false;
-					FlashState tempLampFlashState = FlashState::Solid;
-					get_inactive_list_lamp_state_and_flash_state(Lamps::ProtectLamp, tempLampFlashState, tempLampState);
+	void DiagnosticProtocol::remove_diagnostic_trouble_code(std::uint32_t suspectParameterNumber, std::uint8_t failureModeIdentifier)
+	{
+		auto index = diagnosticTroubleCodeIndices.find(get_diagnostic_trouble_code_key(suspectParameterNumber, failureModeIdentifier));
 
-					/// Encode Protect state and flash
-					buffer[0] = tempLampState;
-					buffer[1] = convert_flash_state_to_byte(tempLampFlashState);
+		if (diagnosticTroubleCodeIndices.end() != index)
+		{
+			auto dtc = diagnosticTroubleCodes.begin() + index->second;
 
-					get_inactive_list_lamp_state_and_flash_state(Lamps::AmberWarningLamp, tempLampFlashState, tempLampState);
+			if (dtc->active)
+			{
+				numberOfActiveDTCs--;
+				dm1PayloadDirty = true;
+			}
+			else
+			{
+				numberOfInactiveDTCs--;
+				dm2PayloadDirty = true;
+			}
+			diagnosticTroubleCodes.erase(dtc);
+			rebuild_diagnostic_trouble_code_indices();
+		}
+	}
 
-					/// Encode amber warning lamp state and flash
-					buffer[0] |= (static_cast<std::uint8_t>(tempLampState) << 2);
-					buffer[1] |= (convert_flash_state_to_byte(tempLampFlashState) << 2);
+	void DiagnosticProtocol::rebuild_diagnostic_trouble_code_indices()
+	{
+		diagnosticTroubleCodeIndices.clear();
 
-					get_inactive_list_lamp_state_and_flash_state(Lamps::RedStopLamp, tempLampFlashState, tempLampState);
+		for (std::size_t i = 0; i < diagnosticTroubleCodes.size(); i++)
+		{
+			diagnosticTroubleCodeIndices[get_diagnostic_trouble_code_key(diagnosticTroubleCodes[i].suspectParameterNumber, static_cast<std::uint8_t>(diagnosticTroubleCodes[i].failureModeIdentifier))] = i;
+		}
+	}
 
-					/// Encode red stop lamp state and flash
-					buffer[0] |= (static_cast<std::uint8_t>(tempLampState) << 4);
-					buffer[1] |= (convert_flash_state_to_byte(tempLampFlashState) << 4);
+	bool DiagnosticProtocol::send_diagnostic_message_1()
+	{
+		bool retVal = false;
 
-					get_inactive_list_lamp_state_and_flash_state(Lamps::MalfunctionIndicatorLamp, tempLampFlashState, tempLampState);
+		if (nullptr != myControlFunction)
+		{
+			if (dm1PayloadDirty)
+			{
+				build_diagnostic_message_payload(true, dm1Payload);
+				dm1PayloadDirty = false;
+			}
 
-					/// Encode malfunction indicator lamp state and flash
-					buffer[0] |= (static_cast<std::uint8_t>(tempLampState) << 6);
-					buffer[1] |= (convert_flash_state_to_byte(tempLampFlashState) << 6);
-				}
-				else
-				{
-					// ISO 11783 does not use lamp state or lamp flash bytes
-					buffer[0] = 0xFF;
-					buffer[1] = 0xFF;
-				}
+			if (!dm1Payload.empty())
+			{
+				retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage1),
+				                                                        dm1Payload.data(),
+				                                                        static_cast<std::uint32_t>(dm1Payload.size()),
+				                                                        myControlFunction);
+			}
+		}
+		return retVal;
+	}
 
-				if (inactiveDTCList.empty())
-				{
-					buffer[2] = 0x00;
-					buffer[3] = 0x00;
-					buffer[4] = 0x00;
-					buffer[5] = 0x00;
-					buffer[6] = 0xFF;
-					buffer[7] = 0xFF;
-					retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage2),
-					                                                        buffer.data(),
-					                                                        CAN_DATA_LENGTH,
-					                                                        myControlFunction);
-				}
-				else
-				{
-					for (std::size_t i = 0; i < inactiveDTCList.size(); i++)
-					{
-						buffer[2 + (DM_PAYLOAD_BYTES_PER_DTC * i)] = static_cast<std::uint8_t>(inactiveDTCList[i].suspectParameterNumber & 0xFF);
-						buffer[3 + (DM_PAYLOAD_BYTES_PER_DTC * i)] = static_cast<std::uint8_t>((inactiveDTCList[i].suspectParameterNumber >> 8) & 0xFF);
-						buffer[4 + (DM_PAYLOAD_BYTES_PER_DTC * i)] = (static_cast<std::uint8_t>(((inactiveDTCList[i].suspectParameterNumber >> 16) & 0xFF) << 5) | (static_cast<std::uint8_t>(inactiveDTCList[i].failureModeIdentifier) & 0x1F));
-						buffer[5 + (DM_PAYLOAD_BYTES_PER_DTC * i)] = (inactiveDTCList[i].occurrenceCount & 0x7F);
-					}
+	bool DiagnosticProtocol::send_diagnostic_message_2()
+	{
+		bool retVal = false;
 
-					if (payloadSize < CAN_DATA_LENGTH)
-					{
-						buffer[6] = 0xFF;
-						buffer[7] = 0xFF;
-						payloadSize = CAN_DATA_LENGTH;
-					}
+		if (nullptr != myControlFunction)
+		{
+			if (dm2PayloadDirty)
+			{
+				build_diagnostic_message_payload(false, dm2Payload);
+				dm2PayloadDirty = false;
+			}
 
-					retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage2),
-					                                                        buffer.data(),
-					                                                        payloadSize,
-					                                                        myControlFunction);
-				}
+			if (!dm2Payload.empty())
+			{
+				retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage2),
+				                                                        dm2Payload.data(),
+				                                                        static_cast<std::uint32_t>(dm2Payload.size()),
+				                                                        myControlFunction);
 			}
 		}
 		return retVal;
@@ -991,41 +909,30 @@ namespace isobus
 							{
 								tempDM22Data.clearActive = true;
 
-								for (auto dtc = activeDTCList.begin(); dtc != activeDTCList.end(); dtc++)
+								DiagnosticTroubleCode *dtc = find_diagnostic_trouble_code(tempDM22Data.suspectParameterNumber, tempDM22Data.failureModeIdentifier);
+
+								if ((nullptr != dtc) && dtc->active)
 								{
-									if ((tempDM22Data.suspectParameterNumber == dtc->suspectParameterNumber) &&
-									    (tempDM22Data.failureModeIdentifier == static_cast<std::uint8_t>(dtc->failureModeIdentifier)))
-									{
-										inactiveDTCList.push_back(*dtc);
-										activeDTCList.erase(dtc);
-										wasDTCCleared = true;
-										tempDM22Data.nack = false;
-
-										dm22ResponseQueue.push_back(tempDM22Data);
-										txFlags.set_flag(static_cast<std::uint32_t>(TransmitFlags::DM22));
-										break;
-									}
+									set_diagnostic_trouble_code_state(*dtc, false);
+									wasDTCCleared = true;
+									tempDM22Data.nack = false;
+
+									dm22ResponseQueue.push_back(tempDM22Data);
+									txFlags.set_flag(static_cast<std::uint32_t>(TransmitFlags::DM22));
 								}
 
 								if (!wasDTCCleared)
 								{
 									tempDM22Data.nack = true;
 
-									// Since we didn't find the DTC in the active list, we check the inactive to determine the proper NACK reason
-									for (const auto &dtc : inactiveDTCList)
+									if (nullptr != dtc)
 									{
-										if ((tempDM22Data.suspectParameterNumber == dtc.suspectParameterNumber) &&
-										    (tempDM22Data.failureModeIdentifier == static_cast<std::uint8_t>(dtc.failureModeIdentifier)))
-										{
-											// The DTC was active, but is inactive now, so we NACK with the proper reason
-											tempDM22Data.nackIndicator = static_cast<std::uint8_t>(DM22NegativeAcknowledgeIndicator::DTCNoLongerActive);
-											break;
-										}
+										// The DTC was active, but is inactive now, so we NACK with the proper reason
+										tempDM22Data.nackIndicator = static_cast<std::uint8_t>(DM22NegativeAcknowledgeIndicator::DTCNoLongerActive);
 									}
-
-									if (0 == tempDM22Data.nackIndicator)
+									else
 									{
-										// DTC is in neither list. NACK with the reason that we don't know anything about it
+										// We don't know anything about this DTC
 										tempDM22Data.nackIndicator = static_cast<std::uint8_t>(DM22NegativeAcknowledgeIndicator::UnknownOrDoesNotExist);
 									}
 									dm22ResponseQueue.push_back(tempDM22Data);
@@ -1036,40 +943,30 @@ namespace isobus
 
 							case static_cast<std::uint8_t>(DM22ControlByte::RequestToClearPreviouslyActiveDTC):
 							{
-								for (auto dtc = inactiveDTCList.begin(); dtc != inactiveDTCList.end(); dtc++)
+								const DiagnosticTroubleCode *dtc = find_diagnostic_trouble_code(tempDM22Data.suspectParameterNumber, tempDM22Data.failureModeIdentifier);
+
+								if ((nullptr != dtc) && (!dtc->active))
 								{
-									if ((tempDM22Data.suspectParameterNumber == dtc->suspectParameterNumber) &&
-									    (tempDM22Data.failureModeIdentifier == static_cast<std::uint8_t>(dtc->failureModeIdentifier)))
-									{
-										inactiveDTCList.erase(dtc);
-										wasDTCCleared = true;
-										tempDM22Data.nack = false;
+									remove_diagnostic_trouble_code(tempDM22Data.suspectParameterNumber, tempDM22Data.failureModeIdentifier);
+									wasDTCCleared = true;
+									tempDM22Data.nack = false;
 
-										dm22ResponseQueue.push_back(tempDM22Data);
-										txFlags.set_flag(static_cast<std::uint32_t>(TransmitFlags::DM22));
-										break;
-									}
+									dm22ResponseQueue.push_back(tempDM22Data);
+									txFlags.set_flag(static_cast<std::uint32_t>(TransmitFlags::DM22));
 								}
 
 								if (!wasDTCCleared)
 								{
 									tempDM22Data.nack = true;
 
-									// Since we didn't find the DTC in the inactive list, we check the active to determine the proper NACK reason
-									for (const auto &dtc : activeDTCList)
+									if (nullptr != dtc)
 									{
-										if ((tempDM22Data.suspectParameterNumber == dtc.suspectParameterNumber) &&
-										    (tempDM22Data.failureModeIdentifier == static_cast<std::uint8_t>(dtc.failureModeIdentifier)))
-										{
-											// The DTC was inactive, but is active now, so we NACK with the proper reason
-											tempDM22Data.nackIndicator = static_cast<std::uint8_t>(DM22NegativeAcknowledgeIndicator::DTCNoLongerPreviouslyActive);
-											break;
-										}
+										// The DTC was inactive, but is active now, so we NACK with the proper reason
+										tempDM22Data.nackIndicator = static_cast<std::uint8_t>(DM22NegativeAcknowledgeIndicator::DTCNoLongerPreviouslyActive);
 									}
-
-									if (0 == tempDM22Data.nackIndicator)
+									else
 									{
-										// DTC is in neither list. NACK with the reason that we don't know anything about it
+										// We don't know anything about this DTC
 										tempDM22Data.nackIndicator = static_cast<std::uint8_t>(DM22NegativeAcknowledgeIndicator::UnknownOrDoesNotExist);
 									}
 									dm22ResponseQueue.push_back(tempDM22Data);
@@ -51,6 +51,11 @@ namespace isobus
 		{
 			CANNetworkManager::CANNetwork.remove_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::AgriculturalGuidanceMachineInfo), process_rx_message, this);
 			CANNetworkManager::CANNetwork.remove_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::AgriculturalGuidanceSystemCommand), process_rx_message, this);
+
+			if (deadlineDrivenTransmit)
+			{
+				set_deadline_driven_transmit(false);
+			}
 		}
 	}
 
@@ -104,6 +109,16 @@ namespace isobus
 		return timestamp_ms;
 	}
 
+	void AgriculturalGuidanceInterface::GuidanceSystemCommand::set_received_timestamp_us(std::uint64_t timestamp)
+	{
+		receivedTimestamp_us = timestamp;
+	}
+
+	std::uint64_t AgriculturalGuidanceInterface::GuidanceSystemCommand::get_received_timestamp_us() const
+	{
+		return receivedTimestamp_us;
+	}
+
 	AgriculturalGuidanceInterface::GuidanceMachineInfo::GuidanceMachineInfo(std::shared_ptr<ControlFunction> sender) :
 	  controlFunction(sender)
 	{
@@ -256,6 +271,11 @@ namespace isobus
 			CANNetworkManager::CANNetwork.add_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::AgriculturalGuidanceMachineInfo), process_rx_message, this);
 			CANNetworkManager::CANNetwork.add_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::AgriculturalGuidanceSystemCommand), process_rx_message, this);
 			initialized = true;
+
+			if (deadlineDrivenTransmit)
+			{
+				start_deadline_driven_transmit();
+			}
 		}
 	}
 
@@ -264,6 +284,63 @@ namespace isobus
 		return initialized;
 	}
 
+	void AgriculturalGuidanceInterface::set_deadline_driven_transmit(bool enable)
+	{
+		if (enable != deadlineDrivenTransmit)
+		{
+			{
+				LOCK_GUARD(Mutex, transmitDataMutex);
+				deadlineDrivenTransmit = enable;
+			}
+
+			if (initialized)
+			{
+				if (enable)
+				{
+					start_deadline_driven_transmit();
+				}
+				else
+				{
+					stop_deadline_driven_transmit();
+				}
+			}
+		}
+	}
+
+	bool AgriculturalGuidanceInterface::get_deadline_driven_transmit() const
+	{
+		return deadlineDrivenTransmit;
+	}
+
+	Mutex &AgriculturalGuidanceInterface::get_transmit_data_mutex()
+	{
+		return transmitDataMutex;
+	}
+
+	AgriculturalGuidanceInterface::TransmitJitterHistogram AgriculturalGuidanceInterface::get_transmit_jitter_histogram() const
+	{
+		LOCK_GUARD(Mutex, transmitDataMutex);
+		return transmitJitterHistogram;
+	}
+
+	void AgriculturalGuidanceInterface::reset_transmit_jitter_histogram()
+	{
+		LOCK_GUARD(Mutex, transmitDataMutex);
+		transmitJitterHistogram = TransmitJitterHistogram();
+	}
+
+	std::uint32_t AgriculturalGuidanceInterface::get_transmit_jitter_histogram_bin_limit_us(std::size_t bin)
+	{
+		static const std::array<std::uint32_t, TransmitJitterHistogram::NUMBER_OF_BINS> BIN_LIMITS_US = { 100, 250, 500, 1000, 2000, 5000, 10000, std::numeric_limits<std::uint32_t>::max() };
+		std::uint32_t retVal = std::numeric_limits<std::uint32_t>::max();
+
+		if (bin < BIN_LIMITS_US.size())
+		{
+			retVal = BIN_LIMITS_US[bin];
+		}
+		return retVal;
+	}
+
 	std::size_t AgriculturalGuidanceInterface::get_number_received_guidance_system_command_sources() const
 	{
 		return receivedGuidanceSystemCommandMessages.size();
@@ -415,13 +492,30 @@ namespace isobus
 			                                                           }),
 			                                            receivedGuidanceSystemCommandMessages.end());
 
-			if (SystemTiming::time_expired_ms(guidanceMachineInfoTransmitTimestamp_ms, GUIDANCE_MESSAGE_TX_INTERVAL_MS) &&
+			bool checkDeadlines = false;
+			{
+				LOCK_GUARD(Mutex, transmitDataMutex);
+				checkDeadlines = (deadlineDrivenTransmit && (!deadlinesServicedByHardware));
+			}
+
+			// If the hardware layer doesn't service deadlines, check them here instead, which is only as punctual as update() is called
+			if (checkDeadlines)
+			{
+				process_deadline();
+			}
+
+			LOCK_GUARD(Mutex, transmitDataMutex);
+
+			// In the deadline driven mode the messages are sent by process_deadline(), only retries are left for here
+			if ((!deadlineDrivenTransmit) &&
+			    SystemTiming::time_expired_ms(guidanceMachineInfoTransmitTimestamp_ms, GUIDANCE_MESSAGE_TX_INTERVAL_MS) &&
 			    (nullptr != guidanceMachineInfoTransmitData.get_sender_control_function()))
 			{
 				txFlags.set_flag(static_cast<std::uint32_t>(TransmitFlags::SendGuidanceMachineInfo));
 				guidanceMachineInfoTransmitTimestamp_ms = SystemTiming::get_timestamp_ms();
 			}
-			if (SystemTiming::time_expired_ms(guidanceSystemCommandTransmitTimestamp_ms, GUIDANCE_MESSAGE_TX_INTERVAL_MS) &&
+			if ((!deadlineDrivenTransmit) &&
+			    SystemTiming::time_expired_ms(guidanceSystemCommandTransmitTimestamp_ms, GUIDANCE_MESSAGE_TX_INTERVAL_MS) &&
 			    (nullptr != guidanceSystemCommandTransmitData.get_sender_control_function()))
 			{
 				txFlags.set_flag(static_cast<std::uint32_t>(TransmitFlags::SendGuidanceSystemCommand));
@@ -467,6 +561,82 @@ namespace isobus
 		}
 	}
 
+	void AgriculturalGuidanceInterface::start_deadline_driven_transmit()
+	{
+		const std::uint64_t timestamp_us = SystemTiming::get_timestamp_us();
+
+		deadlineEventHandle = CANNetworkManager::CANNetwork.get_deadline_event_dispatcher().add_listener([this]() { this->process_deadline(); });
+
+		LOCK_GUARD(Mutex, transmitDataMutex);
+		guidanceSystemCommandDeadline_us = timestamp_us;
+		guidanceMachineInfoDeadline_us = timestamp_us;
+		deadlinesServicedByHardware = CANNetworkManager::CANNetwork.request_deadline_update(timestamp_us);
+	}
+
+	void AgriculturalGuidanceInterface::stop_deadline_driven_transmit()
+	{
+		CANNetworkManager::CANNetwork.get_deadline_event_dispatcher().remove_listener(deadlineEventHandle);
+	}
+
+	void AgriculturalGuidanceInterface::process_deadline()
+	{
+		LOCK_GUARD(Mutex, transmitDataMutex);
+
+		// The listener can still be called once after the mode is disabled, while it is being removed
+		if (deadlineDrivenTransmit)
+		{
+			const std::uint64_t timestamp_us = SystemTiming::get_timestamp_us();
+			std::uint64_t nextDeadline_us = std::numeric_limits<std::uint64_t>::max();
+
+			if (nullptr != guidanceMachineInfoTransmitData.get_sender_control_function())
+			{
+				process_message_deadline(TransmitFlags::SendGuidanceMachineInfo, guidanceMachineInfoDeadline_us, timestamp_us);
+				nextDeadline_us = std::min(nextDeadline_us, guidanceMachineInfoDeadline_us);
+			}
+			if (nullptr != guidanceSystemCommandTransmitData.get_sender_control_function())
+			{
+				process_message_deadline(TransmitFlags::SendGuidanceSystemCommand, guidanceSystemCommandDeadline_us, timestamp_us);
+				nextDeadline_us = std::min(nextDeadline_us, guidanceSystemCommandDeadline_us);
+			}
+
+			// Every listener is notified of any deadline, so ours has to be requested again even if nothing was due
+			if (std::numeric_limits<std::uint64_t>::max() != nextDeadline_us)
+			{
+				deadlinesServicedByHardware = CANNetworkManager::CANNetwork.request_deadline_update(nextDeadline_us);
+			}
+		}
+	}
+
+	void AgriculturalGuidanceInterface::process_message_deadline(TransmitFlags flag, std::uint64_t &deadline_us, std::uint64_t timestamp_us)
+	{
+		if (timestamp_us >= deadline_us)
+		{
+			const std::uint64_t lateness_us = timestamp_us - deadline_us;
+			const std::uint32_t clampedLateness_us = static_cast<std::uint32_t>(std::min<std::uint64_t>(lateness_us, std::numeric_limits<std::uint32_t>::max()));
+			std::size_t bin = 0;
+
+			while ((bin < (TransmitJitterHistogram::NUMBER_OF_BINS - 1)) &&
+			       (clampedLateness_us > get_transmit_jitter_histogram_bin_limit_us(bin)))
+			{
+				bin++;
+			}
+			transmitJitterHistogram.bins[bin]++;
+			transmitJitterHistogram.numberOfMessages++;
+			transmitJitterHistogram.totalLateness_us += lateness_us;
+			transmitJitterHistogram.maximumLateness_us = std::max(transmitJitterHistogram.maximumLateness_us, clampedLateness_us);
+
+			// If this fails, the flag stays set and update() retries it
+			process_flags(static_cast<std::uint32_t>(flag), this);
+
+			// Keep the schedule, unless a whole interval was missed, in which case don't try to catch up with a burst
+			deadline_us += GUIDANCE_MESSAGE_TX_INTERVAL_US;
+			if (deadline_us <= timestamp_us)
+			{
+				deadline_us = timestamp_us + GUIDANCE_MESSAGE_TX_INTERVAL_US;
+			}
+		}
+	}
+
 	void AgriculturalGuidanceInterface::process_rx_message(const CANMessage &message, void *parentPointer)
 	{
 		assert(nullptr != parentPointer);
@@ -499,6 +669,7 @@ namespace isobus
 						changed |= guidanceCommand->set_curvature((message.get_uint16_at(0) * CURVATURE_COMMAND_RESOLUTION_PER_BIT) - CURVATURE_COMMAND_OFFSET_INVERSE_KM);
 						changed |= guidanceCommand->set_status(static_cast<GuidanceSystemCommand::CurvatureCommandStatus>(message.get_uint8_at(2) & 0x03));
 						guidanceCommand->set_timestamp_ms(SystemTiming::get_timestamp_ms());
+						guidanceCommand->set_received_timestamp_us(message.get_timestamp_us());
 
 						targetInterface->guidanceSystemCommandEventPublisher.call(guidanceCommand, changed);
 					}
@@ -21,6 +21,8 @@
 #include "isobus/isobus/can_stack_logger.hpp"
 #include "isobus/utility/system_timing.hpp"
 
+#include <algorithm>
+
 namespace isobus
 {
 	HeartbeatInterface::HeartbeatInterface(const CANMessageFrameCallback &sendCANFrameCallback) :
@@ -77,6 +79,11 @@ namespace isobus
 		{
 			pgnRequestProtocol->remove_request_for_repetition_rate_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::HeartbeatMessage), process_request_for_heartbeat, this);
 		}
+
+		transmittedHeartbeats.erase(std::remove_if(transmittedHeartbeats.begin(), transmittedHeartbeats.end(), [&destroyedControlFunction](const Heartbeat &heartbeat) {
+			                            return (destroyedControlFunction == heartbeat.controlFunction);
+		                            }),
+		                            transmittedHeartbeats.end());
 	}
 
 	EventDispatcher<HeartbeatInterface::HeartBeatError, std::shared_ptr<ControlFunction>> &HeartbeatInterface::get_heartbeat_error_event_dispatcher()
@@ -89,42 +96,66 @@ namespace isobus
 		return newTrackedHeartbeatEventDispatcher;
 	}
 
+	bool HeartbeatInterface::get_heartbeat_statistics(std::shared_ptr<ControlFunction> controlFunction, HeartbeatStatistics &statistics) const
+	{
+		bool retVal = false;
+
+		if ((nullptr != controlFunction) &&
+		    (nullptr != receivedHeartbeats) &&
+		    (controlFunction->get_address() < NULL_CAN_ADDRESS) &&
+		    (controlFunction == receivedHeartbeats->at(controlFunction->get_address()).controlFunction.lock()))
+		{
+			statistics = receivedHeartbeats->at(controlFunction->get_address()).statistics;
+			retVal = true;
+		}
+		return retVal;
+	}
+
+	std::size_t HeartbeatInterface::get_number_of_tracked_heartbeats() const
+	{
+		return numberOfTrackedHeartbeats;
+	}
+
 	void HeartbeatInterface::update()
 	{
 		if (enabled)
 		{
-			trackedHeartbeats.erase(std::remove_if(trackedHeartbeats.begin(), trackedHeartbeats.end(), [this](Heartbeat &heartbeat) {
-				                        bool retVal = false;
-
-				                        if (nullptr != heartbeat.controlFunction)
-				                        {
-					                        if (ControlFunction::Type::Internal == heartbeat.controlFunction->get_type())
-					                        {
-						                        if ((SystemTiming::time_expired_ms(heartbeat.timestamp_ms, heartbeat.repetitionRate_ms)) &&
-						                            heartbeat.send(*this))
-						                        {
-							                        heartbeat.sequenceCounter++;
-
-							                        if (heartbeat.sequenceCounter > 250)
-							                        {
-								                        heartbeat.sequenceCounter = 0;
-							                        }
-						                        }
-					                        }
-					                        else if (SystemTiming::time_expired_ms(heartbeat.timestamp_ms, SEQUENCE_TIMEOUT_MS))
-					                        {
-						                        retVal = true; // External heartbeat is timed-out
-						                        LOG_ERROR("[HB]: Heartbeat from control function at address 0x%02X timed out.", heartbeat.controlFunction->get_address());
-						                        heartbeatErrorEventDispatcher.call(HeartBeatError::TimedOut, heartbeat.controlFunction);
-					                        }
-				                        }
-				                        else
-				                        {
-					                        retVal = true; // Invalid state
-				                        }
-				                        return retVal;
-			                        }),
-			                        trackedHeartbeats.end());
+			transmittedHeartbeats.erase(std::remove_if(transmittedHeartbeats.begin(), transmittedHeartbeats.end(), [](const Heartbeat &heartbeat) {
+				                            return (nullptr == heartbeat.controlFunction); // Invalid state
+			                            }),
+			                            transmittedHeartbeats.end());
+
+			for (auto &heartbeat : transmittedHeartbeats)
+			{
+				if ((SystemTiming::time_expired_ms(heartbeat.timestamp_ms, heartbeat.repetitionRate_ms)) &&
+				    heartbeat.send(*this))
+				{
+					heartbeat.sequenceCounter++;
+
+					if (heartbeat.sequenceCounter > 250)
+					{
+						heartbeat.sequenceCounter = 0;
+					}
+				}
+			}
+
+			// The timeout list is ordered by when each heartbeat was last received, so only the oldest ones need to be checked
+			while ((NULL_CAN_ADDRESS != oldestReceivedHeartbeatAddress) &&
+			       (SystemTiming::time_expired_ms(receivedHeartbeats->at(oldestReceivedHeartbeatAddress).timestamp_ms, SEQUENCE_TIMEOUT_MS)))
+			{
+				const std::uint8_t address = oldestReceivedHeartbeatAddress;
+				auto &heartbeat = receivedHeartbeats->at(address);
+				auto controlFunction = heartbeat.controlFunction.lock();
+
+				unlink_received_heartbeat(address);
+				heartbeat.statistics.numberOfTimeouts++;
+				LOG_ERROR("[HB]: Heartbeat from control function at address 0x%02X timed out.", address);
+
+				if (nullptr != controlFunction)
+				{
+					heartbeatErrorEventDispatcher.call(HeartBeatError::TimedOut, controlFunction);
+				}
+			}
 		}
 	}
 
@@ -156,45 +187,145 @@ namespace isobus
 		if (enabled &&
 		    (static_cast<std::uint32_t>(CANLibParameterGroupNumber::HeartbeatMessage) == message.get_identifier().get_parameter_group_number()) &&
 		    (nullptr != message.get_source_control_function()) &&
+		    (message.get_source_control_function()->get_address() < NULL_CAN_ADDRESS) &&
 		    (message.get_data_length() >= 1))
 		{
-			auto managedHeartbeat = std::find_if(trackedHeartbeats.begin(),
-			                                     trackedHeartbeats.end(),
-			                                     [&message](const Heartbeat &hb) {
-				                                     return (message.get_source_control_function() == hb.controlFunction);
-			                                     });
+			const auto sourceControlFunction = message.get_source_control_function();
+			const std::uint8_t address = sourceControlFunction->get_address();
+			const std::uint8_t sequenceCounter = message.get_uint8_at(0);
+			const std::uint32_t timestamp_ms = SystemTiming::get_timestamp_ms();
 
-			if (managedHeartbeat != trackedHeartbeats.end())
+			if (nullptr == receivedHeartbeats)
 			{
-				managedHeartbeat->timestamp_ms = SystemTiming::get_timestamp_ms();
+				receivedHeartbeats.reset(new std::array<ReceivedHeartbeat, NULL_CAN_ADDRESS>());
+			}
+			auto &heartbeat = receivedHeartbeats->at(address);
+			bool newlyTracked = false;
 
-				if (message.get_uint8_at(0) == managedHeartbeat->sequenceCounter)
+			if (sourceControlFunction != heartbeat.controlFunction.lock())
+			{
+				// A different control function now has this address, so start over
+				if (heartbeat.tracked)
 				{
-					LOG_ERROR("[HB]: Duplicate sequence counter received in heartbeat.");
-					heartbeatErrorEventDispatcher.call(HeartBeatError::InvalidSequenceCounter, message.get_source_control_function());
+					unlink_received_heartbeat(address);
 				}
-				else if (message.get_uint8_at(0) != ((managedHeartbeat->sequenceCounter + 1) % 250))
+				heartbeat = ReceivedHeartbeat();
+				heartbeat.controlFunction = sourceControlFunction;
+			}
+
+			if (heartbeat.tracked)
+			{
+				if (!validate_sequence_counter(heartbeat, sequenceCounter))
 				{
-					LOG_ERROR("[HB]: Invalid sequence counter received in heartbeat.");
-					heartbeatErrorEventDispatcher.call(HeartBeatError::InvalidSequenceCounter, message.get_source_control_function());
+					heartbeatErrorEventDispatcher.call(HeartBeatError::InvalidSequenceCounter, sourceControlFunction);
 				}
-				trackedHeartbeats.back().sequenceCounter = message.get_uint8_at(0);
+				unlink_received_heartbeat(address); // Will be re-linked as the newest one
 			}
 			else
 			{
-				LOG_DEBUG("[HB]: Tracking new heartbeat from control function at address 0x%02X.", message.get_source_control_function()->get_address());
+				LOG_DEBUG("[HB]: Tracking new heartbeat from control function at address 0x%02X.", address);
 
-				if (message.get_uint8_at(0) != static_cast<std::uint8_t>(HeartbeatInterface::SequenceCounterSpecialValue::Initial))
+				if (sequenceCounter != static_cast<std::uint8_t>(HeartbeatInterface::SequenceCounterSpecialValue::Initial))
 				{
-					LOG_WARNING("[HB]: Initial heartbeat sequence counter not received from control function at address 0x%02X.", message.get_source_control_function()->get_address());
+					LOG_WARNING("[HB]: Initial heartbeat sequence counter not received from control function at address 0x%02X.", address);
 				}
+				newlyTracked = true;
+			}
 
-				trackedHeartbeats.emplace_back(message.get_source_control_function());
-				trackedHeartbeats.back().timestamp_ms = SystemTiming::get_timestamp_ms();
-				trackedHeartbeats.back().sequenceCounter = message.get_uint8_at(0);
-				newTrackedHeartbeatEventDispatcher.call(message.get_source_control_function());
+			if (0 != heartbeat.statistics.numberOfHeartbeatsReceived)
+			{
+				heartbeat.statistics.lastGap_ms = timestamp_ms - heartbeat.timestamp_ms;
+
+				if (heartbeat.statistics.lastGap_ms > heartbeat.statistics.maximumGap_ms)
+				{
+					heartbeat.statistics.maximumGap_ms = heartbeat.statistics.lastGap_ms;
+				}
 			}
+			heartbeat.statistics.numberOfHeartbeatsReceived++;
+			heartbeat.timestamp_ms = timestamp_ms;
+			heartbeat.sequenceCounter = sequenceCounter;
+			link_received_heartbeat(address);
+
+			if (newlyTracked)
+			{
+				newTrackedHeartbeatEventDispatcher.call(sourceControlFunction);
+			}
+		}
+	}
+
+	void HeartbeatInterface::link_received_heartbeat(std::uint8_t address)
+	{
+		auto &heartbeat = receivedHeartbeats->at(address);
+
+		heartbeat.previousAddress = newestReceivedHeartbeatAddress;
+		heartbeat.nextAddress = NULL_CAN_ADDRESS;
+		heartbeat.tracked = true;
+
+		if (NULL_CAN_ADDRESS != newestReceivedHeartbeatAddress)
+		{
+			receivedHeartbeats->at(newestReceivedHeartbeatAddress).nextAddress = address;
+		}
+		else
+		{
+			oldestReceivedHeartbeatAddress = address;
+		}
+		newestReceivedHeartbeatAddress = address;
+		numberOfTrackedHeartbeats++;
+	}
+
+	void HeartbeatInterface::unlink_received_heartbeat(std::uint8_t address)
+	{
+		auto &heartbeat = receivedHeartbeats->at(address);
+
+		if (NULL_CAN_ADDRESS != heartbeat.previousAddress)
+		{
+			receivedHeartbeats->at(heartbeat.previousAddress).nextAddress = heartbeat.nextAddress;
+		}
+		else
+		{
+			oldestReceivedHeartbeatAddress = heartbeat.nextAddress;
+		}
+
+		if (NULL_CAN_ADDRESS != heartbeat.nextAddress)
+		{
+			receivedHeartbeats->at(heartbeat.nextAddress).previousAddress = heartbeat.previousAddress;
+		}
+		else
+		{
+			newestReceivedHeartbeatAddress = heartbeat.previousAddress;
+		}
+		heartbeat.previousAddress = NULL_CAN_ADDRESS;
+		heartbeat.nextAddress = NULL_CAN_ADDRESS;
+		heartbeat.tracked = false;
+		numberOfTrackedHeartbeats--;
+	}
+
+	bool HeartbeatInterface::validate_sequence_counter(ReceivedHeartbeat &heartbeat, std::uint8_t sequenceCounter)
+	{
+		constexpr std::uint8_t MAXIMUM_SEQUENCE_COUNTER = 250;
+		bool retVal = true;
+		// After the initial value, or an error, the count starts over from 0
+		const std::uint8_t expectedSequenceCounter = (heartbeat.sequenceCounter < MAXIMUM_SEQUENCE_COUNTER) ? (heartbeat.sequenceCounter + 1) : 0;
+
+		if (sequenceCounter == heartbeat.sequenceCounter)
+		{
+			LOG_ERROR("[HB]: Duplicate sequence counter received in heartbeat.");
+			heartbeat.statistics.numberOfInvalidSequences++;
+			retVal = false;
 		}
+		else if (sequenceCounter != expectedSequenceCounter)
+		{
+			LOG_ERROR("[HB]: Invalid sequence counter received in heartbeat.");
+			heartbeat.statistics.numberOfInvalidSequences++;
+
+			if (sequenceCounter <= MAXIMUM_SEQUENCE_COUNTER)
+			{
+				// The counter skipped ahead, so count the heartbeats in between as missed
+				heartbeat.statistics.numberOfMissedSequences += ((sequenceCounter + MAXIMUM_SEQUENCE_COUNTER + 1 - expectedSequenceCounter) % (MAXIMUM_SEQUENCE_COUNTER + 1));
+			}
+			retVal = false;
+		}
+		return retVal;
 	}
 
 	bool HeartbeatInterface::process_request_for_heartbeat(std::uint32_t parameterGroupNumber,
@@ -223,15 +354,15 @@ namespace isobus
 					LOG_DEBUG("[HB]: Control function at address 0x%02X requested the ISOBUS heartbeat from control function at address 0x%02X.", requestingControlFunction->get_address(), targetControlFunction->get_address());
 				}
 
-				auto managedHeartbeat = std::find_if(interface->trackedHeartbeats.begin(),
-				                                     interface->trackedHeartbeats.end(),
+				auto managedHeartbeat = std::find_if(interface->transmittedHeartbeats.begin(),
+				                                     interface->transmittedHeartbeats.end(),
 				                                     [targetControlFunction](const Heartbeat &hb) {
 					                                     return (targetControlFunction == hb.controlFunction);
 				                                     });
 
-				if (managedHeartbeat == interface->trackedHeartbeats.end())
+				if (managedHeartbeat == interface->transmittedHeartbeats.end())
 				{
-					interface->trackedHeartbeats.emplace_back(targetControlFunction); // Heartbeat will be sent on next update
+					interface->transmittedHeartbeats.emplace_back(targetControlFunction); // Heartbeat will be sent on next update
 				}
 			}
 		}
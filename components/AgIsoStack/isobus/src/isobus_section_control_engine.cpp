@@ -0,0 +1,492 @@
+//================================================================================================
+/// @file isobus_section_control_engine.cpp
+///
+/// @brief Implements an automatic section control engine for task controller servers.
+/// @author The Little Dawn Developers
+///
+/// @copyright 2026 The Little Dawn Developers
+//================================================================================================
+#include "isobus/isobus/isobus_section_control_engine.hpp"
+
+#include "isobus/isobus/can_stack_logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace isobus
+{
+	SectionControlEngine::SectionControlEngine(std::uint32_t cellSize_mm) :
+	  cellSize_m(static_cast<double>(std::max<std::uint32_t>(cellSize_mm, 1)) / 1000.0)
+	{
+	}
+
+	bool SectionControlEngine::set_implement(const DeviceDescriptorObjectPoolHelper::Implement &implement)
+	{
+		bool retVal = false;
+
+		sectionGroups.clear();
+		sectionXOffsets_m.clear();
+		sectionYOffsets_m.clear();
+		sectionHalfWidths_m.clear();
+		sectionElementNumbers.clear();
+
+		auto add_group = [this, &retVal](std::uint16_t elementNumber,
+		                                 const std::vector<DeviceDescriptorObjectPoolHelper::Section> &sections,
+		                                 const DeviceDescriptorObjectPoolHelper::ObjectPoolValue &parentXOffset_mm,
+		                                 const DeviceDescriptorObjectPoolHelper::ObjectPoolValue &parentYOffset_mm) {
+			if (!sections.empty())
+			{
+				SectionGroup group;
+				group.elementNumber = elementNumber;
+				group.firstSection = sectionElementNumbers.size();
+				group.numberOfSections = std::min(sections.size(), MAX_SECTIONS_PER_ELEMENT);
+
+				if (sections.size() > MAX_SECTIONS_PER_ELEMENT)
+				{
+					LOG_WARNING("[SC]: Element %u has more than %u sections, extra sections will not be controlled.", elementNumber, static_cast<unsigned int>(MAX_SECTIONS_PER_ELEMENT));
+				}
+
+				for (std::size_t i = 0; i < group.numberOfSections; i++)
+				{
+					const auto &section = sections.at(i);
+
+					// Section offsets are relative to the DRP, but a section without its own offset sits where its parent does
+					std::int32_t xOffset_mm = section.xOffset_mm ? section.xOffset_mm.get() : parentXOffset_mm.get();
+					std::int32_t yOffset_mm = section.yOffset_mm ? section.yOffset_mm.get() : parentYOffset_mm.get();
+					std::int32_t width_mm = section.width_mm ? std::max(section.width_mm.get(), 0) : 0;
+
+					sectionXOffsets_m.push_back(static_cast<float>(xOffset_mm) / 1000.0f);
+					sectionYOffsets_m.push_back(static_cast<float>(yOffset_mm) / 1000.0f);
+					sectionHalfWidths_m.push_back(static_cast<float>(width_mm) / 2000.0f);
+					sectionElementNumbers.push_back(section.elementNumber);
+
+					if (0 != width_mm)
+					{
+						retVal = true;
+					}
+				}
+				sectionGroups.push_back(group);
+			}
+		};
+
+		for (const auto &boom : implement.booms)
+		{
+			add_group(boom.elementNumber, boom.sections, boom.xOffset_mm, boom.yOffset_mm);
+
+			for (const auto &subBoom : boom.subBooms)
+			{
+				add_group(subBoom.elementNumber, subBoom.sections, subBoom.xOffset_mm, subBoom.yOffset_mm);
+			}
+		}
+
+		const std::size_t numberOfSections = sectionElementNumbers.size();
+		sectionLeftEast_m.assign(numberOfSections, 0.0);
+		sectionLeftNorth_m.assign(numberOfSections, 0.0);
+		sectionRightEast_m.assign(numberOfSections, 0.0);
+		sectionRightNorth_m.assign(numberOfSections, 0.0);
+		previousLeftEast_m.assign(numberOfSections, 0.0);
+		previousLeftNorth_m.assign(numberOfSections, 0.0);
+		previousRightEast_m.assign(numberOfSections, 0.0);
+		previousRightNorth_m.assign(numberOfSections, 0.0);
+		sectionOverlaps.assign(numberOfSections, 0);
+		sectionSetpoints.assign(numberOfSections, false);
+		sectionActualStates.assign(numberOfSections, false);
+		actualStatesReported = false;
+		hasPreviousPosition = false;
+
+		if (!retVal)
+		{
+			LOG_WARNING("[SC]: Implement has no sections with a width, section control will not do anything.");
+		}
+		return retVal;
+	}
+
+	std::size_t SectionControlEngine::get_number_sections() const
+	{
+		return sectionElementNumbers.size();
+	}
+
+	void SectionControlEngine::set_turn_on_latency(std::uint32_t latency_ms)
+	{
+		turnOnLatency_ms = latency_ms;
+	}
+
+	std::uint32_t SectionControlEngine::get_turn_on_latency() const
+	{
+		return turnOnLatency_ms;
+	}
+
+	void SectionControlEngine::set_turn_off_latency(std::uint32_t latency_ms)
+	{
+		turnOffLatency_ms = latency_ms;
+	}
+
+	std::uint32_t SectionControlEngine::get_turn_off_latency() const
+	{
+		return turnOffLatency_ms;
+	}
+
+	void SectionControlEngine::set_overlap_tolerance(std::uint8_t tolerance_percent)
+	{
+		overlapTolerance_percent = std::min<std::uint8_t>(tolerance_percent, 100);
+	}
+
+	std::uint8_t SectionControlEngine::get_overlap_tolerance() const
+	{
+		return overlapTolerance_percent;
+	}
+
+	void SectionControlEngine::set_minimum_speed(std::uint32_t speed_mm_per_s)
+	{
+		minimumSpeed_mm_per_s = speed_mm_per_s;
+	}
+
+	void SectionControlEngine::set_enabled(bool enable)
+	{
+		enabled = enable;
+	}
+
+	bool SectionControlEngine::get_enabled() const
+	{
+		return enabled;
+	}
+
+	void SectionControlEngine::set_section_actual_work_state(std::size_t sectionIndex, bool isOn)
+	{
+		if (sectionIndex < sectionActualStates.size())
+		{
+			sectionActualStates[sectionIndex] = isOn;
+			actualStatesReported = true;
+		}
+	}
+
+	void SectionControlEngine::set_actual_condensed_work_state(std::uint16_t elementNumber, std::uint16_t dataDescriptionIndex, std::uint32_t value)
+	{
+		constexpr std::uint16_t FIRST_DDI = static_cast<std::uint16_t>(DataDescriptionIndex::ActualCondensedWorkState1_16);
+		constexpr std::uint16_t LAST_DDI = FIRST_DDI + 15;
+
+		if ((dataDescriptionIndex >= FIRST_DDI) && (dataDescriptionIndex <= LAST_DDI))
+		{
+			const std::size_t firstSectionInValue = static_cast<std::size_t>(dataDescriptionIndex - FIRST_DDI) * 16;
+
+			for (const auto &group : sectionGroups)
+			{
+				if (group.elementNumber == elementNumber)
+				{
+					for (std::size_t i = 0; (i < 16) && ((firstSectionInValue + i) < group.numberOfSections); i++)
+					{
+						std::uint32_t state = (value >> (2 * i)) & 0x03;
+
+						// Only 0 (off) and 1 (on) are states, the rest are error and not installed
+						if (state <= 1)
+						{
+							sectionActualStates[group.firstSection + firstSectionInValue + i] = (1 == state);
+							actualStatesReported = true;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	void SectionControlEngine::update(double east_m, double north_m, float heading_deg, std::uint32_t speed_mm_per_s)
+	{
+		const std::size_t numberOfSections = sectionElementNumbers.size();
+		const double heading_rad = static_cast<double>(heading_deg) * (3.14159265358979323846 / 180.0);
+		const double sinHeading = std::sin(heading_rad);
+		const double cosHeading = std::cos(heading_rad);
+
+		sectionLeftEast_m.swap(previousLeftEast_m);
+		sectionLeftNorth_m.swap(previousLeftNorth_m);
+		sectionRightEast_m.swap(previousRightEast_m);
+		sectionRightNorth_m.swap(previousRightNorth_m);
+
+		// Forwards is (sin, cos) and right is (cos, -sin) in east/north.
+		// These loops have no branches or lookups, so they vectorize well for implements with many sections.
+		const float *xOffsets = sectionXOffsets_m.data();
+		const float *yOffsets = sectionYOffsets_m.data();
+		const float *halfWidths = sectionHalfWidths_m.data();
+		double *leftEast = sectionLeftEast_m.data();
+		double *leftNorth = sectionLeftNorth_m.data();
+		double *rightEast = sectionRightEast_m.data();
+		double *rightNorth = sectionRightNorth_m.data();
+
+		for (std::size_t i = 0; i < numberOfSections; i++)
+		{
+			const double centreEast = east_m + (xOffsets[i] * sinHeading) + (yOffsets[i] * cosHeading);
+			const double centreNorth = north_m + (xOffsets[i] * cosHeading) - (yOffsets[i] * sinHeading);
+			leftEast[i] = centreEast - (halfWidths[i] * cosHeading);
+			leftNorth[i] = centreNorth + (halfWidths[i] * sinHeading);
+			rightEast[i] = centreEast + (halfWidths[i] * cosHeading);
+			rightNorth[i] = centreNorth - (halfWidths[i] * sinHeading);
+		}
+
+		if (hasPreviousPosition)
+		{
+			const std::vector<bool> &paintedStates = actualStatesReported ? sectionActualStates : sectionSetpoints;
+
+			for (std::size_t i = 0; i < numberOfSections; i++)
+			{
+				if (paintedStates[i])
+				{
+					paint_section(i);
+				}
+			}
+		}
+		hasPreviousPosition = (0 != numberOfSections);
+
+		const std::vector<bool> previousSetpoints = sectionSetpoints;
+
+		if ((!enabled) || (speed_mm_per_s < minimumSpeed_mm_per_s))
+		{
+			std::fill(sectionSetpoints.begin(), sectionSetpoints.end(), false);
+		}
+		else
+		{
+			// Look at least this far ahead so that sections don't see the ground they just covered themselves
+			const double minimumLookAhead_m = MIN_LOOK_AHEAD_CELLS * cellSize_m;
+			const double turnOnLookAhead_m = std::max(minimumLookAhead_m, (static_cast<double>(speed_mm_per_s) * turnOnLatency_ms) / 1000000.0);
+			const double turnOffLookAhead_m = std::max(minimumLookAhead_m, (static_cast<double>(speed_mm_per_s) * turnOffLatency_ms) / 1000000.0);
+
+			for (std::size_t i = 0; i < numberOfSections; i++)
+			{
+				// A section that is on will turn off after the off latency, and one that is off will turn on after the on latency
+				const double lookAhead_m = sectionSetpoints[i] ? turnOffLookAhead_m : turnOnLookAhead_m;
+				const float coveredFraction = get_covered_fraction(i, lookAhead_m * sinHeading, lookAhead_m * cosHeading);
+
+				sectionOverlaps[i] = static_cast<std::uint8_t>(std::lround(coveredFraction * 100.0f));
+				sectionSetpoints[i] = (sectionOverlaps[i] <= overlapTolerance_percent) && (0.0f != sectionHalfWidths_m[i]);
+			}
+		}
+		publish_setpoint_changes(previousSetpoints);
+	}
+
+	bool SectionControlEngine::get_section_setpoint_work_state(std::size_t sectionIndex) const
+	{
+		bool retVal = false;
+
+		if (sectionIndex < sectionSetpoints.size())
+		{
+			retVal = sectionSetpoints[sectionIndex];
+		}
+		return retVal;
+	}
+
+	std::uint8_t SectionControlEngine::get_section_overlap(std::size_t sectionIndex) const
+	{
+		std::uint8_t retVal = 0;
+
+		if (sectionIndex < sectionOverlaps.size())
+		{
+			retVal = sectionOverlaps[sectionIndex];
+		}
+		return retVal;
+	}
+
+	std::uint16_t SectionControlEngine::get_section_element_number(std::size_t sectionIndex) const
+	{
+		std::uint16_t retVal = NULL_OBJECT_ID;
+
+		if (sectionIndex < sectionElementNumbers.size())
+		{
+			retVal = sectionElementNumbers[sectionIndex];
+		}
+		return retVal;
+	}
+
+	bool SectionControlEngine::get_setpoint_condensed_work_state(std::uint16_t elementNumber, std::uint16_t dataDescriptionIndex, std::uint32_t &value) const
+	{
+		constexpr std::uint16_t FIRST_DDI = static_cast<std::uint16_t>(DataDescriptionIndex::SetpointCondensedWorkState1_16);
+		bool retVal = false;
+
+		if (dataDescriptionIndex >= FIRST_DDI)
+		{
+			const std::size_t firstSectionInValue = static_cast<std::size_t>(dataDescriptionIndex - FIRST_DDI) * 16;
+
+			for (const auto &group : sectionGroups)
+			{
+				if ((group.elementNumber == elementNumber) && (firstSectionInValue < group.numberOfSections))
+				{
+					value = get_condensed_work_state(sectionSetpoints,
+					                                 group.firstSection + firstSectionInValue,
+					                                 std::min<std::size_t>(16, group.numberOfSections - firstSectionInValue));
+					retVal = true;
+					break;
+				}
+			}
+		}
+		return retVal;
+	}
+
+	EventDispatcher<std::uint16_t, std::uint16_t, std::uint32_t> &SectionControlEngine::get_setpoint_event_dispatcher()
+	{
+		return setpointEventDispatcher;
+	}
+
+	bool SectionControlEngine::is_covered(double east_m, double north_m) const
+	{
+		return is_cell_covered(get_cell_index(east_m), get_cell_index(north_m));
+	}
+
+	double SectionControlEngine::get_covered_area() const
+	{
+		return static_cast<double>(numberOfCoveredCells) * cellSize_m * cellSize_m;
+	}
+
+	void SectionControlEngine::clear_coverage()
+	{
+		coverage.clear();
+		cachedTile = nullptr;
+		numberOfCoveredCells = 0;
+	}
+
+	std::uint64_t SectionControlEngine::get_tile_key(std::int32_t cellEast, std::int32_t cellNorth)
+	{
+		// Round towards negative infinity so that tiles don't straddle the origin
+		std::int32_t tileEast = (cellEast < 0) ? (((cellEast + 1) / TILE_SIZE) - 1) : (cellEast / TILE_SIZE);
+		std::int32_t tileNorth = (cellNorth < 0) ? (((cellNorth + 1) / TILE_SIZE) - 1) : (cellNorth / TILE_SIZE);
+		return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(tileEast)) << 32) | static_cast<std::uint32_t>(tileNorth);
+	}
+
+	std::int32_t SectionControlEngine::get_cell_index(double position_m) const
+	{
+		return static_cast<std::int32_t>(std::floor(position_m / cellSize_m));
+	}
+
+	bool SectionControlEngine::is_cell_covered(std::int32_t cellEast, std::int32_t cellNorth) const
+	{
+		bool retVal = false;
+		auto tile = coverage.find(get_tile_key(cellEast, cellNorth));
+
+		if (coverage.end() != tile)
+		{
+			// The tile origin is a multiple of the tile size, so the low bits are the cell's position in the tile
+			std::uint32_t row = static_cast<std::uint32_t>(cellNorth) & (TILE_SIZE - 1);
+			std::uint32_t column = static_cast<std::uint32_t>(cellEast) & (TILE_SIZE - 1);
+			retVal = (0 != (tile->second[row] & (static_cast<std::uint64_t>(1) << column)));
+		}
+		return retVal;
+	}
+
+	void SectionControlEngine::cover_cell(std::int32_t cellEast, std::int32_t cellNorth)
+	{
+		std::uint64_t key = get_tile_key(cellEast, cellNorth);
+
+		// Painting mostly stays in one tile, so this saves most of the hash lookups.
+		// Pointers to map elements stay valid when the map rehashes.
+		if ((nullptr == cachedTile) || (key != cachedTileKey))
+		{
+			auto tile = coverage.find(key);
+
+			if (coverage.end() == tile)
+			{
+				CoverageTile emptyTile;
+				emptyTile.fill(0);
+				tile = coverage.emplace(key, emptyTile).first;
+			}
+			cachedTile = &tile->second;
+			cachedTileKey = key;
+		}
+
+		std::uint32_t row = static_cast<std::uint32_t>(cellNorth) & (TILE_SIZE - 1);
+		std::uint64_t mask = static_cast<std::uint64_t>(1) << (static_cast<std::uint32_t>(cellEast) & (TILE_SIZE - 1));
+
+		if (0 == ((*cachedTile)[row] & mask))
+		{
+			(*cachedTile)[row] |= mask;
+			numberOfCoveredCells++;
+		}
+	}
+
+	void SectionControlEngine::paint_section(std::size_t sectionIndex)
+	{
+		const double leftDeltaEast = sectionLeftEast_m[sectionIndex] - previousLeftEast_m[sectionIndex];
+		const double leftDeltaNorth = sectionLeftNorth_m[sectionIndex] - previousLeftNorth_m[sectionIndex];
+		const double rightDeltaEast = sectionRightEast_m[sectionIndex] - previousRightEast_m[sectionIndex];
+		const double rightDeltaNorth = sectionRightNorth_m[sectionIndex] - previousRightNorth_m[sectionIndex];
+		const double distance_m = std::max(std::sqrt((leftDeltaEast * leftDeltaEast) + (leftDeltaNorth * leftDeltaNorth)),
+		                                   std::sqrt((rightDeltaEast * rightDeltaEast) + (rightDeltaNorth * rightDeltaNorth)));
+
+		if (distance_m <= MAX_PAINT_DISTANCE_M)
+		{
+			// Sample at half a cell so every cell the swath passes over is hit, but keep half a cell in from the
+			// ends of the section so that neighbouring sections don't mark each other's edge cells
+			const double width_m = 2.0 * sectionHalfWidths_m[sectionIndex];
+			const double sampleSpacing_m = cellSize_m / 2.0;
+			const std::uint32_t alongSteps = std::max<std::uint32_t>(1, static_cast<std::uint32_t>(std::ceil(distance_m / sampleSpacing_m)));
+			const double inset = (width_m > cellSize_m) ? (sampleSpacing_m / width_m) : 0.5;
+			const std::uint32_t acrossSteps = (width_m > cellSize_m) ? static_cast<std::uint32_t>(std::ceil((width_m - cellSize_m) / sampleSpacing_m)) : 0;
+
+			for (std::uint32_t i = 0; i <= alongSteps; i++)
+			{
+				const double along = static_cast<double>(i) / alongSteps;
+				const double startEast = previousLeftEast_m[sectionIndex] + (leftDeltaEast * along);
+				const double startNorth = previousLeftNorth_m[sectionIndex] + (leftDeltaNorth * along);
+				const double endEast = previousRightEast_m[sectionIndex] + (rightDeltaEast * along);
+				const double endNorth = previousRightNorth_m[sectionIndex] + (rightDeltaNorth * along);
+
+				for (std::uint32_t j = 0; j <= acrossSteps; j++)
+				{
+					const double across = (0 == acrossSteps) ? 0.5 : (inset + ((1.0 - (2.0 * inset)) * j) / acrossSteps);
+					cover_cell(get_cell_index(startEast + ((endEast - startEast) * across)),
+					           get_cell_index(startNorth + ((endNorth - startNorth) * across)));
+				}
+			}
+		}
+	}
+
+	float SectionControlEngine::get_covered_fraction(std::size_t sectionIndex, double shiftEast_m, double shiftNorth_m) const
+	{
+		const double width_m = 2.0 * sectionHalfWidths_m[sectionIndex];
+		const std::uint32_t numberOfSamples = std::max<std::uint32_t>(1, static_cast<std::uint32_t>(std::lround(width_m / cellSize_m)));
+		const double startEast = sectionLeftEast_m[sectionIndex] + shiftEast_m;
+		const double startNorth = sectionLeftNorth_m[sectionIndex] + shiftNorth_m;
+		const double deltaEast = sectionRightEast_m[sectionIndex] - sectionLeftEast_m[sectionIndex];
+		const double deltaNorth = sectionRightNorth_m[sectionIndex] - sectionLeftNorth_m[sectionIndex];
+		std::uint32_t coveredSamples = 0;
+
+		for (std::uint32_t i = 0; i < numberOfSamples; i++)
+		{
+			const double across = (i + 0.5) / numberOfSamples;
+
+			if (is_covered(startEast + (deltaEast * across), startNorth + (deltaNorth * across)))
+			{
+				coveredSamples++;
+			}
+		}
+		return static_cast<float>(coveredSamples) / numberOfSamples;
+	}
+
+	std::uint32_t SectionControlEngine::get_condensed_work_state(const std::vector<bool> &states, std::size_t firstSection, std::size_t numberOfSections)
+	{
+		std::uint32_t retVal = 0xFFFFFFFF; // Sections that don't exist are "not installed"
+
+		for (std::size_t i = 0; i < numberOfSections; i++)
+		{
+			retVal &= ~(static_cast<std::uint32_t>(0x03) << (2 * i));
+			retVal |= (static_cast<std::uint32_t>(states[firstSection + i] ? 1 : 0) << (2 * i));
+		}
+		return retVal;
+	}
+
+	void SectionControlEngine::publish_setpoint_changes(const std::vector<bool> &previousSetpoints)
+	{
+		for (const auto &group : sectionGroups)
+		{
+			for (std::size_t firstSectionInValue = 0; firstSectionInValue < group.numberOfSections; firstSectionInValue += 16)
+			{
+				const std::size_t firstSection = group.firstSection + firstSectionInValue;
+				const std::size_t numberOfSections = std::min<std::size_t>(16, group.numberOfSections - firstSectionInValue);
+
+				if (!std::equal(sectionSetpoints.begin() + firstSection,
+				                sectionSetpoints.begin() + firstSection + numberOfSections,
+				                previousSetpoints.begin() + firstSection))
+				{
+					setpointEventDispatcher.call(group.elementNumber,
+					                             static_cast<std::uint16_t>(static_cast<std::uint16_t>(DataDescriptionIndex::SetpointCondensedWorkState1_16) + (firstSectionInValue / 16)),
+					                             get_condensed_work_state(sectionSetpoints, firstSection, numberOfSections));
+				}
+			}
+		}
+	}
+} // namespace isobus
@@ -0,0 +1,65 @@
+//================================================================================================
+/// @file isobus_static_device_descriptor_object_pool.cpp
+///
+/// @brief Implements the runtime accessors of a DDOP that was serialized at compile time.
+/// @author The Little Dawn Developers
+///
+/// @copyright 2026 The Little Dawn Developers
+//================================================================================================
+#include "isobus/isobus/isobus_static_device_descriptor_object_pool.hpp"
+
+namespace isobus
+{
+	const std::uint8_t *StaticDeviceDescriptorObjectPool::get_binary_object_pool() const
+	{
+		return binaryPool;
+	}
+
+	std::uint32_t StaticDeviceDescriptorObjectPool::size() const
+	{
+		return binaryPoolSize;
+	}
+
+	std::string StaticDeviceDescriptorObjectPool::get_structure_label() const
+	{
+		return std::string(reinterpret_cast<const char *>(&binaryPool[structureLabelOffset]), task_controller_object::DeviceObject::MAX_STRUCTURE_AND_LOCALIZATION_LABEL_LENGTH);
+	}
+
+	std::array<std::uint8_t, task_controller_object::DeviceObject::MAX_STRUCTURE_AND_LOCALIZATION_LABEL_LENGTH> StaticDeviceDescriptorObjectPool::get_localization_label() const
+	{
+		std::array<std::uint8_t, task_controller_object::DeviceObject::MAX_STRUCTURE_AND_LOCALIZATION_LABEL_LENGTH> retVal;
+
+		for (std::size_t i = 0; i < retVal.size(); i++)
+		{
+			retVal[i] = binaryPool[structureLabelOffset + task_controller_object::DeviceObject::MAX_STRUCTURE_AND_LOCALIZATION_LABEL_LENGTH + i];
+		}
+		return retVal;
+	}
+
+	bool StaticDeviceDescriptorObjectPool::get_process_data_object_id(std::uint16_t elementNumber, std::uint16_t ddi, std::uint16_t &objectID) const
+	{
+		bool retVal = false;
+
+		for (std::size_t i = 0; i < numberOfProcessData; i++)
+		{
+			if ((elementNumber == processData[i].elementNumber) &&
+			    (ddi == processData[i].ddi))
+			{
+				objectID = processData[i].objectID;
+				retVal = true;
+				break;
+			}
+		}
+		return retVal;
+	}
+
+	std::size_t StaticDeviceDescriptorObjectPool::get_number_process_data() const
+	{
+		return numberOfProcessData;
+	}
+
+	const static_ddop::ProcessDataEntry &StaticDeviceDescriptorObjectPool::get_process_data(std::size_t index) const
+	{
+		return processData[index];
+	}
+} // namespace isobus
@@ -11,6 +11,7 @@
 #include "isobus/isobus/can_general_parameter_group_numbers.hpp"
 #include "isobus/isobus/can_network_manager.hpp"
 #include "isobus/isobus/can_stack_logger.hpp"
+#include "isobus/isobus/isobus_standard_data_description_indices.hpp"
 #include "isobus/utility/system_timing.hpp"
 #include "isobus/utility/to_string.hpp"
 
@@ -86,6 +87,21 @@ namespace isobus
 		valueCommandsCallbacks.push_back(callbackData);
 	}
 
+	void TaskControllerClient::add_value_command_handler(std::uint16_t elementNumber, std::uint16_t DDI, ValueCommandCallback callback, void *parentPointer, bool immediate)
+	{
+		LOCK_GUARD(Mutex, clientMutex);
+
+		assert(nullptr != callback);
+		ValueCommandHandler handler = { callback, parentPointer, immediate };
+		valueCommandHandlers[get_process_data_key(elementNumber, DDI)] = handler;
+	}
+
+	void TaskControllerClient::remove_value_command_handler(std::uint16_t elementNumber, std::uint16_t DDI)
+	{
+		LOCK_GUARD(Mutex, clientMutex);
+		valueCommandHandlers.erase(get_process_data_key(elementNumber, DDI));
+	}
+
 	void TaskControllerClient::remove_request_value_callback(RequestValueCommandCallback callback, void *parentPointer)
 	{
 		LOCK_GUARD(Mutex, clientMutex);
@@ -97,6 +113,18 @@ namespace isobus
 		{
 			requestValueCallbacks.erase(callbackLocation);
 		}
+
+		for (auto provider = valueProviders.begin(); provider != valueProviders.end();)
+		{
+			if (provider->second == callbackData)
+			{
+				provider = valueProviders.erase(provider);
+			}
+			else
+			{
+				++provider;
+			}
+		}
 	}
 
 	void TaskControllerClient::remove_value_command_callback(ValueCommandCallback callback, void *parentPointer)
@@ -132,6 +160,7 @@ namespace isobus
 			ddopUploadMode = DDOPUploadType::ProgramaticallyGenerated;
 			clientDDOP = DDOP;
 			userSuppliedBinaryDDOP = nullptr;
+			userSuppliedDDOPChunkCallback = nullptr;
 			userSuppliedBinaryDDOPSize_bytes = 0;
 			set_common_config_items(maxNumberBoomsSupported,
 			                        maxNumberSectionsSupported,
@@ -170,6 +199,7 @@ namespace isobus
 			ddopLocalizationLabel.fill(0x00);
 			ddopUploadMode = DDOPUploadType::UserProvidedBinaryPointer;
 			userSuppliedBinaryDDOP = binaryDDOP;
+			userSuppliedDDOPChunkCallback = nullptr;
 			userSuppliedBinaryDDOPSize_bytes = DDOPSize;
 			set_common_config_items(maxNumberBoomsSupported,
 			                        maxNumberSectionsSupported,
@@ -187,6 +217,45 @@ namespace isobus
 		}
 	}
 
+	void TaskControllerClient::configure(const StaticDeviceDescriptorObjectPool &DDOP,
+	                                     std::uint8_t maxNumberBoomsSupported,
+	                                     std::uint8_t maxNumberSectionsSupported,
+	                                     std::uint8_t maxNumberChannelsSupportedForPositionBasedControl,
+	                                     bool reportToTCSupportsDocumentation,
+	                                     bool reportToTCSupportsTCGEOWithoutPositionBasedControl,
+	                                     bool reportToTCSupportsTCGEOWithPositionBasedControl,
+	                                     bool reportToTCSupportsPeerControlAssignment,
+	                                     bool reportToTCSupportsImplementSectionControl)
+	{
+		if (StateMachineState::Disconnected == get_state())
+		{
+			assert(nullptr != DDOP.get_binary_object_pool()); // Client will not work without a DDOP.
+			assert(0 != DDOP.size());
+			generatedBinaryDDOP.clear();
+			userSuppliedVectorDDOP = nullptr;
+			// The labels were located when the pool was compiled, so there's no need to search the DDOP for them later
+			ddopStructureLabel = DDOP.get_structure_label();
+			ddopLocalizationLabel = DDOP.get_localization_label();
+			ddopUploadMode = DDOPUploadType::UserProvidedBinaryPointer;
+			userSuppliedBinaryDDOP = DDOP.get_binary_object_pool();
+			userSuppliedDDOPChunkCallback = nullptr;
+			userSuppliedBinaryDDOPSize_bytes = DDOP.size();
+			set_common_config_items(maxNumberBoomsSupported,
+			                        maxNumberSectionsSupported,
+			                        maxNumberChannelsSupportedForPositionBasedControl,
+			                        reportToTCSupportsDocumentation,
+			                        reportToTCSupportsTCGEOWithoutPositionBasedControl,
+			                        reportToTCSupportsTCGEOWithPositionBasedControl,
+			                        reportToTCSupportsPeerControlAssignment,
+			                        reportToTCSupportsImplementSectionControl);
+		}
+		else
+		{
+			// We don't want someone to erase our object pool or something while it is being used.
+			LOG_ERROR("[TC]: Cannot reconfigure TC client while it is running!");
+		}
+	}
+
 	void TaskControllerClient::configure(std::shared_ptr<std::vector<std::uint8_t>> binaryDDOP,
 	                                     std::uint8_t maxNumberBoomsSupported,
 	                                     std::uint8_t maxNumberSectionsSupported,
@@ -206,6 +275,7 @@ namespace isobus
 			userSuppliedVectorDDOP = binaryDDOP;
 			ddopUploadMode = DDOPUploadType::UserProvidedVector;
 			userSuppliedBinaryDDOP = nullptr;
+			userSuppliedDDOPChunkCallback = nullptr;
 			userSuppliedBinaryDDOPSize_bytes = 0;
 			set_common_config_items(maxNumberBoomsSupported,
 			                        maxNumberSectionsSupported,
@@ -223,6 +293,45 @@ namespace isobus
 		}
 	}
 
+	void TaskControllerClient::configure_streamed_ddop(DataChunkCallback ddopChunkCallback,
+	                                                   std::uint32_t DDOPSize,
+	                                                   std::uint8_t maxNumberBoomsSupported,
+	                                                   std::uint8_t maxNumberSectionsSupported,
+	                                                   std::uint8_t maxNumberChannelsSupportedForPositionBasedControl,
+	                                                   bool reportToTCSupportsDocumentation,
+	                                                   bool reportToTCSupportsTCGEOWithoutPositionBasedControl,
+	                                                   bool reportToTCSupportsTCGEOWithPositionBasedControl,
+	                                                   bool reportToTCSupportsPeerControlAssignment,
+	                                                   bool reportToTCSupportsImplementSectionControl)
+	{
+		if (StateMachineState::Disconnected == get_state())
+		{
+			assert(nullptr != ddopChunkCallback); // Client will not work without a DDOP.
+			assert(0 != DDOPSize);
+			generatedBinaryDDOP.clear();
+			ddopStructureLabel.clear();
+			userSuppliedVectorDDOP = nullptr;
+			ddopLocalizationLabel.fill(0x00);
+			ddopUploadMode = DDOPUploadType::UserProvidedChunkCallback;
+			userSuppliedBinaryDDOP = nullptr;
+			userSuppliedDDOPChunkCallback = ddopChunkCallback;
+			userSuppliedBinaryDDOPSize_bytes = DDOPSize;
+			set_common_config_items(maxNumberBoomsSupported,
+			                        maxNumberSectionsSupported,
+			                        maxNumberChannelsSupportedForPositionBasedControl,
+			                        reportToTCSupportsDocumentation,
+			                        reportToTCSupportsTCGEOWithoutPositionBasedControl,
+			                        reportToTCSupportsTCGEOWithPositionBasedControl,
+			                        reportToTCSupportsPeerControlAssignment,
+			                        reportToTCSupportsImplementSectionControl);
+		}
+		else
+		{
+			// We don't want someone to erase our object pool or something while it is being used.
+			LOG_ERROR("[TC]: Cannot reconfigure TC client while it is running!");
+		}
+	}
+
 	void TaskControllerClient::restart()
 	{
 		if (initialized)
@@ -336,6 +445,7 @@ namespace isobus
 			userSuppliedVectorDDOP = binaryDDOP;
 			ddopUploadMode = DDOPUploadType::UserProvidedVector;
 			userSuppliedBinaryDDOP = nullptr;
+			userSuppliedDDOPChunkCallback = nullptr;
 			userSuppliedBinaryDDOPSize_bytes = 0;
 			shouldReuploadAfterDDOPDeletion = true;
 			set_state(StateMachineState::DeactivateObjectPool);
@@ -361,6 +471,7 @@ namespace isobus
 			ddopLocalizationLabel.fill(0x00);
 			ddopUploadMode = DDOPUploadType::UserProvidedBinaryPointer;
 			userSuppliedBinaryDDOP = binaryDDOP;
+			userSuppliedDDOPChunkCallback = nullptr;
 			userSuppliedBinaryDDOPSize_bytes = DDOPSize;
 			shouldReuploadAfterDDOPDeletion = true;
 			set_state(StateMachineState::DeactivateObjectPool);
@@ -386,6 +497,7 @@ namespace isobus
 			ddopUploadMode = DDOPUploadType::ProgramaticallyGenerated;
 			clientDDOP = DDOP;
 			userSuppliedBinaryDDOP = nullptr;
+			userSuppliedDDOPChunkCallback = nullptr;
 			userSuppliedBinaryDDOPSize_bytes = 0;
 			shouldReuploadAfterDDOPDeletion = true;
 			set_state(StateMachineState::DeactivateObjectPool);
@@ -396,8 +508,36 @@ namespace isobus
 		return retVal;
 	}
 
+	bool TaskControllerClient::reupload_streamed_device_descriptor_object_pool(DataChunkCallback ddopChunkCallback, std::uint32_t DDOPSize)
+	{
+		bool retVal = false;
+		LOCK_GUARD(Mutex, clientMutex);
+
+		if (StateMachineState::Connected == get_state())
+		{
+			assert(nullptr != ddopChunkCallback); // Client will not work without a DDOP.
+			assert(0 != DDOPSize);
+			generatedBinaryDDOP.clear();
+			ddopStructureLabel.clear();
+			userSuppliedVectorDDOP = nullptr;
+			ddopLocalizationLabel.fill(0x00);
+			ddopUploadMode = DDOPUploadType::UserProvidedChunkCallback;
+			userSuppliedBinaryDDOP = nullptr;
+			userSuppliedDDOPChunkCallback = ddopChunkCallback;
+			userSuppliedBinaryDDOPSize_bytes = DDOPSize;
+			shouldReuploadAfterDDOPDeletion = true;
+			set_state(StateMachineState::DeactivateObjectPool);
+			clear_queues();
+			retVal = true;
+			LOG_INFO("[TC]: Requested to change the DDOP. Object pool will be deactivated for a little while.");
+		}
+		return retVal;
+	}
+
 	void TaskControllerClient::update()
 	{
+		process_pushed_process_data_values();
+
 		switch (currentState)
 		{
 			case StateMachineState::Disconnected:
@@ -717,31 +857,7 @@ namespace isobus
 			case StateMachineState::BeginTransferDDOP:
 			{
 				bool transmitSuccessful = false;
-				std::uint32_t dataLength = 0;
-
-				switch (ddopUploadMode)
-				{
-					case DDOPUploadType::ProgramaticallyGenerated:
-					{
-						dataLength = static_cast<std::uint32_t>(generatedBinaryDDOP.size() + 1); // Account for Mux byte
-					}
-					break;
-
-					case DDOPUploadType::UserProvidedBinaryPointer:
-					{
-						dataLength = static_cast<std::uint32_t>(userSuppliedBinaryDDOPSize_bytes + 1);
-					}
-					break;
-
-					case DDOPUploadType::UserProvidedVector:
-					{
-						dataLength = static_cast<std::uint32_t>(userSuppliedVectorDDOP->size() + 1);
-					}
-					break;
-
-					default:
-						break;
-				}
+				std::uint32_t dataLength = get_binary_ddop_size() + 1; // Account for Mux byte
 
 				assert(0 != dataLength);
 				transmitSuccessful = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData),
@@ -876,6 +992,30 @@ namespace isobus
 		return ((obj.ddi == this->ddi) && (obj.elementNumber == this->elementNumber));
 	}
 
+	bool TaskControllerClient::is_measurement_due_after(const TimeIntervalMeasurement &lhs, const TimeIntervalMeasurement &rhs)
+	{
+		// Compare the difference so that the ordering survives the timestamps wrapping around
+		std::uint32_t lhsDue_ms = lhs.lastTransmitTimestamp_ms + lhs.interval_ms;
+		std::uint32_t rhsDue_ms = rhs.lastTransmitTimestamp_ms + rhs.interval_ms;
+		return (static_cast<std::int32_t>(lhsDue_ms - rhsDue_ms) > 0);
+	}
+
+	bool TaskControllerClient::get_is_section_control_ddi(std::uint16_t ddi)
+	{
+		return (static_cast<std::uint16_t>(DataDescriptionIndex::ActualWorkState) == ddi) ||
+		  (static_cast<std::uint16_t>(DataDescriptionIndex::SetpointWorkState) == ddi) ||
+		  (static_cast<std::uint16_t>(DataDescriptionIndex::SectionControlState) == ddi) ||
+		  ((ddi >= static_cast<std::uint16_t>(DataDescriptionIndex::ActualCondensedWorkState1_16)) &&
+		   (ddi <= static_cast<std::uint16_t>(DataDescriptionIndex::ActualCondensedWorkState241_256))) ||
+		  ((ddi >= static_cast<std::uint16_t>(DataDescriptionIndex::SetpointCondensedWorkState1_16)) &&
+		   (ddi <= static_cast<std::uint16_t>(DataDescriptionIndex::SetpointCondensedWorkState241_256)));
+	}
+
+	std::uint32_t TaskControllerClient::get_process_data_key(std::uint16_t elementNumber, std::uint16_t ddi)
+	{
+		return ((static_cast<std::uint32_t>(elementNumber) << 16) | ddi);
+	}
+
 	bool TaskControllerClient::RequestValueCommandCallbackInfo::operator==(const RequestValueCommandCallbackInfo &obj) const
 	{
 		return (obj.callback == this->callback) && (obj.parent == this->parent);
@@ -894,6 +1034,7 @@ namespace isobus
 		measurementMinimumThresholdCommands.clear();
 		measurementMaximumThresholdCommands.clear();
 		measurementOnChangeThresholdCommands.clear();
+		queuedMeasurementValues.clear();
 	}
 
 	bool TaskControllerClient::get_was_ddop_supplied() const
@@ -922,12 +1063,99 @@ namespace isobus
 			}
 			break;
 
+			case DDOPUploadType::UserProvidedChunkCallback:
+			{
+				retVal = (nullptr != userSuppliedDDOPChunkCallback) &&
+				  (0 != userSuppliedBinaryDDOPSize_bytes);
+			}
+			break;
+
 			default:
 				break;
 		}
 		return retVal;
 	}
 
+	std::uint32_t TaskControllerClient::get_binary_ddop_size() const
+	{
+		std::uint32_t retVal = 0;
+
+		switch (ddopUploadMode)
+		{
+			case DDOPUploadType::ProgramaticallyGenerated:
+			{
+				retVal = static_cast<std::uint32_t>(generatedBinaryDDOP.size());
+			}
+			break;
+
+			case DDOPUploadType::UserProvidedBinaryPointer:
+			case DDOPUploadType::UserProvidedChunkCallback:
+			{
+				retVal = userSuppliedBinaryDDOPSize_bytes;
+			}
+			break;
+
+			case DDOPUploadType::UserProvidedVector:
+			{
+				if (nullptr != userSuppliedVectorDDOP)
+				{
+					retVal = static_cast<std::uint32_t>(userSuppliedVectorDDOP->size());
+				}
+			}
+			break;
+
+			default:
+				break;
+		}
+		return retVal;
+	}
+
+	bool TaskControllerClient::get_binary_ddop_chunk(std::uint32_t callbackIndex, std::uint32_t bytesOffset, std::uint32_t numberOfBytes, std::uint8_t *chunkBuffer)
+	{
+		bool retVal = false;
+
+		if (0 == numberOfBytes)
+		{
+			retVal = true;
+		}
+		else if ((bytesOffset + numberOfBytes) <= get_binary_ddop_size())
+		{
+			switch (ddopUploadMode)
+			{
+				case DDOPUploadType::ProgramaticallyGenerated:
+				{
+					memcpy(chunkBuffer, &generatedBinaryDDOP[bytesOffset], numberOfBytes);
+					retVal = true;
+				}
+				break;
+
+				case DDOPUploadType::UserProvidedBinaryPointer:
+				{
+					memcpy(chunkBuffer, &userSuppliedBinaryDDOP[bytesOffset], numberOfBytes);
+					retVal = true;
+				}
+				break;
+
+				case DDOPUploadType::UserProvidedVector:
+				{
+					memcpy(chunkBuffer, &userSuppliedVectorDDOP->at(bytesOffset), numberOfBytes);
+					retVal = true;
+				}
+				break;
+
+				case DDOPUploadType::UserProvidedChunkCallback:
+				{
+					retVal = userSuppliedDDOPChunkCallback(callbackIndex, bytesOffset, numberOfBytes, chunkBuffer, this);
+				}
+				break;
+
+				default:
+					break;
+			}
+		}
+		return retVal;
+	}
+
 	void TaskControllerClient::process_labels_from_ddop()
 	{
 		std::uint32_t currentByteIndex = 0;
@@ -958,27 +1186,38 @@ namespace isobus
 
 			case DDOPUploadType::UserProvidedBinaryPointer:
 			case DDOPUploadType::UserProvidedVector:
+			case DDOPUploadType::UserProvidedChunkCallback:
 			{
-				auto getDDOPSize = [this]() {
-					if (ddopUploadMode == DDOPUploadType::UserProvidedBinaryPointer)
-					{
-						return userSuppliedBinaryDDOPSize_bytes;
-					}
-					else
-					{
-						return static_cast<std::uint32_t>(userSuppliedVectorDDOP->size());
-					}
+				// Read the DDOP through a small window so that a streamed DDOP is not read one byte per callback
+				std::array<std::uint8_t, 32> window;
+				std::uint32_t windowOffset = 0;
+				std::uint32_t windowLength = 0;
+				std::uint32_t numberOfReads = 0;
+				const std::uint32_t ddopSize = get_binary_ddop_size();
+
+				auto getDDOPSize = [ddopSize]() {
+					return ddopSize;
 				};
 
-				auto getDDOPByteAt = [this](std::size_t index) {
-					if (ddopUploadMode == DDOPUploadType::UserProvidedBinaryPointer)
-					{
-						return userSuppliedBinaryDDOP[index];
-					}
-					else
+				auto getDDOPByteAt = [this, ddopSize, &window, &windowOffset, &windowLength, &numberOfReads](std::uint32_t index) {
+					if ((index < windowOffset) || (index >= (windowOffset + windowLength)))
 					{
-						return userSuppliedVectorDDOP->at(index);
+						windowOffset = index;
+						windowLength = 0;
+
+						if (index < ddopSize)
+						{
+							windowLength = std::min(static_cast<std::uint32_t>(window.size()), ddopSize - index);
+						}
+
+						if (!get_binary_ddop_chunk(numberOfReads, windowOffset, windowLength, window.data()))
+						{
+							LOG_ERROR("[TC]: Failed to read the DDOP at offset " + isobus::to_string(index));
+							windowLength = 0;
+						}
+						numberOfReads++;
 					}
+					return (index < (windowOffset + windowLength)) ? window[index - windowOffset] : static_cast<std::uint8_t>(0);
 				};
 				// Searching for "DVC"
 				while (currentByteIndex < (getDDOPSize() - DEVICE_TABLE_ID.size()))
@@ -1020,6 +1259,7 @@ namespace isobus
 						}
 						break;
 					}
+					currentByteIndex++;
 				}
 			}
 			break;
@@ -1029,6 +1269,26 @@ namespace isobus
 		}
 	}
 
+	void TaskControllerClient::process_value_command(const ProcessDataCallbackInfo &valueCommand)
+	{
+		auto handler = valueCommandHandlers.find(get_process_data_key(valueCommand.elementNumber, valueCommand.ddi));
+
+		if ((valueCommandHandlers.end() != handler) && (handler->second.immediate))
+		{
+			handler->second.callback(valueCommand.elementNumber, valueCommand.ddi, valueCommand.processDataValue, handler->second.parent);
+
+			if ((valueCommand.ackRequested) &&
+			    (!send_pdack(valueCommand.elementNumber, valueCommand.ddi)))
+			{
+				LOG_WARNING("[TC]: Failed to send a PDACK for element " + isobus::to_string(static_cast<int>(valueCommand.elementNumber)) + " DDI " + isobus::to_string(static_cast<int>(valueCommand.ddi)));
+			}
+		}
+		else if (!queuedValueCommands.push(valueCommand))
+		{
+			LOG_WARNING("[TC]: Value command queue is full, dropping a command for element " + isobus::to_string(static_cast<int>(valueCommand.elementNumber)) + " DDI " + isobus::to_string(static_cast<int>(valueCommand.ddi)));
+		}
+	}
+
 	void TaskControllerClient::process_queued_commands()
 	{
 		LOCK_GUARD(Mutex, clientMutex);
@@ -1037,30 +1297,34 @@ namespace isobus
 		while (!queuedValueRequests.empty() && transmitSuccessful)
 		{
 			const auto &currentRequest = queuedValueRequests.front();
+			std::int32_t newValue = 0;
 
-			for (auto &currentCallback : requestValueCallbacks)
+			if (get_process_data_value(currentRequest.elementNumber, currentRequest.ddi, newValue))
 			{
-				std::int32_t newValue = 0;
-				if (currentCallback.callback(currentRequest.elementNumber, currentRequest.ddi, newValue, currentCallback.parent))
-				{
-					transmitSuccessful = send_value_command(currentRequest.elementNumber, currentRequest.ddi, newValue);
-					break;
-				}
+				transmitSuccessful = send_value_command(currentRequest.elementNumber, currentRequest.ddi, newValue);
 			}
 			queuedValueRequests.pop_front();
 		}
-		while (!queuedValueCommands.empty() && transmitSuccessful)
+		ProcessDataCallbackInfo currentRequest = { 0, 0, 0, 0, false, false };
+		while (transmitSuccessful && queuedValueCommands.peek(currentRequest))
 		{
-			const auto &currentRequest = queuedValueCommands.front();
+			auto handler = valueCommandHandlers.find(get_process_data_key(currentRequest.elementNumber, currentRequest.ddi));
 
-			for (auto &currentCallback : valueCommandsCallbacks)
+			if (valueCommandHandlers.end() != handler)
+			{
+				handler->second.callback(currentRequest.elementNumber, currentRequest.ddi, currentRequest.processDataValue, handler->second.parent);
+			}
+			else
 			{
-				if (currentCallback.callback(currentRequest.elementNumber, currentRequest.ddi, currentRequest.processDataValue, currentCallback.parent))
+				for (auto &currentCallback : valueCommandsCallbacks)
 				{
-					break;
+					if (currentCallback.callback(currentRequest.elementNumber, currentRequest.ddi, currentRequest.processDataValue, currentCallback.parent))
+					{
+						break;
+					}
 				}
 			}
-			queuedValueCommands.pop_front();
+			queuedValueCommands.pop();
 
 			//! @todo process PDACKs better
 			if (currentRequest.ackRequested)
@@ -1068,118 +1332,239 @@ namespace isobus
 				transmitSuccessful = send_pdack(currentRequest.elementNumber, currentRequest.ddi);
 			}
 		}
+		while (!queuedMeasurementValues.empty() && transmitSuccessful)
+		{
+			const auto &currentValue = queuedMeasurementValues.front();
+
+			// Unlike requests, these stay queued until they're sent, since the value won't be re-evaluated until it changes again
+			transmitSuccessful = send_value_command(currentValue.elementNumber, currentValue.ddi, currentValue.processDataValue);
+			if (transmitSuccessful)
+			{
+				queuedMeasurementValues.pop_front();
+			}
+		}
 	}
 
 	void TaskControllerClient::process_queued_threshold_commands()
 	{
-		bool transmitSuccessful = false;
+		LOCK_GUARD(Mutex, clientMutex);
+
+		const std::uint32_t currentTimestamp_ms = SystemTiming::get_timestamp_ms();
+
+		if (0 != measurementMessagesPerSecond)
+		{
+			// Refill the budget at the configured rate, allowing a burst of up to 1/10th of a second worth of messages
+			const float maximumBudget = std::max(1.0f, measurementMessagesPerSecond / 10.0f);
+			measurementTransmitBudget += (SystemTiming::get_time_elapsed_ms(measurementTransmitTimestamp_ms) * measurementMessagesPerSecond) / 1000.0f;
+			measurementTransmitBudget = std::min(measurementTransmitBudget, maximumBudget);
+		}
+		measurementTransmitTimestamp_ms = currentTimestamp_ms;
+
+		// Only the measurements that are due are touched, the heap keeps the next one due at the front
+		dueMeasurements.clear();
+		while ((!measurementTimeIntervalCommands.empty()) &&
+		       (SystemTiming::time_expired_ms(measurementTimeIntervalCommands.front().lastTransmitTimestamp_ms, measurementTimeIntervalCommands.front().interval_ms)))
+		{
+			std::pop_heap(measurementTimeIntervalCommands.begin(), measurementTimeIntervalCommands.end(), is_measurement_due_after);
+			dueMeasurements.push_back(measurementTimeIntervalCommands.back());
+			measurementTimeIntervalCommands.pop_back();
+		}
 
-		for (auto &measurementTimeCommand : measurementTimeIntervalCommands)
+		if (!dueMeasurements.empty())
 		{
-			if (SystemTiming::time_expired_ms(static_cast<std::uint32_t>(measurementTimeCommand.lastValue), static_cast<std::uint32_t>(measurementTimeCommand.processDataValue)))
+			// Section control work states go first, the rest stay in the order they became due
+			std::stable_sort(dueMeasurements.begin(), dueMeasurements.end(), [](const TimeIntervalMeasurement &lhs, const TimeIntervalMeasurement &rhs) { return lhs.highPriority && !rhs.highPriority; });
+
+			const bool isBusBusy = (nullptr != myControlFunction) &&
+			  (CANNetworkManager::CANNetwork.get_estimated_busload(myControlFunction->get_can_port()) > HIGH_BUSLOAD_PERCENT);
+			bool transmitFailed = false;
+
+			for (auto &measurementTimeCommand : dueMeasurements)
 			{
-				// Time to update this time interval variable
-				transmitSuccessful = false;
-				for (auto &currentCallback : requestValueCallbacks)
+				bool shouldSend = (!transmitFailed) && ((0 == measurementMessagesPerSecond) || (measurementTransmitBudget >= 1.0f));
+
+				if (shouldSend && isBusBusy && (!measurementTimeCommand.highPriority))
+				{
+					shouldSend = SystemTiming::time_expired_ms(measurementTimeCommand.lastTransmitTimestamp_ms, measurementTimeCommand.interval_ms + (measurementTimeCommand.interval_ms / 2));
+				}
+
+				if (shouldSend)
 				{
 					std::int32_t newValue = 0;
-					if (currentCallback.callback(measurementTimeCommand.elementNumber, measurementTimeCommand.ddi, newValue, currentCallback.parent))
+
+					if (get_process_data_value(measurementTimeCommand.elementNumber, measurementTimeCommand.ddi, newValue))
 					{
-						transmitSuccessful = send_value_command(measurementTimeCommand.elementNumber, measurementTimeCommand.ddi, newValue);
-						break;
+						// The bus is probably busy if this fails, so the rest are left until the next update
+						transmitFailed = !send_value_command(measurementTimeCommand.elementNumber, measurementTimeCommand.ddi, newValue);
+
+						if (0 != measurementMessagesPerSecond)
+						{
+							measurementTransmitBudget -= 1.0f;
+						}
 					}
-				}
 
-				if (transmitSuccessful)
-				{
-					measurementTimeCommand.lastValue = static_cast<std::int32_t>(SystemTiming::get_timestamp_ms());
+					if (!transmitFailed)
+					{
+						// Advance by exactly one interval to keep the measurement's place in the stagger, unless it's fallen a whole interval behind.
+						// If no callback provides this value, it's skipped until the next interval rather than retried on every update.
+						measurementTimeCommand.lastTransmitTimestamp_ms += measurementTimeCommand.interval_ms;
+
+						if (SystemTiming::time_expired_ms(measurementTimeCommand.lastTransmitTimestamp_ms, measurementTimeCommand.interval_ms))
+						{
+							measurementTimeCommand.lastTransmitTimestamp_ms = currentTimestamp_ms;
+						}
+					}
 				}
+				measurementTimeIntervalCommands.push_back(measurementTimeCommand);
+				std::push_heap(measurementTimeIntervalCommands.begin(), measurementTimeIntervalCommands.end(), is_measurement_due_after);
 			}
 		}
-		for (auto &measurementMaxCommand : measurementMaximumThresholdCommands)
+
+		// Thresholds of values pushed by the application were already evaluated when the values were pushed,
+		// so only the values that come from callbacks need to be polled here
+		if (!requestValueCallbacks.empty())
 		{
-			// Get the current process data value
-			std::int32_t newValue = 0;
-			for (auto &currentCallback : requestValueCallbacks)
+			for (const auto *thresholdCommands : { &measurementMaximumThresholdCommands, &measurementMinimumThresholdCommands, &measurementOnChangeThresholdCommands })
 			{
-				if (currentCallback.callback(measurementMaxCommand.elementNumber, measurementMaxCommand.ddi, newValue, currentCallback.parent))
+				for (const auto &thresholdCommand : *thresholdCommands)
 				{
-					break;
+					std::int32_t newValue = 0;
+
+					if ((pushedProcessDataValues.end() == pushedProcessDataValues.find(thresholdCommand.first)) &&
+					    (get_process_data_value(thresholdCommand.second.elementNumber, thresholdCommand.second.ddi, newValue)))
+					{
+						evaluate_threshold_measurements(thresholdCommand.second.elementNumber, thresholdCommand.second.ddi, newValue);
+					}
 				}
 			}
+		}
+	}
+
+	void TaskControllerClient::process_pushed_process_data_values()
+	{
+		LOCK_GUARD(Mutex, clientMutex);
+		PushedProcessDataValue pushedValue = { 0, 0, 0 };
+
+		while (pushedProcessDataValueQueue.peek(pushedValue))
+		{
+			pushedProcessDataValueQueue.pop();
+			pushedProcessDataValues[get_process_data_key(pushedValue.elementNumber, pushedValue.ddi)] = pushedValue.value;
+			evaluate_threshold_measurements(pushedValue.elementNumber, pushedValue.ddi, pushedValue.value);
+		}
+	}
+
+	void TaskControllerClient::evaluate_threshold_measurements(std::uint16_t elementNumber, std::uint16_t ddi, std::int32_t value)
+	{
+		auto key = get_process_data_key(elementNumber, ddi);
+		auto maximumCommand = measurementMaximumThresholdCommands.find(key);
+		auto minimumCommand = measurementMinimumThresholdCommands.find(key);
+		auto changeCommand = measurementOnChangeThresholdCommands.find(key);
+		bool shouldTransmit = false;
+
+		if (measurementMaximumThresholdCommands.end() != maximumCommand)
+		{
+			auto &measurementMaxCommand = maximumCommand->second;
 
 			if (!measurementMaxCommand.thresholdPassed)
 			{
-				if ((newValue > measurementMaxCommand.processDataValue) &&
-				    (send_value_command(measurementMaxCommand.elementNumber, measurementMaxCommand.ddi, newValue)))
+				if (value > measurementMaxCommand.processDataValue)
 				{
 					measurementMaxCommand.thresholdPassed = true;
+					shouldTransmit = true;
 				}
 			}
-			else
+			else if (value < measurementMaxCommand.processDataValue)
 			{
-				if (newValue < measurementMaxCommand.processDataValue)
-				{
-					measurementMaxCommand.thresholdPassed = false;
-				}
+				measurementMaxCommand.thresholdPassed = false;
 			}
 		}
-		for (auto &measurementMinCommand : measurementMinimumThresholdCommands)
+
+		if (measurementMinimumThresholdCommands.end() != minimumCommand)
 		{
-			// Get the current process data value
-			std::int32_t newValue = 0;
-			for (auto &currentCallback : requestValueCallbacks)
-			{
-				if (currentCallback.callback(measurementMinCommand.elementNumber, measurementMinCommand.ddi, newValue, currentCallback.parent))
-				{
-					break;
-				}
-			}
+			auto &measurementMinCommand = minimumCommand->second;
 
 			if (!measurementMinCommand.thresholdPassed)
 			{
-				if ((newValue < measurementMinCommand.processDataValue) &&
-				    (send_value_command(measurementMinCommand.elementNumber, measurementMinCommand.ddi, newValue)))
+				if (value < measurementMinCommand.processDataValue)
 				{
 					measurementMinCommand.thresholdPassed = true;
+					shouldTransmit = true;
 				}
 			}
-			else
+			else if (value > measurementMinCommand.processDataValue)
 			{
-				if (newValue > measurementMinCommand.processDataValue)
-				{
-					measurementMinCommand.thresholdPassed = false;
-				}
+				measurementMinCommand.thresholdPassed = false;
 			}
 		}
-		for (auto &measurementChangeCommand : measurementOnChangeThresholdCommands)
-		{
-			// Get the current process data value
-			std::int32_t newValue = 0;
-			for (auto &currentCallback : requestValueCallbacks)
-			{
-				if (currentCallback.callback(measurementChangeCommand.elementNumber, measurementChangeCommand.ddi, newValue, currentCallback.parent))
-				{
-					break;
-				}
-			}
 
+		if (measurementOnChangeThresholdCommands.end() != changeCommand)
+		{
+			auto &measurementChangeCommand = changeCommand->second;
 			std::int64_t lowerLimit = (static_cast<int64_t>(measurementChangeCommand.lastValue) - measurementChangeCommand.processDataValue);
 			if (lowerLimit < 0)
 			{
 				lowerLimit = 0;
 			}
 
-			if ((newValue != measurementChangeCommand.lastValue) &&
-			    ((newValue >= (measurementChangeCommand.lastValue + measurementChangeCommand.processDataValue)) ||
-			     (newValue <= lowerLimit)) &&
-			    (send_value_command(measurementChangeCommand.elementNumber, measurementChangeCommand.ddi, newValue)))
+			if ((value != measurementChangeCommand.lastValue) &&
+			    ((value >= (measurementChangeCommand.lastValue + measurementChangeCommand.processDataValue)) ||
+			     (value <= lowerLimit)))
 			{
-				measurementChangeCommand.lastValue = newValue;
+				measurementChangeCommand.lastValue = value;
+				shouldTransmit = true;
+			}
+		}
+
+		if (shouldTransmit)
+		{
+			ProcessDataCallbackInfo measurementValue = { value, 0, elementNumber, ddi, false, false };
+			auto queuedValue = std::find(queuedMeasurementValues.begin(), queuedMeasurementValues.end(), measurementValue);
+
+			if (queuedMeasurementValues.end() == queuedValue)
+			{
+				queuedMeasurementValues.push_back(measurementValue);
+			}
+			else
+			{
+				// Only the latest value needs to be sent
+				queuedValue->processDataValue = value;
 			}
 		}
 	}
 
+	bool TaskControllerClient::get_process_data_value(std::uint16_t elementNumber, std::uint16_t ddi, std::int32_t &value)
+	{
+		bool retVal = false;
+		auto key = get_process_data_key(elementNumber, ddi);
+		auto pushedValue = pushedProcessDataValues.find(key);
+		auto provider = valueProviders.find(key);
+
+		if (pushedProcessDataValues.end() != pushedValue)
+		{
+			value = pushedValue->second;
+			retVal = true;
+		}
+		else if (valueProviders.end() != provider)
+		{
+			retVal = provider->second.callback(elementNumber, ddi, value, provider->second.parent);
+		}
+
+		if (!retVal)
+		{
+			// Either this is the first lookup, or the bound callback stopped providing the value, so find one that does
+			for (auto &currentCallback : requestValueCallbacks)
+			{
+				if (currentCallback.callback(elementNumber, ddi, value, currentCallback.parent))
+				{
+					valueProviders[key] = currentCallback;
+					retVal = true;
+					break;
+				}
+			}
+		}
+		return retVal;
+	}
+
 	void TaskControllerClient::process_rx_message(const CANMessage &message, void *parentPointer)
 	{
 		if ((nullptr != parentPointer) &&
@@ -1585,7 +1970,7 @@ namespace isobus
 							                                (static_cast<std::int32_t>(messageData[5]) << 8) |
 							                                (static_cast<std::int32_t>(messageData[6]) << 16) |
 							                                (static_cast<std::int32_t>(messageData[7]) << 24));
-							parentTC->queuedValueCommands.push_back(requestData);
+							parentTC->process_value_command(requestData);
 						}
 						break;
 
@@ -1602,46 +1987,59 @@ namespace isobus
 							                                (static_cast<std::int32_t>(messageData[5]) << 8) |
 							                                (static_cast<std::int32_t>(messageData[6]) << 16) |
 							                                (static_cast<std::int32_t>(messageData[7]) << 24));
-							parentTC->queuedValueCommands.push_back(requestData);
+							parentTC->process_value_command(requestData);
 						}
 						break;
 
 						case ProcessDataCommands::MeasurementTimeInterval:
 						{
-							ProcessDataCallbackInfo commandData = { 0, 0, 0, 0, false, false };
+							TimeIntervalMeasurement commandData = { 0, 0, 0, 0, false };
 							LOCK_GUARD(Mutex, clientMutex);
 
 							commandData.elementNumber = (static_cast<std::uint16_t>(messageData[0] >> 4) | (static_cast<std::uint16_t>(messageData[1]) << 4));
 							commandData.ddi = static_cast<std::uint16_t>(messageData[2]) |
 							  (static_cast<std::uint16_t>(messageData[3]) << 8);
-							commandData.processDataValue = (static_cast<std::int32_t>(messageData[4]) |
-							                                (static_cast<std::int32_t>(messageData[5]) << 8) |
-							                                (static_cast<std::int32_t>(messageData[6]) << 16) |
-							                                (static_cast<std::int32_t>(messageData[7]) << 24));
-							commandData.lastValue = static_cast<std::int32_t>(SystemTiming::get_timestamp_ms());
+							commandData.interval_ms = (static_cast<std::uint32_t>(messageData[4]) |
+							                           (static_cast<std::uint32_t>(messageData[5]) << 8) |
+							                           (static_cast<std::uint32_t>(messageData[6]) << 16) |
+							                           (static_cast<std::uint32_t>(messageData[7]) << 24));
+							commandData.highPriority = get_is_section_control_ddi(commandData.ddi);
+
+							// Stagger new measurements by one rate limited message slot each, so that measurements with the same interval don't all come due together
+							std::uint32_t staggerOffset_ms = 0;
+							if ((0 != parentTC->measurementMessagesPerSecond) && (0 != commandData.interval_ms))
+							{
+								const std::uint32_t messageSpacing_ms = std::max<std::uint32_t>(1, 1000 / parentTC->measurementMessagesPerSecond);
+								staggerOffset_ms = static_cast<std::uint32_t>((parentTC->measurementTimeIntervalCommands.size() * messageSpacing_ms) % commandData.interval_ms);
+							}
+							commandData.lastTransmitTimestamp_ms = SystemTiming::get_timestamp_ms() - staggerOffset_ms;
 
-							auto previousCommand = std::find(parentTC->measurementTimeIntervalCommands.begin(), parentTC->measurementTimeIntervalCommands.end(), commandData);
+							auto previousCommand = std::find_if(parentTC->measurementTimeIntervalCommands.begin(),
+							                                    parentTC->measurementTimeIntervalCommands.end(),
+							                                    [&commandData](const TimeIntervalMeasurement &measurement) { return (measurement.elementNumber == commandData.elementNumber) && (measurement.ddi == commandData.ddi); });
 							if (parentTC->measurementTimeIntervalCommands.end() == previousCommand)
 							{
 								parentTC->measurementTimeIntervalCommands.push_back(commandData);
+								std::push_heap(parentTC->measurementTimeIntervalCommands.begin(), parentTC->measurementTimeIntervalCommands.end(), is_measurement_due_after);
 								LOG_DEBUG("[TC]: TC Requests element: " +
 								          isobus::to_string(static_cast<int>(commandData.elementNumber)) +
 								          " DDI: " +
 								          isobus::to_string(static_cast<int>(commandData.ddi)) +
 								          " every: " +
-								          isobus::to_string(static_cast<int>(commandData.processDataValue)) +
+								          isobus::to_string(static_cast<int>(commandData.interval_ms)) +
 								          " milliseconds.");
 							}
 							else
 							{
-								// Use the existing one and update the value
-								previousCommand->processDataValue = commandData.processDataValue;
+								// Use the existing one and update the value, which changes when it is due
+								previousCommand->interval_ms = commandData.interval_ms;
+								std::make_heap(parentTC->measurementTimeIntervalCommands.begin(), parentTC->measurementTimeIntervalCommands.end(), is_measurement_due_after);
 								LOG_DEBUG("[TC]: TC Altered time interval request for element: " +
 								          isobus::to_string(static_cast<int>(commandData.elementNumber)) +
 								          " DDI: " +
 								          isobus::to_string(static_cast<int>(commandData.ddi)) +
 								          " every: " +
-								          isobus::to_string(static_cast<int>(commandData.processDataValue)) +
+								          isobus::to_string(static_cast<int>(commandData.interval_ms)) +
 								          " milliseconds.");
 							}
 						}
@@ -1660,10 +2058,10 @@ namespace isobus
 							                                (static_cast<std::int32_t>(messageData[6]) << 16) |
 							                                (static_cast<std::int32_t>(messageData[7]) << 24));
 
-							auto previousCommand = std::find(parentTC->measurementMaximumThresholdCommands.begin(), parentTC->measurementMaximumThresholdCommands.end(), commandData);
+							auto previousCommand = parentTC->measurementMaximumThresholdCommands.find(get_process_data_key(commandData.elementNumber, commandData.ddi));
 							if (parentTC->measurementMaximumThresholdCommands.end() == previousCommand)
 							{
-								parentTC->measurementMaximumThresholdCommands.push_back(commandData);
+								parentTC->measurementMaximumThresholdCommands[get_process_data_key(commandData.elementNumber, commandData.ddi)] = commandData;
 								LOG_DEBUG("[TC]: TC Requests element: " +
 								          isobus::to_string(static_cast<int>(commandData.elementNumber)) +
 								          " DDI: " +
@@ -1674,8 +2072,8 @@ namespace isobus
 							else
 							{
 								// Just update the existing one with the new value
-								previousCommand->processDataValue = commandData.processDataValue;
-								previousCommand->thresholdPassed = false;
+								previousCommand->second.processDataValue = commandData.processDataValue;
+								previousCommand->second.thresholdPassed = false;
 							}
 						}
 						break;
@@ -1693,10 +2091,10 @@ namespace isobus
 							                                (static_cast<std::int32_t>(messageData[6]) << 16) |
 							                                (static_cast<std::int32_t>(messageData[7]) << 24));
 
-							auto previousCommand = std::find(parentTC->measurementMinimumThresholdCommands.begin(), parentTC->measurementMinimumThresholdCommands.end(), commandData);
+							auto previousCommand = parentTC->measurementMinimumThresholdCommands.find(get_process_data_key(commandData.elementNumber, commandData.ddi));
 							if (parentTC->measurementMinimumThresholdCommands.end() == previousCommand)
 							{
-								parentTC->measurementMinimumThresholdCommands.push_back(commandData);
+								parentTC->measurementMinimumThresholdCommands[get_process_data_key(commandData.elementNumber, commandData.ddi)] = commandData;
 								LOG_DEBUG("[TC]: TC Requests Element " +
 								          isobus::to_string(static_cast<int>(commandData.elementNumber)) +
 								          " DDI: " +
@@ -1707,8 +2105,8 @@ namespace isobus
 							else
 							{
 								// Just update the existing one with the new value
-								previousCommand->processDataValue = commandData.processDataValue;
-								previousCommand->thresholdPassed = false;
+								previousCommand->second.processDataValue = commandData.processDataValue;
+								previousCommand->second.thresholdPassed = false;
 							}
 						}
 						break;
@@ -1726,10 +2124,10 @@ namespace isobus
 							                                (static_cast<std::int32_t>(messageData[6]) << 16) |
 							                                (static_cast<std::int32_t>(messageData[7]) << 24));
 
-							auto previousCommand = std::find(parentTC->measurementOnChangeThresholdCommands.begin(), parentTC->measurementOnChangeThresholdCommands.end(), commandData);
+							auto previousCommand = parentTC->measurementOnChangeThresholdCommands.find(get_process_data_key(commandData.elementNumber, commandData.ddi));
 							if (parentTC->measurementOnChangeThresholdCommands.end() == previousCommand)
 							{
-								parentTC->measurementOnChangeThresholdCommands.push_back(commandData);
+								parentTC->measurementOnChangeThresholdCommands[get_process_data_key(commandData.elementNumber, commandData.ddi)] = commandData;
 								LOG_DEBUG("[TC]: TC Requests element " +
 								          isobus::to_string(static_cast<int>(commandData.elementNumber)) +
 								          " DDI: " +
@@ -1740,8 +2138,8 @@ namespace isobus
 							else
 							{
 								// Just update the existing one with the new value
-								previousCommand->processDataValue = commandData.processDataValue;
-								previousCommand->thresholdPassed = false;
+								previousCommand->second.processDataValue = commandData.processDataValue;
+								previousCommand->second.thresholdPassed = false;
 							}
 						}
 						break;
@@ -1772,7 +2170,7 @@ namespace isobus
 		}
 	}
 
-	bool TaskControllerClient::process_internal_object_pool_upload_callback(std::uint32_t,
+	bool TaskControllerClient::process_internal_object_pool_upload_callback(std::uint32_t callbackIndex,
 	                                                                        std::uint32_t bytesOffset,
 	                                                                        std::uint32_t numberOfBytesNeeded,
 	                                                                        std::uint8_t *chunkBuffer,
@@ -1787,36 +2185,18 @@ namespace isobus
 		assert(nullptr != chunkBuffer);
 		assert(0 != numberOfBytesNeeded);
 
-		if (((bytesOffset + numberOfBytesNeeded) <= parentTCClient->generatedBinaryDDOP.size() + 1) ||
-		    ((bytesOffset + numberOfBytesNeeded) <= parentTCClient->userSuppliedBinaryDDOPSize_bytes + 1))
+		if ((bytesOffset + numberOfBytesNeeded) <= parentTCClient->get_binary_ddop_size() + 1)
 		{
-			retVal = true;
 			if (0 == bytesOffset)
 			{
 				chunkBuffer[0] = static_cast<std::uint8_t>(ProcessDataCommands::DeviceDescriptor) |
 				  (static_cast<std::uint8_t>(DeviceDescriptorCommands::ObjectPoolTransfer) << 4);
-
-				if (DDOPUploadType::UserProvidedBinaryPointer == parentTCClient->ddopUploadMode)
-				{
-					memcpy(&chunkBuffer[1], &parentTCClient->userSuppliedBinaryDDOP[bytesOffset], numberOfBytesNeeded - 1);
-				}
-				else
-				{
-					memcpy(&chunkBuffer[1], &parentTCClient->generatedBinaryDDOP[bytesOffset], numberOfBytesNeeded - 1);
-				}
+				retVal = parentTCClient->get_binary_ddop_chunk(callbackIndex, 0, numberOfBytesNeeded - 1, &chunkBuffer[1]);
 			}
 			else
 			{
-				if (DDOPUploadType::UserProvidedBinaryPointer == parentTCClient->ddopUploadMode)
-				{
-					// Subtract off 1 to account for the mux in the first byte of the message
-					memcpy(chunkBuffer, &parentTCClient->userSuppliedBinaryDDOP[bytesOffset - 1], numberOfBytesNeeded);
-				}
-				else
-				{
-					// Subtract off 1 to account for the mux in the first byte of the message
-					memcpy(chunkBuffer, &parentTCClient->generatedBinaryDDOP[bytesOffset - 1], numberOfBytesNeeded);
-				}
+				// Subtract off 1 to account for the mux in the first byte of the message
+				retVal = parentTCClient->get_binary_ddop_chunk(callbackIndex, bytesOffset - 1, numberOfBytesNeeded, chunkBuffer);
 			}
 		}
 		else
@@ -1929,12 +2309,7 @@ namespace isobus
 
 	bool TaskControllerClient::send_request_object_pool_transfer() const
 	{
-		std::size_t binaryPoolSize = generatedBinaryDDOP.size();
-
-		if (DDOPUploadType::UserProvidedBinaryPointer == ddopUploadMode)
-		{
-			binaryPoolSize = userSuppliedBinaryDDOPSize_bytes;
-		}
+		const std::uint32_t binaryPoolSize = get_binary_ddop_size();
 
 		const std::array<std::uint8_t, CAN_DATA_LENGTH> buffer = { static_cast<std::uint8_t>(ProcessDataCommands::DeviceDescriptor) |
 			                                                           (static_cast<std::uint8_t>(DeviceDescriptorCommands::RequestObjectPoolTransfer) << 4),
@@ -2158,6 +2533,27 @@ namespace isobus
 		queuedValueRequests.push_back(requestData);
 	}
 
+	void TaskControllerClient::set_measurement_transmit_rate_limit(std::uint16_t messagesPerSecond)
+	{
+		LOCK_GUARD(Mutex, clientMutex);
+		measurementMessagesPerSecond = messagesPerSecond;
+
+		// Start the new limit with its own burst, so nothing left over from the previous limit (or from running without one) carries into it
+		measurementTransmitBudget = (0 != messagesPerSecond) ? std::max(1.0f, messagesPerSecond / 10.0f) : 0.0f;
+		measurementTransmitTimestamp_ms = SystemTiming::get_timestamp_ms();
+	}
+
+	std::uint16_t TaskControllerClient::get_measurement_transmit_rate_limit() const
+	{
+		return measurementMessagesPerSecond;
+	}
+
+	bool TaskControllerClient::set_process_data_value(std::uint16_t elementNumber, std::uint16_t DDI, std::int32_t value)
+	{
+		PushedProcessDataValue pushedValue = { value, elementNumber, DDI };
+		return pushedProcessDataValueQueue.push(pushedValue);
+	}
+
 	bool TaskControllerClient::request_task_controller_identification() const
 	{
 		constexpr std::array<std::uint8_t, CAN_DATA_LENGTH> buffer = { static_cast<std::uint8_t>(ProcessDataCommands::TechnicalCapabilities) |
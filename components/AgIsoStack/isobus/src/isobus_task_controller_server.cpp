@@ -14,6 +14,7 @@
 #include "isobus/isobus/can_network_manager.hpp"
 #include "isobus/isobus/can_stack_logger.hpp"
 #include "isobus/isobus/isobus_data_dictionary.hpp"
+#include "isobus/isobus/isobus_device_descriptor_object_pool.hpp"
 #include "isobus/utility/system_timing.hpp"
 
 #include <cassert>
@@ -151,6 +152,7 @@ namespace isobus
 	void TaskControllerServer::update()
 	{
 		process_rx_messages();
+		update_client_statistics();
 		if ((true == SystemTiming::time_expired_ms(lastStatusMessageTimestamp_ms, STATUS_MESSAGE_RATE_MS)) &&
 		    (true == send_status_message()))
 		{
@@ -173,10 +175,204 @@ namespace isobus
 		                    activeClients.end());
 	}
 
+	void TaskControllerServer::add_process_data_handler(std::uint16_t dataDescriptionIndex, ProcessDataHandler handler)
+	{
+		processDataHandlers[dataDescriptionIndex] = handler;
+
+		for (const auto &client : activeClients)
+		{
+			bind_process_data_handlers(*client);
+		}
+	}
+
+	void TaskControllerServer::remove_process_data_handler(std::uint16_t dataDescriptionIndex)
+	{
+		processDataHandlers.erase(dataDescriptionIndex);
+
+		for (const auto &client : activeClients)
+		{
+			bind_process_data_handlers(*client);
+		}
+	}
+
+	bool TaskControllerServer::get_process_data_route(std::shared_ptr<ControlFunction> clientControlFunction, std::uint16_t elementNumber, std::uint16_t dataDescriptionIndex, ProcessDataRoute &route) const
+	{
+		bool retVal = false;
+		auto client = get_active_client(clientControlFunction);
+
+		if (nullptr != client)
+		{
+			auto foundRoute = client->processDataRoutes.find(get_process_data_route_key(elementNumber, dataDescriptionIndex));
+
+			if (client->processDataRoutes.end() != foundRoute)
+			{
+				route = foundRoute->second;
+				retVal = true;
+			}
+		}
+		return retVal;
+	}
+
+	std::size_t TaskControllerServer::get_number_process_data_routes(std::shared_ptr<ControlFunction> clientControlFunction) const
+	{
+		std::size_t retVal = 0;
+		auto client = get_active_client(clientControlFunction);
+
+		if (nullptr != client)
+		{
+			retVal = client->processDataRoutes.size();
+		}
+		return retVal;
+	}
+
+	bool TaskControllerServer::get_client_statistics(std::shared_ptr<ControlFunction> clientControlFunction, ClientStatistics &statistics) const
+	{
+		bool retVal = false;
+		auto client = get_active_client(clientControlFunction);
+
+		if (nullptr != client)
+		{
+			statistics = client->statistics;
+			retVal = true;
+		}
+		return retVal;
+	}
+
 	TaskControllerServer::ActiveClient::ActiveClient(std::shared_ptr<ControlFunction> clientControlFunction) :
 	  clientControlFunction(clientControlFunction),
-	  lastStatusMessageTimestamp_ms(SystemTiming::get_timestamp_ms())
+	  lastStatusMessageTimestamp_ms(SystemTiming::get_timestamp_ms()),
+	  statisticsWindowStartTimestamp_ms(SystemTiming::get_timestamp_ms())
+	{
+	}
+
+	bool TaskControllerServer::build_process_data_routes(std::shared_ptr<ControlFunction> clientControlFunction, const std::vector<std::uint8_t> &binaryDDOP)
+	{
+		bool retVal = false;
+		auto client = get_active_client(clientControlFunction);
+
+		if ((nullptr != client) && (!binaryDDOP.empty()))
+		{
+			// Version 3 and older DDOPs don't have an extended structure label, so parse with the client's version if it reported one
+			std::uint8_t ddopVersion = static_cast<std::uint8_t>(TaskControllerVersion::SecondPublishedEdition);
+			if ((0 != client->reportedVersion) && (client->reportedVersion < ddopVersion))
+			{
+				ddopVersion = client->reportedVersion;
+			}
+			DeviceDescriptorObjectPool clientDDOP(ddopVersion);
+			bool parsed = clientDDOP.deserialize_binary_object_pool(binaryDDOP.data(), static_cast<std::uint32_t>(binaryDDOP.size()));
+
+			if ((!parsed) && (static_cast<std::uint8_t>(TaskControllerVersion::SecondPublishedEdition) == ddopVersion))
+			{
+				// Plenty of clients don't report their version, and older pools lack the extended structure label
+				clientDDOP = DeviceDescriptorObjectPool(static_cast<std::uint8_t>(TaskControllerVersion::SecondEditionDraft));
+				parsed = clientDDOP.deserialize_binary_object_pool(binaryDDOP.data(), static_cast<std::uint32_t>(binaryDDOP.size()));
+			}
+
+			if (parsed)
+			{
+				client->processDataRoutes.clear();
+
+				for (std::uint16_t i = 0; i < clientDDOP.size(); i++)
+				{
+					auto object = clientDDOP.get_object_by_index(i);
+
+					if ((nullptr != object) &&
+					    (task_controller_object::ObjectTypes::DeviceElement == object->get_object_type()))
+					{
+						auto element = std::static_pointer_cast<task_controller_object::DeviceElementObject>(object);
+
+						for (std::uint16_t j = 0; j < element->get_number_child_objects(); j++)
+						{
+							auto child = clientDDOP.get_object_by_id(element->get_child_object_id(j));
+
+							if ((nullptr != child) &&
+							    (task_controller_object::ObjectTypes::DeviceProcessData == child->get_object_type()))
+							{
+								auto processData = std::static_pointer_cast<task_controller_object::DeviceProcessDataObject>(child);
+								auto presentation = clientDDOP.get_object_by_id(processData->get_device_value_presentation_object_id());
+								ProcessDataRoute route;
+
+								route.designator = processData->get_designator();
+								route.elementNumber = element->get_element_number();
+								route.dataDescriptionIndex = processData->get_ddi();
+								route.processDataObjectID = processData->get_object_id();
+								route.elementObjectID = element->get_object_id();
+
+								if ((nullptr != presentation) &&
+								    (task_controller_object::ObjectTypes::DeviceValuePresentation == presentation->get_object_type()))
+								{
+									auto valuePresentation = std::static_pointer_cast<task_controller_object::DeviceValuePresentationObject>(presentation);
+									route.unit = valuePresentation->get_designator();
+									route.offset = valuePresentation->get_offset();
+									route.scale = valuePresentation->get_scale();
+									route.numberOfDecimals = valuePresentation->get_number_of_decimals();
+								}
+								else
+								{
+									const auto &dictionaryEntry = DataDictionary::get_entry(route.dataDescriptionIndex);
+
+									if ((dictionaryEntry.ddi == route.dataDescriptionIndex) && (0.0f != dictionaryEntry.resolution))
+									{
+										route.unit = dictionaryEntry.unitSymbol;
+										route.scale = dictionaryEntry.resolution;
+									}
+								}
+								client->processDataRoutes[get_process_data_route_key(route.elementNumber, route.dataDescriptionIndex)] = route;
+							}
+						}
+					}
+				}
+				bind_process_data_handlers(*client);
+				LOG_DEBUG("[TC Server]: Built %u process data routes for client %hhu", static_cast<unsigned int>(client->processDataRoutes.size()), clientControlFunction->get_address());
+				retVal = true;
+			}
+			else
+			{
+				LOG_WARNING("[TC Server]: Unable to parse the DDOP of client %hhu, so its value commands will not be routed.", clientControlFunction->get_address());
+			}
+		}
+		return retVal;
+	}
+
+	std::uint32_t TaskControllerServer::get_process_data_route_key(std::uint16_t elementNumber, std::uint16_t dataDescriptionIndex)
 	{
+		return (static_cast<std::uint32_t>(elementNumber) << 16) | dataDescriptionIndex;
+	}
+
+	void TaskControllerServer::bind_process_data_handlers(ActiveClient &client) const
+	{
+		for (auto &route : client.processDataRoutes)
+		{
+			auto handler = processDataHandlers.find(route.second.dataDescriptionIndex);
+
+			if (processDataHandlers.end() != handler)
+			{
+				route.second.handler = handler->second;
+			}
+			else
+			{
+				route.second.handler = nullptr;
+			}
+		}
+	}
+
+	void TaskControllerServer::update_client_statistics()
+	{
+		for (const auto &client : activeClients)
+		{
+			std::uint32_t elapsedTime_ms = SystemTiming::get_time_elapsed_ms(client->statisticsWindowStartTimestamp_ms);
+
+			if (elapsedTime_ms >= STATISTICS_WINDOW_MS)
+			{
+				client->statistics.processDataMessagesPerSecond = static_cast<std::uint32_t>((static_cast<std::uint64_t>(client->processDataMessagesInWindow) * 1000) / elapsedTime_ms);
+				if (client->statistics.processDataMessagesPerSecond > client->statistics.peakProcessDataMessagesPerSecond)
+				{
+					client->statistics.peakProcessDataMessagesPerSecond = client->statistics.processDataMessagesPerSecond;
+				}
+				client->processDataMessagesInWindow = 0;
+				client->statisticsWindowStartTimestamp_ms = SystemTiming::get_timestamp_ms();
+			}
+		}
 	}
 
 	void TaskControllerServer::store_rx_message(const CANMessage &message, void *parentPointer)
@@ -208,6 +404,14 @@ namespace isobus
 			{
 				case static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData):
 				{
+					auto sourceClient = get_active_client(rxMessage.get_source_control_function());
+
+					if (nullptr != sourceClient)
+					{
+						sourceClient->statistics.processDataMessagesReceived++;
+						sourceClient->processDataMessagesInWindow++;
+					}
+
 					switch (static_cast<ProcessDataCommands>(rxData[0] & 0x0F))
 					{
 						case ProcessDataCommands::TechnicalCapabilities:
@@ -349,6 +553,8 @@ namespace isobus
 													LOG_INFO("[TC Server]: Client %hhu requests object pool transfer of %u bytes", rxMessage.get_source_control_function()->get_address(), requestedSize);
 
 													get_active_client(rxMessage.get_source_control_function())->clientDDOPsize_bytes = requestedSize;
+													sourceClient->transferredObjectPool.clear();
+													sourceClient->transferredObjectPool.reserve(requestedSize);
 													send_request_object_pool_transfer_response(rxMessage.get_source_control_function(), true);
 												}
 												else
@@ -378,6 +584,7 @@ namespace isobus
 
 												if (store_device_descriptor_object_pool(rxMessage.get_source_control_function(), objectPool, 0 != get_active_client(rxMessage.get_source_control_function())->numberOfObjectPoolSegments))
 												{
+													sourceClient->transferredObjectPool.insert(sourceClient->transferredObjectPool.end(), objectPool.begin(), objectPool.end());
 													LOG_INFO("[TC Server]: Stored DDOP segment for client %hhu", rxMessage.get_source_control_function()->get_address());
 													send_object_pool_transfer_response(rxMessage.get_source_control_function(), 0, static_cast<std::uint32_t>(objectPool.size())); // No error, transfer OK
 												}
@@ -414,6 +621,11 @@ namespace isobus
 													{
 														LOG_INFO("[TC Server]: Object pool activated for client %hhu", rxMessage.get_source_control_function()->get_address());
 														client->isDDOPActive = true;
+
+														if (!client->transferredObjectPool.empty())
+														{
+															build_process_data_routes(rxMessage.get_source_control_function(), client->transferredObjectPool);
+														}
 														send_object_pool_activate_deactivate_response(rxMessage.get_source_control_function(), 0, 0, 0xFFFF, 0xFFFF);
 													}
 													else
@@ -459,6 +671,8 @@ namespace isobus
 												if (delete_device_descriptor_object_pool(rxMessage.get_source_control_function(), errorCode))
 												{
 													LOG_INFO("[TC Server]: Deleted object pool for client %hhu", rxMessage.get_source_control_function()->get_address());
+													sourceClient->transferredObjectPool.clear();
+													sourceClient->processDataRoutes.clear();
 													send_delete_object_pool_response(rxMessage.get_source_control_function(), true, static_cast<std::uint8_t>(ObjectPoolDeletionErrors::ErrorDetailsNotAvailable));
 												}
 												else
@@ -540,18 +754,35 @@ namespace isobus
 						case ProcessDataCommands::Value:
 						case ProcessDataCommands::SetValueAndAcknowledge:
 						{
-							if (nullptr != get_active_client(rxMessage.get_source_control_function()))
+							if (nullptr != sourceClient)
 							{
-								if (get_active_client(rxMessage.get_source_control_function())->isDDOPActive)
+								if (sourceClient->isDDOPActive)
 								{
 									std::uint16_t DDI = rxMessage.get_uint16_at(2);
 									std::uint16_t elementNumber = static_cast<std::uint16_t>(rxData[0] >> 4) | (static_cast<std::uint16_t>(rxData[1]) << 4);
 									std::int32_t processVariableValue = rxMessage.get_int32_at(4);
 									std::uint8_t errorCodes = 0;
+									bool commandSucceeded = false;
+									auto route = sourceClient->processDataRoutes.find(get_process_data_route_key(elementNumber, DDI));
+
+									sourceClient->statistics.valueCommandsReceived++;
 
-									if (on_value_command(rxMessage.get_source_control_function(), DDI, elementNumber, processVariableValue, errorCodes))
+									if ((sourceClient->processDataRoutes.end() != route) && (nullptr != route->second.handler))
 									{
-										LOG_DEBUG("[TC Server]: Client %hhu value command for element %u DDI %s with value %s OK.", rxMessage.get_source_control_function()->get_address(), elementNumber, DataDictionary::ddi_to_string(DDI).c_str(), DataDictionary::format_value_with_ddi(DDI, processVariableValue).c_str());
+										sourceClient->statistics.routedValueCommands++;
+										commandSucceeded = route->second.handler(rxMessage.get_source_control_function(), route->second, processVariableValue, errorCodes);
+									}
+									else
+									{
+										commandSucceeded = on_value_command(rxMessage.get_source_control_function(), DDI, elementNumber, processVariableValue, errorCodes);
+									}
+
+									if (commandSucceeded)
+									{
+										if (CANStackLogger::LoggingLevel::Debug == CANStackLogger::get_log_level()) // Value commands can arrive at a high rate, so only format them if we are logging at debug level
+										{
+											LOG_DEBUG("[TC Server]: Client %hhu value command for element %u DDI %s with value %s OK.", rxMessage.get_source_control_function()->get_address(), elementNumber, DataDictionary::ddi_to_string(DDI).c_str(), DataDictionary::format_value_with_ddi(DDI, processVariableValue).c_str());
+										}
 
 										if (ProcessDataCommands::SetValueAndAcknowledge == static_cast<ProcessDataCommands>(rxData[0] & 0x0F))
 										{
@@ -809,6 +1040,15 @@ namespace isobus
 
 	std::shared_ptr<TaskControllerServer::ActiveClient> TaskControllerServer::get_active_client(std::shared_ptr<ControlFunction> clientControlFunction) const
 	{
+		for (const auto &activeClient : activeClients)
+		{
+			if ((nullptr != activeClient) &&
+			    (nullptr != clientControlFunction) &&
+			    (activeClient->clientControlFunction == clientControlFunction))
+			{
+				return activeClient; // Usually the same control function object, which is much cheaper to compare than the NAME
+			}
+		}
 		for (const auto &activeClient : activeClients)
 		{
 			if ((nullptr != activeClient) &&
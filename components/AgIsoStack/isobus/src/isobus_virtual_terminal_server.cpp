@@ -14,6 +14,7 @@
 #include "isobus/utility/system_timing.hpp"
 #include "isobus/utility/to_string.hpp"
 
+#include <algorithm>
 #include <iomanip>
 #include <sstream>
 
@@ -80,6 +81,17 @@ namespace isobus
 		return 0x7F;
 	}
 
+	bool VirtualTerminalServer::save_version(std::shared_ptr<const std::vector<std::uint8_t>> objectPool, const std::vector<std::uint8_t> &versionLabel, NAME clientNAME)
+	{
+		bool retVal = false;
+
+		if (nullptr != objectPool)
+		{
+			retVal = save_version(*objectPool, versionLabel, clientNAME);
+		}
+		return retVal;
+	}
+
 	void VirtualTerminalServer::identify_vt()
 	{
 		LOG_ERROR("[VT Server]: The Identify VT command is not implemented");
@@ -98,6 +110,11 @@ namespace isobus
 		return onRepaintEventDispatcher;
 	}
 
+	EventDispatcher<std::shared_ptr<VirtualTerminalServerManagedWorkingSet>, std::vector<VirtualTerminalServerManagedWorkingSet::DirtyRegion>> &VirtualTerminalServer::get_on_repaint_regions_event_dispatcher()
+	{
+		return onRepaintRegionsEventDispatcher;
+	}
+
 	EventDispatcher<std::shared_ptr<VirtualTerminalServerManagedWorkingSet>, std::uint16_t, std::uint16_t> &VirtualTerminalServer::get_on_change_active_mask_event_dispatcher()
 	{
 		return onChangeActiveMaskEventDispatcher;
@@ -113,6 +130,16 @@ namespace isobus
 		return onFocusObjectEventDispatcher;
 	}
 
+	void VirtualTerminalServer::set_repaint_frame_interval(std::uint32_t interval_ms)
+	{
+		repaintFrameInterval_ms = interval_ms;
+	}
+
+	std::uint32_t VirtualTerminalServer::get_repaint_frame_interval() const
+	{
+		return repaintFrameInterval_ms;
+	}
+
 	LanguageCommandInterface &VirtualTerminalServer::get_language_command_interface()
 	{
 		return languageCommandInterface;
@@ -185,20 +212,38 @@ namespace isobus
 				LOG_DEBUG("[VT Server]: Executing macro %u", macro->get_id());
 				retVal = true;
 
-				for (std::uint8_t j = 0; j < macro->get_number_of_commands(); j++)
+				bool wasCompiledMacroExecuted = false;
+				auto workingSetMacros = compiledMacros.find(workingSet);
+				if (compiledMacros.end() != workingSetMacros)
 				{
-					std::vector<std::uint8_t> commandPacket;
+					auto compiledMacro = workingSetMacros->second.find(objectIDOfMacro);
 
-					if (macro->get_command_packet(j, commandPacket))
+					// The pool may have changed since it was compiled, in which case we fall back to processing the raw commands
+					if ((workingSetMacros->second.end() != compiledMacro) &&
+					    (compiledMacro->second.macro == macro))
 					{
-						isobus::CANMessage message(isobus::CANMessage::Type::Receive,
-						                           isobus::CANIdentifier(0x14E70000),
-						                           commandPacket,
-						                           workingSet->get_control_function(),
-						                           get_internal_control_function(),
-						                           workingSet->get_control_function()->get_can_port());
-						LOG_DEBUG("[VT Server]: Executing macro command %u", j);
-						execute_macro_as_rx_message(message);
+						execute_compiled_macro(compiledMacro->second, workingSet);
+						wasCompiledMacroExecuted = true;
+					}
+				}
+
+				if (!wasCompiledMacroExecuted)
+				{
+					for (std::uint8_t j = 0; j < macro->get_number_of_commands(); j++)
+					{
+						std::vector<std::uint8_t> commandPacket;
+
+						if (macro->get_command_packet(j, commandPacket))
+						{
+							isobus::CANMessage message(isobus::CANMessage::Type::Receive,
+							                           isobus::CANIdentifier(0x14E70000),
+							                           commandPacket,
+							                           workingSet->get_control_function(),
+							                           get_internal_control_function(),
+							                           workingSet->get_control_function()->get_can_port());
+							LOG_DEBUG("[VT Server]: Executing macro command %u", j);
+							execute_macro_as_rx_message(message);
+						}
 					}
 				}
 			}
@@ -206,6 +251,140 @@ namespace isobus
 		return retVal;
 	}
 
+	void VirtualTerminalServer::compile_macros(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet)
+	{
+		auto &workingSetMacros = compiledMacros[workingSet];
+		const auto &objectTree = workingSet->get_object_tree();
+
+		workingSetMacros.clear();
+
+		for (const auto &object : objectTree)
+		{
+			if ((nullptr == object.second) || (VirtualTerminalObjectType::Macro != object.second->get_object_type()))
+			{
+				continue;
+			}
+
+			auto macro = std::static_pointer_cast<Macro>(object.second);
+			CompiledMacro compiledMacro;
+			compiledMacro.macro = macro;
+
+			for (std::uint8_t i = 0; i < macro->get_number_of_commands(); i++)
+			{
+				std::vector<std::uint8_t> commandPacket;
+
+				// Commands that aren't a full CAN frame would be ignored when executed, so they're dropped here
+				if ((!macro->get_command_packet(i, commandPacket)) ||
+				    (CAN_DATA_LENGTH != commandPacket.size()))
+				{
+					continue;
+				}
+
+				CompiledMacroCommand command;
+				std::copy(commandPacket.begin(), commandPacket.end(), command.commandPacket.begin());
+				command.objectID = static_cast<std::uint16_t>(static_cast<std::uint16_t>(commandPacket[1]) | (static_cast<std::uint16_t>(commandPacket[2]) << 8));
+				command.argument = commandPacket[3];
+				command.value = (static_cast<std::uint32_t>(commandPacket[4]) | (static_cast<std::uint32_t>(commandPacket[5]) << 8) | (static_cast<std::uint32_t>(commandPacket[6]) << 16) | (static_cast<std::uint32_t>(commandPacket[7]) << 24));
+				command.targetObject = VTObject::get_object_by_id(command.objectID, objectTree);
+
+				switch (static_cast<Function>(commandPacket[0]))
+				{
+					case Function::ChangeNumericValueCommand:
+					{
+						command.operation = CompiledMacroOperation::ChangeNumericValue;
+					}
+					break;
+
+					case Function::HideShowObjectCommand:
+					{
+						command.operation = CompiledMacroOperation::HideShowObject;
+					}
+					break;
+
+					case Function::EnableDisableObjectCommand:
+					{
+						command.operation = CompiledMacroOperation::EnableDisableObject;
+					}
+					break;
+
+					case Function::ChangeAttributeCommand:
+					{
+						command.operation = CompiledMacroOperation::ChangeAttribute;
+					}
+					break;
+
+					case Function::ChangeBackgroundColourCommand:
+					{
+						command.operation = CompiledMacroOperation::ChangeBackgroundColour;
+					}
+					break;
+
+					default:
+					{
+						command.operation = CompiledMacroOperation::ProcessAsMessage;
+						command.targetObject = nullptr;
+					}
+					break;
+				}
+				compiledMacro.commands.push_back(command);
+			}
+			workingSetMacros[macro->get_id()] = std::move(compiledMacro);
+		}
+		LOG_DEBUG("[VT Server]: Compiled %u macros", static_cast<unsigned int>(workingSetMacros.size()));
+	}
+
+	void VirtualTerminalServer::execute_compiled_macro(const CompiledMacro &compiledMacro, std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet)
+	{
+		for (const auto &command : compiledMacro.commands)
+		{
+			switch (command.operation)
+			{
+				case CompiledMacroOperation::ChangeNumericValue:
+				{
+					process_change_numeric_value_command(workingSet, command.targetObject, command.objectID, command.value);
+				}
+				break;
+
+				case CompiledMacroOperation::HideShowObject:
+				{
+					process_hide_show_object_command(workingSet, command.targetObject, command.objectID, command.argument);
+				}
+				break;
+
+				case CompiledMacroOperation::EnableDisableObject:
+				{
+					process_enable_disable_object_command(workingSet, command.targetObject, command.objectID, command.argument);
+				}
+				break;
+
+				case CompiledMacroOperation::ChangeAttribute:
+				{
+					process_change_attribute_command(workingSet, command.targetObject, command.objectID, command.argument, command.value);
+				}
+				break;
+
+				case CompiledMacroOperation::ChangeBackgroundColour:
+				{
+					process_change_background_colour_command(workingSet, command.targetObject, command.objectID, command.argument);
+				}
+				break;
+
+				case CompiledMacroOperation::ProcessAsMessage:
+				{
+					isobus::CANMessage message(isobus::CANMessage::Type::Receive,
+					                           isobus::CANIdentifier(0x14E70000),
+					                           command.commandPacket.data(),
+					                           static_cast<std::uint32_t>(command.commandPacket.size()),
+					                           workingSet->get_control_function(),
+					                           get_internal_control_function(),
+					                           workingSet->get_control_function()->get_can_port());
+					execute_macro_as_rx_message(message);
+				}
+				break;
+			}
+		}
+	}
+
 	CANIdentifier::CANPriority VirtualTerminalServer::get_priority() const
 	{
 		if (VTVersion::Version6 == get_version())
@@ -280,10 +459,11 @@ namespace isobus
 							{
 								case Function::ObjectPoolTransferMessage:
 								{
-									auto tempPool = data; // Make a copy of the data (ouch)
-									tempPool.erase(tempPool.begin()); // Strip off the mux byte (double ouch, good thing this is rare)
+									// The message is only lent to us, so this is the one copy of the pool. The mux byte is skipped while copying,
+									// and the working set then owns the buffer and shares it as immutable data for parsing and storing versions.
+									std::vector<std::uint8_t> tempPool(data.begin() + 1, data.end());
 									LOG_INFO("[VT Server]: An ecu at address %u transferred %u bytes of object pool data to us.", message.get_identifier().get_source_address(), static_cast<std::uint32_t>(tempPool.size()));
-									cf->add_iop_raw_data(tempPool);
+									cf->add_iop_raw_data(std::move(tempPool));
 								}
 								break;
 
@@ -467,7 +647,7 @@ namespace isobus
 									if (!loadedVersion.empty())
 									{
 										cf->set_iop_size(loadedVersion.size());
-										cf->add_iop_raw_data(loadedVersion);
+										cf->add_iop_raw_data(std::move(loadedVersion));
 									}
 									else
 									{
@@ -501,7 +681,7 @@ namespace isobus
 
 										for (std::size_t i = 0; i < cf->get_number_iop_files(); i++)
 										{
-											bool didSave = parentServer->save_version(cf->get_iop_raw_data(i), versionLabel, message.get_source_control_function()->get_NAME());
+											bool didSave = parentServer->save_version(cf->get_shared_iop_raw_data(i), versionLabel, message.get_source_control_function()->get_NAME());
 
 											if (didSave)
 											{
@@ -599,234 +779,21 @@ namespace isobus
 								{
 									std::uint32_t value = (static_cast<std::uint32_t>(data[4]) | (static_cast<std::uint32_t>(data[5]) << 8) | (static_cast<std::uint32_t>(data[6]) << 16) | (static_cast<std::uint32_t>(data[7]) << 24));
 									auto objectId = static_cast<std::uint16_t>(static_cast<std::uint16_t>(data[1]) | (static_cast<std::uint16_t>(data[2]) << 8));
-									auto lTargetObject = cf->get_object_by_id(objectId);
-									bool logSuccess = true;
-
-									if (nullptr != lTargetObject)
-									{
-										switch (lTargetObject->get_object_type())
-										{
-											case VirtualTerminalObjectType::InputBoolean:
-											{
-												std::static_pointer_cast<InputBoolean>(lTargetObject)->set_value(value);
-												parentServer->onRepaintEventDispatcher.call(cf);
-												parentServer->send_change_numeric_value_response(objectId, 0, value, cf->get_control_function());
-											}
-											break;
-
-											case VirtualTerminalObjectType::InputNumber:
-											{
-												std::static_pointer_cast<InputNumber>(lTargetObject)->set_value(value);
-												parentServer->onRepaintEventDispatcher.call(cf);
-												parentServer->send_change_numeric_value_response(objectId, 0, value, cf->get_control_function());
-											}
-											break;
-
-											case VirtualTerminalObjectType::InputList:
-											{
-												std::static_pointer_cast<InputList>(lTargetObject)->set_value(value);
-												parentServer->onRepaintEventDispatcher.call(cf);
-												parentServer->send_change_numeric_value_response(objectId, 0, value, cf->get_control_function());
-											}
-											break;
-
-											case VirtualTerminalObjectType::OutputNumber:
-											{
-												std::static_pointer_cast<OutputNumber>(lTargetObject)->set_value(value);
-												parentServer->onRepaintEventDispatcher.call(cf);
-												parentServer->send_change_numeric_value_response(objectId, 0, value, cf->get_control_function());
-											}
-											break;
-
-											case VirtualTerminalObjectType::OutputList:
-											{
-												std::static_pointer_cast<OutputList>(lTargetObject)->set_value(value);
-												parentServer->onRepaintEventDispatcher.call(cf);
-												parentServer->send_change_numeric_value_response(objectId, 0, value, cf->get_control_function());
-											}
-											break;
-
-											case VirtualTerminalObjectType::OutputMeter:
-											{
-												std::static_pointer_cast<OutputMeter>(lTargetObject)->set_value(value);
-												parentServer->onRepaintEventDispatcher.call(cf);
-												parentServer->send_change_numeric_value_response(objectId, 0, value, cf->get_control_function());
-											}
-											break;
-
-											case VirtualTerminalObjectType::OutputLinearBarGraph:
-											{
-												std::static_pointer_cast<OutputLinearBarGraph>(lTargetObject)->set_value(value);
-												parentServer->onRepaintEventDispatcher.call(cf);
-												parentServer->send_change_numeric_value_response(objectId, 0, value, cf->get_control_function());
-											}
-											break;
-
-											case VirtualTerminalObjectType::OutputArchedBarGraph:
-											{
-												std::static_pointer_cast<OutputArchedBarGraph>(lTargetObject)->set_value(value);
-												parentServer->onRepaintEventDispatcher.call(cf);
-												parentServer->send_change_numeric_value_response(objectId, 0, value, cf->get_control_function());
-											}
-											break;
-
-											case VirtualTerminalObjectType::NumberVariable:
-											{
-												std::static_pointer_cast<NumberVariable>(lTargetObject)->set_value(value);
-												parentServer->onRepaintEventDispatcher.call(cf);
-												parentServer->send_change_numeric_value_response(objectId, 0, value, cf->get_control_function());
-											}
-											break;
-
-											case VirtualTerminalObjectType::ObjectPointer:
-											{
-												std::static_pointer_cast<ObjectPointer>(lTargetObject)->set_value(value);
-												parentServer->onRepaintEventDispatcher.call(cf);
-												parentServer->send_change_numeric_value_response(objectId, 0, value, cf->get_control_function());
-											}
-											break;
-
-											case VirtualTerminalObjectType::ExternalObjectPointer:
-											{
-												std::uint16_t externalReferenceNAMEObjectIdD = (static_cast<std::uint16_t>(data[4]) | (static_cast<std::uint16_t>(data[5]) << 8));
-												std::uint16_t referencedObjectID = (static_cast<std::uint16_t>(data[6]) | (static_cast<std::uint16_t>(data[7]) << 8));
-												std::static_pointer_cast<ExternalObjectPointer>(lTargetObject)->set_external_reference_name_id(externalReferenceNAMEObjectIdD);
-												std::static_pointer_cast<ExternalObjectPointer>(lTargetObject)->set_external_object_id(referencedObjectID);
-												parentServer->send_change_numeric_value_response(objectId, 0, value, cf->get_control_function());
-												// Todo: event dispatcher
-											}
-											break;
-
-											case VirtualTerminalObjectType::Animation:
-											{
-												//Todo std::static_pointer_cast<Animation>(lTargetObject)->set_value(value);
-												// parentServer->onChangeNumericValueEventDispatcher.call(objectId, value);
-												parentServer->send_change_numeric_value_response(objectId, (1 << static_cast<std::uint8_t>(ChangeNumericValueErrorBit::AnyOtherError)), value, cf->get_control_function());
-												LOG_WARNING("[VT Server]: Client %u change numeric value for animation not implemented yet", cf->get_control_function()->get_address());
-												logSuccess = false;
-											}
-											break;
-
-											default:
-											{
-												parentServer->send_change_numeric_value_response(objectId, (1 << static_cast<std::uint8_t>(ChangeNumericValueErrorBit::InvalidObjectID)), value, cf->get_control_function());
-												LOG_WARNING("[VT Server]: Client %u change numeric value invalid object type. ID: %u", cf->get_control_function()->get_address(), objectId);
-												logSuccess = false;
-											}
-											break;
-										}
-
-										if (logSuccess)
-										{
-											LOG_DEBUG("[VT Server]: Client %u change numeric value command: change object ID %u to be %u", cf->get_control_function()->get_address(), objectId, value);
-											parentServer->process_macro(lTargetObject, isobus::EventID::OnChangeValue, lTargetObject->get_object_type(), cf);
-										}
-									}
-									else
-									{
-										parentServer->send_change_numeric_value_response(objectId, (1 << static_cast<std::uint8_t>(ChangeNumericValueErrorBit::InvalidObjectID)), value, cf->get_control_function());
-										LOG_WARNING("[VT Server]: Client %u change numeric value invalid object ID of %u", cf->get_control_function()->get_address(), objectId);
-									}
+									parentServer->process_change_numeric_value_command(cf, cf->get_object_by_id(objectId), objectId, value);
 								}
 								break;
 
 								case Function::HideShowObjectCommand:
 								{
 									auto objectId = static_cast<std::uint16_t>(static_cast<std::uint16_t>(data[1]) | (static_cast<std::uint16_t>(data[2]) << 8));
-									auto targetObject = cf->get_object_by_id(objectId);
-
-									if ((nullptr != targetObject) && (VirtualTerminalObjectType::Container == targetObject->get_object_type()))
-									{
-										std::static_pointer_cast<Container>(targetObject)->set_hidden(0 == data[3]);
-										parentServer->send_hide_show_object_response(objectId, 0, (0 != data[3]), cf->get_control_function());
-										parentServer->onRepaintEventDispatcher.call(cf);
-
-										if (0 == data[3])
-										{
-											LOG_DEBUG("[VT Server]: Client %u hide object command %u", cf->get_control_function()->get_address(), objectId);
-											parentServer->process_macro(targetObject, EventID::OnHide, targetObject->get_object_type(), cf);
-										}
-										else
-										{
-											LOG_DEBUG("[VT Server]: Client %u show object command %u", cf->get_control_function()->get_address(), objectId);
-											parentServer->process_macro(targetObject, EventID::OnShow, targetObject->get_object_type(), cf);
-										}
-									}
-									else
-									{
-										parentServer->send_hide_show_object_response(objectId, (1 << static_cast<std::uint8_t>(HideShowObjectErrorBit::InvalidObjectID)), (0 != data[3]), cf->get_control_function());
-										LOG_WARNING("[VT Server]: Client %u hide/show object command failed. It can only affect containers! ID: %u", cf->get_control_function()->get_address(), objectId);
-									}
+									parentServer->process_hide_show_object_command(cf, cf->get_object_by_id(objectId), objectId, data[3]);
 								}
 								break;
 
 								case Function::EnableDisableObjectCommand:
 								{
 									auto objectId = static_cast<std::uint16_t>(static_cast<std::uint16_t>(data[1]) | (static_cast<std::uint16_t>(data[2]) << 8));
-									auto lTargetObject = cf->get_object_by_id(objectId);
-
-									if (nullptr != lTargetObject)
-									{
-										if (data[3] <= 1)
-										{
-											switch (lTargetObject->get_object_type())
-											{
-												case VirtualTerminalObjectType::InputBoolean:
-												{
-													std::static_pointer_cast<InputBoolean>(lTargetObject)->set_enabled(0 != data[3]);
-													parentServer->send_enable_disable_object_response(objectId, 0, (0 != data[3]), cf->get_control_function());
-													parentServer->onRepaintEventDispatcher.call(cf);
-												}
-												break;
-
-												case VirtualTerminalObjectType::InputList:
-												{
-													std::static_pointer_cast<InputList>(lTargetObject)->set_option(InputList::Options::Enabled, (0 != data[3]));
-													parentServer->send_enable_disable_object_response(objectId, 0, (0 != data[3]), cf->get_control_function());
-													parentServer->onRepaintEventDispatcher.call(cf);
-												}
-												break;
-
-												case VirtualTerminalObjectType::InputString:
-												{
-													std::static_pointer_cast<InputString>(lTargetObject)->set_enabled((0 != data[3]));
-													parentServer->send_enable_disable_object_response(objectId, 0, (0 != data[3]), cf->get_control_function());
-													parentServer->onRepaintEventDispatcher.call(cf);
-												}
-												break;
-
-												case VirtualTerminalObjectType::InputNumber:
-												{
-													std::static_pointer_cast<InputNumber>(lTargetObject)->set_option2(InputNumber::Options2::Enabled, (0 != data[3]));
-													parentServer->send_enable_disable_object_response(objectId, 0, (0 != data[3]), cf->get_control_function());
-													parentServer->onRepaintEventDispatcher.call(cf);
-												}
-												break;
-
-												case VirtualTerminalObjectType::Button:
-												{
-													std::static_pointer_cast<Button>(lTargetObject)->set_option(Button::Options::Disabled, (0 == data[3]));
-													parentServer->send_enable_disable_object_response(objectId, 0, (0 != data[3]), cf->get_control_function());
-													parentServer->onRepaintEventDispatcher.call(cf);
-												}
-												break;
-
-												default:
-												{
-													parentServer->send_enable_disable_object_response(objectId, (1 << static_cast<std::uint8_t>(EnableDisableObjectErrorBit::InvalidObjectID)), (0 != data[3]), cf->get_control_function());
-												}
-												break;
-											}
-										}
-										else
-										{
-											parentServer->send_enable_disable_object_response(objectId, (1 << static_cast<std::uint8_t>(EnableDisableObjectErrorBit::InvalidEnableDisableCommandValue)), (0 != data[3]), cf->get_control_function());
-										}
-									}
-									else
-									{
-										parentServer->send_enable_disable_object_response(objectId, (1 << static_cast<std::uint8_t>(EnableDisableObjectErrorBit::InvalidObjectID)), (0 != data[3]), cf->get_control_function());
-									}
+									parentServer->process_enable_disable_object_command(cf, cf->get_object_by_id(objectId), objectId, data[3]);
 								}
 								break;
 
@@ -836,7 +803,7 @@ namespace isobus
 									auto objectID = static_cast<std::uint16_t>(static_cast<std::uint16_t>(data[3]) | (static_cast<std::uint16_t>(data[4]) << 8));
 									auto parentObject = cf->get_object_by_id(parentObjectId);
 
-									if (nullptr != parentObject)
+									if ((nullptr != parentObject) && cf->get_is_parent_of(parentObjectId, objectID))
 									{
 										auto lTargetObject = cf->get_object_by_id(objectID);
 
@@ -846,7 +813,7 @@ namespace isobus
 											auto yRelativeChange = static_cast<std::int8_t>(static_cast<std::int16_t>(data[6]) - 127);
 											bool anyObjectMatched = parentObject->offset_all_children_with_id(objectID, xRelativeChange, yRelativeChange);
 
-											parentServer->onRepaintEventDispatcher.call(cf);
+											cf->mark_object_dirty(parentObjectId);
 
 											if (anyObjectMatched)
 											{
@@ -869,7 +836,7 @@ namespace isobus
 									else
 									{
 										parentServer->send_change_child_location_response(parentObjectId, objectID, (1 << static_cast<std::uint8_t>(ChangeChildLocationorPositionErrorBit::ParentObjectDoesntExistOrIsNotAParentOfSpecifiedObject)), cf->get_control_function());
-										LOG_WARNING("[VT Server]: Client %u change child location failed because the parent object with ID %u doesn't exist", cf->get_control_function()->get_address(), parentObjectId);
+										LOG_WARNING("[VT Server]: Client %u change child location failed because the parent object with ID %u doesn't exist or isn't a parent of object %u", cf->get_control_function()->get_address(), parentObjectId, objectID);
 									}
 								}
 								break;
@@ -941,7 +908,7 @@ namespace isobus
 													}
 													stringVariable->set_value(newStringValue);
 													parentServer->send_change_string_value_response(objectIdToChange, 0, message.get_source_control_function());
-													parentServer->onRepaintEventDispatcher.call(cf);
+													cf->mark_object_dirty(objectIdToChange);
 													LOG_DEBUG("[VT Server]: Client %u change string value command for string variable object %u. Value: " + newStringValue, cf->get_control_function()->get_address(), objectIdToChange);
 												}
 												break;
@@ -958,7 +925,7 @@ namespace isobus
 													}
 													outputString->set_value(newStringValue);
 													parentServer->send_change_string_value_response(objectIdToChange, 0, message.get_source_control_function());
-													parentServer->onRepaintEventDispatcher.call(cf);
+													cf->mark_object_dirty(objectIdToChange);
 													LOG_DEBUG("[VT Server]: Client %u change string value command for output string object %u. Value: " + newStringValue, cf->get_control_function()->get_address(), objectIdToChange);
 												}
 												break;
@@ -975,7 +942,7 @@ namespace isobus
 													}
 													inputString->set_value(newStringValue);
 													parentServer->send_change_string_value_response(objectIdToChange, 0, message.get_source_control_function());
-													parentServer->onRepaintEventDispatcher.call(cf);
+													cf->mark_object_dirty(objectIdToChange);
 													LOG_DEBUG("[VT Server]: Client %u change string value command for input string object %u. Value: " + newStringValue, cf->get_control_function()->get_address(), objectIdToChange);
 												}
 												break;
@@ -1021,7 +988,7 @@ namespace isobus
 												fillObject->set_type(static_cast<FillAttributes::FillType>(data[3]));
 												fillObject->set_background_color(data[4]);
 												parentServer->send_change_fill_attributes_response(objectIdToChange, 0, message.get_source_control_function());
-												parentServer->onRepaintEventDispatcher.call(cf);
+												cf->mark_object_dirty(objectIdToChange);
 												LOG_DEBUG("[VT Server]: Client %u change fill attributes command for object %u", cf->get_control_function()->get_address(), objectIdToChange);
 											}
 											else
@@ -1080,7 +1047,7 @@ namespace isobus
 																wasFound = true;
 																parentObject->set_child_x(i, newXPosition);
 																parentObject->set_child_y(i, newYPosition);
-																parentServer->onRepaintEventDispatcher.call(cf);
+																cf->mark_object_dirty(parentObjectId);
 															}
 														}
 
@@ -1129,31 +1096,9 @@ namespace isobus
 								case Function::ChangeAttributeCommand:
 								{
 									auto objectID = static_cast<std::uint16_t>(static_cast<std::uint16_t>(data[1]) | (static_cast<std::uint16_t>(data[2]) << 8));
-									auto targetObject = cf->get_object_by_id(objectID);
 									std::uint8_t attributeID = data[3];
 									std::uint32_t attributeData = static_cast<std::uint32_t>(static_cast<std::uint32_t>(data[4]) | (static_cast<std::uint32_t>(data[5]) << 8) | (static_cast<std::uint32_t>(data[6]) << 16) | (static_cast<std::uint32_t>(data[7]) << 24));
-									VTObject::AttributeError errorCode = VTObject::AttributeError::AnyOtherError;
-
-									if ((NULL_OBJECT_ID != objectID) && (nullptr != targetObject))
-									{
-										if (targetObject->set_attribute(attributeID, attributeData, cf->get_object_tree(), errorCode)) // 0 Is always the read-only "type" attribute
-										{
-											parentServer->send_change_attribute_response(objectID, 0, data.at(3), message.get_source_control_function());
-											LOG_DEBUG("[VT Server]: Client %u changed object %u attribute %u to %u", cf->get_control_function()->get_address(), objectID, attributeID, attributeData);
-											parentServer->onRepaintEventDispatcher.call(cf);
-											parentServer->process_macro(targetObject, EventID::OnChangeAttribute, targetObject->get_object_type(), cf);
-										}
-										else
-										{
-											parentServer->send_change_attribute_response(objectID, (1 << static_cast<std::uint8_t>(errorCode)), data.at(3), message.get_source_control_function());
-											LOG_WARNING("[VT Server]: Client %u change object %u attribute %u to %ul error %u", cf->get_control_function()->get_address(), objectID, attributeID, attributeData, static_cast<std::uint8_t>(errorCode));
-										}
-									}
-									else
-									{
-										parentServer->send_change_attribute_response(objectID, (1 << static_cast<std::uint8_t>(VTObject::AttributeError::InvalidObjectID)), data.at(3), message.get_source_control_function());
-										LOG_WARNING("[VT Server]: Client %u change attribute %u invalid object ID of %u", cf->get_control_function()->get_address(), attributeID, objectID);
-									}
+									parentServer->process_change_attribute_command(cf, cf->get_object_by_id(objectID), objectID, attributeID, attributeData);
 								}
 								break;
 
@@ -1174,11 +1119,11 @@ namespace isobus
 											{
 												if (newWidth == newHeight) // Output meter must be square!
 												{
+													cf->mark_object_dirty(objectID); // Before resizing, so the area the object used to cover is redrawn too
 													targetObject->set_width(newWidth);
 													targetObject->set_height(newHeight);
 													success = true;
 													LOG_DEBUG("[VT Server]: Client %u change size command: Object: %u, Width: %u, Height: %u", cf->get_control_function()->get_address(), objectID, newWidth, newHeight);
-													parentServer->onRepaintEventDispatcher.call(cf);
 												}
 												else
 												{
@@ -1205,11 +1150,11 @@ namespace isobus
 											case VirtualTerminalObjectType::OutputRectangle:
 											case VirtualTerminalObjectType::OutputString:
 											{
+												cf->mark_object_dirty(objectID); // Before resizing, so the area the object used to cover is redrawn too
 												targetObject->set_width(newWidth);
 												targetObject->set_height(newHeight);
 												success = true;
 												LOG_DEBUG("[VT Server]: Client %u change size command: Object: %u, Width: %u, Height: %u", cf->get_control_function()->get_address(), objectID, newWidth, newHeight);
-												parentServer->onRepaintEventDispatcher.call(cf);
 											}
 											break;
 
@@ -1255,7 +1200,8 @@ namespace isobus
 													{
 														parentServer->send_change_list_item_response(objectID, newObjectID, 0, listIndex, message.get_source_control_function());
 														LOG_DEBUG("[VT Server]: Client %u change list item command: Object ID: %u, New Object ID: %u, Index: %u", cf->get_control_function()->get_address(), objectID, newObjectID, listIndex);
-														parentServer->onRepaintEventDispatcher.call(cf);
+														cf->update_object_references(objectID);
+														cf->mark_object_dirty(objectID);
 													}
 													else
 													{
@@ -1280,7 +1226,8 @@ namespace isobus
 													{
 														parentServer->send_change_list_item_response(objectID, newObjectID, 0, listIndex, message.get_source_control_function());
 														LOG_DEBUG("[VT Server]: Client %u change list item command: Object ID: %u, New Object ID: %u, Index: %u", cf->get_control_function()->get_address(), objectID, newObjectID, listIndex);
-														parentServer->onRepaintEventDispatcher.call(cf);
+														cf->update_object_references(objectID);
+														cf->mark_object_dirty(objectID);
 													}
 													else
 													{
@@ -1333,7 +1280,7 @@ namespace isobus
 											font->set_style(fontStyle);
 											LOG_DEBUG("[VT Server]: Client %u change font attributes command: ObjectID: %u", cf->get_control_function()->get_address(), objectID);
 											parentServer->send_change_font_attributes_response(objectID, 0, message.get_source_control_function());
-											parentServer->onRepaintEventDispatcher.call(cf);
+											cf->mark_object_dirty(objectID);
 										}
 										else
 										{
@@ -1421,49 +1368,8 @@ namespace isobus
 								case Function::ChangeBackgroundColourCommand:
 								{
 									auto objectID = static_cast<std::uint16_t>(static_cast<std::uint16_t>(data[1]) | (static_cast<std::uint16_t>(data[2]) << 8));
-									auto targetObject = cf->get_object_by_id(objectID);
 									std::uint8_t backgroundColour = data[3];
-
-									if (nullptr != targetObject)
-									{
-										switch (targetObject->get_object_type())
-										{
-											case VirtualTerminalObjectType::AuxiliaryInputType2:
-											case VirtualTerminalObjectType::WorkingSet:
-											case VirtualTerminalObjectType::DataMask:
-											case VirtualTerminalObjectType::AlarmMask:
-											case VirtualTerminalObjectType::SoftKeyMask:
-											case VirtualTerminalObjectType::Key:
-											case VirtualTerminalObjectType::Button:
-											case VirtualTerminalObjectType::InputNumber:
-											case VirtualTerminalObjectType::InputBoolean:
-											case VirtualTerminalObjectType::InputString:
-											case VirtualTerminalObjectType::OutputString:
-											case VirtualTerminalObjectType::OutputNumber:
-											case VirtualTerminalObjectType::GraphicsContext:
-											case VirtualTerminalObjectType::WindowMask:
-											{
-												targetObject->set_background_color(backgroundColour);
-												LOG_DEBUG("[VT Server]: Client %u change background colour command: colour = %u", cf->get_control_function()->get_address(), objectID, backgroundColour);
-												parentServer->send_change_background_colour_response(objectID, 0, backgroundColour, message.get_source_control_function());
-												parentServer->process_macro(targetObject, EventID::OnChangeBackgroundColour, targetObject->get_object_type(), cf);
-												parentServer->onRepaintEventDispatcher.call(cf);
-											}
-											break;
-
-											default:
-											{
-												LOG_WARNING("[VT Server]: Client %u change background colour command: invalid object type for object %u", cf->get_control_function()->get_address(), objectID);
-												parentServer->send_change_background_colour_response(objectID, (1 << static_cast<std::uint8_t>(ChangeBackgroundColourErrorBit::AnyOtherError)), backgroundColour, message.get_source_control_function());
-											}
-											break;
-										}
-									}
-									else
-									{
-										LOG_WARNING("[VT Server]: Client %u change background colour command: invalid object ID of %u", cf->get_control_function()->get_address(), objectID);
-										parentServer->send_change_background_colour_response(objectID, (1 << static_cast<std::uint8_t>(ChangeBackgroundColourErrorBit::InvalidObjectID)), backgroundColour, message.get_source_control_function());
-									}
+									parentServer->process_change_background_colour_command(cf, cf->get_object_by_id(objectID), objectID, backgroundColour);
 								}
 								break;
 
@@ -1677,6 +1583,7 @@ namespace isobus
 									if (parentServer->delete_object_pool(cf->get_control_function()->get_NAME()))
 									{
 										LOG_INFO("[VT Server]: Client %u object pool has been deactivated.", cf->get_control_function()->get_address());
+										parentServer->compiledMacros.erase(cf);
 										parentServer->send_delete_object_pool_response(0, message.get_source_control_function());
 									}
 									else
@@ -1704,6 +1611,7 @@ namespace isobus
 											if (polygon->change_point(polygonPointIndex, newXValue, newYValue))
 											{
 												LOG_DEBUG("[VT Server]: Client %u change polygon id %u point index %u. X = %u, Y = %u", cf->get_control_function()->get_address(), objectID, polygonPointIndex, newXValue, newYValue);
+												cf->mark_object_dirty(objectID);
 												parentServer->send_change_polygon_point_response(objectID, 0, message.get_source_control_function());
 											}
 											else
@@ -2216,6 +2124,322 @@ namespace isobus
 		}
 	}
 
+	void VirtualTerminalServer::process_change_numeric_value_command(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::shared_ptr<VTObject> targetObject, std::uint16_t objectID, std::uint32_t value)
+	{
+		bool logSuccess = true;
+
+		if (nullptr != targetObject)
+		{
+			switch (targetObject->get_object_type())
+			{
+				case VirtualTerminalObjectType::InputBoolean:
+				{
+					std::static_pointer_cast<InputBoolean>(targetObject)->set_value(value);
+					workingSet->mark_object_dirty(objectID);
+					send_change_numeric_value_response(objectID, 0, value, workingSet->get_control_function());
+				}
+				break;
+
+				case VirtualTerminalObjectType::InputNumber:
+				{
+					std::static_pointer_cast<InputNumber>(targetObject)->set_value(value);
+					workingSet->mark_object_dirty(objectID);
+					send_change_numeric_value_response(objectID, 0, value, workingSet->get_control_function());
+				}
+				break;
+
+				case VirtualTerminalObjectType::InputList:
+				{
+					std::static_pointer_cast<InputList>(targetObject)->set_value(value);
+					workingSet->mark_object_dirty(objectID);
+					send_change_numeric_value_response(objectID, 0, value, workingSet->get_control_function());
+				}
+				break;
+
+				case VirtualTerminalObjectType::OutputNumber:
+				{
+					std::static_pointer_cast<OutputNumber>(targetObject)->set_value(value);
+					workingSet->mark_object_dirty(objectID);
+					send_change_numeric_value_response(objectID, 0, value, workingSet->get_control_function());
+				}
+				break;
+
+				case VirtualTerminalObjectType::OutputList:
+				{
+					std::static_pointer_cast<OutputList>(targetObject)->set_value(value);
+					workingSet->mark_object_dirty(objectID);
+					send_change_numeric_value_response(objectID, 0, value, workingSet->get_control_function());
+				}
+				break;
+
+				case VirtualTerminalObjectType::OutputMeter:
+				{
+					std::static_pointer_cast<OutputMeter>(targetObject)->set_value(value);
+					workingSet->mark_object_dirty(objectID);
+					send_change_numeric_value_response(objectID, 0, value, workingSet->get_control_function());
+				}
+				break;
+
+				case VirtualTerminalObjectType::OutputLinearBarGraph:
+				{
+					std::static_pointer_cast<OutputLinearBarGraph>(targetObject)->set_value(value);
+					workingSet->mark_object_dirty(objectID);
+					send_change_numeric_value_response(objectID, 0, value, workingSet->get_control_function());
+				}
+				break;
+
+				case VirtualTerminalObjectType::OutputArchedBarGraph:
+				{
+					std::static_pointer_cast<OutputArchedBarGraph>(targetObject)->set_value(value);
+					workingSet->mark_object_dirty(objectID);
+					send_change_numeric_value_response(objectID, 0, value, workingSet->get_control_function());
+				}
+				break;
+
+				case VirtualTerminalObjectType::NumberVariable:
+				{
+					std::static_pointer_cast<NumberVariable>(targetObject)->set_value(value);
+					workingSet->mark_object_dirty(objectID);
+					send_change_numeric_value_response(objectID, 0, value, workingSet->get_control_function());
+				}
+				break;
+
+				case VirtualTerminalObjectType::ObjectPointer:
+				{
+					std::static_pointer_cast<ObjectPointer>(targetObject)->set_value(value);
+					workingSet->update_object_references(objectID);
+					workingSet->mark_object_dirty(objectID);
+					send_change_numeric_value_response(objectID, 0, value, workingSet->get_control_function());
+				}
+				break;
+
+				case VirtualTerminalObjectType::ExternalObjectPointer:
+				{
+					std::uint16_t externalReferenceNAMEObjectIdD = static_cast<std::uint16_t>(value & 0xFFFF);
+					std::uint16_t referencedObjectID = static_cast<std::uint16_t>(value >> 16);
+					std::static_pointer_cast<ExternalObjectPointer>(targetObject)->set_external_reference_name_id(externalReferenceNAMEObjectIdD);
+					std::static_pointer_cast<ExternalObjectPointer>(targetObject)->set_external_object_id(referencedObjectID);
+					send_change_numeric_value_response(objectID, 0, value, workingSet->get_control_function());
+					// Todo: event dispatcher
+				}
+				break;
+
+				case VirtualTerminalObjectType::Animation:
+				{
+					//Todo std::static_pointer_cast<Animation>(targetObject)->set_value(value);
+					// onChangeNumericValueEventDispatcher.call(objectID, value);
+					send_change_numeric_value_response(objectID, (1 << static_cast<std::uint8_t>(ChangeNumericValueErrorBit::AnyOtherError)), value, workingSet->get_control_function());
+					LOG_WARNING("[VT Server]: Client %u change numeric value for animation not implemented yet", workingSet->get_control_function()->get_address());
+					logSuccess = false;
+				}
+				break;
+
+				default:
+				{
+					send_change_numeric_value_response(objectID, (1 << static_cast<std::uint8_t>(ChangeNumericValueErrorBit::InvalidObjectID)), value, workingSet->get_control_function());
+					LOG_WARNING("[VT Server]: Client %u change numeric value invalid object type. ID: %u", workingSet->get_control_function()->get_address(), objectID);
+					logSuccess = false;
+				}
+				break;
+			}
+
+			if (logSuccess)
+			{
+				LOG_DEBUG("[VT Server]: Client %u change numeric value command: change object ID %u to be %u", workingSet->get_control_function()->get_address(), objectID, value);
+				process_macro(targetObject, isobus::EventID::OnChangeValue, targetObject->get_object_type(), workingSet);
+			}
+		}
+		else
+		{
+			send_change_numeric_value_response(objectID, (1 << static_cast<std::uint8_t>(ChangeNumericValueErrorBit::InvalidObjectID)), value, workingSet->get_control_function());
+			LOG_WARNING("[VT Server]: Client %u change numeric value invalid object ID of %u", workingSet->get_control_function()->get_address(), objectID);
+		}
+	}
+
+	void VirtualTerminalServer::process_hide_show_object_command(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::shared_ptr<VTObject> targetObject, std::uint16_t objectID, std::uint8_t show)
+	{
+		if ((nullptr != targetObject) && (VirtualTerminalObjectType::Container == targetObject->get_object_type()))
+		{
+			std::static_pointer_cast<Container>(targetObject)->set_hidden(0 == show);
+			send_hide_show_object_response(objectID, 0, (0 != show), workingSet->get_control_function());
+			workingSet->mark_object_dirty(objectID);
+
+			if (0 == show)
+			{
+				LOG_DEBUG("[VT Server]: Client %u hide object command %u", workingSet->get_control_function()->get_address(), objectID);
+				process_macro(targetObject, EventID::OnHide, targetObject->get_object_type(), workingSet);
+			}
+			else
+			{
+				LOG_DEBUG("[VT Server]: Client %u show object command %u", workingSet->get_control_function()->get_address(), objectID);
+				process_macro(targetObject, EventID::OnShow, targetObject->get_object_type(), workingSet);
+			}
+		}
+		else
+		{
+			send_hide_show_object_response(objectID, (1 << static_cast<std::uint8_t>(HideShowObjectErrorBit::InvalidObjectID)), (0 != show), workingSet->get_control_function());
+			LOG_WARNING("[VT Server]: Client %u hide/show object command failed. It can only affect containers! ID: %u", workingSet->get_control_function()->get_address(), objectID);
+		}
+	}
+
+	void VirtualTerminalServer::process_enable_disable_object_command(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::shared_ptr<VTObject> targetObject, std::uint16_t objectID, std::uint8_t enable)
+	{
+		if (nullptr != targetObject)
+		{
+			if (enable <= 1)
+			{
+				switch (targetObject->get_object_type())
+				{
+					case VirtualTerminalObjectType::InputBoolean:
+					{
+						std::static_pointer_cast<InputBoolean>(targetObject)->set_enabled(0 != enable);
+						send_enable_disable_object_response(objectID, 0, (0 != enable), workingSet->get_control_function());
+						workingSet->mark_object_dirty(objectID);
+					}
+					break;
+
+					case VirtualTerminalObjectType::InputList:
+					{
+						std::static_pointer_cast<InputList>(targetObject)->set_option(InputList::Options::Enabled, (0 != enable));
+						send_enable_disable_object_response(objectID, 0, (0 != enable), workingSet->get_control_function());
+						workingSet->mark_object_dirty(objectID);
+					}
+					break;
+
+					case VirtualTerminalObjectType::InputString:
+					{
+						std::static_pointer_cast<InputString>(targetObject)->set_enabled((0 != enable));
+						send_enable_disable_object_response(objectID, 0, (0 != enable), workingSet->get_control_function());
+						workingSet->mark_object_dirty(objectID);
+					}
+					break;
+
+					case VirtualTerminalObjectType::InputNumber:
+					{
+						std::static_pointer_cast<InputNumber>(targetObject)->set_option2(InputNumber::Options2::Enabled, (0 != enable));
+						send_enable_disable_object_response(objectID, 0, (0 != enable), workingSet->get_control_function());
+						workingSet->mark_object_dirty(objectID);
+					}
+					break;
+
+					case VirtualTerminalObjectType::Button:
+					{
+						std::static_pointer_cast<Button>(targetObject)->set_option(Button::Options::Disabled, (0 == enable));
+						send_enable_disable_object_response(objectID, 0, (0 != enable), workingSet->get_control_function());
+						workingSet->mark_object_dirty(objectID);
+					}
+					break;
+
+					default:
+					{
+						send_enable_disable_object_response(objectID, (1 << static_cast<std::uint8_t>(EnableDisableObjectErrorBit::InvalidObjectID)), (0 != enable), workingSet->get_control_function());
+					}
+					break;
+				}
+			}
+			else
+			{
+				send_enable_disable_object_response(objectID, (1 << static_cast<std::uint8_t>(EnableDisableObjectErrorBit::InvalidEnableDisableCommandValue)), (0 != enable), workingSet->get_control_function());
+			}
+		}
+		else
+		{
+			send_enable_disable_object_response(objectID, (1 << static_cast<std::uint8_t>(EnableDisableObjectErrorBit::InvalidObjectID)), (0 != enable), workingSet->get_control_function());
+		}
+	}
+
+	void VirtualTerminalServer::process_change_attribute_command(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::shared_ptr<VTObject> targetObject, std::uint16_t objectID, std::uint8_t attributeID, std::uint32_t attributeData)
+	{
+		VTObject::AttributeError errorCode = VTObject::AttributeError::AnyOtherError;
+
+		if ((NULL_OBJECT_ID != objectID) && (nullptr != targetObject))
+		{
+			// Marked before the change so that a size attribute shrinking the object still redraws its old area.
+			// If the change is rejected the object is unchanged, and redrawing it is harmless.
+			workingSet->mark_object_dirty(objectID);
+
+			std::uint32_t previousAttributeData = 0;
+			bool canRevert = targetObject->get_attribute(attributeID, previousAttributeData);
+			bool wasChanged = targetObject->set_attribute(attributeID, attributeData, workingSet->get_object_tree(), errorCode); // 0 Is always the read-only "type" attribute
+
+			if (wasChanged)
+			{
+				// Only the changed object and the objects that refer to it can have become invalid, so there's no need to validate the whole pool
+				workingSet->update_object_references(objectID);
+
+				if (canRevert && (!workingSet->get_is_object_neighbourhood_valid(objectID)))
+				{
+					VTObject::AttributeError revertError = VTObject::AttributeError::AnyOtherError;
+					targetObject->set_attribute(attributeID, previousAttributeData, workingSet->get_object_tree(), revertError);
+					workingSet->update_object_references(objectID);
+					errorCode = VTObject::AttributeError::AnyOtherError;
+					wasChanged = false;
+				}
+			}
+
+			if (wasChanged)
+			{
+				send_change_attribute_response(objectID, 0, attributeID, workingSet->get_control_function());
+				LOG_DEBUG("[VT Server]: Client %u changed object %u attribute %u to %u", workingSet->get_control_function()->get_address(), objectID, attributeID, attributeData);
+				process_macro(targetObject, EventID::OnChangeAttribute, targetObject->get_object_type(), workingSet);
+			}
+			else
+			{
+				send_change_attribute_response(objectID, (1 << static_cast<std::uint8_t>(errorCode)), attributeID, workingSet->get_control_function());
+				LOG_WARNING("[VT Server]: Client %u change object %u attribute %u to %ul error %u", workingSet->get_control_function()->get_address(), objectID, attributeID, attributeData, static_cast<std::uint8_t>(errorCode));
+			}
+		}
+		else
+		{
+			send_change_attribute_response(objectID, (1 << static_cast<std::uint8_t>(VTObject::AttributeError::InvalidObjectID)), attributeID, workingSet->get_control_function());
+			LOG_WARNING("[VT Server]: Client %u change attribute %u invalid object ID of %u", workingSet->get_control_function()->get_address(), attributeID, objectID);
+		}
+	}
+
+	void VirtualTerminalServer::process_change_background_colour_command(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::shared_ptr<VTObject> targetObject, std::uint16_t objectID, std::uint8_t backgroundColour)
+	{
+		if (nullptr != targetObject)
+		{
+			switch (targetObject->get_object_type())
+			{
+				case VirtualTerminalObjectType::AuxiliaryInputType2:
+				case VirtualTerminalObjectType::WorkingSet:
+				case VirtualTerminalObjectType::DataMask:
+				case VirtualTerminalObjectType::AlarmMask:
+				case VirtualTerminalObjectType::SoftKeyMask:
+				case VirtualTerminalObjectType::Key:
+				case VirtualTerminalObjectType::Button:
+				case VirtualTerminalObjectType::InputNumber:
+				case VirtualTerminalObjectType::InputBoolean:
+				case VirtualTerminalObjectType::InputString:
+				case VirtualTerminalObjectType::OutputString:
+				case VirtualTerminalObjectType::OutputNumber:
+				case VirtualTerminalObjectType::GraphicsContext:
+				case VirtualTerminalObjectType::WindowMask:
+				{
+					targetObject->set_background_color(backgroundColour);
+					LOG_DEBUG("[VT Server]: Client %u change background colour command: colour = %u", workingSet->get_control_function()->get_address(), objectID, backgroundColour);
+					send_change_background_colour_response(objectID, 0, backgroundColour, workingSet->get_control_function());
+					process_macro(targetObject, EventID::OnChangeBackgroundColour, targetObject->get_object_type(), workingSet);
+					workingSet->mark_object_dirty(objectID);
+				}
+				break;
+
+				default:
+				{
+					LOG_WARNING("[VT Server]: Client %u change background colour command: invalid object type for object %u", workingSet->get_control_function()->get_address(), objectID);
+					send_change_background_colour_response(objectID, (1 << static_cast<std::uint8_t>(ChangeBackgroundColourErrorBit::AnyOtherError)), backgroundColour, workingSet->get_control_function());
+				}
+				break;
+			}
+		}
+		else
+		{
+			LOG_WARNING("[VT Server]: Client %u change background colour command: invalid object ID of %u", workingSet->get_control_function()->get_address(), objectID);
+			send_change_background_colour_response(objectID, (1 << static_cast<std::uint8_t>(ChangeBackgroundColourErrorBit::InvalidObjectID)), backgroundColour, workingSet->get_control_function());
+		}
+	}
+
 	bool VirtualTerminalServer::send_change_numeric_value_response(std::uint16_t objectID, std::uint8_t errorBitfield, std::uint32_t value, std::shared_ptr<ControlFunction> destination) const
 	{
 		bool retVal = false;
@@ -2645,9 +2869,28 @@ namespace isobus
 
 		for (auto &ws : managedWorkingSetList)
 		{
+			if ((ws->get_any_objects_dirty()) &&
+			    (isobus::SystemTiming::time_expired_ms(ws->get_last_repaint_timestamp_ms(), repaintFrameInterval_ms)))
+			{
+				std::vector<VirtualTerminalServerManagedWorkingSet::DirtyRegion> dirtyRegions;
+				auto workingSetObject = ws->get_working_set_object();
+
+				if ((nullptr != workingSetObject) && (VirtualTerminalObjectType::WorkingSet == workingSetObject->get_object_type()))
+				{
+					dirtyRegions = ws->get_dirty_regions(std::static_pointer_cast<WorkingSet>(workingSetObject)->get_active_mask(),
+					                                     get_data_mask_area_size_x_pixels(),
+					                                     get_data_mask_area_size_y_pixels());
+				}
+				onRepaintEventDispatcher.call(ws);
+				onRepaintRegionsEventDispatcher.call(ws, dirtyRegions);
+				ws->clear_dirty_objects();
+				ws->set_last_repaint_timestamp_ms(isobus::SystemTiming::get_timestamp_ms());
+			}
+
 			if (VirtualTerminalServerManagedWorkingSet::ObjectPoolProcessingThreadState::Success == ws->get_object_pool_processing_state())
 			{
 				ws->join_parsing_thread();
+				compile_macros(ws);
 				send_end_of_object_pool_response(true, NULL_OBJECT_ID, NULL_OBJECT_ID, 0, ws->get_control_function());
 				if (isobus::NULL_CAN_ADDRESS == activeWorkingSetMasterAddress)
 				{
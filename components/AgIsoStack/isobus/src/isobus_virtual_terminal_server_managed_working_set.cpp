@@ -12,6 +12,7 @@
 #include "isobus/isobus/can_stack_logger.hpp"
 #include "isobus/utility/to_string.hpp"
 
+#include <algorithm>
 #include <cstring>
 
 namespace isobus
@@ -185,7 +186,7 @@ namespace isobus
 			         " IOP components.");
 			for (std::size_t i = 0; i < iopFilesRawData.size(); i++)
 			{
-				if (!parse_iop_into_objects(iopFilesRawData[i].data(), static_cast<std::uint32_t>(iopFilesRawData[i].size())))
+				if (!parse_iop_into_objects(iopFilesRawData[i]->data(), static_cast<std::uint32_t>(iopFilesRawData[i]->size())))
 				{
 					lSuccess = false;
 					break;
@@ -215,4 +216,200 @@ namespace isobus
 		return iop_load_percentage() != 0.0f;
 	}
 
+	void VirtualTerminalServerManagedWorkingSet::mark_object_dirty(std::uint16_t objectID)
+	{
+		const std::lock_guard<std::mutex> lock(managedWorkingSetMutex);
+		std::uint16_t currentWidth = 0;
+		std::uint16_t currentHeight = 0;
+		auto object = vtObjectTree.find(objectID);
+
+		if ((vtObjectTree.end() != object) && (nullptr != object->second))
+		{
+			currentWidth = object->second->get_width();
+			currentHeight = object->second->get_height();
+		}
+
+		auto dirtyObject = std::find_if(dirtyObjects.begin(), dirtyObjects.end(), [objectID](const DirtyObject &entry) { return entry.objectID == objectID; });
+
+		if (dirtyObjects.end() == dirtyObject)
+		{
+			dirtyObjects.push_back({ objectID, currentWidth, currentHeight });
+		}
+		else
+		{
+			dirtyObject->width = std::max(dirtyObject->width, currentWidth);
+			dirtyObject->height = std::max(dirtyObject->height, currentHeight);
+		}
+	}
+
+	bool VirtualTerminalServerManagedWorkingSet::get_any_objects_dirty()
+	{
+		const std::lock_guard<std::mutex> lock(managedWorkingSetMutex);
+		return !dirtyObjects.empty();
+	}
+
+	std::vector<std::uint16_t> VirtualTerminalServerManagedWorkingSet::get_dirty_objects()
+	{
+		const std::lock_guard<std::mutex> lock(managedWorkingSetMutex);
+		std::vector<std::uint16_t> retVal;
+
+		retVal.reserve(dirtyObjects.size());
+		for (const auto &dirtyObject : dirtyObjects)
+		{
+			retVal.push_back(dirtyObject.objectID);
+		}
+		return retVal;
+	}
+
+	void VirtualTerminalServerManagedWorkingSet::clear_dirty_objects()
+	{
+		const std::lock_guard<std::mutex> lock(managedWorkingSetMutex);
+		dirtyObjects.clear();
+	}
+
+	std::vector<VirtualTerminalServerManagedWorkingSet::DirtyRegion> VirtualTerminalServerManagedWorkingSet::get_dirty_regions(std::uint16_t maskObjectID, std::uint16_t maskWidth, std::uint16_t maskHeight)
+	{
+		const std::lock_guard<std::mutex> lock(managedWorkingSetMutex);
+		std::vector<DirtyRegion> retVal;
+		auto mask = vtObjectTree.find(maskObjectID);
+
+		if ((vtObjectTree.end() == mask) || (nullptr == mask->second) || dirtyObjects.empty())
+		{
+			return retVal;
+		}
+
+		if (dirtyObjects.end() != std::find_if(dirtyObjects.begin(), dirtyObjects.end(), [maskObjectID](const DirtyObject &entry) { return entry.objectID == maskObjectID; }))
+		{
+			// Something like the background colour of the mask changed, so everything needs to be redrawn
+			retVal.push_back({ maskObjectID, 0, 0, maskWidth, maskHeight });
+			return retVal;
+		}
+
+		// An object needs a repaint if it is dirty, or if it draws using a dirty object
+		std::vector<std::uint16_t> affectedObjects;
+
+		for (const auto &dirtyObject : dirtyObjects)
+		{
+			auto referencingObjectIDs = get_referencing_object_ids(dirtyObject.objectID);
+			affectedObjects.push_back(dirtyObject.objectID);
+			affectedObjects.insert(affectedObjects.end(), referencingObjectIDs.begin(), referencingObjectIDs.end());
+		}
+		std::sort(affectedObjects.begin(), affectedObjects.end());
+
+		for (std::uint16_t i = 0; i < mask->second->get_number_children(); i++)
+		{
+			collect_dirty_regions(mask->second->get_child_id(i), mask->second->get_child_x(i), mask->second->get_child_y(i), 0, affectedObjects, retVal);
+		}
+
+		// Coalesce the regions by dropping any region that is already covered by another one
+		std::vector<DirtyRegion> coalescedRegions;
+		coalescedRegions.reserve(retVal.size());
+
+		for (std::size_t i = 0; i < retVal.size(); i++)
+		{
+			bool isCovered = false;
+
+			for (std::size_t j = 0; j < retVal.size(); j++)
+			{
+				const DirtyRegion &inner = retVal[i];
+				const DirtyRegion &outer = retVal[j];
+
+				if ((i != j) &&
+				    (outer.xPosition <= inner.xPosition) &&
+				    (outer.yPosition <= inner.yPosition) &&
+				    ((outer.xPosition + outer.width) >= (inner.xPosition + inner.width)) &&
+				    ((outer.yPosition + outer.height) >= (inner.yPosition + inner.height)))
+				{
+					bool isIdentical = ((outer.xPosition == inner.xPosition) &&
+					                    (outer.yPosition == inner.yPosition) &&
+					                    (outer.width == inner.width) &&
+					                    (outer.height == inner.height));
+
+					// For identical regions, keep only the first one
+					if ((!isIdentical) || (j < i))
+					{
+						isCovered = true;
+						break;
+					}
+				}
+			}
+
+			if (!isCovered)
+			{
+				coalescedRegions.push_back(retVal[i]);
+			}
+		}
+		return coalescedRegions;
+	}
+
+	std::uint32_t VirtualTerminalServerManagedWorkingSet::get_last_repaint_timestamp_ms() const
+	{
+		return lastRepaintTimestamp_ms;
+	}
+
+	void VirtualTerminalServerManagedWorkingSet::set_last_repaint_timestamp_ms(std::uint32_t value)
+	{
+		lastRepaintTimestamp_ms = value;
+	}
+
+	void VirtualTerminalServerManagedWorkingSet::collect_dirty_regions(std::uint16_t objectID, std::int32_t xPosition, std::int32_t yPosition, std::uint8_t depth, const std::vector<std::uint16_t> &affectedObjects, std::vector<DirtyRegion> &regions)
+	{
+		constexpr std::uint8_t MAX_OBJECT_TREE_DEPTH = 32; // Deeper nesting than this is almost certainly a cyclic reference
+		auto objectEntry = vtObjectTree.find(objectID);
+
+		if ((depth > MAX_OBJECT_TREE_DEPTH) ||
+		    (vtObjectTree.end() == objectEntry) ||
+		    (nullptr == objectEntry->second))
+		{
+			return;
+		}
+
+		const auto &object = objectEntry->second;
+		auto dirtyObject = std::find_if(dirtyObjects.begin(), dirtyObjects.end(), [objectID](const DirtyObject &entry) { return entry.objectID == objectID; });
+		bool isDirty = (dirtyObjects.end() != dirtyObject);
+		std::uint16_t width = object->get_width();
+		std::uint16_t height = object->get_height();
+
+		if (isDirty)
+		{
+			width = std::max(width, dirtyObject->width);
+			height = std::max(height, dirtyObject->height);
+
+			if (VirtualTerminalObjectType::ObjectPointer == object->get_object_type())
+			{
+				// Object pointers have no size of their own, they are drawn as the object they point to
+				auto pointedObject = vtObjectTree.find(std::static_pointer_cast<ObjectPointer>(object)->get_value());
+
+				if ((vtObjectTree.end() != pointedObject) && (nullptr != pointedObject->second))
+				{
+					width = std::max(width, pointedObject->second->get_width());
+					height = std::max(height, pointedObject->second->get_height());
+				}
+			}
+		}
+
+		if (isDirty || std::binary_search(affectedObjects.begin(), affectedObjects.end(), objectID))
+		{
+			// The whole object is redrawn, which includes its children
+			regions.push_back({ objectID, xPosition, yPosition, width, height });
+		}
+		else if (VirtualTerminalObjectType::ObjectPointer == object->get_object_type())
+		{
+			collect_dirty_regions(std::static_pointer_cast<ObjectPointer>(object)->get_value(), xPosition, yPosition, depth + 1, affectedObjects, regions);
+		}
+		else if ((VirtualTerminalObjectType::Container != object->get_object_type()) ||
+		         (!std::static_pointer_cast<Container>(object)->get_hidden()))
+		{
+			for (std::uint16_t i = 0; i < object->get_number_children(); i++)
+			{
+				collect_dirty_regions(object->get_child_id(i),
+				                      xPosition + object->get_child_x(i),
+				                      yPosition + object->get_child_y(i),
+				                      depth + 1,
+				                      affectedObjects,
+				                      regions);
+			}
+		}
+	}
+
 } // namespace isobus
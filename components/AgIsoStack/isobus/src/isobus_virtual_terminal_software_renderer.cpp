@@ -0,0 +1,1021 @@
+//================================================================================================
+/// @file isobus_virtual_terminal_software_renderer.cpp
+///
+/// @brief Implements a software rasterizer that draws VT server masks into an RGB framebuffer.
+/// @author The Little Dawn Developers
+///
+/// @copyright 2026 The Little Dawn Developers
+//================================================================================================
+#include "isobus/isobus/isobus_virtual_terminal_software_renderer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+namespace isobus
+{
+	VirtualTerminalSoftwareRenderer::VirtualTerminalSoftwareRenderer(std::uint16_t width, std::uint16_t height) :
+	  framebuffer(static_cast<std::size_t>(width) * height * 3, 0),
+	  frameWidth(width),
+	  frameHeight(height)
+	{
+	}
+
+	bool VirtualTerminalSoftwareRenderer::render(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::uint16_t maskObjectID)
+	{
+		ClipRectangle clip = { 0, 0, frameWidth, frameHeight };
+		return draw_mask(workingSet, maskObjectID, clip);
+	}
+
+	bool VirtualTerminalSoftwareRenderer::render_regions(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet,
+	                                                     std::uint16_t maskObjectID,
+	                                                     const std::vector<VirtualTerminalServerManagedWorkingSet::DirtyRegion> &regions)
+	{
+		bool retVal = true;
+
+		for (const auto &region : regions)
+		{
+			ClipRectangle clip;
+			clip.left = std::max<std::int32_t>(0, region.xPosition);
+			clip.top = std::max<std::int32_t>(0, region.yPosition);
+			clip.right = std::min<std::int32_t>(frameWidth, region.xPosition + region.width);
+			clip.bottom = std::min<std::int32_t>(frameHeight, region.yPosition + region.height);
+
+			if ((clip.left < clip.right) && (clip.top < clip.bottom))
+			{
+				retVal = draw_mask(workingSet, maskObjectID, clip);
+
+				if (!retVal)
+				{
+					break;
+				}
+			}
+		}
+		return retVal;
+	}
+
+	void VirtualTerminalSoftwareRenderer::invalidate_object(std::uint16_t objectID)
+	{
+		for (auto cachedObject = bitmapCache.begin(); cachedObject != bitmapCache.end();)
+		{
+			const auto &dependencies = cachedObject->second.dependencies;
+
+			if ((objectID == cachedObject->first) ||
+			    (dependencies.end() != std::find(dependencies.begin(), dependencies.end(), objectID)))
+			{
+				cachedObject = bitmapCache.erase(cachedObject);
+			}
+			else
+			{
+				++cachedObject;
+			}
+		}
+	}
+
+	void VirtualTerminalSoftwareRenderer::invalidate_objects(const std::vector<std::uint16_t> &objectIDs)
+	{
+		for (auto objectID : objectIDs)
+		{
+			invalidate_object(objectID);
+		}
+	}
+
+	void VirtualTerminalSoftwareRenderer::invalidate_all()
+	{
+		bitmapCache.clear();
+	}
+
+	std::size_t VirtualTerminalSoftwareRenderer::get_number_of_cached_objects() const
+	{
+		return bitmapCache.size();
+	}
+
+	std::uint32_t VirtualTerminalSoftwareRenderer::get_cache_hits() const
+	{
+		return cacheHits;
+	}
+
+	std::uint32_t VirtualTerminalSoftwareRenderer::get_cache_misses() const
+	{
+		return cacheMisses;
+	}
+
+	std::uint16_t VirtualTerminalSoftwareRenderer::get_width() const
+	{
+		return frameWidth;
+	}
+
+	std::uint16_t VirtualTerminalSoftwareRenderer::get_height() const
+	{
+		return frameHeight;
+	}
+
+	const std::vector<std::uint8_t> &VirtualTerminalSoftwareRenderer::get_framebuffer() const
+	{
+		return framebuffer;
+	}
+
+	std::uint32_t VirtualTerminalSoftwareRenderer::get_pixel(std::uint16_t x, std::uint16_t y) const
+	{
+		std::uint32_t retVal = 0;
+
+		if ((x < frameWidth) && (y < frameHeight))
+		{
+			std::size_t index = (static_cast<std::size_t>(y) * frameWidth + x) * 3;
+			retVal = (static_cast<std::uint32_t>(framebuffer.at(index)) << 16) |
+			  (static_cast<std::uint32_t>(framebuffer.at(index + 1)) << 8) |
+			  framebuffer.at(index + 2);
+		}
+		return retVal;
+	}
+
+	std::vector<std::uint8_t> VirtualTerminalSoftwareRenderer::encode_png() const
+	{
+		constexpr std::size_t MAX_STORED_BLOCK_SIZE = 65535;
+		const std::size_t rowLength = static_cast<std::size_t>(frameWidth) * 3;
+		std::vector<std::uint8_t> retVal = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+		std::vector<std::uint8_t> header = {
+			static_cast<std::uint8_t>(frameWidth >> 24),
+			static_cast<std::uint8_t>(frameWidth >> 16),
+			static_cast<std::uint8_t>(frameWidth >> 8),
+			static_cast<std::uint8_t>(frameWidth),
+			static_cast<std::uint8_t>(frameHeight >> 24),
+			static_cast<std::uint8_t>(frameHeight >> 16),
+			static_cast<std::uint8_t>(frameHeight >> 8),
+			static_cast<std::uint8_t>(frameHeight),
+			8, // Bit depth
+			2, // Colour type RGB
+			0, // Deflate compression
+			0, // Adaptive filtering
+			0 // No interlacing
+		};
+		append_png_chunk(retVal, "IHDR", header);
+
+		// Each scanline is prefixed with its filter type, which is always "none"
+		std::vector<std::uint8_t> scanlines;
+		scanlines.reserve((rowLength + 1) * frameHeight);
+		for (std::size_t row = 0; row < frameHeight; row++)
+		{
+			scanlines.push_back(0);
+			scanlines.insert(scanlines.end(), framebuffer.begin() + (row * rowLength), framebuffer.begin() + ((row + 1) * rowLength));
+		}
+
+		// Wrap the scanlines in a zlib stream made of uncompressed deflate blocks
+		std::vector<std::uint8_t> imageData = { 0x78, 0x01 };
+		std::size_t offset = 0;
+		do
+		{
+			std::size_t blockSize = std::min(MAX_STORED_BLOCK_SIZE, scanlines.size() - offset);
+			bool isFinalBlock = ((offset + blockSize) == scanlines.size());
+
+			imageData.push_back(isFinalBlock ? 1 : 0);
+			imageData.push_back(static_cast<std::uint8_t>(blockSize));
+			imageData.push_back(static_cast<std::uint8_t>(blockSize >> 8));
+			imageData.push_back(static_cast<std::uint8_t>(~blockSize));
+			imageData.push_back(static_cast<std::uint8_t>(~blockSize >> 8));
+			imageData.insert(imageData.end(), scanlines.begin() + offset, scanlines.begin() + offset + blockSize);
+			offset += blockSize;
+		} while (offset < scanlines.size());
+
+		std::uint32_t adlerA = 1;
+		std::uint32_t adlerB = 0;
+		for (auto dataByte : scanlines)
+		{
+			adlerA = (adlerA + dataByte) % 65521;
+			adlerB = (adlerB + adlerA) % 65521;
+		}
+		std::uint32_t adler = (adlerB << 16) | adlerA;
+		imageData.push_back(static_cast<std::uint8_t>(adler >> 24));
+		imageData.push_back(static_cast<std::uint8_t>(adler >> 16));
+		imageData.push_back(static_cast<std::uint8_t>(adler >> 8));
+		imageData.push_back(static_cast<std::uint8_t>(adler));
+		append_png_chunk(retVal, "IDAT", imageData);
+
+		append_png_chunk(retVal, "IEND", std::vector<std::uint8_t>());
+		return retVal;
+	}
+
+	bool VirtualTerminalSoftwareRenderer::save_png(const std::string &filePath) const
+	{
+		std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+		bool retVal = false;
+
+		if (file.is_open())
+		{
+			std::vector<std::uint8_t> png = encode_png();
+			file.write(reinterpret_cast<const char *>(png.data()), static_cast<std::streamsize>(png.size()));
+			retVal = file.good();
+		}
+		return retVal;
+	}
+
+	bool VirtualTerminalSoftwareRenderer::draw_mask(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::uint16_t maskObjectID, const ClipRectangle &clip)
+	{
+		bool retVal = false;
+
+		if (nullptr != workingSet)
+		{
+			auto mask = VTObject::get_object_by_id(maskObjectID, workingSet->get_object_tree());
+
+			if ((nullptr != mask) &&
+			    ((VirtualTerminalObjectType::DataMask == mask->get_object_type()) ||
+			     (VirtualTerminalObjectType::AlarmMask == mask->get_object_type())))
+			{
+				fill_framebuffer(0, 0, frameWidth, frameHeight, get_rgb(workingSet, mask->get_background_color()), clip);
+
+				for (std::uint16_t i = 0; i < mask->get_number_children(); i++)
+				{
+					draw_object(workingSet, mask->get_child_id(i), mask->get_child_x(i), mask->get_child_y(i), clip, 1);
+				}
+				retVal = true;
+			}
+		}
+		return retVal;
+	}
+
+	void VirtualTerminalSoftwareRenderer::draw_object(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet,
+	                                                  std::uint16_t objectID,
+	                                                  std::int32_t x,
+	                                                  std::int32_t y,
+	                                                  const ClipRectangle &clip,
+	                                                  std::uint8_t depth)
+	{
+		auto object = VTObject::get_object_by_id(objectID, workingSet->get_object_tree());
+
+		if ((nullptr == object) || (depth > MAX_DRAW_DEPTH))
+		{
+			return;
+		}
+
+		switch (object->get_object_type())
+		{
+			case VirtualTerminalObjectType::Container:
+			{
+				if (!std::static_pointer_cast<Container>(object)->get_hidden())
+				{
+					for (std::uint16_t i = 0; i < object->get_number_children(); i++)
+					{
+						draw_object(workingSet, object->get_child_id(i), x + object->get_child_x(i), y + object->get_child_y(i), clip, depth + 1);
+					}
+				}
+			}
+			break;
+
+			case VirtualTerminalObjectType::ObjectPointer:
+			{
+				std::uint16_t pointedObjectID = std::static_pointer_cast<ObjectPointer>(object)->get_value();
+
+				if (NULL_OBJECT_ID != pointedObjectID)
+				{
+					draw_object(workingSet, pointedObjectID, x, y, clip, depth + 1);
+				}
+			}
+			break;
+
+			default:
+			{
+				const CachedBitmap *bitmap = get_bitmap(workingSet, object);
+
+				if (nullptr != bitmap)
+				{
+					blit(*bitmap, x, y, clip);
+				}
+			}
+			break;
+		}
+	}
+
+	const VirtualTerminalSoftwareRenderer::CachedBitmap *VirtualTerminalSoftwareRenderer::get_bitmap(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::shared_ptr<VTObject> object)
+	{
+		auto cachedObject = bitmapCache.find(object->get_id());
+
+		if (bitmapCache.end() != cachedObject)
+		{
+			cacheHits++;
+			return &cachedObject->second;
+		}
+
+		CachedBitmap bitmap;
+
+		switch (object->get_object_type())
+		{
+			case VirtualTerminalObjectType::OutputString:
+			{
+				auto outputString = std::static_pointer_cast<OutputString>(object);
+				rasterize_text(workingSet,
+				               outputString,
+				               outputString->displayed_value(workingSet),
+				               outputString->get_option(OutputString::Options::Transparent),
+				               bitmap);
+				bitmap.dependencies.push_back(outputString->get_font_attributes());
+				bitmap.dependencies.push_back(outputString->get_variable_reference());
+			}
+			break;
+
+			case VirtualTerminalObjectType::OutputNumber:
+			{
+				auto outputNumber = std::static_pointer_cast<OutputNumber>(object);
+				rasterize_text(workingSet,
+				               outputNumber,
+				               format_number(workingSet, outputNumber),
+				               outputNumber->get_option(OutputNumber::Options::Transparent),
+				               bitmap);
+				bitmap.dependencies.push_back(outputNumber->get_font_attributes());
+				bitmap.dependencies.push_back(outputNumber->get_variable_reference());
+			}
+			break;
+
+			case VirtualTerminalObjectType::PictureGraphic:
+			{
+				rasterize_picture(workingSet, std::static_pointer_cast<PictureGraphic>(object), bitmap);
+			}
+			break;
+
+			case VirtualTerminalObjectType::OutputLine:
+			{
+				auto line = std::static_pointer_cast<OutputLine>(object);
+				rasterize_line(workingSet, line, bitmap);
+				bitmap.dependencies.push_back(line->get_line_attributes());
+			}
+			break;
+
+			case VirtualTerminalObjectType::OutputRectangle:
+			{
+				auto rectangle = std::static_pointer_cast<OutputRectangle>(object);
+				rasterize_rectangle(workingSet, rectangle, bitmap);
+				bitmap.dependencies.push_back(rectangle->get_line_attributes());
+				bitmap.dependencies.push_back(rectangle->get_fill_attributes());
+			}
+			break;
+
+			case VirtualTerminalObjectType::OutputEllipse:
+			{
+				auto ellipse = std::static_pointer_cast<OutputEllipse>(object);
+				rasterize_ellipse(workingSet, ellipse, bitmap);
+				bitmap.dependencies.push_back(ellipse->get_line_attributes());
+				bitmap.dependencies.push_back(ellipse->get_fill_attributes());
+			}
+			break;
+
+			default:
+			{
+				// Not something we know how to draw
+				return nullptr;
+			}
+		}
+
+		cacheMisses++;
+		return &(bitmapCache[object->get_id()] = std::move(bitmap));
+	}
+
+	void VirtualTerminalSoftwareRenderer::blit(const CachedBitmap &bitmap, std::int32_t x, std::int32_t y, const ClipRectangle &clip)
+	{
+		std::int32_t firstRow = std::max<std::int32_t>(0, clip.top - y);
+		std::int32_t lastRow = std::min<std::int32_t>(bitmap.height, clip.bottom - y);
+		std::int32_t firstColumn = std::max<std::int32_t>(0, clip.left - x);
+		std::int32_t lastColumn = std::min<std::int32_t>(bitmap.width, clip.right - x);
+
+		for (std::int32_t row = firstRow; row < lastRow; row++)
+		{
+			for (std::int32_t column = firstColumn; column < lastColumn; column++)
+			{
+				std::size_t bitmapIndex = static_cast<std::size_t>(row) * bitmap.width + column;
+
+				if (bitmap.opaque[bitmapIndex])
+				{
+					std::size_t frameIndex = (static_cast<std::size_t>(y + row) * frameWidth + (x + column)) * 3;
+					framebuffer[frameIndex] = bitmap.pixels[bitmapIndex * 3];
+					framebuffer[frameIndex + 1] = bitmap.pixels[bitmapIndex * 3 + 1];
+					framebuffer[frameIndex + 2] = bitmap.pixels[bitmapIndex * 3 + 2];
+				}
+			}
+		}
+	}
+
+	void VirtualTerminalSoftwareRenderer::fill_framebuffer(std::int32_t left, std::int32_t top, std::int32_t width, std::int32_t height, std::uint32_t colour, const ClipRectangle &clip)
+	{
+		std::int32_t firstRow = std::max(top, clip.top);
+		std::int32_t lastRow = std::min(top + height, clip.bottom);
+		std::int32_t firstColumn = std::max(left, clip.left);
+		std::int32_t lastColumn = std::min(left + width, clip.right);
+
+		for (std::int32_t row = firstRow; row < lastRow; row++)
+		{
+			for (std::int32_t column = firstColumn; column < lastColumn; column++)
+			{
+				std::size_t frameIndex = (static_cast<std::size_t>(row) * frameWidth + column) * 3;
+				framebuffer[frameIndex] = static_cast<std::uint8_t>(colour >> 16);
+				framebuffer[frameIndex + 1] = static_cast<std::uint8_t>(colour >> 8);
+				framebuffer[frameIndex + 2] = static_cast<std::uint8_t>(colour);
+			}
+		}
+	}
+
+	void VirtualTerminalSoftwareRenderer::rasterize_text(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet,
+	                                                     std::shared_ptr<TextualVTObject> object,
+	                                                     const std::string &text,
+	                                                     bool transparent,
+	                                                     CachedBitmap &bitmap)
+	{
+		initialize_bitmap(bitmap, object->get_width(), object->get_height());
+
+		if (!transparent)
+		{
+			std::uint32_t backgroundColour = get_rgb(workingSet, object->get_background_color());
+
+			for (std::int32_t y = 0; y < bitmap.height; y++)
+			{
+				for (std::int32_t x = 0; x < bitmap.width; x++)
+				{
+					set_bitmap_pixel(bitmap, x, y, backgroundColour);
+				}
+			}
+		}
+
+		auto font = VTObject::get_object_by_id(object->get_font_attributes(), workingSet->get_object_tree());
+		std::uint32_t fontColour = get_rgb(workingSet, 0);
+		std::int32_t cellWidth = GLYPH_CELL_WIDTH;
+		std::int32_t cellHeight = GLYPH_CELL_HEIGHT;
+
+		if ((nullptr != font) && (VirtualTerminalObjectType::FontAttributes == font->get_object_type()))
+		{
+			auto fontAttributes = std::static_pointer_cast<FontAttributes>(font);
+			fontColour = get_rgb(workingSet, fontAttributes->get_colour());
+			cellWidth = std::max<std::int32_t>(GLYPH_CELL_WIDTH, fontAttributes->get_font_width_pixels());
+			cellHeight = std::max<std::int32_t>(GLYPH_CELL_HEIGHT, fontAttributes->get_font_height_pixels());
+		}
+
+		const std::int32_t scaleX = cellWidth / GLYPH_CELL_WIDTH;
+		const std::int32_t scaleY = cellHeight / GLYPH_CELL_HEIGHT;
+		const std::int32_t textWidth = static_cast<std::int32_t>(text.size()) * cellWidth;
+		std::int32_t startX = 0;
+		std::int32_t startY = 0;
+
+		switch (object->get_horizontal_justification())
+		{
+			case TextualVTObject::HorizontalJustification::PositionMiddle:
+			{
+				startX = (bitmap.width - textWidth) / 2;
+			}
+			break;
+
+			case TextualVTObject::HorizontalJustification::PositionRight:
+			{
+				startX = bitmap.width - textWidth;
+			}
+			break;
+
+			default:
+				break;
+		}
+
+		switch (object->get_vertical_justification())
+		{
+			case TextualVTObject::VerticalJustification::PositionMiddle:
+			{
+				startY = (bitmap.height - cellHeight) / 2;
+			}
+			break;
+
+			case TextualVTObject::VerticalJustification::PositionBottom:
+			{
+				startY = bitmap.height - cellHeight;
+			}
+			break;
+
+			default:
+				break;
+		}
+
+		for (std::size_t i = 0; i < text.size(); i++)
+		{
+			const std::uint8_t *glyph = get_glyph(text[i]);
+			std::int32_t cellX = startX + static_cast<std::int32_t>(i) * cellWidth;
+
+			for (std::int32_t column = 0; column < GLYPH_WIDTH; column++)
+			{
+				for (std::int32_t row = 0; row < GLYPH_HEIGHT; row++)
+				{
+					if (0 != (glyph[column] & (1 << row)))
+					{
+						for (std::int32_t blockY = 0; blockY < scaleY; blockY++)
+						{
+							for (std::int32_t blockX = 0; blockX < scaleX; blockX++)
+							{
+								set_bitmap_pixel(bitmap, cellX + (column * scaleX) + blockX, startY + (row * scaleY) + blockY, fontColour);
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	void VirtualTerminalSoftwareRenderer::rasterize_line(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::shared_ptr<OutputLine> line, CachedBitmap &bitmap)
+	{
+		// A horizontal or vertical line has a width or height of 0, but still needs one row or column of pixels
+		initialize_bitmap(bitmap, std::max<std::uint16_t>(1, line->get_width()), std::max<std::uint16_t>(1, line->get_height()));
+
+		std::uint32_t lineColour = 0;
+		std::uint16_t lineWidth = 0;
+		std::uint16_t lineArt = 0;
+		get_line_style(workingSet, line->get_line_attributes(), lineColour, lineWidth, lineArt);
+
+		if (0 == lineWidth)
+		{
+			return;
+		}
+
+		std::int32_t x = 0;
+		std::int32_t y = (OutputLine::LineDirection::TopLeftToBottomRight == line->get_line_direction()) ? 0 : (bitmap.height - 1);
+		const std::int32_t endX = bitmap.width - 1;
+		const std::int32_t endY = (0 == y) ? (bitmap.height - 1) : 0;
+		const std::int32_t deltaX = endX - x;
+		const std::int32_t deltaY = -std::abs(endY - y);
+		const std::int32_t stepY = (y < endY) ? 1 : -1;
+		const std::int32_t brushOffset = (lineWidth - 1) / 2;
+		std::int32_t error = deltaX + deltaY;
+		std::uint32_t step = 0;
+
+		while (true)
+		{
+			// Line art is a repeating 16 bit pattern, most significant bit first
+			if (0 != (lineArt & (1 << (15 - (step % 16)))))
+			{
+				for (std::int32_t brushY = 0; brushY < lineWidth; brushY++)
+				{
+					for (std::int32_t brushX = 0; brushX < lineWidth; brushX++)
+					{
+						set_bitmap_pixel(bitmap, x - brushOffset + brushX, y - brushOffset + brushY, lineColour);
+					}
+				}
+			}
+
+			if ((x == endX) && (y == endY))
+			{
+				break;
+			}
+
+			std::int32_t doubledError = 2 * error;
+			if (doubledError >= deltaY)
+			{
+				error += deltaY;
+				x++;
+			}
+			if (doubledError <= deltaX)
+			{
+				error += deltaX;
+				y += stepY;
+			}
+			step++;
+		}
+	}
+
+	void VirtualTerminalSoftwareRenderer::rasterize_rectangle(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::shared_ptr<OutputRectangle> rectangle, CachedBitmap &bitmap)
+	{
+		initialize_bitmap(bitmap, rectangle->get_width(), rectangle->get_height());
+
+		std::uint32_t lineColour = 0;
+		std::uint16_t lineWidth = 0;
+		std::uint16_t lineArt = 0;
+		get_line_style(workingSet, rectangle->get_line_attributes(), lineColour, lineWidth, lineArt);
+
+		fill_shape(workingSet, rectangle->get_fill_attributes(), lineColour, std::vector<bool>(bitmap.opaque.size(), true), bitmap);
+
+		const std::uint8_t suppression = rectangle->get_line_suppression_bitfield();
+		const bool drawTop = (0 == (suppression & (1 << static_cast<std::uint8_t>(OutputRectangle::LineSuppressionOption::SuppressTopLine))));
+		const bool drawRight = (0 == (suppression & (1 << static_cast<std::uint8_t>(OutputRectangle::LineSuppressionOption::SuppressRightSideLine))));
+		const bool drawBottom = (0 == (suppression & (1 << static_cast<std::uint8_t>(OutputRectangle::LineSuppressionOption::SuppressBottomLine))));
+		const bool drawLeft = (0 == (suppression & (1 << static_cast<std::uint8_t>(OutputRectangle::LineSuppressionOption::SuppressLeftSideLine))));
+
+		for (std::int32_t y = 0; y < bitmap.height; y++)
+		{
+			for (std::int32_t x = 0; x < bitmap.width; x++)
+			{
+				if ((drawTop && (y < lineWidth)) ||
+				    (drawRight && (x >= (bitmap.width - lineWidth))) ||
+				    (drawBottom && (y >= (bitmap.height - lineWidth))) ||
+				    (drawLeft && (x < lineWidth)))
+				{
+					set_bitmap_pixel(bitmap, x, y, lineColour);
+				}
+			}
+		}
+	}
+
+	void VirtualTerminalSoftwareRenderer::rasterize_ellipse(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::shared_ptr<OutputEllipse> ellipse, CachedBitmap &bitmap)
+	{
+		initialize_bitmap(bitmap, ellipse->get_width(), ellipse->get_height());
+
+		std::uint32_t lineColour = 0;
+		std::uint16_t lineWidth = 0;
+		std::uint16_t lineArt = 0;
+		get_line_style(workingSet, ellipse->get_line_attributes(), lineColour, lineWidth, lineArt);
+
+		const float radiusX = bitmap.width / 2.0f;
+		const float radiusY = bitmap.height / 2.0f;
+		const float innerRadiusX = radiusX - lineWidth;
+		const float innerRadiusY = radiusY - lineWidth;
+		std::vector<bool> interior(bitmap.opaque.size(), false);
+		std::vector<bool> outline(bitmap.opaque.size(), false);
+
+		for (std::int32_t y = 0; y < bitmap.height; y++)
+		{
+			for (std::int32_t x = 0; x < bitmap.width; x++)
+			{
+				// Sample at the center of each pixel
+				const float offsetX = (x + 0.5f) - radiusX;
+				const float offsetY = (y + 0.5f) - radiusY;
+				const bool isInside = (((offsetX * offsetX) / (radiusX * radiusX)) + ((offsetY * offsetY) / (radiusY * radiusY))) <= 1.0f;
+				const bool isInsideOutline = (innerRadiusX > 0.0f) &&
+				  (innerRadiusY > 0.0f) &&
+				  ((((offsetX * offsetX) / (innerRadiusX * innerRadiusX)) + ((offsetY * offsetY) / (innerRadiusY * innerRadiusY))) <= 1.0f);
+				const std::size_t index = static_cast<std::size_t>(y) * bitmap.width + x;
+
+				interior[index] = isInsideOutline;
+				outline[index] = isInside && !isInsideOutline;
+			}
+		}
+
+		fill_shape(workingSet, ellipse->get_fill_attributes(), lineColour, interior, bitmap);
+
+		if (0 != lineWidth)
+		{
+			for (std::size_t i = 0; i < outline.size(); i++)
+			{
+				if (outline[i])
+				{
+					set_bitmap_pixel(bitmap, static_cast<std::int32_t>(i % bitmap.width), static_cast<std::int32_t>(i / bitmap.width), lineColour);
+				}
+			}
+		}
+	}
+
+	void VirtualTerminalSoftwareRenderer::rasterize_picture(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::shared_ptr<PictureGraphic> picture, CachedBitmap &bitmap)
+	{
+		const std::uint32_t actualWidth = picture->get_actual_width();
+		const std::uint32_t actualHeight = picture->get_actual_height();
+
+		if ((0 == actualWidth) || (0 == actualHeight) || (0 == picture->get_width()))
+		{
+			return;
+		}
+
+		// The picture is scaled to the object's width, keeping its aspect ratio
+		const std::uint32_t width = picture->get_width();
+		const std::uint32_t height = std::max<std::uint32_t>(1, (actualHeight * width) / actualWidth);
+		const bool transparent = picture->get_option(PictureGraphic::Options::Transparent);
+		initialize_bitmap(bitmap, static_cast<std::uint16_t>(width), static_cast<std::uint16_t>(std::min<std::uint32_t>(height, 0xFFFF)));
+
+		for (std::uint32_t y = 0; y < bitmap.height; y++)
+		{
+			for (std::uint32_t x = 0; x < bitmap.width; x++)
+			{
+				std::uint8_t colourIndex = get_picture_pixel(picture, (x * actualWidth) / width, (y * actualHeight) / height);
+
+				if ((!transparent) || (colourIndex != picture->get_transparency_colour()))
+				{
+					set_bitmap_pixel(bitmap, static_cast<std::int32_t>(x), static_cast<std::int32_t>(y), get_rgb(workingSet, colourIndex));
+				}
+			}
+		}
+	}
+
+	void VirtualTerminalSoftwareRenderer::fill_shape(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet,
+	                                                 std::uint16_t fillAttributesID,
+	                                                 std::uint32_t lineColour,
+	                                                 const std::vector<bool> &interior,
+	                                                 CachedBitmap &bitmap)
+	{
+		auto object = VTObject::get_object_by_id(fillAttributesID, workingSet->get_object_tree());
+
+		if ((nullptr == object) || (VirtualTerminalObjectType::FillAttributes != object->get_object_type()))
+		{
+			return;
+		}
+
+		auto fillAttributes = std::static_pointer_cast<FillAttributes>(object);
+		std::uint32_t fillColour = get_rgb(workingSet, fillAttributes->get_background_color());
+		std::shared_ptr<PictureGraphic> pattern;
+
+		switch (fillAttributes->get_type())
+		{
+			case FillAttributes::FillType::NoFill:
+			{
+				return;
+			}
+
+			case FillAttributes::FillType::FillWithLineColor:
+			{
+				fillColour = lineColour;
+			}
+			break;
+
+			case FillAttributes::FillType::FillWithPatternGivenByFillPatternAttribute:
+			{
+				auto patternObject = VTObject::get_object_by_id(fillAttributes->get_fill_pattern(), workingSet->get_object_tree());
+
+				if ((nullptr != patternObject) &&
+				    (VirtualTerminalObjectType::PictureGraphic == patternObject->get_object_type()) &&
+				    (0 != std::static_pointer_cast<PictureGraphic>(patternObject)->get_actual_width()) &&
+				    (0 != std::static_pointer_cast<PictureGraphic>(patternObject)->get_actual_height()))
+				{
+					pattern = std::static_pointer_cast<PictureGraphic>(patternObject);
+					bitmap.dependencies.push_back(pattern->get_id());
+				}
+			}
+			break;
+
+			default:
+				break;
+		}
+
+		for (std::size_t i = 0; i < interior.size(); i++)
+		{
+			if (interior[i])
+			{
+				const std::int32_t x = static_cast<std::int32_t>(i % bitmap.width);
+				const std::int32_t y = static_cast<std::int32_t>(i / bitmap.width);
+
+				if (nullptr != pattern)
+				{
+					// Patterns are tiled from the top left of the shape at their actual size
+					set_bitmap_pixel(bitmap, x, y, get_rgb(workingSet, get_picture_pixel(pattern, static_cast<std::uint32_t>(x) % pattern->get_actual_width(), static_cast<std::uint32_t>(y) % pattern->get_actual_height())));
+				}
+				else
+				{
+					set_bitmap_pixel(bitmap, x, y, fillColour);
+				}
+			}
+		}
+	}
+
+	std::uint8_t VirtualTerminalSoftwareRenderer::get_picture_pixel(std::shared_ptr<PictureGraphic> picture, std::uint32_t x, std::uint32_t y)
+	{
+		// The working set stores picture data already decoded to one colour index per pixel
+		const std::vector<std::uint8_t> &rawData = picture->get_raw_data();
+		const std::size_t index = static_cast<std::size_t>(y) * picture->get_actual_width() + x;
+		std::uint8_t retVal = 0;
+
+		if (index < rawData.size())
+		{
+			retVal = rawData[index];
+		}
+		return retVal;
+	}
+
+	std::string VirtualTerminalSoftwareRenderer::format_number(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::shared_ptr<OutputNumber> number)
+	{
+		std::uint32_t rawValue = number->get_value();
+
+		if (NULL_OBJECT_ID != number->get_variable_reference())
+		{
+			auto variable = VTObject::get_object_by_id(number->get_variable_reference(), workingSet->get_object_tree());
+
+			if ((nullptr != variable) && (VirtualTerminalObjectType::NumberVariable == variable->get_object_type()))
+			{
+				rawValue = std::static_pointer_cast<NumberVariable>(variable)->get_value();
+			}
+		}
+
+		const int numberOfDecimals = std::min<int>(number->get_number_of_decimals(), 7);
+		const double decimalFactor = std::pow(10.0, numberOfDecimals);
+		double displayedValue = (static_cast<double>(rawValue) + number->get_offset()) * number->get_scale();
+
+		if (number->get_option(OutputNumber::Options::Truncate))
+		{
+			displayedValue = std::trunc(displayedValue * decimalFactor) / decimalFactor;
+		}
+		else
+		{
+			displayedValue = std::round(displayedValue * decimalFactor) / decimalFactor;
+		}
+
+		if (number->get_option(OutputNumber::Options::DisplayZeroAsBlank) && (0.0 == displayedValue))
+		{
+			return std::string();
+		}
+
+		char buffer[64] = { 0 };
+		std::snprintf(buffer, sizeof(buffer), number->get_format() ? "%.*e" : "%.*f", numberOfDecimals, displayedValue);
+		std::string retVal(buffer);
+
+		if (number->get_option(OutputNumber::Options::DisplayLeadingZeros))
+		{
+			std::size_t characterWidth = GLYPH_CELL_WIDTH;
+			auto font = VTObject::get_object_by_id(number->get_font_attributes(), workingSet->get_object_tree());
+
+			if ((nullptr != font) && (VirtualTerminalObjectType::FontAttributes == font->get_object_type()))
+			{
+				characterWidth = std::max<std::size_t>(1, std::static_pointer_cast<FontAttributes>(font)->get_font_width_pixels());
+			}
+
+			const std::size_t fieldLength = number->get_width() / characterWidth;
+			const std::size_t signLength = ((!retVal.empty()) && ('-' == retVal[0])) ? 1 : 0;
+
+			if (retVal.size() < fieldLength)
+			{
+				retVal.insert(signLength, fieldLength - retVal.size(), '0');
+			}
+		}
+		return retVal;
+	}
+
+	std::uint32_t VirtualTerminalSoftwareRenderer::get_rgb(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet, std::uint8_t colourIndex)
+	{
+		VTColourVector colour = workingSet->get_colour(colourIndex);
+
+		return (static_cast<std::uint32_t>(colour.r * 255.0f + 0.5f) << 16) |
+		  (static_cast<std::uint32_t>(colour.g * 255.0f + 0.5f) << 8) |
+		  static_cast<std::uint32_t>(colour.b * 255.0f + 0.5f);
+	}
+
+	void VirtualTerminalSoftwareRenderer::get_line_style(std::shared_ptr<VirtualTerminalServerManagedWorkingSet> workingSet,
+	                                                     std::uint16_t lineAttributesID,
+	                                                     std::uint32_t &colour,
+	                                                     std::uint16_t &width,
+	                                                     std::uint16_t &lineArt)
+	{
+		auto object = VTObject::get_object_by_id(lineAttributesID, workingSet->get_object_tree());
+
+		colour = get_rgb(workingSet, 0);
+		width = 0;
+		lineArt = 0xFFFF;
+
+		if ((nullptr != object) && (VirtualTerminalObjectType::LineAttributes == object->get_object_type()))
+		{
+			auto lineAttributes = std::static_pointer_cast<LineAttributes>(object);
+			colour = get_rgb(workingSet, lineAttributes->get_background_color());
+			width = lineAttributes->get_width();
+			lineArt = lineAttributes->get_line_art_bit_pattern();
+		}
+	}
+
+	void VirtualTerminalSoftwareRenderer::initialize_bitmap(CachedBitmap &bitmap, std::uint16_t width, std::uint16_t height)
+	{
+		const std::size_t numberOfPixels = static_cast<std::size_t>(width) * height;
+
+		bitmap.width = width;
+		bitmap.height = height;
+		bitmap.pixels.assign(numberOfPixels * 3, 0);
+		bitmap.opaque.assign(numberOfPixels, false);
+	}
+
+	void VirtualTerminalSoftwareRenderer::set_bitmap_pixel(CachedBitmap &bitmap, std::int32_t x, std::int32_t y, std::uint32_t colour)
+	{
+		if ((x >= 0) && (y >= 0) && (x < bitmap.width) && (y < bitmap.height))
+		{
+			const std::size_t index = static_cast<std::size_t>(y) * bitmap.width + x;
+			bitmap.pixels[index * 3] = static_cast<std::uint8_t>(colour >> 16);
+			bitmap.pixels[index * 3 + 1] = static_cast<std::uint8_t>(colour >> 8);
+			bitmap.pixels[index * 3 + 2] = static_cast<std::uint8_t>(colour);
+			bitmap.opaque[index] = true;
+		}
+	}
+
+	const std::uint8_t *VirtualTerminalSoftwareRenderer::get_glyph(char character)
+	{
+		// Classic 5x7 font covering printable ASCII, stored column by column
+		static const std::uint8_t GLYPHS[95][GLYPH_WIDTH] = {
+			{ 0x00, 0x00, 0x00, 0x00, 0x00 }, // ' '
+			{ 0x00, 0x00, 0x5F, 0x00, 0x00 }, // '!'
+			{ 0x00, 0x07, 0x00, 0x07, 0x00 }, // '"'
+			{ 0x14, 0x7F, 0x14, 0x7F, 0x14 }, // '#'
+			{ 0x24, 0x2A, 0x7F, 0x2A, 0x12 }, // '$'
+			{ 0x23, 0x13, 0x08, 0x64, 0x62 }, // '%'
+			{ 0x36, 0x49, 0x56, 0x20, 0x50 }, // '&'
+			{ 0x00, 0x00, 0x07, 0x00, 0x00 }, // '''
+			{ 0x00, 0x1C, 0x22, 0x41, 0x00 }, // '('
+			{ 0x00, 0x41, 0x22, 0x1C, 0x00 }, // ')'
+			{ 0x14, 0x08, 0x3E, 0x08, 0x14 }, // '*'
+			{ 0x08, 0x08, 0x3E, 0x08, 0x08 }, // '+'
+			{ 0x00, 0x50, 0x30, 0x00, 0x00 }, // ','
+			{ 0x08, 0x08, 0x08, 0x08, 0x08 }, // '-'
+			{ 0x00, 0x60, 0x60, 0x00, 0x00 }, // '.'
+			{ 0x20, 0x10, 0x08, 0x04, 0x02 }, // '/'
+			{ 0x3E, 0x51, 0x49, 0x45, 0x3E }, // '0'
+			{ 0x00, 0x42, 0x7F, 0x40, 0x00 }, // '1'
+			{ 0x42, 0x61, 0x51, 0x49, 0x46 }, // '2'
+			{ 0x21, 0x41, 0x45, 0x4B, 0x31 }, // '3'
+			{ 0x18, 0x14, 0x12, 0x7F, 0x10 }, // '4'
+			{ 0x27, 0x45, 0x45, 0x45, 0x39 }, // '5'
+			{ 0x3C, 0x4A, 0x49, 0x49, 0x30 }, // '6'
+			{ 0x01, 0x71, 0x09, 0x05, 0x03 }, // '7'
+			{ 0x36, 0x49, 0x49, 0x49, 0x36 }, // '8'
+			{ 0x06, 0x49, 0x49, 0x29, 0x1E }, // '9'
+			{ 0x00, 0x36, 0x36, 0x00, 0x00 }, // ':'
+			{ 0x00, 0x56, 0x36, 0x00, 0x00 }, // ';'
+			{ 0x08, 0x14, 0x22, 0x41, 0x00 }, // '<'
+			{ 0x14, 0x14, 0x14, 0x14, 0x14 }, // '='
+			{ 0x00, 0x41, 0x22, 0x14, 0x08 }, // '>'
+			{ 0x02, 0x01, 0x51, 0x09, 0x06 }, // '?'
+			{ 0x32, 0x49, 0x79, 0x41, 0x3E }, // '@'
+			{ 0x7E, 0x11, 0x11, 0x11, 0x7E }, // 'A'
+			{ 0x7F, 0x49, 0x49, 0x49, 0x36 }, // 'B'
+			{ 0x3E, 0x41, 0x41, 0x41, 0x22 }, // 'C'
+			{ 0x7F, 0x41, 0x41, 0x22, 0x1C }, // 'D'
+			{ 0x7F, 0x49, 0x49, 0x49, 0x41 }, // 'E'
+			{ 0x7F, 0x09, 0x09, 0x09, 0x01 }, // 'F'
+			{ 0x3E, 0x41, 0x49, 0x49, 0x7A }, // 'G'
+			{ 0x7F, 0x08, 0x08, 0x08, 0x7F }, // 'H'
+			{ 0x00, 0x41, 0x7F, 0x41, 0x00 }, // 'I'
+			{ 0x20, 0x40, 0x41, 0x3F, 0x01 }, // 'J'
+			{ 0x7F, 0x08, 0x14, 0x22, 0x41 }, // 'K'
+			{ 0x7F, 0x40, 0x40, 0x40, 0x40 }, // 'L'
+			{ 0x7F, 0x02, 0x0C, 0x02, 0x7F }, // 'M'
+			{ 0x7F, 0x04, 0x08, 0x10, 0x7F }, // 'N'
+			{ 0x3E, 0x41, 0x41, 0x41, 0x3E }, // 'O'
+			{ 0x7F, 0x09, 0x09, 0x09, 0x06 }, // 'P'
+			{ 0x3E, 0x41, 0x51, 0x21, 0x5E }, // 'Q'
+			{ 0x7F, 0x09, 0x19, 0x29, 0x46 }, // 'R'
+			{ 0x46, 0x49, 0x49, 0x49, 0x31 }, // 'S'
+			{ 0x01, 0x01, 0x7F, 0x01, 0x01 }, // 'T'
+			{ 0x3F, 0x40, 0x40, 0x40, 0x3F }, // 'U'
+			{ 0x1F, 0x20, 0x40, 0x20, 0x1F }, // 'V'
+			{ 0x3F, 0x40, 0x38, 0x40, 0x3F }, // 'W'
+			{ 0x63, 0x14, 0x08, 0x14, 0x63 }, // 'X'
+			{ 0x07, 0x08, 0x70, 0x08, 0x07 }, // 'Y'
+			{ 0x61, 0x51, 0x49, 0x45, 0x43 }, // 'Z'
+			{ 0x00, 0x7F, 0x41, 0x41, 0x00 }, // '['
+			{ 0x02, 0x04, 0x08, 0x10, 0x20 }, // '\'
+			{ 0x00, 0x41, 0x41, 0x7F, 0x00 }, // ']'
+			{ 0x04, 0x02, 0x01, 0x02, 0x04 }, // '^'
+			{ 0x40, 0x40, 0x40, 0x40, 0x40 }, // '_'
+			{ 0x00, 0x01, 0x02, 0x04, 0x00 }, // '`'
+			{ 0x20, 0x54, 0x54, 0x54, 0x78 }, // 'a'
+			{ 0x7F, 0x48, 0x44, 0x44, 0x38 }, // 'b'
+			{ 0x38, 0x44, 0x44, 0x44, 0x20 }, // 'c'
+			{ 0x38, 0x44, 0x44, 0x48, 0x7F }, // 'd'
+			{ 0x38, 0x54, 0x54, 0x54, 0x18 }, // 'e'
+			{ 0x08, 0x7E, 0x09, 0x01, 0x02 }, // 'f'
+			{ 0x0C, 0x52, 0x52, 0x52, 0x3E }, // 'g'
+			{ 0x7F, 0x08, 0x04, 0x04, 0x78 }, // 'h'
+			{ 0x00, 0x44, 0x7D, 0x40, 0x00 }, // 'i'
+			{ 0x20, 0x40, 0x44, 0x3D, 0x00 }, // 'j'
+			{ 0x7F, 0x10, 0x28, 0x44, 0x00 }, // 'k'
+			{ 0x00, 0x41, 0x7F, 0x40, 0x00 }, // 'l'
+			{ 0x7C, 0x04, 0x18, 0x04, 0x78 }, // 'm'
+			{ 0x7C, 0x08, 0x04, 0x04, 0x78 }, // 'n'
+			{ 0x38, 0x44, 0x44, 0x44, 0x38 }, // 'o'
+			{ 0x7C, 0x14, 0x14, 0x14, 0x08 }, // 'p'
+			{ 0x08, 0x14, 0x14, 0x18, 0x7C }, // 'q'
+			{ 0x7C, 0x08, 0x04, 0x04, 0x08 }, // 'r'
+			{ 0x48, 0x54, 0x54, 0x54, 0x20 }, // 's'
+			{ 0x04, 0x3F, 0x44, 0x40, 0x20 }, // 't'
+			{ 0x3C, 0x40, 0x40, 0x20, 0x7C }, // 'u'
+			{ 0x1C, 0x20, 0x40, 0x20, 0x1C }, // 'v'
+			{ 0x3C, 0x40, 0x30, 0x40, 0x3C }, // 'w'
+			{ 0x44, 0x28, 0x10, 0x28, 0x44 }, // 'x'
+			{ 0x0C, 0x50, 0x50, 0x50, 0x3C }, // 'y'
+			{ 0x44, 0x64, 0x54, 0x4C, 0x44 }, // 'z'
+			{ 0x00, 0x08, 0x36, 0x41, 0x00 }, // '{'
+			{ 0x00, 0x00, 0x7F, 0x00, 0x00 }, // '|'
+			{ 0x00, 0x41, 0x36, 0x08, 0x00 }, // '}'
+			{ 0x10, 0x08, 0x08, 0x10, 0x08 } // '~'
+		};
+
+		if ((character < ' ') || (character > '~'))
+		{
+			character = '?';
+		}
+		return GLYPHS[character - ' '];
+	}
+
+	std::uint32_t VirtualTerminalSoftwareRenderer::crc32(const std::uint8_t *data, std::size_t length)
+	{
+		std::uint32_t retVal = 0xFFFFFFFF;
+
+		for (std::size_t i = 0; i < length; i++)
+		{
+			retVal ^= data[i];
+
+			for (std::uint8_t bit = 0; bit < 8; bit++)
+			{
+				retVal = (retVal >> 1) ^ (0xEDB88320 & (0 - (retVal & 1)));
+			}
+		}
+		return ~retVal;
+	}
+
+	void VirtualTerminalSoftwareRenderer::append_png_chunk(std::vector<std::uint8_t> &png, const char *type, const std::vector<std::uint8_t> &data)
+	{
+		const std::uint32_t length = static_cast<std::uint32_t>(data.size());
+
+		png.push_back(static_cast<std::uint8_t>(length >> 24));
+		png.push_back(static_cast<std::uint8_t>(length >> 16));
+		png.push_back(static_cast<std::uint8_t>(length >> 8));
+		png.push_back(static_cast<std::uint8_t>(length));
+
+		// The CRC covers the chunk type and its data, but not the length
+		const std::size_t crcStart = png.size();
+		png.insert(png.end(), type, type + 4);
+		png.insert(png.end(), data.begin(), data.end());
+
+		const std::uint32_t crc = crc32(png.data() + crcStart, png.size() - crcStart);
+		png.push_back(static_cast<std::uint8_t>(crc >> 24));
+		png.push_back(static_cast<std::uint8_t>(crc >> 16));
+		png.push_back(static_cast<std::uint8_t>(crc >> 8));
+		png.push_back(static_cast<std::uint8_t>(crc));
+	}
+} // namespace isobus
@@ -12,6 +12,7 @@
 #include "isobus/isobus/can_stack_logger.hpp"
 #include "isobus/utility/to_string.hpp"
 
+#include <algorithm>
 #include <cstring>
 
 namespace isobus
@@ -22,10 +23,10 @@ namespace isobus
 		return faultingObjectID;
 	}
 
-	void VirtualTerminalWorkingSetBase::add_iop_raw_data(const std::vector<std::uint8_t> &dataToAdd)
+	void VirtualTerminalWorkingSetBase::add_iop_raw_data(std::vector<std::uint8_t> dataToAdd)
 	{
 		transferredIopSize += dataToAdd.size();
-		iopFilesRawData.push_back(dataToAdd);
+		iopFilesRawData.push_back(std::make_shared<const std::vector<std::uint8_t>>(std::move(dataToAdd)));
 	}
 
 	std::size_t VirtualTerminalWorkingSetBase::get_number_iop_files() const
@@ -33,7 +34,12 @@ namespace isobus
 		return iopFilesRawData.size();
 	}
 
-	std::vector<std::uint8_t> &VirtualTerminalWorkingSetBase::get_iop_raw_data(std::size_t index)
+	const std::vector<std::uint8_t> &VirtualTerminalWorkingSetBase::get_iop_raw_data(std::size_t index) const
+	{
+		return *iopFilesRawData.at(index);
+	}
+
+	std::shared_ptr<const std::vector<std::uint8_t>> VirtualTerminalWorkingSetBase::get_shared_iop_raw_data(std::size_t index) const
 	{
 		return iopFilesRawData.at(index);
 	}
@@ -55,12 +61,206 @@ namespace isobus
 		if (nullptr != objectToAdd)
 		{
 			vtObjectTree[objectToAdd->get_id()] = objectToAdd;
+			update_object_references(objectToAdd->get_id());
 			retVal = true;
 		}
 		return retVal;
 	}
 
-	bool VirtualTerminalWorkingSetBase::parse_next_object(std::uint8_t *&iopData, std::uint32_t &iopLength)
+	void VirtualTerminalWorkingSetBase::update_object_references(std::uint16_t objectID)
+	{
+		remove_object_references(objectID);
+
+		auto object = vtObjectTree.find(objectID);
+
+		if ((vtObjectTree.end() != object) && (nullptr != object->second))
+		{
+			ObjectReferences &references = objectReferences[objectID];
+			get_object_references(*object->second, references);
+
+			for (auto childID : references.children)
+			{
+				parentObjects[childID].push_back(objectID);
+			}
+			for (auto referencedID : references.attributes)
+			{
+				referencingObjects[referencedID].push_back(objectID);
+			}
+		}
+	}
+
+	std::vector<std::uint16_t> VirtualTerminalWorkingSetBase::get_parent_object_ids(std::uint16_t objectID) const
+	{
+		std::vector<std::uint16_t> retVal;
+		auto parents = parentObjects.find(objectID);
+
+		if (parentObjects.end() != parents)
+		{
+			retVal = parents->second;
+		}
+		return retVal;
+	}
+
+	std::vector<std::uint16_t> VirtualTerminalWorkingSetBase::get_referencing_object_ids(std::uint16_t objectID) const
+	{
+		std::vector<std::uint16_t> retVal;
+		auto referencers = referencingObjects.find(objectID);
+
+		if (referencingObjects.end() != referencers)
+		{
+			retVal = referencers->second;
+		}
+		return retVal;
+	}
+
+	bool VirtualTerminalWorkingSetBase::get_is_parent_of(std::uint16_t parentObjectID, std::uint16_t childObjectID) const
+	{
+		bool retVal = false;
+		auto parents = parentObjects.find(childObjectID);
+
+		if (parentObjects.end() != parents)
+		{
+			retVal = (parents->second.end() != std::find(parents->second.begin(), parents->second.end(), parentObjectID));
+		}
+		return retVal;
+	}
+
+	bool VirtualTerminalWorkingSetBase::get_is_object_neighbourhood_valid(std::uint16_t objectID) const
+	{
+		auto object = VTObject::get_object_by_id(objectID, vtObjectTree);
+		bool retVal = ((nullptr != object) && object->get_is_valid(vtObjectTree));
+
+		// Parents validate the types of their children, and referencing objects validate the types of their references
+		for (const auto &index : { &parentObjects, &referencingObjects })
+		{
+			auto neighbours = index->find(objectID);
+
+			if (retVal && (index->end() != neighbours))
+			{
+				for (auto neighbourID : neighbours->second)
+				{
+					auto neighbour = VTObject::get_object_by_id(neighbourID, vtObjectTree);
+
+					if ((nullptr == neighbour) || (!neighbour->get_is_valid(vtObjectTree)))
+					{
+						retVal = false;
+						break;
+					}
+				}
+			}
+		}
+		return retVal;
+	}
+
+	void VirtualTerminalWorkingSetBase::get_object_references(const VTObject &object, ObjectReferences &references)
+	{
+		references.children.clear();
+		references.attributes.clear();
+
+		if (VirtualTerminalObjectType::ObjectPointer == object.get_object_type())
+		{
+			// Object pointers are drawn as the object they point to, so that object is effectively their child
+			references.children.push_back(static_cast<const ObjectPointer &>(object).get_value());
+		}
+
+		for (std::uint16_t i = 0; i < object.get_number_children(); i++)
+		{
+			references.children.push_back(object.get_child_id(i));
+		}
+
+		switch (object.get_object_type())
+		{
+			case VirtualTerminalObjectType::InputString:
+			{
+				const auto &inputString = static_cast<const InputString &>(object);
+				references.attributes = { inputString.get_font_attributes(), inputString.get_input_attributes(), inputString.get_variable_reference() };
+			}
+			break;
+
+			case VirtualTerminalObjectType::OutputString:
+			case VirtualTerminalObjectType::InputNumber:
+			case VirtualTerminalObjectType::OutputNumber:
+			{
+				const auto &textualObject = static_cast<const TextualVTObject &>(object);
+				references.attributes = { textualObject.get_font_attributes(), textualObject.get_variable_reference() };
+			}
+			break;
+
+			case VirtualTerminalObjectType::InputBoolean:
+			{
+				const auto &inputBoolean = static_cast<const InputBoolean &>(object);
+				references.attributes = { inputBoolean.get_foreground_colour_object_id(), inputBoolean.get_variable_reference() };
+			}
+			break;
+
+			case VirtualTerminalObjectType::InputList:
+			case VirtualTerminalObjectType::OutputList:
+			case VirtualTerminalObjectType::OutputMeter:
+			{
+				references.attributes = { static_cast<const VTObjectWithVariableReference &>(object).get_variable_reference() };
+			}
+			break;
+
+			case VirtualTerminalObjectType::OutputLinearBarGraph:
+			{
+				const auto &barGraph = static_cast<const OutputLinearBarGraph &>(object);
+				references.attributes = { barGraph.get_variable_reference(), barGraph.get_target_value_reference() };
+			}
+			break;
+
+			case VirtualTerminalObjectType::OutputArchedBarGraph:
+			{
+				const auto &barGraph = static_cast<const OutputArchedBarGraph &>(object);
+				references.attributes = { barGraph.get_variable_reference(), barGraph.get_target_value_reference() };
+			}
+			break;
+
+			case VirtualTerminalObjectType::OutputLine:
+			{
+				references.attributes = { static_cast<const OutputLine &>(object).get_line_attributes() };
+			}
+			break;
+
+			case VirtualTerminalObjectType::OutputRectangle:
+			{
+				const auto &rectangle = static_cast<const OutputRectangle &>(object);
+				references.attributes = { rectangle.get_line_attributes(), rectangle.get_fill_attributes() };
+			}
+			break;
+
+			case VirtualTerminalObjectType::OutputEllipse:
+			{
+				const auto &ellipse = static_cast<const OutputEllipse &>(object);
+				references.attributes = { ellipse.get_line_attributes(), ellipse.get_fill_attributes() };
+			}
+			break;
+
+			case VirtualTerminalObjectType::OutputPolygon:
+			{
+				const auto &polygon = static_cast<const OutputPolygon &>(object);
+				references.attributes = { polygon.get_line_attributes(), polygon.get_fill_attributes() };
+			}
+			break;
+
+			case VirtualTerminalObjectType::FillAttributes:
+			{
+				references.attributes = { static_cast<const FillAttributes &>(object).get_fill_pattern() };
+			}
+			break;
+
+			default:
+				break;
+		}
+
+		for (auto *list : { &references.children, &references.attributes })
+		{
+			list->erase(std::remove(list->begin(), list->end(), NULL_OBJECT_ID), list->end());
+			std::sort(list->begin(), list->end());
+			list->erase(std::unique(list->begin(), list->end()), list->end());
+		}
+	}
+
+	bool VirtualTerminalWorkingSetBase::parse_next_object(const std::uint8_t *&iopData, std::uint32_t &iopLength)
 	{
 		bool retVal = false;
 
@@ -2898,10 +3098,10 @@ namespace isobus
 		}
 	}
 
-	bool VirtualTerminalWorkingSetBase::parse_iop_into_objects(std::uint8_t *iopData, std::uint32_t iopLength)
+	bool VirtualTerminalWorkingSetBase::parse_iop_into_objects(const std::uint8_t *iopData, std::uint32_t iopLength)
 	{
 		uint32_t remainingLength = iopLength;
-		std::uint8_t *currentIopPointer = iopData;
+		const std::uint8_t *currentIopPointer = iopData;
 		bool retVal = true;
 
 		if (iopLength > 0)
@@ -2932,7 +3132,7 @@ namespace isobus
 	bool VirtualTerminalWorkingSetBase::parse_object_macro_reference(
 	  std::shared_ptr<VTObject> object,
 	  const uint8_t numberOfMacrosToFollow,
-	  uint8_t *&iopData,
+	  const uint8_t *&iopData,
 	  uint32_t &iopLength) const
 	{
 		bool retVal = true;
@@ -2981,4 +3181,24 @@ namespace isobus
 		}
 		return retVal;
 	}
+
+	void VirtualTerminalWorkingSetBase::remove_object_references(std::uint16_t objectID)
+	{
+		auto references = objectReferences.find(objectID);
+
+		if (objectReferences.end() != references)
+		{
+			for (auto childID : references->second.children)
+			{
+				auto &parents = parentObjects[childID];
+				parents.erase(std::remove(parents.begin(), parents.end(), objectID), parents.end());
+			}
+			for (auto referencedID : references->second.attributes)
+			{
+				auto &referencers = referencingObjects[referencedID];
+				referencers.erase(std::remove(referencers.begin(), referencers.end(), objectID), referencers.end());
+			}
+			objectReferences.erase(references);
+		}
+	}
 } // namespace isobus
@@ -23,6 +23,37 @@
 
 namespace isobus
 {
+	std::size_t FastPacketProtocol::FastPacketProtocolData::size() const
+	{
+		return length;
+	}
+
+	std::uint8_t FastPacketProtocol::FastPacketProtocolData::get_byte(std::size_t index)
+	{
+		return buffer.at(index);
+	}
+
+	void FastPacketProtocol::FastPacketProtocolData::set_byte(std::size_t index, std::uint8_t value)
+	{
+		buffer.at(index) = value;
+	}
+
+	void FastPacketProtocol::FastPacketProtocolData::set_size(std::uint8_t newLength)
+	{
+		length = (newLength <= MAX_LENGTH) ? newLength : MAX_LENGTH;
+	}
+
+	std::uint8_t *FastPacketProtocol::FastPacketProtocolData::data()
+	{
+		return buffer.data();
+	}
+
+	std::unique_ptr<CANMessageData> FastPacketProtocol::FastPacketProtocolData::copy_if_not_owned(std::unique_ptr<CANMessageData> self) const
+	{
+		// The data is stored inline, so it's always owned by itself
+		return self;
+	}
+
 	FastPacketProtocol::FastPacketProtocolSession::FastPacketProtocolSession(TransportProtocolSessionBase::Direction direction,
 	                                                                         std::unique_ptr<CANMessageData> data,
 	                                                                         std::uint32_t parameterGroupNumber,
@@ -85,6 +116,22 @@ namespace isobus
 		update_timestamp();
 	}
 
+	void FastPacketProtocol::FastPacketProtocolSession::reset(TransportProtocolSessionBase::Direction sessionDirection,
+	                                                          std::uint32_t sessionParameterGroupNumber,
+	                                                          std::uint16_t sessionTotalMessageSize,
+	                                                          std::uint8_t sessionSequenceNumber,
+	                                                          CANIdentifier::CANPriority sessionPriority,
+	                                                          std::shared_ptr<ControlFunction> sessionSource,
+	                                                          std::shared_ptr<ControlFunction> sessionDestination,
+	                                                          TransmitCompleteCallback completeCallback,
+	                                                          void *parentPointer)
+	{
+		TransportProtocolSessionBase::reset(sessionDirection, sessionParameterGroupNumber, sessionTotalMessageSize, sessionSource, sessionDestination, completeCallback, parentPointer);
+		numberOfBytesTransferred = 0;
+		sequenceNumber = sessionSequenceNumber;
+		priority = sessionPriority;
+	}
+
 	std::uint8_t FastPacketProtocol::calculate_number_of_frames(std::uint8_t messageLength)
 	{
 		std::uint8_t numberOfFrames = 0;
@@ -137,19 +184,8 @@ namespace isobus
 	                                                  void *parentPointer,
 	                                                  DataChunkCallback frameChunkCallback)
 	{
-		std::unique_ptr<CANMessageData> data;
-		if (nullptr != frameChunkCallback)
-		{
-			data.reset(new CANMessageDataCallback(messageLength, frameChunkCallback, parentPointer));
-		}
-		else if (nullptr != messageData)
-		{
-			// Make a copy of the data as it could go out of scope
-			data.reset(new CANMessageDataVector(messageData, messageLength));
-		}
-
 		// Return false early if we can't send the message
-		if ((nullptr == data) || (data->size() <= CAN_DATA_LENGTH) || (data->size() > MAX_PROTOCOL_MESSAGE_LENGTH))
+		if (((nullptr == messageData) && (nullptr == frameChunkCallback)) || (messageLength <= CAN_DATA_LENGTH) || (messageLength > MAX_PROTOCOL_MESSAGE_LENGTH))
 		{
 			LOG_ERROR("[FP]: Unable to send multipacket message, data is invalid or has invalid length.");
 			return false;
@@ -170,17 +206,41 @@ namespace isobus
 			return false;
 		}
 
+		std::shared_ptr<FastPacketProtocolSession> session;
+		{
+			LOCK_GUARD(Mutex, sessionMutex);
+			session = get_unused_session();
+		}
+
+		// Copy the data into the session, as it could go out of scope. A fast packet message is small
+		// enough that the chunk callback can supply it all at once.
+		auto &data = static_cast<FastPacketProtocolData &>(session->get_data());
+		data.set_size(messageLength);
+		if (nullptr != frameChunkCallback)
+		{
+			if (!frameChunkCallback(0, 0, messageLength, data.data(), parentPointer))
+			{
+				LOG_ERROR("[FP]: Unable to send multipacket message, the data chunk callback failed.");
+				LOCK_GUARD(Mutex, sessionMutex);
+				unusedSessions.push_back(session);
+				return false;
+			}
+		}
+		else
+		{
+			std::copy(messageData, messageData + messageLength, data.data());
+		}
+
 		std::uint8_t sequenceNumber = get_new_sequence_number(source->get_NAME(), parameterGroupNumber);
-		auto session = std::make_shared<FastPacketProtocolSession>(FastPacketProtocolSession::Direction::Transmit,
-		                                                           std::move(data),
-		                                                           parameterGroupNumber,
-		                                                           messageLength,
-		                                                           sequenceNumber,
-		                                                           priority,
-		                                                           source,
-		                                                           destination,
-		                                                           txCompleteCallback,
-		                                                           parentPointer);
+		session->reset(FastPacketProtocolSession::Direction::Transmit,
+		               parameterGroupNumber,
+		               messageLength,
+		               sequenceNumber,
+		               priority,
+		               source,
+		               destination,
+		               txCompleteCallback,
+		               parentPointer);
 
 		LOCK_GUARD(Mutex, sessionMutex);
 		activeSessions.push_back(session);
@@ -204,50 +264,68 @@ namespace isobus
 				LOG_WARNING("[FP]: Closing active session as the destination control function is no longer valid");
 				close_session(session, false);
 			}
-			update_session(session);
+			else
+			{
+				update_session(session);
+			}
 		}
 	}
 
+	std::size_t FastPacketProtocol::SessionHistoryHash::operator()(const SessionHistoryKey &key) const
+	{
+		return std::hash<std::uint64_t>()(key.first ^ (static_cast<std::uint64_t>(key.second) << 32));
+	}
+
 	void FastPacketProtocol::add_session_history(const std::shared_ptr<FastPacketProtocolSession> &session)
 	{
-		if (nullptr != session)
+		if ((nullptr != session) && (nullptr != session->get_source()))
 		{
-			bool formerSessionMatched = false;
+			sessionHistory[SessionHistoryKey(session->get_source()->get_NAME().get_full_name(), session->get_parameter_group_number())] = session->sequenceNumber;
+		}
+	}
 
-			for (auto &formerSessions : sessionHistory)
-			{
-				if ((formerSessions.isoName == session->get_source()->get_NAME()) &&
-				    (formerSessions.parameterGroupNumber == session->get_parameter_group_number()))
-				{
-					formerSessions.sequenceNumber = session->sequenceNumber;
-					formerSessionMatched = true;
-					break;
-				}
-			}
+	std::shared_ptr<FastPacketProtocol::FastPacketProtocolSession> FastPacketProtocol::get_unused_session()
+	{
+		std::shared_ptr<FastPacketProtocolSession> retVal;
 
-			if (!formerSessionMatched)
-			{
-				FastPacketHistory history{
-					session->get_source()->get_NAME(),
-					session->get_parameter_group_number(),
-					session->sequenceNumber
-				};
-				sessionHistory.push_back(history);
-			}
+		if (unusedSessions.empty())
+		{
+			// The pool grows to the most sessions that were ever active at once, after that sessions are only reused
+			retVal = std::make_shared<FastPacketProtocolSession>(FastPacketProtocolSession::Direction::Receive,
+			                                                     std::unique_ptr<CANMessageData>(new FastPacketProtocolData()),
+			                                                     0,
+			                                                     0,
+			                                                     0,
+			                                                     CANIdentifier::CANPriority::PriorityDefault6,
+			                                                     nullptr,
+			                                                     nullptr,
+			                                                     nullptr,
+			                                                     nullptr);
+			activeSessions.reserve(activeSessions.size() + 1);
+			unusedSessions.reserve(activeSessions.capacity());
+		}
+		else
+		{
+			retVal = unusedSessions.back();
+			unusedSessions.pop_back();
 		}
+		return retVal;
 	}
 
 	void FastPacketProtocol::close_session(std::shared_ptr<FastPacketProtocolSession> session, bool successful)
 	{
 		if (nullptr != session)
 		{
-			session->complete(successful);
-			add_session_history(session);
-
 			auto sessionLocation = std::find(activeSessions.begin(), activeSessions.end(), session);
 			if (activeSessions.end() != sessionLocation)
 			{
+				session->complete(successful);
+				add_session_history(session);
 				activeSessions.erase(sessionLocation);
+
+				// Release the control functions and put the session back in the pool
+				session->reset(FastPacketProtocolSession::Direction::Receive, 0, 0, 0, CANIdentifier::CANPriority::PriorityDefault6, nullptr, nullptr, nullptr, nullptr);
+				unusedSessions.push_back(session);
 			}
 		}
 	}
@@ -255,13 +333,11 @@ namespace isobus
 	std::uint8_t FastPacketProtocol::get_new_sequence_number(NAME name, std::uint32_t parameterGroupNumber) const
 	{
 		std::uint8_t sequenceNumber = 0;
-		for (const auto &formerSessions : sessionHistory)
+		auto formerSession = sessionHistory.find(SessionHistoryKey(name.get_full_name(), parameterGroupNumber));
+
+		if (sessionHistory.end() != formerSession)
 		{
-			if ((formerSessions.isoName == name) && (formerSessions.parameterGroupNumber == parameterGroupNumber))
-			{
-				sequenceNumber = formerSessions.sequenceNumber + 1;
-				break;
-			}
+			sequenceNumber = formerSession->second + 1;
 		}
 		return sequenceNumber;
 	}
@@ -325,8 +401,7 @@ namespace isobus
 			else
 			{
 				// Correct sequence number, copy the data
-				// Convert data type to a vector to allow for manipulation
-				auto &data = static_cast<CANMessageDataVector &>(session->get_data());
+				auto &data = static_cast<FastPacketProtocolData &>(session->get_data());
 				for (std::uint8_t i = 0; i < PROTOCOL_BYTES_PER_FRAME; i++)
 				{
 					if (session->numberOfBytesTransferred < session->get_message_length())
@@ -346,7 +421,8 @@ namespace isobus
 					// Complete
 					CANMessage completedMessage(CANMessage::Type::Receive,
 					                            message.get_identifier(),
-					                            std::move(data),
+					                            data.data(),
+					                            static_cast<std::uint32_t>(data.size()),
 					                            message.get_source_control_function(),
 					                            message.get_destination_control_function(),
 					                            message.get_can_port_index());
@@ -390,28 +466,28 @@ namespace isobus
 					return;
 				}
 
-				// Create a new session
-				session = std::make_shared<FastPacketProtocolSession>(FastPacketProtocolSession::Direction::Receive,
-				                                                      std::unique_ptr<CANMessageData>(new CANMessageDataVector(messageLength)),
-				                                                      message.get_identifier().get_parameter_group_number(),
-				                                                      messageLength,
-				                                                      (message.get_uint8_at(0) & SEQUENCE_NUMBER_BIT_MASK),
-				                                                      message.get_identifier().get_priority(),
-				                                                      message.get_source_control_function(),
-				                                                      message.get_destination_control_function(),
-				                                                      nullptr, // No callback
-				                                                      nullptr);
+				// Start a new session
+				LOCK_GUARD(Mutex, sessionMutex);
+				session = get_unused_session();
+				session->reset(FastPacketProtocolSession::Direction::Receive,
+				               message.get_identifier().get_parameter_group_number(),
+				               messageLength,
+				               (message.get_uint8_at(0) & SEQUENCE_NUMBER_BIT_MASK),
+				               message.get_identifier().get_priority(),
+				               message.get_source_control_function(),
+				               message.get_destination_control_function(),
+				               nullptr, // No callback
+				               nullptr);
 
 				// Save the 6 bytes of payload in this first message
-				// Convert data type to a vector to allow for manipulation
-				auto &data = static_cast<CANMessageDataVector &>(session->get_data());
+				auto &data = static_cast<FastPacketProtocolData &>(session->get_data());
+				data.set_size(messageLength);
 				for (std::uint8_t i = 0; i < (PROTOCOL_BYTES_PER_FRAME - 1); i++)
 				{
 					data.set_byte(session->numberOfBytesTransferred, message.get_uint8_at(2 + i));
 					session->add_number_of_bytes_transferred(1);
 				}
 
-				LOCK_GUARD(Mutex, sessionMutex);
 				activeSessions.push_back(session);
 			}
 		}
@@ -479,6 +555,7 @@ namespace isobus
 					{
 						LOG_ERROR("[FP]: Tx session timed out.");
 						close_session(session, false);
+						return;
 					}
 					break;
 				}
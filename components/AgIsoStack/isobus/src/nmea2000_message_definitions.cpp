@@ -118,9 +118,8 @@ namespace isobus
 			return retVal;
 		}
 
-		void VesselHeading::serialize(std::vector<std::uint8_t> &buffer) const
+		void VesselHeading::serialize(std::array<std::uint8_t, CAN_DATA_LENGTH> &buffer) const
 		{
-			buffer.resize(CAN_DATA_LENGTH);
 			buffer.at(0) = (sequenceID <= MAX_SEQUENCE_ID) ? sequenceID : 0xFF;
 			buffer.at(1) = static_cast<std::uint8_t>(headingReading & 0xFF);
 			buffer.at(2) = static_cast<std::uint8_t>((headingReading >> 8) & 0xFF);
@@ -132,6 +131,13 @@ namespace isobus
 			buffer.at(7) |= 0xFC;
 		}
 
+		void VesselHeading::serialize(std::vector<std::uint8_t> &buffer) const
+		{
+			std::array<std::uint8_t, CAN_DATA_LENGTH> frameBuffer;
+			serialize(frameBuffer);
+			buffer.assign(frameBuffer.begin(), frameBuffer.end());
+		}
+
 		bool VesselHeading::deserialize(const CANMessage &receivedMessage)
 		{
 			bool retVal = false;
@@ -208,10 +214,8 @@ namespace isobus
 			return retVal;
 		}
 
-		void RateOfTurn::serialize(std::vector<std::uint8_t> &buffer) const
+		void RateOfTurn::serialize(std::array<std::uint8_t, CAN_DATA_LENGTH> &buffer) const
 		{
-			buffer.resize(CAN_DATA_LENGTH);
-
 			buffer.at(0) = (sequenceID <= MAX_SEQUENCE_ID) ? sequenceID : 0xFF;
 			buffer.at(1) = static_cast<std::uint8_t>(rateOfTurn & 0xFF);
 			buffer.at(2) = static_cast<std::uint8_t>((rateOfTurn >> 8) & 0xFF);
@@ -222,6 +226,13 @@ namespace isobus
 			buffer.at(7) = 0xFF;
 		}
 
+		void RateOfTurn::serialize(std::vector<std::uint8_t> &buffer) const
+		{
+			std::array<std::uint8_t, CAN_DATA_LENGTH> frameBuffer;
+			serialize(frameBuffer);
+			buffer.assign(frameBuffer.begin(), frameBuffer.end());
+		}
+
 		bool RateOfTurn::deserialize(const CANMessage &receivedMessage)
 		{
 			bool retVal = false;
@@ -304,10 +315,8 @@ namespace isobus
 			return retVal;
 		}
 
-		void PositionRapidUpdate::serialize(std::vector<std::uint8_t> &buffer) const
+		void PositionRapidUpdate::serialize(std::array<std::uint8_t, CAN_DATA_LENGTH> &buffer) const
 		{
-			buffer.resize(CAN_DATA_LENGTH);
-
 			buffer.at(0) = static_cast<std::uint8_t>(latitude & 0xFF);
 			buffer.at(1) = static_cast<std::uint8_t>((latitude >> 8) & 0xFF);
 			buffer.at(2) = static_cast<std::uint8_t>((latitude >> 16) & 0xFF);
@@ -318,6 +327,13 @@ namespace isobus
 			buffer.at(7) = static_cast<std::uint8_t>((longitude >> 24) & 0xFF);
 		}
 
+		void PositionRapidUpdate::serialize(std::vector<std::uint8_t> &buffer) const
+		{
+			std::array<std::uint8_t, CAN_DATA_LENGTH> frameBuffer;
+			serialize(frameBuffer);
+			buffer.assign(frameBuffer.begin(), frameBuffer.end());
+		}
+
 		bool PositionRapidUpdate::deserialize(const CANMessage &receivedMessage)
 		{
 			bool retVal = false;
@@ -428,10 +444,8 @@ namespace isobus
 			return retVal;
 		}
 
-		void CourseOverGroundSpeedOverGroundRapidUpdate::serialize(std::vector<std::uint8_t> &buffer) const
+		void CourseOverGroundSpeedOverGroundRapidUpdate::serialize(std::array<std::uint8_t, CAN_DATA_LENGTH> &buffer) const
 		{
-			buffer.resize(CAN_DATA_LENGTH);
-
 			buffer.at(0) = sequenceID;
 			buffer.at(1) = (0xFC | static_cast<std::uint8_t>(cogReference));
 			buffer.at(2) = static_cast<std::uint8_t>(courseOverGround & 0xFF);
@@ -442,6 +456,13 @@ namespace isobus
 			buffer.at(7) = 0xFF; // Reserved
 		}
 
+		void CourseOverGroundSpeedOverGroundRapidUpdate::serialize(std::vector<std::uint8_t> &buffer) const
+		{
+			std::array<std::uint8_t, CAN_DATA_LENGTH> frameBuffer;
+			serialize(frameBuffer);
+			buffer.assign(frameBuffer.begin(), frameBuffer.end());
+		}
+
 		bool CourseOverGroundSpeedOverGroundRapidUpdate::deserialize(const CANMessage &receivedMessage)
 		{
 			bool retVal = false;
@@ -551,10 +572,8 @@ namespace isobus
 			return retVal;
 		}
 
-		void PositionDeltaHighPrecisionRapidUpdate::serialize(std::vector<std::uint8_t> &buffer) const
+		void PositionDeltaHighPrecisionRapidUpdate::serialize(std::array<std::uint8_t, CAN_DATA_LENGTH> &buffer) const
 		{
-			buffer.resize(CAN_DATA_LENGTH);
-
 			buffer.at(0) = sequenceID;
 			buffer.at(1) = timeDelta;
 			buffer.at(2) = static_cast<std::uint8_t>(latitudeDelta & 0xFF);
@@ -565,6 +584,13 @@ namespace isobus
 			buffer.at(7) = static_cast<std::uint8_t>((longitudeDelta >> 16) & 0xFF);
 		}
 
+		void PositionDeltaHighPrecisionRapidUpdate::serialize(std::vector<std::uint8_t> &buffer) const
+		{
+			std::array<std::uint8_t, CAN_DATA_LENGTH> frameBuffer;
+			serialize(frameBuffer);
+			buffer.assign(frameBuffer.begin(), frameBuffer.end());
+		}
+
 		bool PositionDeltaHighPrecisionRapidUpdate::deserialize(const CANMessage &receivedMessage)
 		{
 			bool retVal = false;
@@ -23,12 +23,127 @@
 #include "isobus/isobus/nmea2000_fast_packet_protocol.hpp"
 #include "isobus/utility/system_timing.hpp"
 
-#include <algorithm>
-
 namespace isobus
 {
 	using namespace NMEA2000Messages;
 
+	template<typename T>
+	NMEA2000MessageInterface::ReceivedMessageTable<T>::ReceivedMessageTable(const char *messageName) :
+	  name(messageName)
+	{
+		sourceIndices.fill(0);
+	}
+
+	template<typename T>
+	std::shared_ptr<T> NMEA2000MessageInterface::ReceivedMessageTable<T>::process_message(const CANMessage &message, bool &anySignalChanged)
+	{
+		std::shared_ptr<T> retVal = nullptr;
+		const auto source = message.get_source_control_function();
+		anySignalChanged = false;
+
+		if ((nullptr != source) && (message.get_can_port_index() < CAN_PORT_MAXIMUM))
+		{
+			const std::size_t key = get_key(message.get_can_port_index(), message.get_identifier().get_source_address());
+			std::uint8_t index = sourceIndices[key];
+
+			if (0 == index)
+			{
+				if (sources.size() < MAX_NUMBER_OF_SOURCES)
+				{
+					if (sources.empty())
+					{
+						oldestTimestamp_ms = SystemTiming::get_timestamp_ms();
+					}
+					// There is no existing message object from this control function, so create a new one
+					sources.push_back(std::make_shared<T>(source));
+					sourceKeys.push_back(static_cast<std::uint16_t>(key));
+					index = static_cast<std::uint8_t>(sources.size());
+					sourceIndices[key] = index;
+				}
+				else
+				{
+					LOG_WARNING("[NMEA2K]: Too many sources of the " + std::string(name) + ", ignoring a new one.");
+				}
+			}
+			else if (sources[index - 1]->get_control_function() != source)
+			{
+				// A different control function has taken over this address, so its content starts over
+				sources[index - 1] = std::make_shared<T>(source);
+			}
+
+			if (0 != index)
+			{
+				retVal = sources[index - 1];
+				anySignalChanged = retVal->deserialize(message);
+			}
+		}
+		return retVal;
+	}
+
+	template<typename T>
+	std::size_t NMEA2000MessageInterface::ReceivedMessageTable<T>::size() const
+	{
+		return sources.size();
+	}
+
+	template<typename T>
+	std::shared_ptr<T> NMEA2000MessageInterface::ReceivedMessageTable<T>::get(std::size_t index) const
+	{
+		std::shared_ptr<T> retVal = nullptr;
+
+		if (index < sources.size())
+		{
+			retVal = sources[index];
+		}
+		return retVal;
+	}
+
+	template<typename T>
+	void NMEA2000MessageInterface::ReceivedMessageTable<T>::check_timeouts()
+	{
+		const std::uint32_t timeout_ms = 3 * T::get_timeout();
+
+		if ((!sources.empty()) && SystemTiming::time_expired_ms(oldestTimestamp_ms, timeout_ms))
+		{
+			const std::uint32_t currentTimestamp_ms = SystemTiming::get_timestamp_ms();
+			std::size_t index = 0;
+			oldestTimestamp_ms = currentTimestamp_ms;
+
+			while (index < sources.size())
+			{
+				const std::uint32_t sourceTimestamp_ms = sources[index]->get_timestamp();
+
+				if (SystemTiming::time_expired_ms(sourceTimestamp_ms, timeout_ms))
+				{
+					LOG_WARNING("[NMEA2K]: " + std::string(name) + " Rx timeout.");
+					sourceIndices[sourceKeys[index]] = 0;
+					sources.erase(sources.begin() + index);
+					sourceKeys.erase(sourceKeys.begin() + index);
+
+					// Keep the sources in the order they were received, so the ones after this one move down
+					for (std::size_t i = index; i < sources.size(); i++)
+					{
+						sourceIndices[sourceKeys[i]] = static_cast<std::uint8_t>(i + 1);
+					}
+				}
+				else
+				{
+					if ((currentTimestamp_ms - sourceTimestamp_ms) > (currentTimestamp_ms - oldestTimestamp_ms))
+					{
+						oldestTimestamp_ms = sourceTimestamp_ms;
+					}
+					index++;
+				}
+			}
+		}
+	}
+
+	template<typename T>
+	std::size_t NMEA2000MessageInterface::ReceivedMessageTable<T>::get_key(std::uint8_t canPortIndex, std::uint8_t sourceAddress)
+	{
+		return (static_cast<std::size_t>(canPortIndex) << 8) | sourceAddress;
+	}
+
 	NMEA2000MessageInterface::NMEA2000MessageInterface(std::shared_ptr<InternalControlFunction> sendingControlFunction,
 	                                                   bool enableSendingCogSogCyclically,
 	                                                   bool enableSendingDatumCyclically,
@@ -45,6 +160,13 @@ namespace isobus
 	  positionRapidUpdateTransmitMessage(sendingControlFunction),
 	  rateOfTurnTransmitMessage(sendingControlFunction),
 	  vesselHeadingTransmitMessage(sendingControlFunction),
+	  receivedCogSogMessages("COG & SOG message"),
+	  receivedDatumMessages("Datum message"),
+	  receivedGNSSPositionDataMessages("GNSS position data message"),
+	  receivedPositionDeltaHighPrecisionRapidUpdateMessages("Position delta high precision rapid update message"),
+	  receivedPositionRapidUpdateMessages("Position rapid update message"),
+	  receivedRateOfTurnMessages("Rate of turn message"),
+	  receivedVesselHeadingMessages("Vessel heading message"),
 	  sendCogSogCyclically(enableSendingCogSogCyclically),
 	  sendDatumCyclically(enableSendingDatumCyclically),
 	  sendGNSSPositionDataCyclically(enableSendingGNSSPositionDataCyclically),
@@ -132,79 +254,37 @@ namespace isobus
 
 	std::shared_ptr<CourseOverGroundSpeedOverGroundRapidUpdate> NMEA2000MessageInterface::get_received_course_speed_over_ground_message(std::size_t index) const
 	{
-		std::shared_ptr<CourseOverGroundSpeedOverGroundRapidUpdate> retVal = nullptr;
-
-		if (index < receivedCogSogMessages.size())
-		{
-			retVal = receivedCogSogMessages.at(index);
-		}
-		return retVal;
+		return receivedCogSogMessages.get(index);
 	}
 
 	std::shared_ptr<Datum> NMEA2000MessageInterface::get_received_datum_message(std::size_t index) const
 	{
-		std::shared_ptr<Datum> retVal = nullptr;
-
-		if (index < receivedDatumMessages.size())
-		{
-			retVal = receivedDatumMessages.at(index);
-		}
-		return retVal;
+		return receivedDatumMessages.get(index);
 	}
 
 	std::shared_ptr<GNSSPositionData> NMEA2000MessageInterface::get_received_gnss_position_data_message(std::size_t index) const
 	{
-		std::shared_ptr<GNSSPositionData> retVal = nullptr;
-
-		if (index < receivedGNSSPositionDataMessages.size())
-		{
-			retVal = receivedGNSSPositionDataMessages.at(index);
-		}
-		return retVal;
+		return receivedGNSSPositionDataMessages.get(index);
 	}
 
 	std::shared_ptr<PositionDeltaHighPrecisionRapidUpdate> NMEA2000MessageInterface::get_received_position_delta_high_precision_rapid_update_message(std::size_t index) const
 	{
-		std::shared_ptr<PositionDeltaHighPrecisionRapidUpdate> retVal = nullptr;
-
-		if (index < receivedPositionDeltaHighPrecisionRapidUpdateMessages.size())
-		{
-			retVal = receivedPositionDeltaHighPrecisionRapidUpdateMessages.at(index);
-		}
-		return retVal;
+		return receivedPositionDeltaHighPrecisionRapidUpdateMessages.get(index);
 	}
 
 	std::shared_ptr<PositionRapidUpdate> NMEA2000MessageInterface::get_received_position_rapid_update_message(std::size_t index) const
 	{
-		std::shared_ptr<PositionRapidUpdate> retVal = nullptr;
-
-		if (index < receivedPositionRapidUpdateMessages.size())
-		{
-			retVal = receivedPositionRapidUpdateMessages.at(index);
-		}
-		return retVal;
+		return receivedPositionRapidUpdateMessages.get(index);
 	}
 
 	std::shared_ptr<RateOfTurn> NMEA2000MessageInterface::get_received_rate_of_turn_message(std::size_t index) const
 	{
-		std::shared_ptr<RateOfTurn> retVal = nullptr;
-
-		if (index < receivedRateOfTurnMessages.size())
-		{
-			retVal = receivedRateOfTurnMessages.at(index);
-		}
-		return retVal;
+		return receivedRateOfTurnMessages.get(index);
 	}
 
 	std::shared_ptr<VesselHeading> NMEA2000MessageInterface::get_received_vessel_heading_message(std::size_t index) const
 	{
-		std::shared_ptr<VesselHeading> retVal = nullptr;
-
-		if (index < receivedVesselHeadingMessages.size())
-		{
-			retVal = receivedVesselHeadingMessages.at(index);
-		}
-		return retVal;
+		return receivedVesselHeadingMessages.get(index);
 	}
 
 	EventDispatcher<const std::shared_ptr<NMEA2000Messages::CourseOverGroundSpeedOverGroundRapidUpdate>, bool> &NMEA2000MessageInterface::get_course_speed_over_ground_rapid_update_event_publisher()
@@ -369,7 +449,7 @@ namespace isobus
 		    (flag < static_cast<std::uint32_t>(TransmitFlags::NumberOfFlags)))
 		{
 			auto targetInterface = static_cast<NMEA2000MessageInterface *>(parentPointer);
-			std::vector<std::uint8_t> messageBuffer;
+			std::array<std::uint8_t, CAN_DATA_LENGTH> frameBuffer;
 			bool transmitSuccessful = true;
 
 			switch (static_cast<TransmitFlags>(flag))
@@ -378,10 +458,10 @@ namespace isobus
 				{
 					if (nullptr != targetInterface->cogSogTransmitMessage.get_control_function())
 					{
-						targetInterface->cogSogTransmitMessage.serialize(messageBuffer);
+						targetInterface->cogSogTransmitMessage.serialize(frameBuffer);
 						transmitSuccessful = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::CourseOverGroundSpeedOverGroundRapidUpdate),
-						                                                                    messageBuffer.data(),
-						                                                                    messageBuffer.size(),
+						                                                                    frameBuffer.data(),
+						                                                                    frameBuffer.size(),
 						                                                                    std::static_pointer_cast<InternalControlFunction>(targetInterface->cogSogTransmitMessage.get_control_function()),
 						                                                                    nullptr,
 						                                                                    CANIdentifier::CANPriority::Priority2);
@@ -393,10 +473,10 @@ namespace isobus
 				{
 					if (nullptr != targetInterface->datumTransmitMessage.get_control_function())
 					{
-						targetInterface->datumTransmitMessage.serialize(messageBuffer);
+						targetInterface->datumTransmitMessage.serialize(targetInterface->fastPacketTransmitBuffer);
 						transmitSuccessful = CANNetworkManager::CANNetwork.get_fast_packet_protocol(0)->send_multipacket_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::Datum),
-						                                                                                                         messageBuffer.data(),
-						                                                                                                         messageBuffer.size(),
+						                                                                                                         targetInterface->fastPacketTransmitBuffer.data(),
+						                                                                                                         targetInterface->fastPacketTransmitBuffer.size(),
 						                                                                                                         std::static_pointer_cast<InternalControlFunction>(targetInterface->datumTransmitMessage.get_control_function()),
 						                                                                                                         nullptr,
 						                                                                                                         CANIdentifier::CANPriority::PriorityDefault6);
@@ -408,10 +488,10 @@ namespace isobus
 				{
 					if (nullptr != targetInterface->gnssPositionDataTransmitMessage.get_control_function())
 					{
-						targetInterface->gnssPositionDataTransmitMessage.serialize(messageBuffer);
+						targetInterface->gnssPositionDataTransmitMessage.serialize(targetInterface->fastPacketTransmitBuffer);
 						transmitSuccessful = CANNetworkManager::CANNetwork.get_fast_packet_protocol(0)->send_multipacket_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::GNSSPositionData),
-						                                                                                                         messageBuffer.data(),
-						                                                                                                         messageBuffer.size(),
+						                                                                                                         targetInterface->fastPacketTransmitBuffer.data(),
+						                                                                                                         targetInterface->fastPacketTransmitBuffer.size(),
 						                                                                                                         std::static_pointer_cast<InternalControlFunction>(targetInterface->gnssPositionDataTransmitMessage.get_control_function()),
 						                                                                                                         nullptr,
 						                                                                                                         CANIdentifier::CANPriority::Priority3);
@@ -423,10 +503,10 @@ namespace isobus
 				{
 					if (nullptr != targetInterface->positionDeltaHighPrecisionRapidUpdateTransmitMessage.get_control_function())
 					{
-						targetInterface->positionDeltaHighPrecisionRapidUpdateTransmitMessage.serialize(messageBuffer);
+						targetInterface->positionDeltaHighPrecisionRapidUpdateTransmitMessage.serialize(frameBuffer);
 						transmitSuccessful = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::PositionDeltaHighPrecisionRapidUpdate),
-						                                                                    messageBuffer.data(),
-						                                                                    messageBuffer.size(),
+						                                                                    frameBuffer.data(),
+						                                                                    frameBuffer.size(),
 						                                                                    std::static_pointer_cast<InternalControlFunction>(targetInterface->positionDeltaHighPrecisionRapidUpdateTransmitMessage.get_control_function()),
 						                                                                    nullptr,
 						                                                                    CANIdentifier::CANPriority::Priority2);
@@ -438,10 +518,10 @@ namespace isobus
 				{
 					if (nullptr != targetInterface->positionRapidUpdateTransmitMessage.get_control_function())
 					{
-						targetInterface->positionRapidUpdateTransmitMessage.serialize(messageBuffer);
+						targetInterface->positionRapidUpdateTransmitMessage.serialize(frameBuffer);
 						transmitSuccessful = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::PositionRapidUpdate),
-						                                                                    messageBuffer.data(),
-						                                                                    messageBuffer.size(),
+						                                                                    frameBuffer.data(),
+						                                                                    frameBuffer.size(),
 						                                                                    std::static_pointer_cast<InternalControlFunction>(targetInterface->positionRapidUpdateTransmitMessage.get_control_function()),
 						                                                                    nullptr,
 						                                                                    CANIdentifier::CANPriority::Priority2);
@@ -453,10 +533,10 @@ namespace isobus
 				{
 					if (nullptr != targetInterface->rateOfTurnTransmitMessage.get_control_function())
 					{
-						targetInterface->rateOfTurnTransmitMessage.serialize(messageBuffer);
+						targetInterface->rateOfTurnTransmitMessage.serialize(frameBuffer);
 						transmitSuccessful = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::RateOfTurn),
-						                                                                    messageBuffer.data(),
-						                                                                    messageBuffer.size(),
+						                                                                    frameBuffer.data(),
+						                                                                    frameBuffer.size(),
 						                                                                    std::static_pointer_cast<InternalControlFunction>(targetInterface->rateOfTurnTransmitMessage.get_control_function()),
 						                                                                    nullptr,
 						                                                                    CANIdentifier::CANPriority::Priority2);
@@ -468,10 +548,10 @@ namespace isobus
 				{
 					if (nullptr != targetInterface->vesselHeadingTransmitMessage.get_control_function())
 					{
-						targetInterface->vesselHeadingTransmitMessage.serialize(messageBuffer);
+						targetInterface->vesselHeadingTransmitMessage.serialize(frameBuffer);
 						transmitSuccessful = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::VesselHeading),
-						                                                                    messageBuffer.data(),
-						                                                                    messageBuffer.size(),
+						                                                                    frameBuffer.data(),
+						                                                                    frameBuffer.size(),
 						                                                                    std::static_pointer_cast<InternalControlFunction>(targetInterface->vesselHeadingTransmitMessage.get_control_function()),
 						                                                                    nullptr,
 						                                                                    CANIdentifier::CANPriority::Priority2);
@@ -500,161 +580,84 @@ namespace isobus
 			{
 				case static_cast<std::uint32_t>(CANLibParameterGroupNumber::CourseOverGroundSpeedOverGroundRapidUpdate):
 				{
-					if (message.get_source_control_function() != nullptr)
+					bool anySignalChanged = false;
+					auto result = targetInterface->receivedCogSogMessages.process_message(message, anySignalChanged);
+
+					if (nullptr != result)
 					{
-						auto result = std::find_if(targetInterface->receivedCogSogMessages.begin(),
-						                           targetInterface->receivedCogSogMessages.end(),
-						                           [&message](const std::shared_ptr<CourseOverGroundSpeedOverGroundRapidUpdate> &receivedCommand) {
-							                           return (nullptr != receivedCommand) && (receivedCommand->get_control_function() == message.get_source_control_function());
-						                           });
-
-						if (result == targetInterface->receivedCogSogMessages.end())
-						{
-							// There is no existing message object from this control function, so create a new one
-							targetInterface->receivedCogSogMessages.push_back(std::make_shared<CourseOverGroundSpeedOverGroundRapidUpdate>(message.get_source_control_function()));
-							result = targetInterface->receivedCogSogMessages.end() - 1;
-						}
-
-						bool anySignalChanged = (*result)->deserialize(message);
-						targetInterface->cogSogEventPublisher.call(*result, anySignalChanged);
+						targetInterface->cogSogEventPublisher.call(result, anySignalChanged);
 					}
 				}
 				break;
 
 				case static_cast<std::uint32_t>(CANLibParameterGroupNumber::Datum):
 				{
-					if (message.get_source_control_function() != nullptr)
+					bool anySignalChanged = false;
+					auto result = targetInterface->receivedDatumMessages.process_message(message, anySignalChanged);
+
+					if (nullptr != result)
 					{
-						auto result = std::find_if(targetInterface->receivedDatumMessages.begin(),
-						                           targetInterface->receivedDatumMessages.end(),
-						                           [&message](const std::shared_ptr<Datum> &receivedCommand) {
-							                           return (nullptr != receivedCommand) && (receivedCommand->get_control_function() == message.get_source_control_function());
-						                           });
-
-						if (result == targetInterface->receivedDatumMessages.end())
-						{
-							// There is no existing message object from this control function, so create a new one
-							targetInterface->receivedDatumMessages.push_back(std::make_shared<Datum>(message.get_source_control_function()));
-							result = targetInterface->receivedDatumMessages.end() - 1;
-						}
-
-						bool anySignalChanged = (*result)->deserialize(message);
-						targetInterface->datumEventPublisher.call(*result, anySignalChanged);
+						targetInterface->datumEventPublisher.call(result, anySignalChanged);
 					}
 				}
 				break;
 
 				case static_cast<std::uint32_t>(CANLibParameterGroupNumber::GNSSPositionData):
 				{
-					if (message.get_source_control_function() != nullptr)
+					bool anySignalChanged = false;
+					auto result = targetInterface->receivedGNSSPositionDataMessages.process_message(message, anySignalChanged);
+
+					if (nullptr != result)
 					{
-						auto result = std::find_if(targetInterface->receivedGNSSPositionDataMessages.begin(),
-						                           targetInterface->receivedGNSSPositionDataMessages.end(),
-						                           [&message](const std::shared_ptr<GNSSPositionData> &receivedCommand) {
-							                           return (nullptr != receivedCommand) && (receivedCommand->get_control_function() == message.get_source_control_function());
-						                           });
-
-						if (result == targetInterface->receivedGNSSPositionDataMessages.end())
-						{
-							// There is no existing message object from this control function, so create a new one
-							targetInterface->receivedGNSSPositionDataMessages.push_back(std::make_shared<GNSSPositionData>(message.get_source_control_function()));
-							result = targetInterface->receivedGNSSPositionDataMessages.end() - 1;
-						}
-
-						bool anySignalChanged = (*result)->deserialize(message);
-						targetInterface->gnssPositionDataEventPublisher.call(*result, anySignalChanged);
+						targetInterface->gnssPositionDataEventPublisher.call(result, anySignalChanged);
 					}
 				}
 				break;
 
 				case static_cast<std::uint32_t>(CANLibParameterGroupNumber::PositionDeltaHighPrecisionRapidUpdate):
 				{
-					if (message.get_source_control_function() != nullptr)
+					bool anySignalChanged = false;
+					auto result = targetInterface->receivedPositionDeltaHighPrecisionRapidUpdateMessages.process_message(message, anySignalChanged);
+
+					if (nullptr != result)
 					{
-						auto result = std::find_if(targetInterface->receivedPositionDeltaHighPrecisionRapidUpdateMessages.begin(),
-						                           targetInterface->receivedPositionDeltaHighPrecisionRapidUpdateMessages.end(),
-						                           [&message](const std::shared_ptr<PositionDeltaHighPrecisionRapidUpdate> &receivedCommand) {
-							                           return (nullptr != receivedCommand) && (receivedCommand->get_control_function() == message.get_source_control_function());
-						                           });
-
-						if (result == targetInterface->receivedPositionDeltaHighPrecisionRapidUpdateMessages.end())
-						{
-							// There is no existing message object from this control function, so create a new one
-							targetInterface->receivedPositionDeltaHighPrecisionRapidUpdateMessages.push_back(std::make_shared<PositionDeltaHighPrecisionRapidUpdate>(message.get_source_control_function()));
-							result = targetInterface->receivedPositionDeltaHighPrecisionRapidUpdateMessages.end() - 1;
-						}
-
-						bool anySignalChanged = (*result)->deserialize(message);
-						targetInterface->positionDeltaHighPrecisionRapidUpdateEventPublisher.call(*result, anySignalChanged);
+						targetInterface->positionDeltaHighPrecisionRapidUpdateEventPublisher.call(result, anySignalChanged);
 					}
 				}
 				break;
 
 				case static_cast<std::uint32_t>(CANLibParameterGroupNumber::PositionRapidUpdate):
 				{
-					if (message.get_source_control_function() != nullptr)
+					bool anySignalChanged = false;
+					auto result = targetInterface->receivedPositionRapidUpdateMessages.process_message(message, anySignalChanged);
+
+					if (nullptr != result)
 					{
-						auto result = std::find_if(targetInterface->receivedPositionRapidUpdateMessages.begin(),
-						                           targetInterface->receivedPositionRapidUpdateMessages.end(),
-						                           [&message](const std::shared_ptr<PositionRapidUpdate> &receivedCommand) {
-							                           return (nullptr != receivedCommand) && (receivedCommand->get_control_function() == message.get_source_control_function());
-						                           });
-
-						if (result == targetInterface->receivedPositionRapidUpdateMessages.end())
-						{
-							// There is no existing message object from this control function, so create a new one
-							targetInterface->receivedPositionRapidUpdateMessages.push_back(std::make_shared<PositionRapidUpdate>(message.get_source_control_function()));
-							result = targetInterface->receivedPositionRapidUpdateMessages.end() - 1;
-						}
-
-						bool anySignalChanged = (*result)->deserialize(message);
-						targetInterface->positionRapidUpdateEventPublisher.call(*result, anySignalChanged);
+						targetInterface->positionRapidUpdateEventPublisher.call(result, anySignalChanged);
 					}
 				}
 				break;
 
 				case static_cast<std::uint32_t>(CANLibParameterGroupNumber::RateOfTurn):
 				{
-					if (message.get_source_control_function() != nullptr)
+					bool anySignalChanged = false;
+					auto result = targetInterface->receivedRateOfTurnMessages.process_message(message, anySignalChanged);
+
+					if (nullptr != result)
 					{
-						auto result = std::find_if(targetInterface->receivedRateOfTurnMessages.begin(),
-						                           targetInterface->receivedRateOfTurnMessages.end(),
-						                           [&message](const std::shared_ptr<RateOfTurn> &receivedCommand) {
-							                           return (nullptr != receivedCommand) && (receivedCommand->get_control_function() == message.get_source_control_function());
-						                           });
-
-						if (result == targetInterface->receivedRateOfTurnMessages.end())
-						{
-							// There is no existing message object from this control function, so create a new one
-							targetInterface->receivedRateOfTurnMessages.push_back(std::make_shared<RateOfTurn>(message.get_source_control_function()));
-							result = targetInterface->receivedRateOfTurnMessages.end() - 1;
-						}
-
-						bool anySignalChanged = (*result)->deserialize(message);
-						targetInterface->rateOfTurnEventPublisher.call(*result, anySignalChanged);
+						targetInterface->rateOfTurnEventPublisher.call(result, anySignalChanged);
 					}
 				}
 				break;
 
 				case static_cast<std::uint32_t>(CANLibParameterGroupNumber::VesselHeading):
 				{
-					if (message.get_source_control_function() != nullptr)
+					bool anySignalChanged = false;
+					auto result = targetInterface->receivedVesselHeadingMessages.process_message(message, anySignalChanged);
+
+					if (nullptr != result)
 					{
-						auto result = std::find_if(targetInterface->receivedVesselHeadingMessages.begin(),
-						                           targetInterface->receivedVesselHeadingMessages.end(),
-						                           [&message](const std::shared_ptr<VesselHeading> &receivedCommand) {
-							                           return (nullptr != receivedCommand) && (receivedCommand->get_control_function() == message.get_source_control_function());
-						                           });
-
-						if (result == targetInterface->receivedVesselHeadingMessages.end())
-						{
-							// There is no existing message object from this control function, so create a new one
-							targetInterface->receivedVesselHeadingMessages.push_back(std::make_shared<VesselHeading>(message.get_source_control_function()));
-							result = targetInterface->receivedVesselHeadingMessages.end() - 1;
-						}
-
-						bool anySignalChanged = (*result)->deserialize(message);
-						targetInterface->vesselHeadingEventPublisher.call(*result, anySignalChanged);
+						targetInterface->vesselHeadingEventPublisher.call(result, anySignalChanged);
 					}
 				}
 				break;
@@ -669,83 +672,13 @@ namespace isobus
 	{
 		if (initialized)
 		{
-			receivedCogSogMessages.erase(std::remove_if(receivedCogSogMessages.begin(),
-			                                            receivedCogSogMessages.end(),
-			                                            [](std::shared_ptr<CourseOverGroundSpeedOverGroundRapidUpdate> message) {
-				                                            if (SystemTiming::time_expired_ms(message->get_timestamp(), 3 * CourseOverGroundSpeedOverGroundRapidUpdate::get_timeout()))
-				                                            {
-					                                            LOG_WARNING("[NMEA2K]: COG & SOG message Rx timeout.");
-					                                            return true;
-				                                            }
-				                                            return false;
-			                                            }),
-			                             receivedCogSogMessages.end());
-			receivedDatumMessages.erase(std::remove_if(receivedDatumMessages.begin(),
-			                                           receivedDatumMessages.end(),
-			                                           [](std::shared_ptr<Datum> message) {
-				                                           if (SystemTiming::time_expired_ms(message->get_timestamp(), 3 * Datum::get_timeout()))
-				                                           {
-					                                           LOG_WARNING("[NMEA2K]: Datum message Rx timeout.");
-					                                           return true;
-				                                           }
-				                                           return false;
-			                                           }),
-			                            receivedDatumMessages.end());
-			receivedGNSSPositionDataMessages.erase(std::remove_if(receivedGNSSPositionDataMessages.begin(),
-			                                                      receivedGNSSPositionDataMessages.end(),
-			                                                      [](std::shared_ptr<GNSSPositionData> message) {
-				                                                      if (SystemTiming::time_expired_ms(message->get_timestamp(), 3 * GNSSPositionData::get_timeout()))
-				                                                      {
-					                                                      LOG_WARNING("[NMEA2K]: GNSS position data message Rx timeout.");
-					                                                      return true;
-				                                                      }
-				                                                      return false;
-			                                                      }),
-			                                       receivedGNSSPositionDataMessages.end());
-			receivedPositionDeltaHighPrecisionRapidUpdateMessages.erase(std::remove_if(receivedPositionDeltaHighPrecisionRapidUpdateMessages.begin(),
-			                                                                           receivedPositionDeltaHighPrecisionRapidUpdateMessages.end(),
-			                                                                           [](std::shared_ptr<PositionDeltaHighPrecisionRapidUpdate> message) {
-				                                                                           if (SystemTiming::time_expired_ms(message->get_timestamp(), 3 * PositionDeltaHighPrecisionRapidUpdate::get_timeout()))
-				                                                                           {
-					                                                                           LOG_WARNING("[NMEA2K]: Position Delta High Precision Rapid Update Rx timeout.");
-					                                                                           return true;
-				                                                                           }
-				                                                                           return false;
-			                                                                           }),
-			                                                            receivedPositionDeltaHighPrecisionRapidUpdateMessages.end());
-			receivedPositionRapidUpdateMessages.erase(std::remove_if(receivedPositionRapidUpdateMessages.begin(),
-			                                                         receivedPositionRapidUpdateMessages.end(),
-			                                                         [](std::shared_ptr<PositionRapidUpdate> message) {
-				                                                         if (SystemTiming::time_expired_ms(message->get_timestamp(), 3 * PositionRapidUpdate::get_timeout()))
-				                                                         {
-					                                                         LOG_WARNING("[NMEA2K]: Position delta high precision rapid update message Rx timeout.");
-					                                                         return true;
-				                                                         }
-				                                                         return false;
-			                                                         }),
-			                                          receivedPositionRapidUpdateMessages.end());
-			receivedRateOfTurnMessages.erase(std::remove_if(receivedRateOfTurnMessages.begin(),
-			                                                receivedRateOfTurnMessages.end(),
-			                                                [](std::shared_ptr<RateOfTurn> message) {
-				                                                if (SystemTiming::time_expired_ms(message->get_timestamp(), 3 * RateOfTurn::get_timeout()))
-				                                                {
-					                                                LOG_WARNING("[NMEA2K]: Rate of turn message Rx timeout.");
-					                                                return true;
-				                                                }
-				                                                return false;
-			                                                }),
-			                                 receivedRateOfTurnMessages.end());
-			receivedVesselHeadingMessages.erase(std::remove_if(receivedVesselHeadingMessages.begin(),
-			                                                   receivedVesselHeadingMessages.end(),
-			                                                   [](std::shared_ptr<VesselHeading> message) {
-				                                                   if (SystemTiming::time_expired_ms(message->get_timestamp(), 3 * VesselHeading::get_timeout()))
-				                                                   {
-					                                                   LOG_WARNING("[NMEA2K]: Vessel heading message Rx timeout.");
-					                                                   return true;
-				                                                   }
-				                                                   return false;
-			                                                   }),
-			                                    receivedVesselHeadingMessages.end());
+			receivedCogSogMessages.check_timeouts();
+			receivedDatumMessages.check_timeouts();
+			receivedGNSSPositionDataMessages.check_timeouts();
+			receivedPositionDeltaHighPrecisionRapidUpdateMessages.check_timeouts();
+			receivedPositionRapidUpdateMessages.check_timeouts();
+			receivedRateOfTurnMessages.check_timeouts();
+			receivedVesselHeadingMessages.check_timeouts();
 		}
 	}
 
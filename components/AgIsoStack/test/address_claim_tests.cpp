@@ -157,3 +157,84 @@ TEST(ADDRESS_CLAIM_TESTS, CannotClaim)
 	CANHardwareInterface::stop();
 	CANNetworkManager::CANNetwork.deactivate_control_function(secondInternalECU2);
 }
+
+TEST(ADDRESS_CLAIM_TESTS, RememberedAddressAndKnownControlFunctions)
+{
+	VirtualCANPlugin plugin;
+	plugin.open();
+
+	CANHardwareInterface::set_number_of_can_channels(1);
+	CANHardwareInterface::assign_can_channel_frame_handler(0, std::make_shared<VirtualCANPlugin>());
+	CANHardwareInterface::start();
+
+	NAME terminalName(0);
+	terminalName.set_arbitrary_address_capable(true);
+	terminalName.set_industry_group(2);
+	terminalName.set_function_code(static_cast<std::uint8_t>(NAME::Function::VirtualTerminal));
+	terminalName.set_identity_number(5);
+	terminalName.set_manufacturer_code(69);
+
+	NAME otherName(0);
+	otherName.set_identity_number(6);
+	otherName.set_manufacturer_code(69);
+
+	const NAMEFilter filterTerminal(NAME::NAMEParameters::FunctionCode, static_cast<std::uint8_t>(NAME::Function::VirtualTerminal));
+	auto partneredTerminal = CANNetworkManager::CANNetwork.create_partnered_control_function(0, { filterTerminal });
+
+	// A remembered CF is usable straight away, and fills in a matching partner
+	EXPECT_FALSE(CANNetworkManager::CANNetwork.add_known_control_function(terminalName, 0x26, CAN_PORT_MAXIMUM));
+	EXPECT_FALSE(CANNetworkManager::CANNetwork.add_known_control_function(terminalName, NULL_CAN_ADDRESS, 0));
+	EXPECT_TRUE(CANNetworkManager::CANNetwork.add_known_control_function(terminalName, 0x26, 0));
+	EXPECT_TRUE(partneredTerminal->get_address_valid());
+	EXPECT_EQ(0x26, partneredTerminal->get_address());
+	EXPECT_EQ(terminalName, partneredTerminal->get_NAME());
+	EXPECT_EQ(partneredTerminal, CANNetworkManager::CANNetwork.get_control_function(0, 0x26));
+	EXPECT_FALSE(CANNetworkManager::CANNetwork.add_known_control_function(terminalName, 0x27, 0));
+	EXPECT_FALSE(CANNetworkManager::CANNetwork.add_known_control_function(otherName, 0x26, 0));
+
+	NAME ourName(0);
+	ourName.set_arbitrary_address_capable(true);
+	ourName.set_industry_group(2);
+	ourName.set_function_code(static_cast<std::uint8_t>(NAME::Function::SteeringControl));
+	ourName.set_identity_number(7);
+	ourName.set_manufacturer_code(69);
+
+	// Get the virtual CAN plugin back to a known state
+	CANMessageFrame testFrame = {};
+	while (!plugin.get_queue_empty())
+	{
+		plugin.read_frame(testFrame);
+	}
+
+	auto internalECU = CANNetworkManager::CANNetwork.create_internal_control_function(ourName, 0, 0x80);
+	EXPECT_FALSE(internalECU->set_remembered_address(NULL_CAN_ADDRESS));
+	EXPECT_TRUE(internalECU->set_remembered_address(0x81));
+
+	// The remembered address is claimed once the random delay expires, without the contention period
+	std::this_thread::sleep_for(std::chrono::milliseconds(200));
+	EXPECT_EQ(InternalControlFunction::State::AddressClaimingComplete, internalECU->get_current_state());
+	EXPECT_TRUE(internalECU->get_address_valid());
+	EXPECT_EQ(0x81, internalECU->get_address());
+	EXPECT_FALSE(internalECU->set_remembered_address(0x82));
+
+	// The claim goes first, then the request for everyone else's claims
+	ASSERT_FALSE(plugin.get_queue_empty());
+	plugin.read_frame(testFrame);
+	EXPECT_EQ(0x18EEFF81, testFrame.identifier);
+	EXPECT_EQ(static_cast<std::uint8_t>(ourName.get_full_name()), testFrame.data[0]);
+	ASSERT_FALSE(plugin.get_queue_empty());
+	plugin.read_frame(testFrame);
+	EXPECT_EQ(0x18EAFFFE, testFrame.identifier);
+	EXPECT_EQ(0x00, testFrame.data[0]);
+	EXPECT_EQ(0xEE, testFrame.data[1]);
+	EXPECT_EQ(0x00, testFrame.data[2]);
+
+	// The remembered CF never claimed, so it goes offline like any other CF that doesn't respond
+	std::this_thread::sleep_for(std::chrono::milliseconds(700));
+	EXPECT_FALSE(partneredTerminal->get_address_valid());
+	EXPECT_EQ(nullptr, CANNetworkManager::CANNetwork.get_control_function(0, 0x26));
+
+	CANHardwareInterface::stop();
+	CANNetworkManager::CANNetwork.deactivate_control_function(partneredTerminal);
+	CANNetworkManager::CANNetwork.deactivate_control_function(internalECU);
+}
@@ -2,6 +2,7 @@
 
 #include "isobus/isobus/can_NAME_filter.hpp"
 #include "isobus/isobus/can_constants.hpp"
+#include "isobus/isobus/can_partnered_control_function.hpp"
 
 #include <chrono>
 #include <thread>
@@ -106,3 +107,51 @@ TEST(CAN_NAME_TESTS, FilterMatches)
 	TestDeviceNAME.set_arbitrary_address_capable(true);
 	EXPECT_TRUE(filterArbitraryAddressCapable.check_name_matches_filter(TestDeviceNAME));
 }
+
+TEST(CAN_NAME_TESTS, FilterMasks)
+{
+	std::uint64_t mask = 0;
+	std::uint64_t maskedValue = 0;
+
+	NAMEFilter filterIdentityNumber(NAME::NAMEParameters::IdentityNumber, 1);
+	ASSERT_TRUE(filterIdentityNumber.get_name_mask(mask, maskedValue));
+	EXPECT_EQ(0x1FFFFFULL, mask);
+	EXPECT_EQ(1ULL, maskedValue);
+
+	NAMEFilter filterFunctionCode(NAME::NAMEParameters::FunctionCode, 0x82);
+	ASSERT_TRUE(filterFunctionCode.get_name_mask(mask, maskedValue));
+	EXPECT_EQ(0xFFULL << 40, mask);
+	EXPECT_EQ(0x82ULL << 40, maskedValue);
+
+	NAMEFilter filterArbitraryAddressCapable(NAME::NAMEParameters::ArbitraryAddressCapable, 5);
+	ASSERT_TRUE(filterArbitraryAddressCapable.get_name_mask(mask, maskedValue));
+	EXPECT_EQ(1ULL << 63, mask);
+	EXPECT_EQ(1ULL << 63, maskedValue);
+
+	// A value that doesn't fit in the component can never match
+	NAMEFilter filterManufacturerCode(NAME::NAMEParameters::ManufacturerCode, 0x800);
+	EXPECT_FALSE(filterManufacturerCode.get_name_mask(mask, maskedValue));
+
+	NAME testDeviceNAME(0);
+	testDeviceNAME.set_function_code(0x82);
+	testDeviceNAME.set_device_class(6);
+	testDeviceNAME.set_identity_number(1234);
+
+	// Filters on different components must all match
+	PartneredControlFunction partner(0, { filterFunctionCode, NAMEFilter(NAME::NAMEParameters::DeviceClass, 6) });
+	EXPECT_TRUE(partner.check_matches_name(testDeviceNAME));
+	testDeviceNAME.set_device_class(7);
+	EXPECT_FALSE(partner.check_matches_name(testDeviceNAME));
+
+	// Filters that contradict each other, or can't match, match nothing
+	PartneredControlFunction contradictingPartner(0, { filterFunctionCode, NAMEFilter(NAME::NAMEParameters::FunctionCode, 0x83) });
+	EXPECT_FALSE(contradictingPartner.check_matches_name(testDeviceNAME));
+	PartneredControlFunction impossiblePartner(0, { filterFunctionCode, filterManufacturerCode });
+	EXPECT_FALSE(impossiblePartner.check_matches_name(testDeviceNAME));
+	PartneredControlFunction unfilteredPartner(0, {});
+	EXPECT_FALSE(unfilteredPartner.check_matches_name(testDeviceNAME));
+
+	// The same filter twice is fine
+	PartneredControlFunction repeatedPartner(0, { filterFunctionCode, filterFunctionCode });
+	EXPECT_TRUE(repeatedPartner.check_matches_name(testDeviceNAME));
+}
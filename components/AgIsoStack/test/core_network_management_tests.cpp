@@ -293,3 +293,109 @@ TEST(CORE_TESTS, SimilarControlFunctions)
 	EXPECT_EQ(TestPartner->get_NAME().get_full_name(), 0xa0000F000425e9f8);
 	CANNetworkManager::CANNetwork.deactivate_control_function(TestPartner);
 }
+
+static void claim_address_with_NAME(std::uint64_t rawNAME, std::uint8_t address)
+{
+	CANNetworkManager::CANNetwork.process_receive_can_message_frame(test_helpers::create_message_frame_broadcast(
+	  6,
+	  0xEE00, // Address Claim PGN
+	  test_helpers::create_mock_control_function(address),
+	  {
+	    static_cast<std::uint8_t>(rawNAME),
+	    static_cast<std::uint8_t>(rawNAME >> 8),
+	    static_cast<std::uint8_t>(rawNAME >> 16),
+	    static_cast<std::uint8_t>(rawNAME >> 24),
+	    static_cast<std::uint8_t>(rawNAME >> 32),
+	    static_cast<std::uint8_t>(rawNAME >> 40),
+	    static_cast<std::uint8_t>(rawNAME >> 48),
+	    static_cast<std::uint8_t>(rawNAME >> 56),
+	  }));
+	CANNetworkManager::CANNetwork.update();
+}
+
+static std::shared_ptr<ControlFunction> get_only_control_function_with_NAME(std::uint64_t rawNAME)
+{
+	std::shared_ptr<ControlFunction> retVal = nullptr;
+
+	for (const auto &controlFunction : CANNetworkManager::CANNetwork.get_control_functions(true))
+	{
+		if (rawNAME == controlFunction->get_NAME().get_full_name())
+		{
+			// The same control function may be in the table and the inactive list, but there must never be two of them
+			EXPECT_TRUE((nullptr == retVal) || (retVal == controlFunction));
+			retVal = controlFunction;
+		}
+	}
+	return retVal;
+}
+
+TEST(CORE_TESTS, ControlFunctionNAMEIndex)
+{
+	CANNetworkManager::CANNetwork.update();
+
+	constexpr std::uint64_t rawNAME = 0xa00086000c1c5d31;
+	constexpr std::uint64_t otherRawNAME = 0xa00086000c1c5d32;
+
+	// Repeated claims resolve to the same control function, even from a different address
+	claim_address_with_NAME(rawNAME, 0x30);
+	auto firstControlFunction = get_only_control_function_with_NAME(rawNAME);
+	ASSERT_NE(nullptr, firstControlFunction);
+	EXPECT_EQ(0x30, firstControlFunction->get_address());
+
+	claim_address_with_NAME(rawNAME, 0x30);
+	EXPECT_EQ(firstControlFunction, get_only_control_function_with_NAME(rawNAME));
+	claim_address_with_NAME(rawNAME, 0x31);
+	EXPECT_EQ(firstControlFunction, get_only_control_function_with_NAME(rawNAME));
+	EXPECT_EQ(0x31, firstControlFunction->get_address());
+
+	// A known NAME can't be added again at another address
+	EXPECT_FALSE(CANNetworkManager::CANNetwork.add_known_control_function(NAME(rawNAME), 0x3F, 0));
+
+	// It doesn't answer a request for address claim, so it goes offline, and is found again when it claims
+	CANNetworkManager::CANNetwork.process_receive_can_message_frame(test_helpers::create_message_frame_pgn_request(
+	  0xEE00, // Address Claim PGN
+	  nullptr,
+	  nullptr));
+	CANNetworkManager::CANNetwork.update();
+	std::this_thread::sleep_for(std::chrono::milliseconds(800));
+	CANNetworkManager::CANNetwork.update();
+	EXPECT_FALSE(firstControlFunction->get_address_valid());
+
+	claim_address_with_NAME(rawNAME, 0x32);
+	EXPECT_EQ(firstControlFunction, get_only_control_function_with_NAME(rawNAME));
+	EXPECT_EQ(0x32, firstControlFunction->get_address());
+
+	// A partner that matches takes its place, and when the partner is deactivated the external control function that
+	// replaces it is found instead
+	const isobus::NAMEFilter filterIdentity(isobus::NAME::NAMEParameters::IdentityNumber, static_cast<std::uint32_t>(rawNAME & 0x1FFFFF));
+	auto partner = CANNetworkManager::CANNetwork.create_partnered_control_function(0, { filterIdentity });
+	CANNetworkManager::CANNetwork.update();
+	EXPECT_EQ(partner, get_only_control_function_with_NAME(rawNAME));
+	claim_address_with_NAME(rawNAME, 0x32);
+	EXPECT_EQ(partner, get_only_control_function_with_NAME(rawNAME));
+
+	CANNetworkManager::CANNetwork.deactivate_control_function(partner);
+	auto secondControlFunction = get_only_control_function_with_NAME(rawNAME);
+	ASSERT_NE(nullptr, secondControlFunction);
+	EXPECT_NE(std::static_pointer_cast<ControlFunction>(partner), secondControlFunction);
+	EXPECT_NE(firstControlFunction, secondControlFunction);
+	claim_address_with_NAME(rawNAME, 0x33);
+	EXPECT_EQ(secondControlFunction, get_only_control_function_with_NAME(rawNAME));
+	EXPECT_EQ(0x33, secondControlFunction->get_address());
+
+	// Another NAME claiming its address drops it from the table while the index still points at it.
+	// The stale entry is noticed on the next claim, and the control function made for it is indexed instead.
+	claim_address_with_NAME(otherRawNAME, 0x33);
+	EXPECT_FALSE(secondControlFunction->get_address_valid());
+	EXPECT_EQ(nullptr, get_only_control_function_with_NAME(rawNAME));
+
+	claim_address_with_NAME(rawNAME, 0x34);
+	auto thirdControlFunction = get_only_control_function_with_NAME(rawNAME);
+	ASSERT_NE(nullptr, thirdControlFunction);
+	EXPECT_NE(secondControlFunction, thirdControlFunction);
+	EXPECT_EQ(0x34, thirdControlFunction->get_address());
+	claim_address_with_NAME(rawNAME, 0x35);
+	EXPECT_EQ(thirdControlFunction, get_only_control_function_with_NAME(rawNAME));
+	EXPECT_EQ(0x35, thirdControlFunction->get_address());
+	EXPECT_FALSE(CANNetworkManager::CANNetwork.add_known_control_function(NAME(rawNAME), 0x3F, 0));
+}
@@ -2,13 +2,16 @@
 
 #include "isobus/isobus/can_constants.hpp"
 #include "isobus/isobus/isobus_device_descriptor_object_pool.hpp"
+#include "isobus/isobus/isobus_device_descriptor_object_pool_helpers.hpp"
 #include "isobus/isobus/isobus_language_command_interface.hpp"
 #include "isobus/isobus/isobus_standard_data_description_indices.hpp"
+#include "isobus/isobus/isobus_static_device_descriptor_object_pool.hpp"
 #include "isobus/utility/to_string.hpp"
 
 using namespace isobus;
 
 static constexpr std::size_t NUMBER_SECTIONS_TO_CREATE = 16;
+static constexpr std::uint16_t NUMBER_LARGE_DDOP_SECTIONS = 499; ///< With 4 objects per section plus 4 others, this makes a 2000 object DDOP
 
 enum class SprayerDDOPObjectIDs : std::uint16_t
 {
@@ -728,3 +731,165 @@ TEST(DDOP_TESTS, ISOXMLOutput)
 )ISOXML";
 	EXPECT_EQ(textXML, isoxml);
 }
+
+TEST(DDOP_TESTS, LargeDDOPIndexedLookup)
+{
+	DeviceDescriptorObjectPool testDDOP;
+	LanguageCommandInterface testLanguageInterface(nullptr, nullptr);
+
+	// A synthetic planter sized DDOP, with one boom of sections that each have work state, offset and width
+	ASSERT_TRUE(testDDOP.add_device("AgIsoStack++ UnitTest", "1.0.0", "123", "I++1.0", testLanguageInterface.get_localization_raw_data(), std::vector<std::uint8_t>(), 0));
+	ASSERT_TRUE(testDDOP.add_device_element("Planter", 0, 0, task_controller_object::DeviceElementObject::Type::Device, 1));
+	ASSERT_TRUE(testDDOP.add_device_element("Boom", 1, 1, task_controller_object::DeviceElementObject::Type::Function, 2));
+	ASSERT_TRUE(testDDOP.add_device_value_presentation("mm", 0, 1.0f, 0, 3));
+
+	for (std::uint16_t i = 0; i < NUMBER_LARGE_DDOP_SECTIONS; i++)
+	{
+		const std::uint16_t sectionID = 10 + (4 * i);
+		ASSERT_TRUE(testDDOP.add_device_element("Section " + isobus::to_string(static_cast<int>(i)), 2 + i, 2, task_controller_object::DeviceElementObject::Type::Section, sectionID));
+		ASSERT_TRUE(testDDOP.add_device_process_data("Actual Work State", static_cast<std::uint16_t>(DataDescriptionIndex::ActualWorkState), NULL_OBJECT_ID, 0, static_cast<std::uint8_t>(task_controller_object::DeviceProcessDataObject::AvailableTriggerMethods::OnChange), sectionID + 1));
+		ASSERT_TRUE(testDDOP.add_device_property("Offset Y", 500 * i, static_cast<std::uint16_t>(DataDescriptionIndex::DeviceElementOffsetY), 3, sectionID + 2));
+		ASSERT_TRUE(testDDOP.add_device_property("Width", 500, static_cast<std::uint16_t>(DataDescriptionIndex::ActualWorkingWidth), 3, sectionID + 3));
+
+		auto section = std::static_pointer_cast<task_controller_object::DeviceElementObject>(testDDOP.get_object_by_id(sectionID));
+		ASSERT_NE(nullptr, section);
+		section->add_reference_to_child_object(sectionID + 1);
+		section->add_reference_to_child_object(sectionID + 2);
+		section->add_reference_to_child_object(sectionID + 3);
+	}
+	ASSERT_EQ(2000, testDDOP.size());
+
+	std::vector<std::uint8_t> binaryDDOP;
+	ASSERT_TRUE(testDDOP.generate_binary_object_pool(binaryDDOP));
+
+	// Deserialize and parse the geometry as a TC server would when the pool is uploaded
+	DeviceDescriptorObjectPool deserializedDDOP;
+	ASSERT_TRUE(deserializedDDOP.deserialize_binary_object_pool(binaryDDOP));
+	EXPECT_EQ(2000, deserializedDDOP.size());
+
+	auto implement = DeviceDescriptorObjectPoolHelper::get_implement_geometry(deserializedDDOP);
+
+	ASSERT_EQ(1, implement.booms.size());
+	ASSERT_EQ(NUMBER_LARGE_DDOP_SECTIONS, implement.booms[0].sections.size());
+	EXPECT_EQ(NUMBER_LARGE_DDOP_SECTIONS + 1, implement.booms[0].sections.back().elementNumber);
+	EXPECT_EQ(500 * (NUMBER_LARGE_DDOP_SECTIONS - 1), implement.booms[0].sections.back().yOffset_mm.get());
+	EXPECT_EQ(500, implement.booms[0].sections.back().width_mm.get());
+
+	// Look up every section's work state the way process data messages address it
+	for (std::uint16_t i = 0; i < NUMBER_LARGE_DDOP_SECTIONS; i++)
+	{
+		auto workState = deserializedDDOP.get_process_data_object(2 + i, static_cast<std::uint16_t>(DataDescriptionIndex::ActualWorkState));
+		ASSERT_NE(nullptr, workState);
+		EXPECT_EQ(11 + (4 * i), workState->get_object_id());
+	}
+	EXPECT_EQ(nullptr, deserializedDDOP.get_process_data_object(1, static_cast<std::uint16_t>(DataDescriptionIndex::ActualWorkState)));
+	EXPECT_EQ(nullptr, deserializedDDOP.get_process_data_object(2, static_cast<std::uint16_t>(DataDescriptionIndex::SetpointWorkState)));
+
+	// The indexes keep up with objects that are changed, removed and re-added
+	auto renamedObject = deserializedDDOP.get_object_by_id(3);
+	ASSERT_NE(nullptr, renamedObject);
+	renamedObject->set_object_id(4);
+	EXPECT_EQ(nullptr, deserializedDDOP.get_object_by_id(3));
+	EXPECT_EQ(renamedObject, deserializedDDOP.get_object_by_id(4));
+
+	auto movedWorkState = std::static_pointer_cast<task_controller_object::DeviceProcessDataObject>(deserializedDDOP.get_object_by_id(11));
+	ASSERT_NE(nullptr, movedWorkState);
+	movedWorkState->set_ddi(static_cast<std::uint16_t>(DataDescriptionIndex::SetpointWorkState));
+	EXPECT_EQ(nullptr, deserializedDDOP.get_process_data_object(2, static_cast<std::uint16_t>(DataDescriptionIndex::ActualWorkState)));
+
+	EXPECT_TRUE(deserializedDDOP.remove_object_by_id(11));
+	EXPECT_EQ(nullptr, deserializedDDOP.get_object_by_id(11));
+	EXPECT_EQ(nullptr, deserializedDDOP.get_process_data_object(2, static_cast<std::uint16_t>(DataDescriptionIndex::SetpointWorkState)));
+	EXPECT_TRUE(deserializedDDOP.add_device_process_data("Actual Work State", static_cast<std::uint16_t>(DataDescriptionIndex::ActualWorkState), NULL_OBJECT_ID, 0, 0, 11));
+	EXPECT_EQ(11, deserializedDDOP.get_process_data_object(2, static_cast<std::uint16_t>(DataDescriptionIndex::ActualWorkState))->get_object_id());
+}
+
+static constexpr std::uint8_t STATIC_LOCALIZATION_LABEL[] = { 'e', 'n', 0x50, 0x00, 0x55, 0x55, 0xFF };
+static constexpr std::uint8_t STATIC_EXTENDED_STRUCTURE_LABEL[] = { 'E', 'X', 'T' };
+static constexpr std::uint16_t STATIC_MAIN_ELEMENT_CHILDREN[] = { 2, 3 };
+static constexpr std::uint16_t STATIC_BOOM_CHILDREN[] = { 5, 6, 7 };
+static constexpr std::uint64_t STATIC_CLIENT_NAME = 0xA00086000CE00001;
+
+static constexpr auto STATIC_SPRAYER_DDOP = static_ddop::make_pool(
+  static_ddop::device("AgIsoStack++ UnitTest", "1.0.0", "123", "I++1.0", STATIC_LOCALIZATION_LABEL, STATIC_EXTENDED_STRUCTURE_LABEL, STATIC_CLIENT_NAME),
+  static_ddop::device_element("Sprayer", 0, 0, task_controller_object::DeviceElementObject::Type::Device, 1, STATIC_MAIN_ELEMENT_CHILDREN),
+  static_ddop::device_process_data("Actual Work State", static_cast<std::uint16_t>(DataDescriptionIndex::ActualWorkState), NULL_OBJECT_ID, static_cast<std::uint8_t>(task_controller_object::DeviceProcessDataObject::PropertiesBit::MemberOfDefaultSet), static_cast<std::uint8_t>(task_controller_object::DeviceProcessDataObject::AvailableTriggerMethods::OnChange), 2),
+  static_ddop::device_property("Connector Type", 6, static_cast<std::uint16_t>(DataDescriptionIndex::ConnectorType), NULL_OBJECT_ID, 3),
+  static_ddop::device_element("Boom", 1, 1, task_controller_object::DeviceElementObject::Type::Function, 4, STATIC_BOOM_CHILDREN),
+  static_ddop::device_process_data("Setpoint Work State", static_cast<std::uint16_t>(DataDescriptionIndex::SetpointWorkState), NULL_OBJECT_ID, static_cast<std::uint8_t>(task_controller_object::DeviceProcessDataObject::PropertiesBit::Settable), static_cast<std::uint8_t>(task_controller_object::DeviceProcessDataObject::AvailableTriggerMethods::OnChange), 5),
+  static_ddop::device_process_data("Actual Working Width", static_cast<std::uint16_t>(DataDescriptionIndex::ActualWorkingWidth), 8, static_cast<std::uint8_t>(task_controller_object::DeviceProcessDataObject::PropertiesBit::MemberOfDefaultSet), static_cast<std::uint8_t>(task_controller_object::DeviceProcessDataObject::AvailableTriggerMethods::TimeInterval), 6),
+  static_ddop::device_property("Offset Y", -18288, static_cast<std::uint16_t>(DataDescriptionIndex::DeviceElementOffsetY), 9, 7),
+  static_ddop::device_value_presentation("m", 0, 0.001f, 3, 8),
+  static_ddop::device_value_presentation("mm", -5, 1.0f, 0, 9),
+  static_ddop::device_element("Section", 2, 4, task_controller_object::DeviceElementObject::Type::Section, 10));
+static constexpr auto STATIC_SPRAYER_PROCESS_DATA = static_ddop::make_process_data_table<static_ddop::count_process_data(STATIC_SPRAYER_DDOP)>(STATIC_SPRAYER_DDOP);
+
+TEST(DDOP_TESTS, StaticDDOPMatchesRuntimeDDOP)
+{
+	DeviceDescriptorObjectPool testDDOP;
+
+	EXPECT_TRUE(testDDOP.add_device("AgIsoStack++ UnitTest", "1.0.0", "123", "I++1.0", std::array<std::uint8_t, 7>{ { 'e', 'n', 0x50, 0x00, 0x55, 0x55, 0xFF } }, std::vector<std::uint8_t>{ 'E', 'X', 'T' }, STATIC_CLIENT_NAME));
+	EXPECT_TRUE(testDDOP.add_device_element("Sprayer", 0, 0, task_controller_object::DeviceElementObject::Type::Device, 1));
+	EXPECT_TRUE(testDDOP.add_device_process_data("Actual Work State", static_cast<std::uint16_t>(DataDescriptionIndex::ActualWorkState), NULL_OBJECT_ID, static_cast<std::uint8_t>(task_controller_object::DeviceProcessDataObject::PropertiesBit::MemberOfDefaultSet), static_cast<std::uint8_t>(task_controller_object::DeviceProcessDataObject::AvailableTriggerMethods::OnChange), 2));
+	EXPECT_TRUE(testDDOP.add_device_property("Connector Type", 6, static_cast<std::uint16_t>(DataDescriptionIndex::ConnectorType), NULL_OBJECT_ID, 3));
+	EXPECT_TRUE(testDDOP.add_device_element("Boom", 1, 1, task_controller_object::DeviceElementObject::Type::Function, 4));
+	EXPECT_TRUE(testDDOP.add_device_process_data("Setpoint Work State", static_cast<std::uint16_t>(DataDescriptionIndex::SetpointWorkState), NULL_OBJECT_ID, static_cast<std::uint8_t>(task_controller_object::DeviceProcessDataObject::PropertiesBit::Settable), static_cast<std::uint8_t>(task_controller_object::DeviceProcessDataObject::AvailableTriggerMethods::OnChange), 5));
+	EXPECT_TRUE(testDDOP.add_device_process_data("Actual Working Width", static_cast<std::uint16_t>(DataDescriptionIndex::ActualWorkingWidth), 8, static_cast<std::uint8_t>(task_controller_object::DeviceProcessDataObject::PropertiesBit::MemberOfDefaultSet), static_cast<std::uint8_t>(task_controller_object::DeviceProcessDataObject::AvailableTriggerMethods::TimeInterval), 6));
+	EXPECT_TRUE(testDDOP.add_device_property("Offset Y", -18288, static_cast<std::uint16_t>(DataDescriptionIndex::DeviceElementOffsetY), 9, 7));
+	EXPECT_TRUE(testDDOP.add_device_value_presentation("m", 0, 0.001f, 3, 8));
+	EXPECT_TRUE(testDDOP.add_device_value_presentation("mm", -5, 1.0f, 0, 9));
+	EXPECT_TRUE(testDDOP.add_device_element("Section", 2, 4, task_controller_object::DeviceElementObject::Type::Section, 10));
+
+	auto sprayer = std::static_pointer_cast<task_controller_object::DeviceElementObject>(testDDOP.get_object_by_id(1));
+	sprayer->add_reference_to_child_object(2);
+	sprayer->add_reference_to_child_object(3);
+	auto boom = std::static_pointer_cast<task_controller_object::DeviceElementObject>(testDDOP.get_object_by_id(4));
+	boom->add_reference_to_child_object(5);
+	boom->add_reference_to_child_object(6);
+	boom->add_reference_to_child_object(7);
+
+	std::vector<std::uint8_t> binaryDDOP;
+	ASSERT_TRUE(testDDOP.generate_binary_object_pool(binaryDDOP));
+
+	// The compile time pool must be byte for byte what the runtime builder serializes
+	ASSERT_EQ(binaryDDOP.size(), STATIC_SPRAYER_DDOP.size());
+	EXPECT_EQ(binaryDDOP, std::vector<std::uint8_t>(STATIC_SPRAYER_DDOP.bytes, STATIC_SPRAYER_DDOP.bytes + STATIC_SPRAYER_DDOP.size()));
+
+	// Check the compile time lookups
+	static_assert(3 == static_ddop::count_process_data(STATIC_SPRAYER_DDOP), "Sprayer DDOP should have 3 process data entries");
+	static_assert(1 == STATIC_SPRAYER_PROCESS_DATA.entries[1].elementNumber, "Setpoint work state should belong to the boom");
+	static_assert(5 == STATIC_SPRAYER_PROCESS_DATA.entries[1].objectID, "Setpoint work state should be object 5");
+
+	StaticDeviceDescriptorObjectPool staticDDOP(STATIC_SPRAYER_DDOP, STATIC_SPRAYER_PROCESS_DATA);
+	EXPECT_EQ(binaryDDOP.size(), staticDDOP.size());
+	EXPECT_EQ(STATIC_SPRAYER_DDOP.bytes, staticDDOP.get_binary_object_pool());
+	EXPECT_EQ("I++1.0 ", staticDDOP.get_structure_label());
+	std::array<std::uint8_t, 7> expectedLocalization = { { 'e', 'n', 0x50, 0x00, 0x55, 0x55, 0xFF } };
+	EXPECT_EQ(expectedLocalization, staticDDOP.get_localization_label());
+	ASSERT_EQ(3, staticDDOP.get_number_process_data());
+
+	std::uint16_t objectID = NULL_OBJECT_ID;
+	EXPECT_TRUE(staticDDOP.get_process_data_object_id(0, static_cast<std::uint16_t>(DataDescriptionIndex::ActualWorkState), objectID));
+	EXPECT_EQ(2, objectID);
+	EXPECT_TRUE(staticDDOP.get_process_data_object_id(1, static_cast<std::uint16_t>(DataDescriptionIndex::ActualWorkingWidth), objectID));
+	EXPECT_EQ(6, objectID);
+	EXPECT_FALSE(staticDDOP.get_process_data_object_id(0, static_cast<std::uint16_t>(DataDescriptionIndex::ConnectorType), objectID));
+	EXPECT_FALSE(staticDDOP.get_process_data_object_id(2, static_cast<std::uint16_t>(DataDescriptionIndex::ActualWorkState), objectID));
+
+	// Every entry should agree with the runtime index
+	for (std::size_t i = 0; i < staticDDOP.get_number_process_data(); i++)
+	{
+		const auto &entry = staticDDOP.get_process_data(i);
+		auto processData = testDDOP.get_process_data_object(entry.elementNumber, entry.ddi);
+		ASSERT_NE(nullptr, processData);
+		EXPECT_EQ(entry.objectID, processData->get_object_id());
+	}
+
+	// And the runtime parser should be able to read it back
+	testDDOP.clear();
+	std::vector<std::uint8_t> staticBinary(STATIC_SPRAYER_DDOP.bytes, STATIC_SPRAYER_DDOP.bytes + STATIC_SPRAYER_DDOP.size());
+	EXPECT_TRUE(testDDOP.deserialize_binary_object_pool(staticBinary, NAME(STATIC_CLIENT_NAME)));
+	auto presentation = std::static_pointer_cast<task_controller_object::DeviceValuePresentationObject>(testDDOP.get_object_by_id(8));
+	ASSERT_NE(nullptr, presentation);
+	EXPECT_EQ(0.001f, presentation->get_scale());
+}
@@ -1287,6 +1287,41 @@ TEST(DIAGNOSTIC_PROTOCOL_TESTS, MessageEncoding)
 		EXPECT_FALSE(protocolUnderTest.get_diagnostic_trouble_code_active(testDTC2));
 		EXPECT_TRUE(protocolUnderTest.get_diagnostic_trouble_code_active(testDTC3));
 
+		// DTCs are identified by their SPN and FMI, so a different lamp state is still the same DTC
+		isobus::DiagnosticProtocol::DiagnosticTroubleCode testDTC1Amber(1234, isobus::DiagnosticProtocol::FailureModeIdentifier::ConditionExists, isobus::DiagnosticProtocol::LampStatus::AmberWarningLampSolid);
+		EXPECT_TRUE(protocolUnderTest.get_diagnostic_trouble_code_active(testDTC1Amber));
+		EXPECT_FALSE(protocolUnderTest.set_diagnostic_trouble_code_active(testDTC1Amber, true));
+
+		// Reactivating a DTC keeps its place in the DM1 and counts another occurrence
+		EXPECT_TRUE(protocolUnderTest.set_diagnostic_trouble_code_active(testDTC2, true));
+		EXPECT_TRUE(protocolUnderTest.get_diagnostic_trouble_code_active(testDTC2));
+
+		testFrame.dataLength = 3;
+		testFrame.identifier = 0x18EAAAAB;
+		testFrame.data[0] = 0xCA;
+		testFrame.data[1] = 0xFE;
+		testFrame.data[2] = 0x00;
+		CANNetworkManager::CANNetwork.process_receive_can_message_frame(testFrame);
+		CANNetworkManager::CANNetwork.update();
+		protocolUnderTest.update();
+
+		EXPECT_TRUE(testPlugin.read_frame(testFrame));
+		EXPECT_EQ(0x1CECFFAA, testFrame.identifier); // BAM
+		EXPECT_EQ(14, testFrame.data[1]); // Length LSB
+
+		EXPECT_TRUE(testPlugin.read_frame(testFrame));
+		EXPECT_EQ(0x01, testFrame.data[0]); // Sequence 1
+		EXPECT_EQ(0xD2, testFrame.data[3]); // SPN 1
+		EXPECT_EQ(1, testFrame.data[6]); // Count 1
+		EXPECT_EQ(0x37, testFrame.data[7]); // SPN 2
+
+		EXPECT_TRUE(testPlugin.read_frame(testFrame));
+		EXPECT_EQ(0x02, testFrame.data[0]); // Sequence 2
+		EXPECT_EQ(2, testFrame.data[2]); // FMI 2
+		EXPECT_EQ(2, testFrame.data[3]); // Count 2
+		EXPECT_EQ(0xCE, testFrame.data[4]); // SPN 3
+		EXPECT_EQ(1, testFrame.data[7]); // Count 3
+
 		EXPECT_EQ(1234, testDTC1.get_suspect_parameter_number());
 		EXPECT_EQ(567, testDTC2.get_suspect_parameter_number());
 		EXPECT_EQ(8910, testDTC3.get_suspect_parameter_number());
@@ -0,0 +1,146 @@
+//================================================================================================
+/// @file fast_packet_protocol_tests.cpp
+///
+/// @brief Unit tests for sending and receiving NMEA2000 fast packet messages.
+/// @author The Little Dawn Developers
+///
+/// @copyright 2026 The Little Dawn Developers
+//================================================================================================
+#include <gtest/gtest.h>
+
+#include "isobus/isobus/nmea2000_fast_packet_protocol.hpp"
+
+#include "helpers/control_function_helpers.hpp"
+#include "helpers/messaging_helpers.hpp"
+
+#include <array>
+#include <vector>
+
+using namespace isobus;
+
+static bool read_chunked_message(std::uint32_t, std::uint32_t bytesOffset, std::uint32_t numberOfBytesNeeded, std::uint8_t *chunkBuffer, void *)
+{
+	for (std::uint32_t i = 0; i < numberOfBytesNeeded; i++)
+	{
+		chunkBuffer[i] = static_cast<std::uint8_t>(0x80 + bytesOffset + i);
+	}
+	return true;
+}
+
+TEST(FAST_PACKET_PROTOCOL_TESTS, MessageSending)
+{
+	constexpr std::uint32_t pgnToSend = 0x1F805;
+	std::array<std::uint8_t, 20> dataToSend;
+	for (std::uint8_t i = 0; i < dataToSend.size(); i++)
+	{
+		dataToSend[i] = i;
+	}
+
+	auto originator = test_helpers::create_mock_internal_control_function(0x46);
+	std::vector<std::array<std::uint8_t, CAN_DATA_LENGTH>> sentFrames;
+
+	auto sendFrameCallback = [&](std::uint32_t parameterGroupNumber,
+	                             CANDataSpan data,
+	                             std::shared_ptr<InternalControlFunction> sourceControlFunction,
+	                             std::shared_ptr<ControlFunction> destinationControlFunction,
+	                             CANIdentifier::CANPriority priority) {
+		EXPECT_EQ(pgnToSend, parameterGroupNumber);
+		EXPECT_EQ(CAN_DATA_LENGTH, data.size());
+		EXPECT_EQ(originator, sourceControlFunction);
+		EXPECT_EQ(nullptr, destinationControlFunction);
+		EXPECT_EQ(CANIdentifier::CANPriority::Priority3, priority);
+
+		std::array<std::uint8_t, CAN_DATA_LENGTH> frame;
+		std::copy(data.begin(), data.end(), frame.begin());
+		sentFrames.push_back(frame);
+		return true;
+	};
+
+	FastPacketProtocol protocol(sendFrameCallback);
+
+	EXPECT_FALSE(protocol.send_multipacket_message(pgnToSend, dataToSend.data(), CAN_DATA_LENGTH, originator, nullptr, CANIdentifier::CANPriority::Priority3));
+	EXPECT_FALSE(protocol.send_multipacket_message(pgnToSend, nullptr, 20, originator, nullptr, CANIdentifier::CANPriority::Priority3));
+
+	// Each message continues the sequence of the previous one with the same PGN, and reuses its session
+	for (std::uint8_t sequenceNumber = 0; sequenceNumber < 3; sequenceNumber++)
+	{
+		sentFrames.clear();
+		ASSERT_TRUE(protocol.send_multipacket_message(pgnToSend, dataToSend.data(), static_cast<std::uint8_t>(dataToSend.size()), originator, nullptr, CANIdentifier::CANPriority::Priority3));
+		EXPECT_FALSE(protocol.send_multipacket_message(pgnToSend, dataToSend.data(), static_cast<std::uint8_t>(dataToSend.size()), originator, nullptr, CANIdentifier::CANPriority::Priority3));
+		protocol.update();
+		protocol.update();
+
+		ASSERT_EQ(3, sentFrames.size());
+		EXPECT_EQ(sequenceNumber << 5, sentFrames[0][0]);
+		EXPECT_EQ(20, sentFrames[0][1]);
+		EXPECT_EQ((sequenceNumber << 5) | 1, sentFrames[1][0]);
+		EXPECT_EQ((sequenceNumber << 5) | 2, sentFrames[2][0]);
+
+		for (std::uint8_t i = 0; i < 6; i++)
+		{
+			EXPECT_EQ(dataToSend[i], sentFrames[0][2 + i]);
+		}
+		for (std::uint8_t i = 0; i < 7; i++)
+		{
+			EXPECT_EQ(dataToSend[6 + i], sentFrames[1][1 + i]);
+		}
+		for (std::uint8_t i = 0; i < 7; i++)
+		{
+			EXPECT_EQ(dataToSend[13 + i], sentFrames[2][1 + i]);
+		}
+	}
+
+	// Data can also be supplied by a chunk callback
+	sentFrames.clear();
+	ASSERT_TRUE(protocol.send_multipacket_message(pgnToSend, nullptr, 9, originator, nullptr, CANIdentifier::CANPriority::Priority3, nullptr, nullptr, read_chunked_message));
+	protocol.update();
+	protocol.update();
+
+	ASSERT_EQ(2, sentFrames.size());
+	EXPECT_EQ(3 << 5, sentFrames[0][0]);
+	EXPECT_EQ(9, sentFrames[0][1]);
+	EXPECT_EQ(0x80, sentFrames[0][2]);
+	EXPECT_EQ(0x85, sentFrames[0][7]);
+	EXPECT_EQ(0x86, sentFrames[1][1]);
+	EXPECT_EQ(0x88, sentFrames[1][3]);
+	EXPECT_EQ(0xFF, sentFrames[1][4]);
+}
+
+TEST(FAST_PACKET_PROTOCOL_TESTS, MessageReceiving)
+{
+	constexpr std::uint32_t pgnToReceive = 0x1F805;
+
+	auto originator = test_helpers::create_mock_control_function(0x47);
+	std::vector<std::vector<std::uint8_t>> receivedMessages;
+
+	FastPacketProtocol protocol([](std::uint32_t, CANDataSpan, std::shared_ptr<InternalControlFunction>, std::shared_ptr<ControlFunction>, CANIdentifier::CANPriority) {
+		return true;
+	});
+	protocol.register_multipacket_message_callback(
+	  pgnToReceive,
+	  [](const CANMessage &message, void *parent) {
+		  EXPECT_EQ(0x1F805, message.get_identifier().get_parameter_group_number());
+		  static_cast<std::vector<std::vector<std::uint8_t>> *>(parent)->push_back(message.get_data());
+	  },
+	  &receivedMessages);
+
+	// Receive the same message twice, so the second one uses the session of the first one
+	for (std::uint8_t sequenceNumber = 0; sequenceNumber < 2; sequenceNumber++)
+	{
+		const std::uint8_t counter = static_cast<std::uint8_t>(sequenceNumber << 5);
+		protocol.process_message(test_helpers::create_message_broadcast(3, pgnToReceive, originator, { counter, 10, 1, 2, 3, 4, 5, 6 }));
+		EXPECT_EQ(sequenceNumber, receivedMessages.size());
+		protocol.process_message(test_helpers::create_message_broadcast(3, pgnToReceive, originator, { static_cast<std::uint8_t>(counter | 1), 7, 8, 9, 10, 0xFF, 0xFF, 0xFF }));
+
+		ASSERT_EQ(sequenceNumber + 1, receivedMessages.size());
+		ASSERT_EQ(10, receivedMessages.back().size());
+		for (std::uint8_t i = 0; i < 10; i++)
+		{
+			EXPECT_EQ(i + 1, receivedMessages.back()[i]);
+		}
+	}
+
+	// A frame in the middle of a message we have no context for is ignored
+	protocol.process_message(test_helpers::create_message_broadcast(3, pgnToReceive, originator, { 1, 7, 8, 9, 10, 0xFF, 0xFF, 0xFF }));
+	EXPECT_EQ(2, receivedMessages.size());
+}
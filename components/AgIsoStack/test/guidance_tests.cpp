@@ -9,6 +9,7 @@
 #include "helpers/control_function_helpers.hpp"
 
 #include <cmath>
+#include <limits>
 
 using namespace isobus;
 
@@ -333,3 +334,86 @@ TEST(GUIDANCE_TESTS, ListenOnlyModeAndDecoding)
 	EXPECT_EQ(nullptr, interfaceUnderTest.get_received_guidance_machine_info(0));
 	EXPECT_EQ(nullptr, interfaceUnderTest.get_received_guidance_system_command(0));
 }
+
+TEST(GUIDANCE_TESTS, DeadlineDrivenTransmit)
+{
+	VirtualCANPlugin testPlugin;
+	testPlugin.open();
+
+	CANHardwareInterface::set_number_of_can_channels(1);
+	CANHardwareInterface::assign_can_channel_frame_handler(0, std::make_shared<VirtualCANPlugin>());
+	CANHardwareInterface::start();
+
+	auto testECU = test_helpers::claim_internal_control_function(0x45, 0);
+
+	// Get the virtual CAN plugin back to a known state
+	CANMessageFrame testFrame = {};
+	while (!testPlugin.get_queue_empty())
+	{
+		testPlugin.read_frame(testFrame);
+	}
+	ASSERT_TRUE(testPlugin.get_queue_empty());
+
+	EXPECT_EQ(100, AgriculturalGuidanceInterface::get_transmit_jitter_histogram_bin_limit_us(0));
+	EXPECT_EQ(10000, AgriculturalGuidanceInterface::get_transmit_jitter_histogram_bin_limit_us(AgriculturalGuidanceInterface::TransmitJitterHistogram::NUMBER_OF_BINS - 2));
+	EXPECT_EQ(std::numeric_limits<std::uint32_t>::max(), AgriculturalGuidanceInterface::get_transmit_jitter_histogram_bin_limit_us(AgriculturalGuidanceInterface::TransmitJitterHistogram::NUMBER_OF_BINS - 1));
+	EXPECT_EQ(std::numeric_limits<std::uint32_t>::max(), AgriculturalGuidanceInterface::get_transmit_jitter_histogram_bin_limit_us(100));
+
+	{
+		AgriculturalGuidanceInterface interfaceUnderTest(testECU, nullptr, true, true);
+		EXPECT_FALSE(interfaceUnderTest.get_deadline_driven_transmit());
+		interfaceUnderTest.set_deadline_driven_transmit(true);
+		EXPECT_TRUE(interfaceUnderTest.get_deadline_driven_transmit());
+		interfaceUnderTest.initialize();
+
+		{
+			// The hardware interface's thread sends the messages, so changes to them are made with the transmit data locked
+			auto &transmitDataMutex = interfaceUnderTest.get_transmit_data_mutex();
+			LOCK_GUARD(Mutex, transmitDataMutex);
+			interfaceUnderTest.guidanceMachineInfoTransmitData.set_estimated_curvature(10.0f);
+		}
+
+		// Both messages are sent right away and then every 100ms by the hardware interface's thread, without calling update()
+		std::this_thread::sleep_for(std::chrono::milliseconds(250));
+
+		std::size_t numberOfFrames = 0;
+		while (!testPlugin.get_queue_empty())
+		{
+			testPlugin.read_frame(testFrame);
+			numberOfFrames++;
+		}
+		EXPECT_EQ(6, numberOfFrames);
+
+		const auto histogram = interfaceUnderTest.get_transmit_jitter_histogram();
+		std::uint32_t numberOfBinnedMessages = 0;
+		for (const auto &bin : histogram.bins)
+		{
+			numberOfBinnedMessages += bin;
+		}
+		EXPECT_EQ(6, histogram.numberOfMessages);
+		EXPECT_EQ(6, numberOfBinnedMessages);
+		EXPECT_LE(histogram.totalLateness_us, static_cast<std::uint64_t>(histogram.maximumLateness_us) * histogram.numberOfMessages);
+
+		interfaceUnderTest.reset_transmit_jitter_histogram();
+		EXPECT_EQ(0, interfaceUnderTest.get_transmit_jitter_histogram().numberOfMessages);
+
+		// Without the deadline driven mode, nothing is sent until update() is called
+		interfaceUnderTest.set_deadline_driven_transmit(false);
+		std::this_thread::sleep_for(std::chrono::milliseconds(150));
+		EXPECT_TRUE(testPlugin.get_queue_empty());
+
+		interfaceUnderTest.update();
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		EXPECT_FALSE(testPlugin.get_queue_empty());
+		EXPECT_EQ(0, interfaceUnderTest.get_transmit_jitter_histogram().numberOfMessages);
+	}
+
+	CANHardwareInterface::stop();
+	testPlugin.close();
+
+	// Once stopped, the hardware interface no longer services deadlines, so they are left to update()
+	EXPECT_FALSE(CANNetworkManager::CANNetwork.request_deadline_update(SystemTiming::get_timestamp_us()));
+
+	CANNetworkManager::CANNetwork.update(); //! @todo: quick hack for clearing the transmit queue, can be removed once network manager' singleton is removed
+	CANNetworkManager::CANNetwork.deactivate_control_function(testECU);
+}
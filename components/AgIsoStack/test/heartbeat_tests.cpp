@@ -133,3 +133,109 @@ TEST(HEARTBEAT_TESTS, HeartBeat)
 
 	CANHardwareInterface::stop();
 }
+
+TEST(HEARTBEAT_TESTS, ReceivedHeartbeatStatistics)
+{
+	HeartbeatInterface interface([](std::uint32_t, CANDataSpan, std::shared_ptr<InternalControlFunction>, std::shared_ptr<ControlFunction>, CANIdentifier::CANPriority) {
+		return true;
+	});
+	constexpr std::uint32_t HEARTBEAT_PGN = 0xF0E4;
+	std::size_t numberOfNewHeartbeats = 0;
+	std::size_t numberOfInvalidSequences = 0;
+	std::size_t numberOfTimeouts = 0;
+
+	interface.get_new_tracked_heartbeat_event_dispatcher().add_listener([&numberOfNewHeartbeats](std::shared_ptr<ControlFunction>) {
+		numberOfNewHeartbeats++;
+	});
+	interface.get_heartbeat_error_event_dispatcher().add_listener([&numberOfInvalidSequences, &numberOfTimeouts](HeartbeatInterface::HeartBeatError error, std::shared_ptr<ControlFunction>) {
+		if (HeartbeatInterface::HeartBeatError::TimedOut == error)
+		{
+			numberOfTimeouts++;
+		}
+		else
+		{
+			numberOfInvalidSequences++;
+		}
+	});
+
+	auto firstPartner = test_helpers::create_mock_control_function(0x10);
+	auto secondPartner = test_helpers::create_mock_control_function(0x20);
+	auto thirdPartner = test_helpers::create_mock_control_function(0x30);
+	HeartbeatInterface::HeartbeatStatistics statistics;
+
+	EXPECT_FALSE(interface.get_heartbeat_statistics(firstPartner, statistics));
+
+	interface.process_rx_message(test_helpers::create_message_broadcast(3, HEARTBEAT_PGN, firstPartner, { 251 }));
+	interface.process_rx_message(test_helpers::create_message_broadcast(3, HEARTBEAT_PGN, secondPartner, { 251 }));
+	interface.process_rx_message(test_helpers::create_message_broadcast(3, HEARTBEAT_PGN, thirdPartner, { 251 }));
+	EXPECT_EQ(3, numberOfNewHeartbeats);
+	EXPECT_EQ(3, interface.get_number_of_tracked_heartbeats());
+
+	// The first partner counts normally, the second one skips two, and the third one repeats itself
+	interface.process_rx_message(test_helpers::create_message_broadcast(3, HEARTBEAT_PGN, firstPartner, { 0 }));
+	interface.process_rx_message(test_helpers::create_message_broadcast(3, HEARTBEAT_PGN, secondPartner, { 2 }));
+	interface.process_rx_message(test_helpers::create_message_broadcast(3, HEARTBEAT_PGN, thirdPartner, { 251 }));
+	EXPECT_EQ(3, numberOfNewHeartbeats);
+	EXPECT_EQ(2, numberOfInvalidSequences);
+
+	ASSERT_TRUE(interface.get_heartbeat_statistics(firstPartner, statistics));
+	EXPECT_EQ(2, statistics.numberOfHeartbeatsReceived);
+	EXPECT_EQ(0, statistics.numberOfMissedSequences);
+	EXPECT_EQ(0, statistics.numberOfInvalidSequences);
+	ASSERT_TRUE(interface.get_heartbeat_statistics(secondPartner, statistics));
+	EXPECT_EQ(2, statistics.numberOfMissedSequences);
+	EXPECT_EQ(1, statistics.numberOfInvalidSequences);
+	ASSERT_TRUE(interface.get_heartbeat_statistics(thirdPartner, statistics));
+	EXPECT_EQ(0, statistics.numberOfMissedSequences);
+	EXPECT_EQ(1, statistics.numberOfInvalidSequences);
+
+	// Only the first partner keeps sending, so the others time out
+	std::this_thread::sleep_for(std::chrono::milliseconds(150));
+	interface.process_rx_message(test_helpers::create_message_broadcast(3, HEARTBEAT_PGN, firstPartner, { 1 }));
+	std::this_thread::sleep_for(std::chrono::milliseconds(200));
+	interface.update();
+	EXPECT_EQ(2, numberOfTimeouts);
+	EXPECT_EQ(1, interface.get_number_of_tracked_heartbeats());
+
+	ASSERT_TRUE(interface.get_heartbeat_statistics(firstPartner, statistics));
+	EXPECT_EQ(0, statistics.numberOfTimeouts);
+	EXPECT_GE(statistics.maximumGap_ms, 150);
+	EXPECT_EQ(statistics.lastGap_ms, statistics.maximumGap_ms);
+	ASSERT_TRUE(interface.get_heartbeat_statistics(secondPartner, statistics));
+	EXPECT_EQ(1, statistics.numberOfTimeouts);
+
+	// The count wraps from 250 back to 0
+	interface.process_rx_message(test_helpers::create_message_broadcast(3, HEARTBEAT_PGN, firstPartner, { 250 }));
+	interface.process_rx_message(test_helpers::create_message_broadcast(3, HEARTBEAT_PGN, firstPartner, { 0 }));
+	ASSERT_TRUE(interface.get_heartbeat_statistics(firstPartner, statistics));
+	EXPECT_EQ(248, statistics.numberOfMissedSequences);
+	EXPECT_EQ(1, statistics.numberOfInvalidSequences);
+
+	// A timed out heartbeat is tracked again when it comes back, keeping its statistics
+	interface.process_rx_message(test_helpers::create_message_broadcast(3, HEARTBEAT_PGN, secondPartner, { 10 }));
+	EXPECT_EQ(4, numberOfNewHeartbeats);
+	EXPECT_EQ(2, interface.get_number_of_tracked_heartbeats());
+	ASSERT_TRUE(interface.get_heartbeat_statistics(secondPartner, statistics));
+	EXPECT_EQ(3, statistics.numberOfHeartbeatsReceived);
+	EXPECT_GE(statistics.maximumGap_ms, 350);
+
+	// Another control function taking over an address starts over
+	auto newPartner = test_helpers::create_mock_control_function(0x20);
+	interface.process_rx_message(test_helpers::create_message_broadcast(3, HEARTBEAT_PGN, newPartner, { 251 }));
+	EXPECT_EQ(5, numberOfNewHeartbeats);
+	EXPECT_EQ(2, interface.get_number_of_tracked_heartbeats());
+	EXPECT_FALSE(interface.get_heartbeat_statistics(secondPartner, statistics));
+	ASSERT_TRUE(interface.get_heartbeat_statistics(newPartner, statistics));
+	EXPECT_EQ(1, statistics.numberOfHeartbeatsReceived);
+	EXPECT_EQ(0, statistics.numberOfTimeouts);
+
+	// The disabled interface ignores heartbeats
+	interface.set_enabled(false);
+	interface.process_rx_message(test_helpers::create_message_broadcast(3, HEARTBEAT_PGN, thirdPartner, { 251 }));
+	EXPECT_EQ(5, numberOfNewHeartbeats);
+
+	// The statistics don't keep a control function that left the bus alive
+	std::weak_ptr<ControlFunction> departedPartner = thirdPartner;
+	thirdPartner.reset();
+	EXPECT_TRUE(departedPartner.expired());
+}
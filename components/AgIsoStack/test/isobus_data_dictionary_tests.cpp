@@ -2,6 +2,8 @@
 
 #include "isobus/isobus/isobus_data_dictionary.hpp"
 
+#include <limits>
+
 using namespace isobus;
 
 TEST(DATA_DICTIONARY_TESTS, DDI_Lookups)
@@ -35,3 +37,43 @@ TEST(DATA_DICTIONARY_TESTS, DDI_Lookups)
 	EXPECT_EQ(0.0f, testEntry3.displayRange.first);
 	EXPECT_EQ(0.0f, testEntry3.displayRange.second);
 }
+
+TEST(DATA_DICTIONARY_TESTS, EveryDDIFound)
+{
+	std::size_t numberFound = 0;
+
+	for (std::uint32_t ddi = 0; ddi <= 0xFFFF; ddi++)
+	{
+		const auto &testEntry = DataDictionary::get_entry(static_cast<std::uint16_t>(ddi));
+
+		if ("Unknown" != testEntry.name)
+		{
+			EXPECT_EQ(ddi, testEntry.ddi);
+			numberFound++;
+		}
+	}
+	EXPECT_EQ(724, numberFound);
+	EXPECT_EQ("Reserved", DataDictionary::get_entry(65535).name);
+	EXPECT_EQ("Internal Data Base DDI", DataDictionary::get_entry(0).name);
+}
+
+TEST(DATA_DICTIONARY_TESTS, Formatter)
+{
+	EXPECT_EQ("1000g", DataDictionary::format_value_with_ddi(229, 1000));
+	EXPECT_EQ("-5g", DataDictionary::format_value_with_ddi(229, -5));
+	EXPECT_EQ("On", DataDictionary::format_value_with_ddi(141, 1));
+
+	const std::uint16_t testDDIs[] = { 1, 67, 141, 161, 229, 40962, 57342, 1957 };
+	const std::int32_t testValues[] = { 0, 1, -1, 150, 12345678, std::numeric_limits<std::int32_t>::min(), std::numeric_limits<std::int32_t>::max() };
+
+	for (auto ddi : testDDIs)
+	{
+		DataDictionary::Formatter formatter(ddi);
+		EXPECT_EQ(&DataDictionary::get_entry(ddi), &formatter.get_entry());
+
+		for (auto value : testValues)
+		{
+			EXPECT_EQ(DataDictionary::format_value_with_ddi(ddi, value), formatter.format_value(value));
+		}
+	}
+}
@@ -980,6 +980,21 @@ TEST(NMEA2000_Tests, NMEA2KInterface)
 		EXPECT_TRUE(wasVesselHeadingCallbackHit);
 		EXPECT_EQ(1, interfaceUnderTest.get_number_received_vessel_heading_message_sources());
 		EXPECT_NE(nullptr, interfaceUnderTest.get_received_vessel_heading_message(0));
+
+		// A second source gets its own message instance
+		test_helpers::force_claim_partnered_control_function(0x53, 0);
+		testFrame.identifier = 0x19F11253;
+		CANNetworkManager::CANNetwork.process_receive_can_message_frame(testFrame);
+		CANNetworkManager::CANNetwork.update();
+		ASSERT_EQ(2, interfaceUnderTest.get_number_received_vessel_heading_message_sources());
+		EXPECT_NE(interfaceUnderTest.get_received_vessel_heading_message(0), interfaceUnderTest.get_received_vessel_heading_message(1));
+		EXPECT_EQ(0x53, interfaceUnderTest.get_received_vessel_heading_message(1)->get_control_function()->get_address());
+
+		// Both sources should time out once they stop sending
+		std::this_thread::sleep_for(std::chrono::milliseconds(3 * VesselHeading::get_timeout() + 50));
+		interfaceUnderTest.update();
+		EXPECT_EQ(0, interfaceUnderTest.get_number_received_vessel_heading_message_sources());
+		EXPECT_EQ(nullptr, interfaceUnderTest.get_received_vessel_heading_message(0));
 	}
 
 	CANHardwareInterface::stop();
@@ -0,0 +1,193 @@
+//================================================================================================
+/// @file section_control_engine_tests.cpp
+///
+/// @brief Unit tests for the SectionControlEngine class.
+///
+/// @author The Little Dawn Developers
+///
+/// @copyright 2026 The Little Dawn Developers
+//================================================================================================
+#include <gtest/gtest.h>
+
+#include "isobus/isobus/isobus_device_descriptor_object_pool.hpp"
+#include "isobus/isobus/isobus_device_descriptor_object_pool_helpers.hpp"
+#include "isobus/isobus/isobus_section_control_engine.hpp"
+
+#include <cmath>
+#include <map>
+
+using namespace isobus;
+
+/// @brief Makes a DDOP with one boom (element 1) of evenly spaced sections (elements 2 and up)
+static DeviceDescriptorObjectPoolHelper::Implement make_implement(std::uint16_t numberOfSections, std::int32_t sectionWidth_mm, std::int32_t xOffset_mm)
+{
+	DeviceDescriptorObjectPool ddop(3);
+	const std::int32_t boomWidth_mm = numberOfSections * sectionWidth_mm;
+
+	EXPECT_TRUE(ddop.add_device("Planter", "1.0.0", "123", "PLNTR01", { 'e', 'n', 0x50, 0x00, 0x55, 0x55, 0xFF }, {}, 0));
+	EXPECT_TRUE(ddop.add_device_element("Planter", 0, 0, task_controller_object::DeviceElementObject::Type::Device, 1));
+	EXPECT_TRUE(ddop.add_device_element("Boom", 1, 1, task_controller_object::DeviceElementObject::Type::Function, 2));
+
+	for (std::uint16_t i = 0; i < numberOfSections; i++)
+	{
+		const std::uint16_t sectionID = 100 + (4 * i);
+		EXPECT_TRUE(ddop.add_device_element("Section", 2 + i, 2, task_controller_object::DeviceElementObject::Type::Section, sectionID));
+		EXPECT_TRUE(ddop.add_device_property("Offset X", xOffset_mm, static_cast<std::uint16_t>(DataDescriptionIndex::DeviceElementOffsetX), NULL_OBJECT_ID, sectionID + 1));
+		EXPECT_TRUE(ddop.add_device_property("Offset Y", (sectionWidth_mm * i) + (sectionWidth_mm / 2) - (boomWidth_mm / 2), static_cast<std::uint16_t>(DataDescriptionIndex::DeviceElementOffsetY), NULL_OBJECT_ID, sectionID + 2));
+		EXPECT_TRUE(ddop.add_device_property("Width", sectionWidth_mm, static_cast<std::uint16_t>(DataDescriptionIndex::ActualWorkingWidth), NULL_OBJECT_ID, sectionID + 3));
+
+		auto section = std::static_pointer_cast<task_controller_object::DeviceElementObject>(ddop.get_object_by_id(sectionID));
+		section->add_reference_to_child_object(sectionID + 1);
+		section->add_reference_to_child_object(sectionID + 2);
+		section->add_reference_to_child_object(sectionID + 3);
+	}
+	return DeviceDescriptorObjectPoolHelper::get_implement_geometry(ddop);
+}
+
+/// @brief Drives in a straight line at 2 m/s, updating the engine at 50 Hz
+static void drive(SectionControlEngine &engine, double east_m, double startNorth_m, double endNorth_m)
+{
+	const float heading_deg = (endNorth_m >= startNorth_m) ? 0.0f : 180.0f;
+	const double step_m = (endNorth_m >= startNorth_m) ? 0.04 : -0.04;
+	const std::size_t numberOfSteps = static_cast<std::size_t>(std::abs(endNorth_m - startNorth_m) / 0.04);
+
+	for (std::size_t i = 0; i <= numberOfSteps; i++)
+	{
+		engine.update(east_m, startNorth_m + (step_m * i), heading_deg, 2000);
+	}
+}
+
+TEST(SECTION_CONTROL_ENGINE_TESTS, CoverageAndOverlap)
+{
+	SectionControlEngine engine;
+	std::map<std::uint16_t, std::uint32_t> publishedStates;
+	std::size_t numberOfEvents = 0;
+
+	engine.get_setpoint_event_dispatcher().add_listener([&publishedStates, &numberOfEvents](std::uint16_t elementNumber, std::uint16_t ddi, std::uint32_t value) {
+		EXPECT_EQ(1, elementNumber);
+		publishedStates[ddi] = value;
+		numberOfEvents++;
+	});
+
+	EXPECT_FALSE(engine.set_implement(DeviceDescriptorObjectPoolHelper::Implement()));
+	ASSERT_TRUE(engine.set_implement(make_implement(4, 3000, -1000)));
+	ASSERT_EQ(4, engine.get_number_sections());
+	EXPECT_EQ(2, engine.get_section_element_number(0));
+	EXPECT_EQ(5, engine.get_section_element_number(3));
+	EXPECT_EQ(NULL_OBJECT_ID, engine.get_section_element_number(4));
+
+	// Nothing is covered yet, so every section should turn on
+	engine.update(0.0, 0.0, 0.0f, 2000);
+	for (std::size_t i = 0; i < engine.get_number_sections(); i++)
+	{
+		EXPECT_TRUE(engine.get_section_setpoint_work_state(i));
+	}
+	EXPECT_EQ(1, numberOfEvents);
+	EXPECT_EQ(0xFFFFFF55, publishedStates[290]);
+
+	std::uint32_t condensedState = 0;
+	EXPECT_TRUE(engine.get_setpoint_condensed_work_state(1, 290, condensedState));
+	EXPECT_EQ(0xFFFFFF55, condensedState);
+	EXPECT_FALSE(engine.get_setpoint_condensed_work_state(1, 291, condensedState));
+	EXPECT_FALSE(engine.get_setpoint_condensed_work_state(2, 290, condensedState));
+
+	// A 12 m wide pass. The sections are 1 m behind the DRP, so it covers from -1 m to 19 m.
+	drive(engine, 0.0, 0.0, 20.0);
+	EXPECT_EQ(1, numberOfEvents); // Nothing changed
+	EXPECT_TRUE(engine.is_covered(-4.5, 10.0));
+	EXPECT_TRUE(engine.is_covered(4.5, 10.0));
+	EXPECT_FALSE(engine.is_covered(4.5, 19.5));
+	EXPECT_FALSE(engine.is_covered(7.0, 10.0));
+	EXPECT_NEAR(12.0 * 20.0, engine.get_covered_area(), 12.0);
+
+	// Come back overlapping half of the first pass, so the two sections over the first pass should turn off
+	drive(engine, 6.0, 30.0, 10.0);
+	EXPECT_TRUE(engine.get_section_setpoint_work_state(0));
+	EXPECT_TRUE(engine.get_section_setpoint_work_state(1));
+	EXPECT_FALSE(engine.get_section_setpoint_work_state(2));
+	EXPECT_FALSE(engine.get_section_setpoint_work_state(3));
+	EXPECT_EQ(0, engine.get_section_overlap(1));
+	EXPECT_EQ(100, engine.get_section_overlap(2));
+	EXPECT_EQ(0xFFFFFF05, publishedStates[290]);
+
+	// Stopping turns everything off
+	engine.update(6.0, 10.0, 180.0f, 100);
+	EXPECT_FALSE(engine.get_section_setpoint_work_state(0));
+	EXPECT_EQ(0xFFFFFF00, publishedStates[290]);
+
+	// So does disabling the engine
+	engine.update(6.0, 10.0, 180.0f, 2000);
+	EXPECT_TRUE(engine.get_section_setpoint_work_state(0));
+	engine.set_enabled(false);
+	EXPECT_FALSE(engine.get_enabled());
+	engine.update(6.0, 10.0, 180.0f, 2000);
+	EXPECT_FALSE(engine.get_section_setpoint_work_state(0));
+
+	engine.clear_coverage();
+	EXPECT_FALSE(engine.is_covered(4.5, 10.0));
+	EXPECT_EQ(0.0, engine.get_covered_area());
+}
+
+TEST(SECTION_CONTROL_ENGINE_TESTS, LookAhead)
+{
+	SectionControlEngine engine;
+	ASSERT_TRUE(engine.set_implement(make_implement(4, 3000, -1000)));
+	engine.set_turn_off_latency(1000);
+	EXPECT_EQ(1000, engine.get_turn_off_latency());
+	engine.set_turn_on_latency(500);
+	EXPECT_EQ(500, engine.get_turn_on_latency());
+	engine.set_overlap_tolerance(150);
+	EXPECT_EQ(100, engine.get_overlap_tolerance());
+	engine.set_overlap_tolerance(10);
+
+	drive(engine, 0.0, 0.0, 20.0);
+
+	// Drive back over the first pass. The sections trail the DRP by 1 m and the end of the pass was painted at 19 m,
+	// so with 2 m of look-ahead the sections should be turned off when the DRP reaches about 20 m.
+	double turnOffNorth_m = 0.0;
+	for (double north_m = 30.0; north_m > 10.0; north_m -= 0.04)
+	{
+		engine.update(0.0, north_m, 180.0f, 2000);
+
+		if (!engine.get_section_setpoint_work_state(1))
+		{
+			turnOffNorth_m = north_m;
+			break;
+		}
+	}
+	EXPECT_NEAR(20.0, turnOffNorth_m, 0.3);
+
+	// Sections that are reported off by the implement don't paint coverage
+	engine.clear_coverage();
+	engine.set_actual_condensed_work_state(1, static_cast<std::uint16_t>(DataDescriptionIndex::ActualCondensedWorkState1_16), 0xFFFFFF00);
+	drive(engine, 0.0, 0.0, 20.0);
+	EXPECT_EQ(0.0, engine.get_covered_area());
+	engine.set_section_actual_work_state(0, true);
+	drive(engine, 0.0, 20.0, 30.0);
+	EXPECT_TRUE(engine.is_covered(-4.5, 25.0));
+	EXPECT_FALSE(engine.is_covered(-1.5, 25.0));
+}
+
+TEST(SECTION_CONTROL_ENGINE_TESTS, LargePlanter)
+{
+	SectionControlEngine engine;
+	std::map<std::uint16_t, std::uint32_t> publishedStates;
+
+	engine.get_setpoint_event_dispatcher().add_listener([&publishedStates](std::uint16_t, std::uint16_t ddi, std::uint32_t value) {
+		publishedStates[ddi] = value;
+	});
+
+	ASSERT_TRUE(engine.set_implement(make_implement(96, 500, -2000)));
+	ASSERT_EQ(96, engine.get_number_sections());
+
+	// One minute of driving at 50 Hz
+	drive(engine, 0.0, 0.0, 120.0);
+
+	// Every 16 sections are packed into their own setpoint condensed work state
+	ASSERT_EQ(6, publishedStates.size());
+	for (std::uint16_t ddi = 290; ddi < 296; ddi++)
+	{
+		EXPECT_EQ(0x55555555, publishedStates[ddi]);
+	}
+	EXPECT_NEAR(48.0 * 120.0, engine.get_covered_area(), 48.0 * 120.0 * 0.05);
+}
@@ -1690,6 +1690,343 @@ TEST(TASK_CONTROLLER_CLIENT_TESTS, CallbackTests)
 	CANNetworkManager::CANNetwork.deactivate_control_function(internalECU);
 }
 
+static std::uint32_t elementFiveProviderCalls = 0;
+static std::uint32_t fallbackProviderCalls = 0;
+
+bool element_five_value_provider(std::uint16_t element,
+                                 std::uint16_t,
+                                 std::int32_t &value,
+                                 void *)
+{
+	elementFiveProviderCalls++;
+	value = 5;
+	return (5 == element);
+}
+
+bool fallback_value_provider(std::uint16_t,
+                             std::uint16_t,
+                             std::int32_t &value,
+                             void *)
+{
+	fallbackProviderCalls++;
+	value = 1;
+	return true;
+}
+
+TEST(TASK_CONTROLLER_CLIENT_TESTS, MeasurementScheduling)
+{
+	VirtualCANPlugin serverTC;
+	serverTC.open();
+
+	CANHardwareInterface::set_number_of_can_channels(1);
+	CANHardwareInterface::assign_can_channel_frame_handler(0, std::make_shared<VirtualCANPlugin>());
+	CANHardwareInterface::start();
+
+	auto internalECU = test_helpers::claim_internal_control_function(0x88, 0);
+	auto TestPartnerTC = test_helpers::force_claim_partnered_control_function(0xF6, 0);
+
+	DerivedTestTCClient interfaceUnderTest(TestPartnerTC, internalECU);
+	interfaceUnderTest.initialize(false);
+
+	auto blankDDOP = std::make_shared<DeviceDescriptorObjectPool>();
+	interfaceUnderTest.configure(blankDDOP, 1, 32, 32, true, false, true, false, true);
+	interfaceUnderTest.add_request_value_callback(element_five_value_provider, nullptr);
+	interfaceUnderTest.add_request_value_callback(fallback_value_provider, nullptr);
+	interfaceUnderTest.test_wrapper_set_state(TaskControllerClient::StateMachineState::Connected);
+
+	// Status message
+	CANMessageFrame testFrame = {};
+	testFrame.identifier = 0x18CBFFF6;
+	testFrame.dataLength = 8;
+	testFrame.data[0] = 0xFE;
+	testFrame.data[1] = 0xFF;
+	testFrame.data[2] = 0xFF;
+	testFrame.data[3] = 0xFF;
+	testFrame.data[4] = 0x01;
+	testFrame.data[5] = 0x00;
+	testFrame.data[6] = 0x00;
+	testFrame.data[7] = 0xFF;
+	CANNetworkManager::CANNetwork.process_receive_can_message_frame(testFrame);
+
+	// Element 5 DDI 0x10 every 5ms, and element 6 DDI 0x10 every minute
+	testFrame.identifier = 0x18CB88F6;
+	testFrame.data[0] = 0x54;
+	testFrame.data[1] = 0x00;
+	testFrame.data[2] = 0x10;
+	testFrame.data[3] = 0x00;
+	testFrame.data[4] = 0x05;
+	testFrame.data[5] = 0x00;
+	testFrame.data[6] = 0x00;
+	testFrame.data[7] = 0x00;
+	CANNetworkManager::CANNetwork.process_receive_can_message_frame(testFrame);
+	testFrame.data[0] = 0x64;
+	testFrame.data[4] = 0x60;
+	testFrame.data[5] = 0xEA;
+	CANNetworkManager::CANNetwork.process_receive_can_message_frame(testFrame);
+	CANNetworkManager::CANNetwork.update();
+
+	for (std::uint_fast8_t i = 0; i < 30; i++)
+	{
+		interfaceUnderTest.update();
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	// Only element 5 was due, and it was bound to the first provider, so the fallback was never needed
+	EXPECT_GE(elementFiveProviderCalls, 2u);
+	EXPECT_EQ(0u, fallbackProviderCalls);
+
+	// Slow element 5 down so that it isn't due during the rest of the test
+	testFrame.data[0] = 0x54;
+	CANNetworkManager::CANNetwork.process_receive_can_message_frame(testFrame);
+	CANNetworkManager::CANNetwork.update();
+	interfaceUnderTest.update();
+	elementFiveProviderCalls = 0;
+
+	// The first request for element 6 searches the providers, after that it goes straight to the fallback one
+	interfaceUnderTest.on_value_changed_trigger(6, 0x10);
+	interfaceUnderTest.update();
+	EXPECT_EQ(1u, elementFiveProviderCalls);
+	EXPECT_EQ(1u, fallbackProviderCalls);
+
+	interfaceUnderTest.on_value_changed_trigger(6, 0x10);
+	interfaceUnderTest.update();
+	EXPECT_EQ(1u, elementFiveProviderCalls);
+	EXPECT_EQ(2u, fallbackProviderCalls);
+
+	// Removing a provider also removes its bindings
+	interfaceUnderTest.remove_request_value_callback(fallback_value_provider, nullptr);
+	interfaceUnderTest.on_value_changed_trigger(6, 0x10);
+	interfaceUnderTest.update();
+	EXPECT_EQ(2u, elementFiveProviderCalls);
+	EXPECT_EQ(2u, fallbackProviderCalls);
+
+	// A zero interval is sent once per update, rather than keeping the update busy forever
+	testFrame.data[0] = 0x54;
+	testFrame.data[4] = 0x00;
+	testFrame.data[5] = 0x00;
+	CANNetworkManager::CANNetwork.process_receive_can_message_frame(testFrame);
+	CANNetworkManager::CANNetwork.update();
+	elementFiveProviderCalls = 0;
+	interfaceUnderTest.update();
+	EXPECT_EQ(1u, elementFiveProviderCalls);
+	interfaceUnderTest.update();
+	EXPECT_EQ(2u, elementFiveProviderCalls);
+
+	CANHardwareInterface::stop();
+
+	CANNetworkManager::CANNetwork.deactivate_control_function(TestPartnerTC);
+	CANNetworkManager::CANNetwork.deactivate_control_function(internalECU);
+}
+
+TEST(TASK_CONTROLLER_CLIENT_TESTS, PushedProcessDataValues)
+{
+	VirtualCANPlugin serverTC;
+	serverTC.open();
+
+	CANHardwareInterface::set_number_of_can_channels(1);
+	CANHardwareInterface::assign_can_channel_frame_handler(0, std::make_shared<VirtualCANPlugin>());
+	CANHardwareInterface::start();
+
+	auto internalECU = test_helpers::claim_internal_control_function(0x89, 0);
+	auto TestPartnerTC = test_helpers::force_claim_partnered_control_function(0xF5, 0);
+
+	DerivedTestTCClient interfaceUnderTest(TestPartnerTC, internalECU);
+	interfaceUnderTest.initialize(false);
+
+	auto blankDDOP = std::make_shared<DeviceDescriptorObjectPool>();
+	interfaceUnderTest.configure(blankDDOP, 1, 32, 32, true, false, true, false, true);
+	interfaceUnderTest.test_wrapper_set_state(TaskControllerClient::StateMachineState::Connected);
+
+	// Status message
+	CANMessageFrame testFrame = {};
+	testFrame.identifier = 0x18CBFFF5;
+	testFrame.dataLength = 8;
+	testFrame.data[0] = 0xFE;
+	testFrame.data[1] = 0xFF;
+	testFrame.data[2] = 0xFF;
+	testFrame.data[3] = 0xFF;
+	testFrame.data[4] = 0x01;
+	testFrame.data[5] = 0x00;
+	testFrame.data[6] = 0x00;
+	testFrame.data[7] = 0xFF;
+	CANNetworkManager::CANNetwork.process_receive_can_message_frame(testFrame);
+
+	// Element 7 DDI 0x20 when above 100
+	testFrame.identifier = 0x18CB89F5;
+	testFrame.data[0] = 0x77;
+	testFrame.data[1] = 0x00;
+	testFrame.data[2] = 0x20;
+	testFrame.data[3] = 0x00;
+	testFrame.data[4] = 100;
+	testFrame.data[5] = 0x00;
+	testFrame.data[6] = 0x00;
+	testFrame.data[7] = 0x00;
+	CANNetworkManager::CANNetwork.process_receive_can_message_frame(testFrame);
+	CANNetworkManager::CANNetwork.update();
+	interfaceUnderTest.update();
+
+	// Returns the last value the client sent for element 7 DDI 0x20, or -1 if none was sent
+	auto get_last_sent_value = [&serverTC]() {
+		std::int32_t retVal = -1;
+		CANMessageFrame frame = {};
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		while (!serverTC.get_queue_empty())
+		{
+			serverTC.read_frame(frame);
+
+			if ((0x18CBF589 == frame.identifier) && (0x73 == frame.data[0]) && (0x00 == frame.data[1]) && (0x20 == frame.data[2]))
+			{
+				retVal = static_cast<std::int32_t>(frame.data[4]) | (static_cast<std::int32_t>(frame.data[5]) << 8);
+			}
+		}
+		return retVal;
+	};
+	get_last_sent_value();
+
+	EXPECT_TRUE(interfaceUnderTest.set_process_data_value(7, 0x20, 50));
+	interfaceUnderTest.update();
+	EXPECT_EQ(-1, get_last_sent_value());
+
+	// Crossing the threshold sends the value once
+	EXPECT_TRUE(interfaceUnderTest.set_process_data_value(7, 0x20, 150));
+	interfaceUnderTest.update();
+	EXPECT_EQ(150, get_last_sent_value());
+
+	EXPECT_TRUE(interfaceUnderTest.set_process_data_value(7, 0x20, 160));
+	interfaceUnderTest.update();
+	EXPECT_EQ(-1, get_last_sent_value());
+
+	// Requests for the value use the pushed value, without needing any callbacks
+	interfaceUnderTest.on_value_changed_trigger(7, 0x20);
+	interfaceUnderTest.update();
+	EXPECT_EQ(160, get_last_sent_value());
+
+	// The producer can't get ahead of the client by more than the queue size, which holds 128 values
+	std::uint32_t acceptedValues = 0;
+	for (std::uint16_t i = 0; i < 1000; i++)
+	{
+		if (interfaceUnderTest.set_process_data_value(8, 0x20, i))
+		{
+			acceptedValues++;
+		}
+	}
+	EXPECT_EQ(128u, acceptedValues);
+	EXPECT_FALSE(interfaceUnderTest.set_process_data_value(8, 0x20, 0));
+	interfaceUnderTest.update();
+	EXPECT_TRUE(interfaceUnderTest.set_process_data_value(8, 0x20, 0));
+
+	CANHardwareInterface::stop();
+
+	CANNetworkManager::CANNetwork.deactivate_control_function(TestPartnerTC);
+	CANNetworkManager::CANNetwork.deactivate_control_function(internalECU);
+}
+
+TEST(TASK_CONTROLLER_CLIENT_TESTS, MeasurementTransmitScheduling)
+{
+	VirtualCANPlugin serverTC;
+	serverTC.open();
+
+	CANHardwareInterface::set_number_of_can_channels(1);
+	CANHardwareInterface::assign_can_channel_frame_handler(0, std::make_shared<VirtualCANPlugin>());
+	CANHardwareInterface::start();
+
+	auto internalECU = test_helpers::claim_internal_control_function(0x8A, 0);
+	auto TestPartnerTC = test_helpers::force_claim_partnered_control_function(0xF4, 0);
+
+	DerivedTestTCClient interfaceUnderTest(TestPartnerTC, internalECU);
+	interfaceUnderTest.initialize(false);
+
+	auto blankDDOP = std::make_shared<DeviceDescriptorObjectPool>();
+	interfaceUnderTest.configure(blankDDOP, 1, 32, 32, true, false, true, false, true);
+	interfaceUnderTest.test_wrapper_set_state(TaskControllerClient::StateMachineState::Connected);
+
+	EXPECT_EQ(500, interfaceUnderTest.get_measurement_transmit_rate_limit());
+	interfaceUnderTest.set_measurement_transmit_rate_limit(100);
+	EXPECT_EQ(100, interfaceUnderTest.get_measurement_transmit_rate_limit());
+
+	// Status message
+	CANMessageFrame testFrame = {};
+	testFrame.identifier = 0x18CBFFF4;
+	testFrame.dataLength = 8;
+	testFrame.data[0] = 0xFE;
+	testFrame.data[1] = 0xFF;
+	testFrame.data[2] = 0xFF;
+	testFrame.data[3] = 0xFF;
+	testFrame.data[4] = 0x01;
+	testFrame.data[5] = 0x00;
+	testFrame.data[6] = 0x00;
+	testFrame.data[7] = 0xFF;
+	CANNetworkManager::CANNetwork.process_receive_can_message_frame(testFrame);
+
+	// Elements 1 to 20 DDI 0x10 every 10ms, then element 0 actual condensed work state 1-16 every 10ms
+	testFrame.identifier = 0x18CB8AF4;
+	testFrame.data[2] = 0x10;
+	testFrame.data[3] = 0x00;
+	testFrame.data[4] = 0x0A;
+	testFrame.data[5] = 0x00;
+	testFrame.data[6] = 0x00;
+	testFrame.data[7] = 0x00;
+	for (std::uint16_t i = 1; i <= 20; i++)
+	{
+		testFrame.data[0] = static_cast<std::uint8_t>(0x04 | ((i & 0x0F) << 4));
+		testFrame.data[1] = static_cast<std::uint8_t>(i >> 4);
+		CANNetworkManager::CANNetwork.process_receive_can_message_frame(testFrame);
+		EXPECT_TRUE(interfaceUnderTest.set_process_data_value(i, 0x10, i));
+	}
+	testFrame.data[0] = 0x04;
+	testFrame.data[1] = 0x00;
+	testFrame.data[2] = 0xA1;
+	CANNetworkManager::CANNetwork.process_receive_can_message_frame(testFrame);
+	EXPECT_TRUE(interfaceUnderTest.set_process_data_value(0, 0xA1, 1));
+	CANNetworkManager::CANNetwork.update();
+
+	CANMessageFrame frame = {};
+	while (!serverTC.get_queue_empty())
+	{
+		serverTC.read_frame(frame);
+	}
+
+	// Let everything come due at once
+	std::this_thread::sleep_for(std::chrono::milliseconds(15));
+	const std::uint32_t firstUpdateTimestamp_ms = SystemTiming::get_timestamp_ms();
+	interfaceUnderTest.update();
+	CANNetworkManager::CANNetwork.update();
+	std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+	// The section control DDI goes first, even though it was requested last
+	std::uint32_t measurementsSent = 0;
+	ASSERT_FALSE(serverTC.get_queue_empty());
+	serverTC.read_frame(frame);
+	EXPECT_EQ(0x18CBF48A, frame.identifier);
+	EXPECT_EQ(0x03, frame.data[0]);
+	EXPECT_EQ(0xA1, frame.data[2]);
+	measurementsSent++;
+
+	// Unlimited, this would be 21 messages every 10ms. Limited to 100 per second, it's the initial burst of 10 plus about one per millisecond.
+	for (std::uint_fast8_t i = 0; i < 50; i++)
+	{
+		interfaceUnderTest.update();
+		CANNetworkManager::CANNetwork.update();
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	while (!serverTC.get_queue_empty())
+	{
+		serverTC.read_frame(frame);
+		if ((0x18CBF48A == frame.identifier) && (0x03 == (frame.data[0] & 0x0F)))
+		{
+			measurementsSent++;
+		}
+	}
+	EXPECT_GE(measurementsSent, 10u);
+	EXPECT_LE(measurementsSent, 11u + (100u * SystemTiming::get_time_elapsed_ms(firstUpdateTimestamp_ms)) / 1000u);
+
+	CANHardwareInterface::stop();
+
+	CANNetworkManager::CANNetwork.deactivate_control_function(TestPartnerTC);
+	CANNetworkManager::CANNetwork.deactivate_control_function(internalECU);
+}
+
 TEST(TASK_CONTROLLER_CLIENT_TESTS, LanguageCommandFallback)
 {
 	VirtualCANPlugin serverTC;
@@ -1762,3 +2099,220 @@ TEST(TASK_CONTROLLER_CLIENT_TESTS, LanguageCommandFallback)
 	CANHardwareInterface::stop();
 	CANNetworkManager::CANNetwork.update();
 }
+
+static constexpr std::uint8_t STATIC_DDOP_LOCALIZATION_LABEL[] = { 'e', 'n', 0x50, 0x00, 0x55, 0x55, 0xFF };
+static constexpr std::uint16_t STATIC_DDOP_ELEMENT_CHILDREN[] = { 2 };
+static constexpr auto STATIC_BINARY_DDOP = static_ddop::make_pool(
+  static_ddop::device("Static", "1.0.0", "42", "STA1.0", STATIC_DDOP_LOCALIZATION_LABEL, 0),
+  static_ddop::device_element("Static", 0, 0, task_controller_object::DeviceElementObject::Type::Device, 1, STATIC_DDOP_ELEMENT_CHILDREN),
+  static_ddop::device_process_data("Actual Work State", 141, NULL_OBJECT_ID, 1, 8, 2));
+static constexpr auto STATIC_PROCESS_DATA = static_ddop::make_process_data_table<static_ddop::count_process_data(STATIC_BINARY_DDOP)>(STATIC_BINARY_DDOP);
+
+TEST(TASK_CONTROLLER_CLIENT_TESTS, StaticDDOPConfiguration)
+{
+	DerivedTestTCClient interfaceUnderTest(nullptr, nullptr);
+	StaticDeviceDescriptorObjectPool staticDDOP(STATIC_BINARY_DDOP, STATIC_PROCESS_DATA);
+
+	interfaceUnderTest.configure(staticDDOP, 1, 16, 0, true, false, false, false, true);
+	EXPECT_EQ(1, interfaceUnderTest.get_number_booms_supported());
+	EXPECT_EQ(16, interfaceUnderTest.get_number_sections_supported());
+	EXPECT_EQ(true, interfaceUnderTest.get_supports_documentation());
+	EXPECT_EQ(true, interfaceUnderTest.get_supports_implement_section_control());
+
+	// The upload should be served straight out of the compile time pool, after the mux byte
+	std::array<std::uint8_t, 16> chunk;
+	EXPECT_TRUE(interfaceUnderTest.test_wrapper_process_internal_object_pool_upload_callback(0, 0, static_cast<std::uint32_t>(chunk.size()), chunk.data(), &interfaceUnderTest));
+	EXPECT_EQ(0x61, chunk[0]);
+	for (std::size_t i = 1; i < chunk.size(); i++)
+	{
+		EXPECT_EQ(STATIC_BINARY_DDOP[i - 1], chunk[i]);
+	}
+	EXPECT_TRUE(interfaceUnderTest.test_wrapper_process_internal_object_pool_upload_callback(0, STATIC_BINARY_DDOP.size() - 3, 4, chunk.data(), &interfaceUnderTest));
+	EXPECT_EQ(STATIC_BINARY_DDOP[STATIC_BINARY_DDOP.size() - 1], chunk[3]);
+	EXPECT_FALSE(interfaceUnderTest.test_wrapper_process_internal_object_pool_upload_callback(0, STATIC_BINARY_DDOP.size(), 4, chunk.data(), &interfaceUnderTest));
+}
+
+static std::uint32_t numberOfStreamedDDOPReads = 0;
+
+static bool read_streamed_ddop(std::uint32_t, std::uint32_t bytesOffset, std::uint32_t numberOfBytesNeeded, std::uint8_t *chunkBuffer, void *parentPointer)
+{
+	EXPECT_NE(nullptr, parentPointer);
+	numberOfStreamedDDOPReads++;
+	memcpy(chunkBuffer, &DerivedTestTCClient::testBinaryDDOP[bytesOffset], numberOfBytesNeeded);
+	return true;
+}
+
+TEST(TASK_CONTROLLER_CLIENT_TESTS, StreamedDDOPConfiguration)
+{
+	DerivedTestTCClient interfaceUnderTest(nullptr, nullptr);
+	const std::uint32_t ddopSize = sizeof(DerivedTestTCClient::testBinaryDDOP);
+
+	interfaceUnderTest.configure_streamed_ddop(read_streamed_ddop, ddopSize, 1, 16, 0, true, false, false, false, true);
+	EXPECT_EQ(1, interfaceUnderTest.get_number_booms_supported());
+	EXPECT_EQ(16, interfaceUnderTest.get_number_sections_supported());
+
+	// The upload should be read through the callback, after the mux byte
+	std::array<std::uint8_t, 16> chunk;
+	EXPECT_TRUE(interfaceUnderTest.test_wrapper_process_internal_object_pool_upload_callback(0, 0, static_cast<std::uint32_t>(chunk.size()), chunk.data(), &interfaceUnderTest));
+	EXPECT_EQ(0x61, chunk[0]);
+	for (std::size_t i = 1; i < chunk.size(); i++)
+	{
+		EXPECT_EQ(DerivedTestTCClient::testBinaryDDOP[i - 1], chunk[i]);
+	}
+	EXPECT_TRUE(interfaceUnderTest.test_wrapper_process_internal_object_pool_upload_callback(1, ddopSize - 3, 4, chunk.data(), &interfaceUnderTest));
+	EXPECT_EQ(DerivedTestTCClient::testBinaryDDOP[ddopSize - 1], chunk[3]);
+	EXPECT_FALSE(interfaceUnderTest.test_wrapper_process_internal_object_pool_upload_callback(2, ddopSize, 4, chunk.data(), &interfaceUnderTest));
+	EXPECT_EQ(2, numberOfStreamedDDOPReads);
+
+	// The labels are located with a few reads of the start of the pool
+	numberOfStreamedDDOPReads = 0;
+	interfaceUnderTest.test_wrapper_set_state(TaskControllerClient::StateMachineState::ProcessDDOP);
+	interfaceUnderTest.update();
+	EXPECT_EQ(interfaceUnderTest.test_wrapper_get_state(), TaskControllerClient::StateMachineState::RequestStructureLabel);
+	EXPECT_NE(0, numberOfStreamedDDOPReads);
+	EXPECT_GT(5, numberOfStreamedDDOPReads);
+
+	// Then they are cached, so reconnecting doesn't read the pool again
+	numberOfStreamedDDOPReads = 0;
+	interfaceUnderTest.test_wrapper_set_state(TaskControllerClient::StateMachineState::ProcessDDOP);
+	interfaceUnderTest.update();
+	EXPECT_EQ(interfaceUnderTest.test_wrapper_get_state(), TaskControllerClient::StateMachineState::RequestStructureLabel);
+	EXPECT_EQ(0, numberOfStreamedDDOPReads);
+}
+
+static std::uint32_t handledValueCommands = 0;
+static std::uint32_t fallbackValueCommands = 0;
+static std::int32_t handledValue = 0;
+
+bool value_command_handler(std::uint16_t, std::uint16_t, std::int32_t value, void *parentPointer)
+{
+	EXPECT_EQ(&handledValue, parentPointer);
+	handledValueCommands++;
+	handledValue = value;
+	return true;
+}
+
+bool fallback_value_command_callback(std::uint16_t, std::uint16_t, std::int32_t, void *)
+{
+	fallbackValueCommands++;
+	return true;
+}
+
+TEST(TASK_CONTROLLER_CLIENT_TESTS, ValueCommandHandlers)
+{
+	VirtualCANPlugin serverTC;
+	serverTC.open();
+
+	CANHardwareInterface::set_number_of_can_channels(1);
+	CANHardwareInterface::assign_can_channel_frame_handler(0, std::make_shared<VirtualCANPlugin>());
+	CANHardwareInterface::start();
+
+	auto internalECU = test_helpers::claim_internal_control_function(0x8B, 0);
+	auto TestPartnerTC = test_helpers::force_claim_partnered_control_function(0xF3, 0);
+
+	DerivedTestTCClient interfaceUnderTest(TestPartnerTC, internalECU);
+	interfaceUnderTest.initialize(false);
+
+	auto blankDDOP = std::make_shared<DeviceDescriptorObjectPool>();
+	interfaceUnderTest.configure(blankDDOP, 1, 32, 32, true, false, true, false, true);
+	interfaceUnderTest.add_value_command_callback(fallback_value_command_callback, nullptr);
+	interfaceUnderTest.add_value_command_handler(5, 0x86, value_command_handler, &handledValue, true);
+	interfaceUnderTest.add_value_command_handler(6, 0x87, value_command_handler, &handledValue, false);
+	interfaceUnderTest.test_wrapper_set_state(TaskControllerClient::StateMachineState::Connected);
+
+	CANMessageFrame frame = {};
+	std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	while (!serverTC.get_queue_empty())
+	{
+		serverTC.read_frame(frame);
+	}
+
+	// Status message
+	CANMessageFrame testFrame = {};
+	testFrame.identifier = 0x18CBFFF3;
+	testFrame.isExtendedFrame = true;
+	testFrame.dataLength = 8;
+	testFrame.data[0] = 0xFE; // Status mux
+	testFrame.data[1] = 0xFF; // Element number, set to not available
+	testFrame.data[2] = 0xFF; // DDI (N/A)
+	testFrame.data[3] = 0xFF; // DDI (N/A)
+	testFrame.data[4] = 0x01; // Status (task active)
+	testFrame.data[5] = 0x00; // Command address
+	testFrame.data[6] = 0x00; // Command
+	testFrame.data[7] = 0xFF; // Reserved
+	CANNetworkManager::CANNetwork.process_receive_can_message_frame(testFrame);
+
+	// Set value and acknowledge for an immediate handler, which is handled without an update
+	testFrame.identifier = 0x18CB8BF3;
+	testFrame.data[0] = 0x5A;
+	testFrame.data[1] = 0x00;
+	testFrame.data[2] = 0x86;
+	testFrame.data[3] = 0x00;
+	testFrame.data[4] = 0x10;
+	testFrame.data[5] = 0x27;
+	testFrame.data[6] = 0x00;
+	testFrame.data[7] = 0x00;
+	CANNetworkManager::CANNetwork.process_receive_can_message_frame(testFrame);
+	CANNetworkManager::CANNetwork.update();
+	EXPECT_EQ(1, handledValueCommands);
+	EXPECT_EQ(10000, handledValue);
+	EXPECT_EQ(0, fallbackValueCommands);
+
+	// The PDACK should have been sent right away as well
+	std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	bool pdackSent = false;
+	while (!serverTC.get_queue_empty())
+	{
+		serverTC.read_frame(frame);
+		if ((0x18CBF38B == frame.identifier) && (0x5D == frame.data[0]) && (0x86 == frame.data[2]))
+		{
+			pdackSent = true;
+		}
+	}
+	EXPECT_TRUE(pdackSent);
+
+	// A deferred handler gets its command on the next update, and is the only callback called
+	testFrame.data[0] = 0x63;
+	testFrame.data[2] = 0x87;
+	testFrame.data[4] = 0x20;
+	testFrame.data[5] = 0x4E;
+	CANNetworkManager::CANNetwork.process_receive_can_message_frame(testFrame);
+	CANNetworkManager::CANNetwork.update();
+	EXPECT_EQ(1, handledValueCommands);
+	interfaceUnderTest.update();
+	EXPECT_EQ(2, handledValueCommands);
+	EXPECT_EQ(20000, handledValue);
+	EXPECT_EQ(0, fallbackValueCommands);
+
+	// Everything else goes to the general callbacks, including commands for removed handlers
+	testFrame.data[0] = 0x73;
+	CANNetworkManager::CANNetwork.process_receive_can_message_frame(testFrame);
+	interfaceUnderTest.remove_value_command_handler(5, 0x86);
+	testFrame.data[0] = 0x53;
+	testFrame.data[2] = 0x86;
+	CANNetworkManager::CANNetwork.process_receive_can_message_frame(testFrame);
+	CANNetworkManager::CANNetwork.update();
+	interfaceUnderTest.update();
+	EXPECT_EQ(2, handledValueCommands);
+	EXPECT_EQ(2, fallbackValueCommands);
+
+	// Deferred commands beyond the 64 the queue holds are dropped until the next update
+	testFrame.data[0] = 0x63;
+	testFrame.data[2] = 0x87;
+	for (std::uint8_t i = 0; i < 70; i++)
+	{
+		CANNetworkManager::CANNetwork.process_receive_can_message_frame(testFrame);
+	}
+	CANNetworkManager::CANNetwork.update();
+	interfaceUnderTest.update();
+	EXPECT_EQ(66, handledValueCommands);
+	CANNetworkManager::CANNetwork.process_receive_can_message_frame(testFrame);
+	CANNetworkManager::CANNetwork.update();
+	interfaceUnderTest.update();
+	EXPECT_EQ(67, handledValueCommands);
+
+	CANHardwareInterface::stop();
+
+	CANNetworkManager::CANNetwork.deactivate_control_function(TestPartnerTC);
+	CANNetworkManager::CANNetwork.deactivate_control_function(internalECU);
+}
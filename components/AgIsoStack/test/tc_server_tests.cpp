@@ -957,6 +957,60 @@ TEST(TASK_CONTROLLER_SERVER_TESTS, MessageEncoding)
 		EXPECT_EQ(0x00, testFrame.data[6]); // Pool error codes (0 = none)
 		EXPECT_EQ(0xFF, testFrame.data[7]); // reserved
 
+		// Activation should have built a route for every process data object in the transferred pool
+		TaskControllerServer::ProcessDataRoute route;
+		EXPECT_EQ(14, server.get_number_process_data_routes(partnerClient));
+		EXPECT_FALSE(server.get_process_data_route(partnerClient, 4, 7, route));
+		ASSERT_TRUE(server.get_process_data_route(partnerClient, 0, 141, route));
+		EXPECT_EQ("Actual Work State", route.designator);
+		EXPECT_EQ(2, route.processDataObjectID);
+		EXPECT_NE(NULL_OBJECT_ID, route.elementObjectID);
+		EXPECT_EQ(1.0f, route.scale);
+		EXPECT_EQ("", route.unit); // Actual work state has no unit in the data dictionary
+		ASSERT_TRUE(server.get_process_data_route(partnerClient, 1, 134, route));
+		EXPECT_EQ("Connector X", route.designator);
+		EXPECT_EQ("mm", route.unit); // From the device value presentation
+		EXPECT_EQ(0, route.offset);
+		EXPECT_EQ(0, route.numberOfDecimals);
+
+		// Routed value commands should go to the DDI's handler instead of on_value_command
+		std::int32_t handledValue = 0;
+		std::uint16_t handledElement = 0xFFFF;
+		server.add_process_data_handler(141, [&handledValue, &handledElement](std::shared_ptr<ControlFunction>, const TaskControllerServer::ProcessDataRoute &handledRoute, std::int32_t value, std::uint8_t &) {
+			handledValue = value;
+			handledElement = handledRoute.elementNumber;
+			return true;
+		});
+		CANNetworkManager::CANNetwork.process_receive_can_message_frame(test_helpers::create_message_frame(5,
+		                                                                                                   0xCB00,
+		                                                                                                   internalECU,
+		                                                                                                   partnerClient,
+		                                                                                                   { 0x0A, // Element 0 set and ack
+		                                                                                                     0x00,
+		                                                                                                     0x8D, // DDI LSB
+		                                                                                                     0x00,
+		                                                                                                     0x01, // Value LSB
+		                                                                                                     0x00,
+		                                                                                                     0x00,
+		                                                                                                     0x00 }));
+		CANNetworkManager::CANNetwork.update();
+		server.update();
+		EXPECT_TRUE(readFrameFilterStatus(testPlugin, testFrame));
+		EXPECT_EQ(0x0D, testFrame.data[0]); // PDACK, element 0
+		EXPECT_EQ(0x00, testFrame.data[4]); // Error codes
+		EXPECT_EQ(1, handledValue);
+		EXPECT_EQ(0, handledElement);
+
+		TaskControllerServer::ClientStatistics statistics;
+		ASSERT_TRUE(server.get_client_statistics(partnerClient, statistics));
+		EXPECT_NE(0, statistics.processDataMessagesReceived);
+		EXPECT_EQ(1, statistics.valueCommandsReceived);
+		EXPECT_EQ(1, statistics.routedValueCommands);
+
+		server.remove_process_data_handler(141);
+		EXPECT_TRUE(server.get_process_data_route(partnerClient, 0, 141, route));
+		EXPECT_EQ(nullptr, route.handler);
+
 		// test failing to activate returns reported faulty objects
 		server.failActivations = true;
 		CANNetworkManager::CANNetwork.process_receive_can_message_frame(test_helpers::create_message_frame(5,
@@ -1035,6 +1089,7 @@ TEST(TASK_CONTROLLER_SERVER_TESTS, MessageEncoding)
 		EXPECT_EQ(0xFF, testFrame.data[5]); // reserved
 		EXPECT_EQ(0xFF, testFrame.data[6]); // reserved
 		EXPECT_EQ(0xFF, testFrame.data[7]); // reserved
+		EXPECT_EQ(0, server.get_number_process_data_routes(partnerClient)); // Routes go away with the pool
 	}
 
 	// test change designator
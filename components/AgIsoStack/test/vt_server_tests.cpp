@@ -0,0 +1,354 @@
+//================================================================================================
+/// @file vt_server_tests.cpp
+///
+/// @brief Unit tests for the VT server's managed working set
+/// @author The Little Dawn Developers
+///
+/// @copyright 2026 The Little Dawn Developers
+//================================================================================================
+#include <gtest/gtest.h>
+
+#include "isobus/isobus/isobus_virtual_terminal_server.hpp"
+#include "isobus/isobus/isobus_virtual_terminal_server_managed_working_set.hpp"
+
+#include "helpers/control_function_helpers.hpp"
+
+#include <algorithm>
+
+using namespace isobus;
+
+class TestManagedWorkingSet : public VirtualTerminalServerManagedWorkingSet
+{
+public:
+	using VirtualTerminalServerManagedWorkingSet::VirtualTerminalServerManagedWorkingSet;
+	using VirtualTerminalWorkingSetBase::add_or_replace_object;
+};
+
+class TestVirtualTerminalServer : public VirtualTerminalServer
+{
+public:
+	using VirtualTerminalServer::VirtualTerminalServer;
+	using VirtualTerminalServer::compile_macros;
+	using VirtualTerminalServer::execute_macro;
+
+	bool get_is_enough_memory(std::uint32_t) const override
+	{
+		return true;
+	}
+
+	VTVersion get_version() const override
+	{
+		return VTVersion::Version5;
+	}
+
+	std::uint8_t get_number_of_navigation_soft_keys() const override
+	{
+		return 0;
+	}
+
+	std::uint8_t get_soft_key_descriptor_x_pixel_width() const override
+	{
+		return 60;
+	}
+
+	std::uint8_t get_soft_key_descriptor_y_pixel_height() const override
+	{
+		return 60;
+	}
+
+	std::uint8_t get_number_of_possible_virtual_soft_keys_in_soft_key_mask() const override
+	{
+		return 64;
+	}
+
+	std::uint8_t get_number_of_physical_soft_keys() const override
+	{
+		return 6;
+	}
+
+	std::uint16_t get_data_mask_area_size_x_pixels() const override
+	{
+		return 480;
+	}
+
+	std::uint16_t get_data_mask_area_size_y_pixels() const override
+	{
+		return 480;
+	}
+
+	void suspend_working_set(std::shared_ptr<VirtualTerminalServerManagedWorkingSet>) override
+	{
+	}
+
+	SupportedWideCharsErrorCode get_supported_wide_chars(std::uint8_t, std::uint16_t, std::uint16_t, std::uint8_t &, std::vector<std::uint8_t> &) override
+	{
+		return SupportedWideCharsErrorCode::AnyOtherError;
+	}
+
+	std::vector<std::array<std::uint8_t, 7>> get_versions(NAME) override
+	{
+		return {};
+	}
+
+	std::vector<std::uint8_t> get_supported_objects() const override
+	{
+		return {};
+	}
+
+	std::vector<std::uint8_t> load_version(const std::vector<std::uint8_t> &, NAME) override
+	{
+		return {};
+	}
+
+	bool save_version(const std::vector<std::uint8_t> &, const std::vector<std::uint8_t> &, NAME) override
+	{
+		return false;
+	}
+
+	bool delete_version(const std::vector<std::uint8_t> &, NAME) override
+	{
+		return false;
+	}
+
+	bool delete_all_versions(NAME) override
+	{
+		return false;
+	}
+
+	bool delete_object_pool(NAME) override
+	{
+		return false;
+	}
+};
+
+// Builds a data mask 1000 with:
+// - container 2000 at (10, 20), which has output number 3000 at (5, 5) using number variable 4000 and font 5000
+// - output number 3001 at (100, 100) using font 5000
+static void build_test_mask(TestManagedWorkingSet &workingSet)
+{
+	auto dataMask = std::make_shared<DataMask>();
+	dataMask->set_id(1000);
+	dataMask->add_child(2000, 10, 20);
+	dataMask->add_child(3001, 100, 100);
+	workingSet.add_or_replace_object(dataMask);
+
+	auto container = std::make_shared<Container>();
+	container->set_id(2000);
+	container->set_width(50);
+	container->set_height(50);
+	container->add_child(3000, 5, 5);
+	workingSet.add_or_replace_object(container);
+
+	auto number = std::make_shared<OutputNumber>();
+	number->set_id(3000);
+	number->set_width(40);
+	number->set_height(10);
+	number->set_variable_reference(4000);
+	number->set_font_attributes(5000);
+	workingSet.add_or_replace_object(number);
+
+	auto otherNumber = std::make_shared<OutputNumber>();
+	otherNumber->set_id(3001);
+	otherNumber->set_width(30);
+	otherNumber->set_height(12);
+	otherNumber->set_font_attributes(5000);
+	workingSet.add_or_replace_object(otherNumber);
+
+	auto variable = std::make_shared<NumberVariable>();
+	variable->set_id(4000);
+	workingSet.add_or_replace_object(variable);
+
+	auto font = std::make_shared<FontAttributes>();
+	font->set_id(5000);
+	workingSet.add_or_replace_object(font);
+}
+
+TEST(VIRTUAL_TERMINAL_SERVER_TESTS, DirtyObjectTracking)
+{
+	TestManagedWorkingSet workingSet;
+	build_test_mask(workingSet);
+
+	EXPECT_FALSE(workingSet.get_any_objects_dirty());
+	EXPECT_TRUE(workingSet.get_dirty_regions(1000, 480, 480).empty());
+
+	workingSet.mark_object_dirty(3001);
+	workingSet.mark_object_dirty(3001);
+	EXPECT_TRUE(workingSet.get_any_objects_dirty());
+	ASSERT_EQ(1u, workingSet.get_dirty_objects().size());
+	EXPECT_EQ(3001, workingSet.get_dirty_objects().at(0));
+
+	workingSet.clear_dirty_objects();
+	EXPECT_FALSE(workingSet.get_any_objects_dirty());
+}
+
+TEST(VIRTUAL_TERMINAL_SERVER_TESTS, DirtyRegionsFromVariableReference)
+{
+	TestManagedWorkingSet workingSet;
+	build_test_mask(workingSet);
+
+	// The number variable isn't drawn itself, but the output number that uses it is
+	workingSet.mark_object_dirty(4000);
+	auto regions = workingSet.get_dirty_regions(1000, 480, 480);
+	ASSERT_EQ(1u, regions.size());
+	EXPECT_EQ(3000, regions.at(0).objectID);
+	EXPECT_EQ(15, regions.at(0).xPosition);
+	EXPECT_EQ(25, regions.at(0).yPosition);
+	EXPECT_EQ(40, regions.at(0).width);
+	EXPECT_EQ(10, regions.at(0).height);
+
+	// A shared font affects both output numbers
+	workingSet.clear_dirty_objects();
+	workingSet.mark_object_dirty(5000);
+	regions = workingSet.get_dirty_regions(1000, 480, 480);
+	ASSERT_EQ(2u, regions.size());
+	EXPECT_EQ(3000, regions.at(0).objectID);
+	EXPECT_EQ(3001, regions.at(1).objectID);
+	EXPECT_EQ(100, regions.at(1).xPosition);
+	EXPECT_EQ(100, regions.at(1).yPosition);
+}
+
+TEST(VIRTUAL_TERMINAL_SERVER_TESTS, DirtyRegionsCoalescing)
+{
+	TestManagedWorkingSet workingSet;
+	build_test_mask(workingSet);
+
+	// The container covers the output number inside it, so only the container is reported
+	workingSet.mark_object_dirty(3000);
+	workingSet.mark_object_dirty(2000);
+	auto regions = workingSet.get_dirty_regions(1000, 480, 480);
+	ASSERT_EQ(1u, regions.size());
+	EXPECT_EQ(2000, regions.at(0).objectID);
+	EXPECT_EQ(10, regions.at(0).xPosition);
+	EXPECT_EQ(20, regions.at(0).yPosition);
+
+	// The mask itself being dirty means a full repaint
+	workingSet.mark_object_dirty(1000);
+	regions = workingSet.get_dirty_regions(1000, 480, 480);
+	ASSERT_EQ(1u, regions.size());
+	EXPECT_EQ(1000, regions.at(0).objectID);
+	EXPECT_EQ(0, regions.at(0).xPosition);
+	EXPECT_EQ(0, regions.at(0).yPosition);
+	EXPECT_EQ(480, regions.at(0).width);
+	EXPECT_EQ(480, regions.at(0).height);
+}
+
+TEST(VIRTUAL_TERMINAL_SERVER_TESTS, DirtyRegionsHiddenAndResized)
+{
+	TestManagedWorkingSet workingSet;
+	build_test_mask(workingSet);
+
+	// Children of hidden containers aren't visible, so they don't need a repaint
+	std::static_pointer_cast<Container>(workingSet.get_object_by_id(2000))->set_hidden(true);
+	workingSet.mark_object_dirty(3000);
+	EXPECT_TRUE(workingSet.get_dirty_regions(1000, 480, 480).empty());
+
+	// A shrinking object still needs its old area redrawn
+	workingSet.clear_dirty_objects();
+	workingSet.mark_object_dirty(3001);
+	workingSet.get_object_by_id(3001)->set_width(5);
+	workingSet.get_object_by_id(3001)->set_height(5);
+	auto regions = workingSet.get_dirty_regions(1000, 480, 480);
+	ASSERT_EQ(1u, regions.size());
+	EXPECT_EQ(30, regions.at(0).width);
+	EXPECT_EQ(12, regions.at(0).height);
+}
+
+TEST(VIRTUAL_TERMINAL_SERVER_TESTS, ObjectReferenceIndex)
+{
+	TestManagedWorkingSet workingSet;
+	build_test_mask(workingSet);
+
+	EXPECT_EQ(std::vector<std::uint16_t>{ 1000 }, workingSet.get_parent_object_ids(2000));
+	EXPECT_EQ(std::vector<std::uint16_t>{ 2000 }, workingSet.get_parent_object_ids(3000));
+	EXPECT_TRUE(workingSet.get_parent_object_ids(1000).empty());
+	EXPECT_TRUE(workingSet.get_is_parent_of(1000, 3001));
+	EXPECT_FALSE(workingSet.get_is_parent_of(1000, 3000));
+	EXPECT_EQ(std::vector<std::uint16_t>{ 3000 }, workingSet.get_referencing_object_ids(4000));
+	EXPECT_EQ((std::vector<std::uint16_t>{ 3000, 3001 }), workingSet.get_referencing_object_ids(5000));
+	EXPECT_TRUE(workingSet.get_is_object_neighbourhood_valid(3000));
+	EXPECT_TRUE(workingSet.get_is_object_neighbourhood_valid(5000));
+
+	// Changing a reference at runtime only takes effect in the index once it is updated
+	auto number = std::static_pointer_cast<OutputNumber>(workingSet.get_object_by_id(3001));
+	number->set_variable_reference(4000);
+	number->set_font_attributes(NULL_OBJECT_ID);
+	workingSet.update_object_references(3001);
+	EXPECT_EQ((std::vector<std::uint16_t>{ 3000, 3001 }), workingSet.get_referencing_object_ids(4000));
+	EXPECT_EQ(std::vector<std::uint16_t>{ 3000 }, workingSet.get_referencing_object_ids(5000));
+
+	// A font attributes object is not a valid variable reference, which makes both objects' neighbourhoods invalid
+	number->set_variable_reference(5000);
+	workingSet.update_object_references(3001);
+	EXPECT_FALSE(workingSet.get_is_object_neighbourhood_valid(3001));
+	EXPECT_FALSE(workingSet.get_is_object_neighbourhood_valid(5000));
+	EXPECT_TRUE(workingSet.get_is_object_neighbourhood_valid(4000));
+
+	// Replacing an object drops its old references
+	auto container = std::make_shared<Container>();
+	container->set_id(2000);
+	workingSet.add_or_replace_object(container);
+	EXPECT_TRUE(workingSet.get_parent_object_ids(3000).empty());
+	EXPECT_EQ(std::vector<std::uint16_t>{ 1000 }, workingSet.get_parent_object_ids(2000));
+}
+
+TEST(VIRTUAL_TERMINAL_SERVER_TESTS, CompiledMacroExecution)
+{
+	TestVirtualTerminalServer server(test_helpers::create_mock_internal_control_function(0x26));
+	auto workingSet = std::make_shared<TestManagedWorkingSet>(test_helpers::create_mock_control_function(0x81));
+	build_test_mask(*workingSet);
+
+	auto macro = std::make_shared<Macro>();
+	macro->set_id(6000);
+	macro->add_command_packet({ 0xA8, 0xA0, 0x0F, 0xFF, 77, 0, 0, 0 }); // Change numeric value of 4000 to 77
+	macro->add_command_packet({ 0xA0, 0xD0, 0x07, 0, 0xFF, 0xFF, 0xFF, 0xFF }); // Hide container 2000
+	macro->add_command_packet({ 0xA7, 0xB9, 0x0B, 12, 0xFF, 0xFF, 0xFF, 0xFF }); // Change background colour of 3001 to 12
+	macro->add_command_packet({ 0xAF, 0xB8, 0x0B, 1, 55, 0, 0, 0 }); // Change attribute 1 (width) of 3000 to 55
+	macro->add_command_packet({ 0xA8, 0x39, 0x30, 0xFF, 1, 0, 0, 0 }); // Change numeric value of an object that doesn't exist
+	workingSet->add_or_replace_object(macro);
+
+	server.compile_macros(workingSet);
+	EXPECT_FALSE(server.execute_macro(1000, workingSet));
+	EXPECT_FALSE(server.execute_macro(6001, workingSet));
+	ASSERT_TRUE(server.execute_macro(6000, workingSet));
+
+	EXPECT_EQ(77u, std::static_pointer_cast<NumberVariable>(workingSet->get_object_by_id(4000))->get_value());
+	EXPECT_TRUE(std::static_pointer_cast<Container>(workingSet->get_object_by_id(2000))->get_hidden());
+	EXPECT_EQ(12, workingSet->get_object_by_id(3001)->get_background_color());
+	EXPECT_EQ(55, workingSet->get_object_by_id(3000)->get_width());
+
+	// Executing the macro marks the affected objects for a repaint, the same as the equivalent commands would
+	auto dirtyObjects = workingSet->get_dirty_objects();
+	EXPECT_NE(dirtyObjects.end(), std::find(dirtyObjects.begin(), dirtyObjects.end(), 4000));
+	EXPECT_NE(dirtyObjects.end(), std::find(dirtyObjects.begin(), dirtyObjects.end(), 2000));
+	EXPECT_NE(dirtyObjects.end(), std::find(dirtyObjects.begin(), dirtyObjects.end(), 3001));
+	EXPECT_NE(dirtyObjects.end(), std::find(dirtyObjects.begin(), dirtyObjects.end(), 3000));
+
+	// If the pool changes without the macros being recompiled, the stale compiled macro must not be used.
+	// Since this working set isn't managed by the server, falling back to processing the raw commands has no effect.
+	auto replacementMacro = std::make_shared<Macro>();
+	replacementMacro->set_id(6000);
+	replacementMacro->add_command_packet({ 0xA8, 0xA0, 0x0F, 0xFF, 5, 0, 0, 0 });
+	workingSet->add_or_replace_object(replacementMacro);
+	EXPECT_TRUE(server.execute_macro(6000, workingSet));
+	EXPECT_EQ(77u, std::static_pointer_cast<NumberVariable>(workingSet->get_object_by_id(4000))->get_value());
+
+	server.compile_macros(workingSet);
+	EXPECT_TRUE(server.execute_macro(6000, workingSet));
+	EXPECT_EQ(5u, std::static_pointer_cast<NumberVariable>(workingSet->get_object_by_id(4000))->get_value());
+}
+
+TEST(VIRTUAL_TERMINAL_SERVER_TESTS, ObjectPoolDataIsNotCopied)
+{
+	TestManagedWorkingSet workingSet;
+	std::vector<std::uint8_t> objectPool(100000, 0xFF);
+	const std::uint8_t *originalBuffer = objectPool.data();
+
+	workingSet.add_iop_raw_data(std::move(objectPool));
+	ASSERT_EQ(1u, workingSet.get_number_iop_files());
+	EXPECT_EQ(originalBuffer, workingSet.get_iop_raw_data(0).data());
+
+	// Holders of the shared data, such as a version store, see the same bytes
+	auto sharedData = workingSet.get_shared_iop_raw_data(0);
+	EXPECT_EQ(originalBuffer, sharedData->data());
+	EXPECT_EQ(100000u, sharedData->size());
+}
@@ -0,0 +1,305 @@
+//================================================================================================
+/// @file vt_software_renderer_tests.cpp
+///
+/// @brief Unit tests for the VT server's software renderer
+/// @author The Little Dawn Developers
+///
+/// @copyright 2026 The Little Dawn Developers
+//================================================================================================
+#include <gtest/gtest.h>
+
+#include "isobus/isobus/isobus_virtual_terminal_software_renderer.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+using namespace isobus;
+
+class RendererTestWorkingSet : public VirtualTerminalServerManagedWorkingSet
+{
+public:
+	using VirtualTerminalWorkingSetBase::add_or_replace_object;
+};
+
+static constexpr std::uint32_t BLACK = 0x000000;
+static constexpr std::uint32_t WHITE = 0xFFFFFF;
+static constexpr std::uint32_t SILVER = 0xCCCCCC;
+static constexpr std::uint32_t BLUE = 0x0000FF;
+static constexpr std::uint32_t RED = 0xFF0000;
+
+// Builds a silver 100x100 data mask 1000 with:
+// - a red bordered, blue filled rectangle 2000 at (10, 10)
+// - a matching ellipse 2001 at (50, 50)
+// - a red horizontal line 2002 at (0, 80)
+// - an output number 2003 at (0, 0) showing number variable 4000 using font 5000
+// - an output string 2004 at (0, 20) showing "42" using font 5000
+static std::shared_ptr<RendererTestWorkingSet> build_test_pool()
+{
+	auto workingSet = std::make_shared<RendererTestWorkingSet>();
+
+	auto dataMask = std::make_shared<DataMask>();
+	dataMask->set_id(1000);
+	dataMask->set_background_color(7);
+	dataMask->add_child(2000, 10, 10);
+	dataMask->add_child(2001, 50, 50);
+	dataMask->add_child(2002, 0, 80);
+	dataMask->add_child(2003, 0, 0);
+	dataMask->add_child(2004, 0, 20);
+	workingSet->add_or_replace_object(dataMask);
+
+	auto rectangle = std::make_shared<OutputRectangle>();
+	rectangle->set_id(2000);
+	rectangle->set_width(20);
+	rectangle->set_height(10);
+	rectangle->set_line_attributes(3000);
+	rectangle->set_fill_attributes(3001);
+	workingSet->add_or_replace_object(rectangle);
+
+	auto ellipse = std::make_shared<OutputEllipse>();
+	ellipse->set_id(2001);
+	ellipse->set_width(20);
+	ellipse->set_height(20);
+	ellipse->set_line_attributes(3000);
+	ellipse->set_fill_attributes(3001);
+	workingSet->add_or_replace_object(ellipse);
+
+	auto line = std::make_shared<OutputLine>();
+	line->set_id(2002);
+	line->set_width(10);
+	line->set_height(0);
+	line->set_line_attributes(3000);
+	workingSet->add_or_replace_object(line);
+
+	auto number = std::make_shared<OutputNumber>();
+	number->set_id(2003);
+	number->set_width(40);
+	number->set_height(8);
+	number->set_background_color(1);
+	number->set_variable_reference(4000);
+	number->set_font_attributes(5000);
+	workingSet->add_or_replace_object(number);
+
+	auto string = std::make_shared<OutputString>();
+	string->set_id(2004);
+	string->set_width(40);
+	string->set_height(8);
+	string->set_background_color(1);
+	string->set_value("42");
+	string->set_font_attributes(5000);
+	workingSet->add_or_replace_object(string);
+
+	auto lineAttributes = std::make_shared<LineAttributes>();
+	lineAttributes->set_id(3000);
+	lineAttributes->set_background_color(12);
+	lineAttributes->set_width(1);
+	lineAttributes->set_line_art_bit_pattern(0xFFFF);
+	workingSet->add_or_replace_object(lineAttributes);
+
+	auto fillAttributes = std::make_shared<FillAttributes>();
+	fillAttributes->set_id(3001);
+	fillAttributes->set_type(FillAttributes::FillType::FillWithSpecifiedColorInFillColorAttribute);
+	fillAttributes->set_background_color(9);
+	workingSet->add_or_replace_object(fillAttributes);
+
+	auto variable = std::make_shared<NumberVariable>();
+	variable->set_id(4000);
+	variable->set_value(42);
+	workingSet->add_or_replace_object(variable);
+
+	auto font = std::make_shared<FontAttributes>();
+	font->set_id(5000);
+	font->set_size(FontAttributes::FontSize::Size6x8);
+	font->set_colour(0);
+	workingSet->add_or_replace_object(font);
+
+	return workingSet;
+}
+
+TEST(VIRTUAL_TERMINAL_SOFTWARE_RENDERER_TESTS, RendersShapes)
+{
+	auto workingSet = build_test_pool();
+	VirtualTerminalSoftwareRenderer renderer(100, 100);
+
+	EXPECT_FALSE(renderer.render(workingSet, 2000));
+	EXPECT_FALSE(renderer.render(workingSet, 1234));
+	ASSERT_TRUE(renderer.render(workingSet, 1000));
+
+	// Mask background
+	EXPECT_EQ(SILVER, renderer.get_pixel(5, 15));
+	EXPECT_EQ(SILVER, renderer.get_pixel(99, 99));
+
+	// Rectangle border and fill
+	EXPECT_EQ(RED, renderer.get_pixel(10, 10));
+	EXPECT_EQ(RED, renderer.get_pixel(29, 19));
+	EXPECT_EQ(BLUE, renderer.get_pixel(15, 15));
+	EXPECT_EQ(SILVER, renderer.get_pixel(30, 15));
+	EXPECT_EQ(SILVER, renderer.get_pixel(45, 19));
+
+	// Ellipse corners are outside the ellipse, its center is filled
+	EXPECT_EQ(SILVER, renderer.get_pixel(50, 50));
+	EXPECT_EQ(BLUE, renderer.get_pixel(60, 60));
+	EXPECT_EQ(RED, renderer.get_pixel(60, 50));
+
+	// Horizontal line
+	EXPECT_EQ(RED, renderer.get_pixel(0, 80));
+	EXPECT_EQ(RED, renderer.get_pixel(9, 80));
+	EXPECT_EQ(SILVER, renderer.get_pixel(10, 80));
+	EXPECT_EQ(SILVER, renderer.get_pixel(5, 81));
+}
+
+TEST(VIRTUAL_TERMINAL_SOFTWARE_RENDERER_TESTS, RendersText)
+{
+	auto workingSet = build_test_pool();
+	VirtualTerminalSoftwareRenderer renderer(100, 100);
+	ASSERT_TRUE(renderer.render(workingSet, 1000));
+
+	// The number and the string both show "42" in the same font, so they should look identical
+	bool anyBlackPixels = false;
+	for (std::uint16_t y = 0; y < 8; y++)
+	{
+		for (std::uint16_t x = 0; x < 40; x++)
+		{
+			EXPECT_EQ(renderer.get_pixel(x, y), renderer.get_pixel(x, y + 20));
+			anyBlackPixels |= (BLACK == renderer.get_pixel(x, y));
+		}
+	}
+	EXPECT_TRUE(anyBlackPixels);
+
+	// The "4" glyph's vertical stroke, and the empty background to the right of the text
+	EXPECT_EQ(BLACK, renderer.get_pixel(3, 0));
+	EXPECT_EQ(WHITE, renderer.get_pixel(30, 4));
+
+	// Leading zeros pad the number to the width of the field
+	auto number = std::static_pointer_cast<OutputNumber>(workingSet->get_object_by_id(2003));
+	number->set_option(OutputNumber::Options::DisplayLeadingZeros, true);
+	renderer.invalidate_object(2003);
+	ASSERT_TRUE(renderer.render(workingSet, 1000));
+	EXPECT_EQ(BLACK, renderer.get_pixel(0, 1));
+	EXPECT_EQ(WHITE, renderer.get_pixel(0, 21));
+}
+
+TEST(VIRTUAL_TERMINAL_SOFTWARE_RENDERER_TESTS, BitmapCache)
+{
+	auto workingSet = build_test_pool();
+	VirtualTerminalSoftwareRenderer renderer(100, 100);
+
+	ASSERT_TRUE(renderer.render(workingSet, 1000));
+	EXPECT_EQ(5u, renderer.get_number_of_cached_objects());
+	EXPECT_EQ(5u, renderer.get_cache_misses());
+	EXPECT_EQ(0u, renderer.get_cache_hits());
+
+	ASSERT_TRUE(renderer.render(workingSet, 1000));
+	EXPECT_EQ(5u, renderer.get_cache_misses());
+	EXPECT_EQ(5u, renderer.get_cache_hits());
+
+	// Changing the number variable only invalidates the output number that uses it
+	std::vector<std::uint8_t> before = renderer.get_framebuffer();
+	std::static_pointer_cast<NumberVariable>(workingSet->get_object_by_id(4000))->set_value(7);
+	renderer.invalidate_object(4000);
+	EXPECT_EQ(4u, renderer.get_number_of_cached_objects());
+	ASSERT_TRUE(renderer.render(workingSet, 1000));
+	EXPECT_EQ(6u, renderer.get_cache_misses());
+	EXPECT_NE(before, renderer.get_framebuffer());
+
+	// The shared line attributes are used by the rectangle, ellipse and line
+	renderer.invalidate_object(3000);
+	EXPECT_EQ(2u, renderer.get_number_of_cached_objects());
+
+	renderer.invalidate_all();
+	EXPECT_EQ(0u, renderer.get_number_of_cached_objects());
+}
+
+TEST(VIRTUAL_TERMINAL_SOFTWARE_RENDERER_TESTS, RendersOnlyDirtyRegions)
+{
+	auto workingSet = build_test_pool();
+	VirtualTerminalSoftwareRenderer renderer(100, 100);
+	ASSERT_TRUE(renderer.render(workingSet, 1000));
+
+	// Change the mask without marking it dirty, so we can tell which areas were redrawn
+	workingSet->get_object_by_id(1000)->set_background_color(1);
+	std::static_pointer_cast<FillAttributes>(workingSet->get_object_by_id(3001))->set_background_color(12);
+	workingSet->mark_object_dirty(3001);
+
+	auto regions = workingSet->get_dirty_regions(1000, 100, 100);
+	ASSERT_EQ(2u, regions.size());
+	renderer.invalidate_objects(workingSet->get_dirty_objects());
+	ASSERT_TRUE(renderer.render_regions(workingSet, 1000, regions));
+
+	// The rectangle and ellipse regions were redrawn, everything else was left alone
+	EXPECT_EQ(RED, renderer.get_pixel(15, 15));
+	EXPECT_EQ(RED, renderer.get_pixel(60, 60));
+	EXPECT_EQ(WHITE, renderer.get_pixel(50, 50));
+	EXPECT_EQ(SILVER, renderer.get_pixel(5, 15));
+	EXPECT_EQ(SILVER, renderer.get_pixel(99, 99));
+	EXPECT_EQ(2u, renderer.get_cache_misses() - 5u);
+}
+
+TEST(VIRTUAL_TERMINAL_SOFTWARE_RENDERER_TESTS, RendersPictureGraphics)
+{
+	auto workingSet = std::make_shared<RendererTestWorkingSet>();
+
+	auto dataMask = std::make_shared<DataMask>();
+	dataMask->set_id(1000);
+	dataMask->set_background_color(7);
+	dataMask->add_child(2000, 0, 0);
+	workingSet->add_or_replace_object(dataMask);
+
+	// A 2x2 picture scaled up to 4x4, with the bottom right pixel transparent
+	const std::uint8_t pictureData[] = { 12, 9, 1, 0 };
+	auto picture = std::make_shared<PictureGraphic>();
+	picture->set_id(2000);
+	picture->set_width(4);
+	picture->set_actual_width(2);
+	picture->set_actual_height(2);
+	picture->set_format(PictureGraphic::Format::EightBitColour);
+	picture->set_raw_data(pictureData, sizeof(pictureData));
+	picture->set_option(PictureGraphic::Options::Transparent, true);
+	picture->set_transparency_colour(0);
+	workingSet->add_or_replace_object(picture);
+
+	VirtualTerminalSoftwareRenderer renderer(8, 8);
+	ASSERT_TRUE(renderer.render(workingSet, 1000));
+
+	EXPECT_EQ(RED, renderer.get_pixel(0, 0));
+	EXPECT_EQ(RED, renderer.get_pixel(1, 1));
+	EXPECT_EQ(BLUE, renderer.get_pixel(3, 0));
+	EXPECT_EQ(WHITE, renderer.get_pixel(0, 3));
+	EXPECT_EQ(SILVER, renderer.get_pixel(3, 3));
+	EXPECT_EQ(SILVER, renderer.get_pixel(4, 0));
+}
+
+TEST(VIRTUAL_TERMINAL_SOFTWARE_RENDERER_TESTS, EncodesPNG)
+{
+	auto workingSet = build_test_pool();
+	VirtualTerminalSoftwareRenderer renderer(100, 100);
+	ASSERT_TRUE(renderer.render(workingSet, 1000));
+
+	auto png = renderer.encode_png();
+	const std::uint8_t signature[] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+	ASSERT_GT(png.size(), sizeof(signature));
+	EXPECT_TRUE(std::equal(std::begin(signature), std::end(signature), png.begin()));
+
+	// IHDR chunk with the frame's size, 8 bit RGB
+	EXPECT_EQ(13, png.at(11));
+	EXPECT_EQ('I', png.at(12));
+	EXPECT_EQ('H', png.at(13));
+	EXPECT_EQ(100, png.at(19));
+	EXPECT_EQ(100, png.at(23));
+	EXPECT_EQ(8, png.at(24));
+	EXPECT_EQ(2, png.at(25));
+
+	// 100 rows of a filter byte plus 300 bytes of RGB fit in one stored block
+	const std::size_t imageDataLength = 2 + 5 + (100 * 301) + 4;
+	EXPECT_EQ(8u + 25u + (12u + imageDataLength) + 12u, png.size());
+
+	// The IEND chunk always has the same CRC
+	const std::uint8_t end[] = { 'I', 'E', 'N', 'D', 0xAE, 0x42, 0x60, 0x82 };
+	EXPECT_TRUE(std::equal(std::begin(end), std::end(end), png.end() - 8));
+
+	const std::string fileName = "vt_software_renderer_test.png";
+	ASSERT_TRUE(renderer.save_png(fileName));
+	std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+	EXPECT_EQ(static_cast<std::streamoff>(png.size()), static_cast<std::streamoff>(file.tellg()));
+	file.close();
+	std::remove(fileName.c_str());
+}
@@ -0,0 +1,131 @@
+//================================================================================================
+/// @file zero_allocation_tests.cpp
+///
+/// @brief Verifies that the periodic broadcasts don't allocate memory each time they are sent.
+/// @author The Little Dawn Developers
+///
+/// @copyright 2026 The Little Dawn Developers
+//================================================================================================
+#include <gtest/gtest.h>
+
+#include "isobus/hardware_integration/can_hardware_interface.hpp"
+#include "isobus/hardware_integration/virtual_can_plugin.hpp"
+#include "isobus/isobus/can_network_manager.hpp"
+#include "isobus/isobus/isobus_guidance_interface.hpp"
+#include "isobus/isobus/isobus_speed_distance_messages.hpp"
+#include "isobus/isobus/nmea2000_message_interface.hpp"
+
+#include "helpers/control_function_helpers.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <thread>
+
+using namespace isobus;
+
+static thread_local bool countAllocations = false; ///< Only allocations made by the test's own thread are counted
+static std::size_t numberOfAllocations = 0; ///< The number of allocations made while counting
+
+void *operator new(std::size_t size)
+{
+	if (countAllocations)
+	{
+		numberOfAllocations++;
+	}
+
+	void *retVal = std::malloc(0 != size ? size : 1);
+
+	if (nullptr == retVal)
+	{
+		throw std::bad_alloc();
+	}
+	return retVal;
+}
+
+void *operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void *pointer) noexcept
+{
+	std::free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept
+{
+	std::free(pointer);
+}
+
+TEST(ZERO_ALLOCATION_TESTS, PeriodicBroadcasts)
+{
+	VirtualCANPlugin testPlugin;
+	testPlugin.open();
+
+	CANHardwareInterface::set_number_of_can_channels(1);
+	CANHardwareInterface::assign_can_channel_frame_handler(0, std::make_shared<VirtualCANPlugin>());
+	CANHardwareInterface::start();
+
+	auto testECU = test_helpers::claim_internal_control_function(0x49, 0);
+
+	NMEA2000MessageInterface nmea2000Interface(testECU, true, false, false, false, true, true, true);
+	SpeedMessagesInterface speedInterface(testECU, true, true, true, false);
+	AgriculturalGuidanceInterface guidanceInterface(testECU, nullptr, false, true);
+
+	nmea2000Interface.initialize();
+	speedInterface.initialize();
+	guidanceInterface.initialize();
+
+	nmea2000Interface.get_vessel_heading_transmit_message().set_heading(1000);
+	speedInterface.groundBasedSpeedTransmitData.set_machine_speed(1000);
+	guidanceInterface.guidanceMachineInfoTransmitData.set_estimated_curvature(1.5f);
+
+	// The first pass may set up any lazily created state
+	nmea2000Interface.update();
+	speedInterface.update();
+	guidanceInterface.update();
+
+	// Let the hardware interface thread finish sending the first pass, then discard it
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	CANMessageFrame testFrame = {};
+	while (!testPlugin.get_queue_empty())
+	{
+		testPlugin.read_frame(testFrame);
+	}
+
+	for (std::uint8_t i = 0; i < 3; i++)
+	{
+		// Wait for every message's interval to pass, so each one is sent again
+		std::this_thread::sleep_for(std::chrono::milliseconds(260));
+
+		numberOfAllocations = 0;
+		countAllocations = true;
+		nmea2000Interface.update();
+		speedInterface.update();
+		guidanceInterface.update();
+		countAllocations = false;
+
+		EXPECT_EQ(0, numberOfAllocations);
+
+		// COG & SOG, position rapid update, rate of turn, vessel heading, 3 speed messages, and guidance machine info
+		std::size_t numberOfFrames = 0;
+		for (std::uint8_t j = 0; j < 50; j++)
+		{
+			while (!testPlugin.get_queue_empty())
+			{
+				testPlugin.read_frame(testFrame);
+				numberOfFrames++;
+			}
+
+			if (numberOfFrames >= 8)
+			{
+				break;
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		EXPECT_EQ(8, numberOfFrames);
+	}
+
+	CANHardwareInterface::stop();
+}
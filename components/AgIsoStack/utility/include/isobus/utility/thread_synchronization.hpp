@@ -203,4 +203,98 @@ private:
 
 #endif
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+/// @brief A single producer, single consumer queue with a fixed capacity.
+/// @details Unlike LockFreeQueue, the storage is part of the object and the capacity is the same whether or not
+/// threads are enabled, so pushing never allocates and fails once the queue is full. One context may push while
+/// another peeks and pops, for example an interrupt pushing and the stack's update popping.
+/// @tparam T The item type for the queue.
+/// @tparam N The maximum number of items the queue can hold.
+template<typename T, std::size_t N>
+class FixedSizeLockFreeQueue
+{
+public:
+	static_assert(N > 0, "The size of the queue must be greater than 0.");
+
+	/// @brief Push an item to the queue.
+	/// @param item The item to push to the queue.
+	/// @return True if the item was pushed to the queue, false if the queue is full.
+	bool push(const T &item)
+	{
+		const auto currentWriteIndex = writeIndex.load(std::memory_order_relaxed);
+		const auto nextWriteIndex = next_index(currentWriteIndex);
+
+		if (nextWriteIndex == readIndex.load(std::memory_order_acquire))
+		{
+			// The buffer is full.
+			return false;
+		}
+
+		buffer[currentWriteIndex] = item;
+		writeIndex.store(nextWriteIndex, std::memory_order_release);
+		return true;
+	}
+
+	/// @brief Peek at the next item in the queue.
+	/// @param item The item to peek at in the queue.
+	/// @return True if the item was peeked at in the queue, false if the queue is empty.
+	bool peek(T &item) const
+	{
+		const auto currentReadIndex = readIndex.load(std::memory_order_relaxed);
+		if (currentReadIndex == writeIndex.load(std::memory_order_acquire))
+		{
+			// The buffer is empty.
+			return false;
+		}
+
+		item = buffer[currentReadIndex];
+		return true;
+	}
+
+	/// @brief Pop an item from the queue.
+	/// @return True if the item was popped from the queue, false if the queue is empty.
+	bool pop()
+	{
+		const auto currentReadIndex = readIndex.load(std::memory_order_relaxed);
+		if (currentReadIndex == writeIndex.load(std::memory_order_acquire))
+		{
+			// The buffer is empty.
+			return false;
+		}
+
+		readIndex.store(next_index(currentReadIndex), std::memory_order_release);
+		return true;
+	}
+
+	/// @brief Check if the queue is full.
+	/// @return True if the queue is full, false if the queue is not full.
+	bool is_full() const
+	{
+		return next_index(writeIndex.load(std::memory_order_acquire)) == readIndex.load(std::memory_order_acquire);
+	}
+
+	/// @brief Clear the queue. Only call this from the consumer.
+	void clear()
+	{
+		// Simply move the read index to the write index.
+		readIndex.store(writeIndex.load(std::memory_order_acquire), std::memory_order_release);
+	}
+
+private:
+	std::array<T, N + 1> buffer = {}; ///< The buffer for the circular buffer, one slot is always left empty to tell full from empty
+	std::atomic<std::size_t> readIndex = { 0 }; ///< The read index for the circular buffer.
+	std::atomic<std::size_t> writeIndex = { 0 }; ///< The write index for the circular buffer.
+
+	/// @brief Get the next index in the circular buffer.
+	/// @param current The current index.
+	/// @return The next index in the circular buffer.
+	static std::size_t next_index(std::size_t current)
+	{
+		return (current + 1) % (N + 1);
+	}
+};
+
 #endif // THREAD_SYNCHRONIZATION_HPP
@@ -0,0 +1,135 @@
+#include "bus_memory.h"
+#include "esp_log.h"
+#include "nvs.h"
+#include "nvs_flash.h"
+#include <string.h>
+
+#include "isobus/isobus/can_network_manager.hpp"
+
+static const char *TAG = "BUS_MEMORY";
+
+static bus_memory_snapshot_t stored_snapshot;
+static bool snapshot_loaded = false;
+
+static bool load_snapshot(bus_memory_snapshot_t *snapshot)
+{
+    nvs_handle_t handle;
+    if (nvs_open(BUS_MEMORY_NAMESPACE, NVS_READONLY, &handle) != ESP_OK) {
+        return false;
+    }
+
+    size_t length = sizeof(bus_memory_snapshot_t);
+    bool result = (nvs_get_blob(handle, BUS_MEMORY_KEY, snapshot, &length) == ESP_OK) &&
+                  (length == sizeof(bus_memory_snapshot_t)) &&
+                  (snapshot->version == BUS_MEMORY_VERSION) &&
+                  (snapshot->count <= BUS_MEMORY_MAX_CONTROL_FUNCTIONS);
+    nvs_close(handle);
+    return result;
+}
+
+static bool store_snapshot(const bus_memory_snapshot_t *snapshot)
+{
+    nvs_handle_t handle;
+    if (nvs_open(BUS_MEMORY_NAMESPACE, NVS_READWRITE, &handle) != ESP_OK) {
+        return false;
+    }
+
+    bool result = (nvs_set_blob(handle, BUS_MEMORY_KEY, snapshot, sizeof(bus_memory_snapshot_t)) == ESP_OK) &&
+                  (nvs_commit(handle) == ESP_OK);
+    nvs_close(handle);
+    return result;
+}
+
+bool bus_memory_init(void)
+{
+    esp_err_t err = nvs_flash_init();
+    if ((err == ESP_ERR_NVS_NO_FREE_PAGES) || (err == ESP_ERR_NVS_NEW_VERSION_FOUND)) {
+        // The partition was truncated or is from another IDF version, start again
+        ESP_ERROR_CHECK(nvs_flash_erase());
+        err = nvs_flash_init();
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to initialize NVS: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    memset(&stored_snapshot, 0, sizeof(stored_snapshot));
+    snapshot_loaded = load_snapshot(&stored_snapshot);
+    if (snapshot_loaded) {
+        ESP_LOGI(TAG, "Last address 0x%02X, %d other control functions", stored_snapshot.address, stored_snapshot.count);
+    } else {
+        memset(&stored_snapshot, 0, sizeof(stored_snapshot));
+    }
+    return snapshot_loaded;
+}
+
+void bus_memory_restore(std::shared_ptr<isobus::InternalControlFunction> ecu)
+{
+    if (!BUS_MEMORY_ENABLED || !snapshot_loaded || !ecu) {
+        return;
+    }
+
+    if (stored_snapshot.name != ecu->get_NAME().get_full_name()) {
+        ESP_LOGW(TAG, "Our NAME changed, claiming the normal way");
+        return;
+    }
+
+    if (ecu->set_remembered_address(stored_snapshot.address)) {
+        ESP_LOGI(TAG, "Claiming remembered address 0x%02X", stored_snapshot.address);
+    }
+
+    uint8_t restored = 0;
+    for (uint8_t i = 0; i < stored_snapshot.count; i++) {
+        if (isobus::CANNetworkManager::CANNetwork.add_known_control_function(isobus::NAME(stored_snapshot.entries[i].name),
+                                                                             stored_snapshot.entries[i].address,
+                                                                             ecu->get_can_port())) {
+            restored++;
+        }
+    }
+    ESP_LOGI(TAG, "Restored %d of %d known control functions", restored, stored_snapshot.count);
+}
+
+bool bus_memory_save(std::shared_ptr<isobus::InternalControlFunction> ecu, SemaphoreHandle_t stack_mutex)
+{
+    if (!BUS_MEMORY_ENABLED || !ecu || !stack_mutex) {
+        return false;
+    }
+
+    bus_memory_snapshot_t snapshot;
+    memset(&snapshot, 0, sizeof(snapshot));
+    snapshot.version = BUS_MEMORY_VERSION;
+
+    xSemaphoreTake(stack_mutex, portMAX_DELAY);
+    bool claimed = (ecu->get_current_state() == isobus::InternalControlFunction::State::AddressClaimingComplete) && ecu->get_address_valid();
+    if (claimed) {
+        snapshot.address = ecu->get_address();
+        snapshot.name = ecu->get_NAME().get_full_name();
+
+        // Only the CFs that are online, in address order, so an unchanged bus gives an identical snapshot
+        for (const auto &cf : isobus::CANNetworkManager::CANNetwork.get_control_functions(false)) {
+            if ((snapshot.count < BUS_MEMORY_MAX_CONTROL_FUNCTIONS) &&
+                (cf->get_type() != isobus::ControlFunction::Type::Internal) &&
+                (cf->get_can_port() == ecu->get_can_port()) &&
+                cf->get_address_valid()) {
+                snapshot.entries[snapshot.count].name = cf->get_NAME().get_full_name();
+                snapshot.entries[snapshot.count].address = cf->get_address();
+                snapshot.count++;
+            }
+        }
+    }
+    xSemaphoreGive(stack_mutex);
+
+    if (!claimed || (snapshot_loaded && (memcmp(&snapshot, &stored_snapshot, sizeof(snapshot)) == 0))) {
+        return false;
+    }
+
+    if (!store_snapshot(&snapshot)) {
+        ESP_LOGE(TAG, "Failed to store the bus snapshot");
+        return false;
+    }
+
+    memcpy(&stored_snapshot, &snapshot, sizeof(snapshot));
+    snapshot_loaded = true;
+    ESP_LOGI(TAG, "Stored address 0x%02X and %d other control functions", snapshot.address, snapshot.count);
+    return true;
+}
@@ -0,0 +1,43 @@
+#ifndef BUS_MEMORY_H
+#define BUS_MEMORY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <memory>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "isobus/isobus/can_internal_control_function.hpp"
+
+// Remembers our claimed address and the other control functions on the bus in NVS,
+// so the next power up can claim straight away and find the VT without waiting for the bus's claims.
+// Set to 0 to always claim the normal way.
+#define BUS_MEMORY_ENABLED              1
+#define BUS_MEMORY_MAX_CONTROL_FUNCTIONS 16 // Control functions remembered, besides our own
+#define BUS_MEMORY_NAMESPACE            "bus_memory"
+#define BUS_MEMORY_KEY                  "snapshot"
+#define BUS_MEMORY_VERSION              1   // Bump when bus_memory_snapshot_t changes
+
+typedef struct {
+    uint64_t name;          // Full ISO NAME
+    uint8_t address;        // Address it last claimed
+} bus_memory_entry_t;
+
+// What is stored in NVS
+typedef struct {
+    uint8_t version;        // BUS_MEMORY_VERSION
+    uint8_t address;        // Address we last claimed
+    uint8_t count;          // Number of used entries
+    uint64_t name;          // Our NAME, the snapshot is ignored if it changes
+    bus_memory_entry_t entries[BUS_MEMORY_MAX_CONTROL_FUNCTIONS];
+} bus_memory_snapshot_t;
+
+// Function prototypes
+// Initializes NVS and loads the last snapshot. Returns true if there was one.
+bool bus_memory_init(void);
+// Applies the loaded snapshot. Call after the partners are created, and before the CAN stack is first updated.
+void bus_memory_restore(std::shared_ptr<isobus::InternalControlFunction> ecu);
+// Stores the current bus if it changed. Only writes once our address is claimed, to save flash wear.
+bool bus_memory_save(std::shared_ptr<isobus::InternalControlFunction> ecu, SemaphoreHandle_t stack_mutex);
+
+#endif // BUS_MEMORY_H
@@ -0,0 +1,247 @@
+#include "machine_publisher.h"
+#include "new_dawn_serial.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <array>
+
+#include "isobus/isobus/can_general_parameter_group_numbers.hpp"
+#include "isobus/isobus/can_network_manager.hpp"
+#include "isobus/isobus/isobus_speed_distance_messages.hpp"
+#include "isobus/isobus/nmea2000_message_interface.hpp"
+
+static const char *TAG = "PUBLISHER";
+
+// The speed interface normally decides when to send by itself each time it is updated.
+// Exposing its send functions lets the timer decide instead, so the cadence isn't
+// quantized to whenever update() happens to be called.
+class TimedSpeedMessagesInterface : public isobus::SpeedMessagesInterface
+{
+public:
+    using isobus::SpeedMessagesInterface::SpeedMessagesInterface;
+    using isobus::SpeedMessagesInterface::send_ground_based_speed;
+    using isobus::SpeedMessagesInterface::send_machine_selected_speed;
+};
+
+static std::shared_ptr<isobus::InternalControlFunction> publisherSource = nullptr;
+static std::unique_ptr<TimedSpeedMessagesInterface> speedInterface = nullptr;
+static std::unique_ptr<isobus::NMEA2000MessageInterface> nmea2000Interface = nullptr;
+static SemaphoreHandle_t stackMutex = NULL;
+static TaskHandle_t publisherTaskHandle = NULL;
+static esp_timer_handle_t publisherTimer = NULL;
+
+// Jitter statistics
+static machine_publisher_jitter_t publisher_jitter = {0, 0, INT32_MAX, INT32_MIN, 0, 0};
+static SemaphoreHandle_t jitter_mutex = NULL;
+
+// Runs from the esp_timer task, so just wake the publisher
+static void publisher_timer_callback(void *arg)
+{
+    xTaskNotifyGive(publisherTaskHandle);
+}
+
+static void record_jitter(int32_t jitter_us, bool published)
+{
+    if (xSemaphoreTake(jitter_mutex, 0) == pdTRUE) {
+        publisher_jitter.count++;
+        publisher_jitter.last_us = jitter_us;
+        publisher_jitter.total_abs_us += abs(jitter_us);
+        if (jitter_us < publisher_jitter.min_us) {
+            publisher_jitter.min_us = jitter_us;
+        }
+        if (jitter_us > publisher_jitter.max_us) {
+            publisher_jitter.max_us = jitter_us;
+        }
+        if (published) {
+            publisher_jitter.published++;
+        }
+        xSemaphoreGive(jitter_mutex);
+    }
+}
+
+static bool send_nmea2000_frame(isobus::CANLibParameterGroupNumber pgn, const std::array<uint8_t, isobus::CAN_DATA_LENGTH> &frame)
+{
+    return isobus::CANNetworkManager::CANNetwork.send_can_message(static_cast<uint32_t>(pgn),
+                                                                  frame.data(),
+                                                                  frame.size(),
+                                                                  publisherSource,
+                                                                  nullptr,
+                                                                  isobus::CANIdentifier::CANPriority::Priority2);
+}
+
+// Wraps a heading in 0.1 degrees to [0, 3600)
+static int32_t normalize_heading(int32_t heading)
+{
+    heading %= 3600;
+    if (heading < 0) {
+        heading += 3600;
+    }
+    return heading;
+}
+
+static void publish_speed(const MachineStatus &status, uint64_t &distance_um)
+{
+    // 0.01 km/h to mm/s
+    uint16_t speed_mm_s = (uint16_t)((abs(status.speed) * 25) / 9);
+    isobus::SpeedMessagesInterface::MachineDirection direction = (status.speed < 0) ? isobus::SpeedMessagesInterface::MachineDirection::Reverse : isobus::SpeedMessagesInterface::MachineDirection::Forward;
+
+    // Distance is kept in um so each step's fraction of a mm isn't lost, and rolls over to zero past the largest valid value
+    distance_um += (uint64_t)speed_mm_s * MACHINE_PUBLISHER_SPEED_MS;
+    if ((distance_um / 1000) > 4211081215U) {
+        distance_um = 0;
+    }
+    uint32_t distance_mm = (uint32_t)(distance_um / 1000);
+
+    speedInterface->groundBasedSpeedTransmitData.set_machine_speed(speed_mm_s);
+    speedInterface->groundBasedSpeedTransmitData.set_machine_distance(distance_mm);
+    speedInterface->groundBasedSpeedTransmitData.set_machine_direction_of_travel(direction);
+    speedInterface->send_ground_based_speed();
+
+    speedInterface->machineSelectedSpeedTransmitData.set_machine_speed(speed_mm_s);
+    speedInterface->machineSelectedSpeedTransmitData.set_machine_distance(distance_mm);
+    speedInterface->machineSelectedSpeedTransmitData.set_machine_direction_of_travel(direction);
+    speedInterface->machineSelectedSpeedTransmitData.set_speed_source(isobus::SpeedMessagesInterface::MachineSelectedSpeedData::SpeedSource::NavigationBasedSpeed);
+    speedInterface->send_machine_selected_speed();
+}
+
+static void publish_heading(const MachineStatus &status, int32_t &last_heading, int64_t &last_heading_us, int64_t now_us)
+{
+    std::array<uint8_t, isobus::CAN_DATA_LENGTH> frame;
+    int32_t heading = normalize_heading(status.heading);
+
+    // 0.1 degrees to 0.0001 radians
+    nmea2000Interface->get_vessel_heading_transmit_message().set_heading((uint16_t)(heading * (M_PI / 1800.0) * 10000.0));
+    nmea2000Interface->get_vessel_heading_transmit_message().set_sensor_reference(isobus::NMEA2000Messages::VesselHeading::HeadingSensorReference::True);
+    nmea2000Interface->get_vessel_heading_transmit_message().serialize(frame);
+    send_nmea2000_frame(isobus::CANLibParameterGroupNumber::VesselHeading, frame);
+
+    // Rate of turn comes from the change in heading since the last publish, in 1/32 x 10E-6 rad/s
+    if (last_heading_us != 0) {
+        int32_t delta = normalize_heading(heading - last_heading);
+        if (delta >= 1800) {
+            delta -= 3600;
+        }
+        double rate_rad_s = (delta * (M_PI / 1800.0)) / ((now_us - last_heading_us) / 1000000.0);
+        nmea2000Interface->get_rate_of_turn_transmit_message().set_rate_of_turn((int32_t)(rate_rad_s * 32000000.0));
+        nmea2000Interface->get_rate_of_turn_transmit_message().serialize(frame);
+        send_nmea2000_frame(isobus::CANLibParameterGroupNumber::RateOfTurn, frame);
+    }
+    last_heading = heading;
+    last_heading_us = now_us;
+}
+
+static void publish_cog_sog(const MachineStatus &status)
+{
+    std::array<uint8_t, isobus::CAN_DATA_LENGTH> frame;
+
+    // New Dawn's heading is the GNSS course, 0.1 degrees to 0.0001 radians, and 0.01 km/h to 0.01 m/s
+    nmea2000Interface->get_cog_sog_transmit_message().set_course_over_ground((uint16_t)(normalize_heading(status.heading) * (M_PI / 1800.0) * 10000.0));
+    nmea2000Interface->get_cog_sog_transmit_message().set_speed_over_ground((uint16_t)((abs(status.speed) * 10) / 36));
+    nmea2000Interface->get_cog_sog_transmit_message().set_course_over_ground_reference(isobus::NMEA2000Messages::CourseOverGroundSpeedOverGroundRapidUpdate::CourseOverGroundReference::True);
+    nmea2000Interface->get_cog_sog_transmit_message().serialize(frame);
+    send_nmea2000_frame(isobus::CANLibParameterGroupNumber::CourseOverGroundSpeedOverGroundRapidUpdate, frame);
+}
+
+static void publisher_task(void *arg)
+{
+    uint32_t tick = 0;
+    int64_t last_tick_us = 0;
+    uint64_t distance_um = 0;
+    int32_t last_heading = 0;
+    int64_t last_heading_us = 0;
+
+    ESP_LOGI(TAG, "Publisher task started, tick %dms", MACHINE_PUBLISHER_TICK_MS);
+
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        uint32_t this_tick = tick++;
+
+        new_dawn_data_t dawn_data;
+        uint32_t currentTime = xTaskGetTickCount() * portTICK_PERIOD_MS;
+        bool dataFresh = new_dawn_get_data(&dawn_data) && (currentTime - dawn_data.timestamp < MACHINE_PUBLISHER_DATA_TIMEOUT_MS);
+
+        if (xSemaphoreTake(stackMutex, pdMS_TO_TICKS(MACHINE_PUBLISHER_TICK_MS)) != pdTRUE) {
+            ESP_LOGW(TAG, "CAN stack busy, skipped a tick");
+            continue;
+        }
+
+        // Jitter is measured once we own the stack, since that is when the frames get queued
+        int64_t now_us = esp_timer_get_time();
+        if (last_tick_us != 0) {
+            record_jitter((int32_t)(now_us - last_tick_us - (MACHINE_PUBLISHER_TICK_MS * 1000)), dataFresh);
+        }
+        last_tick_us = now_us;
+
+        if (dataFresh) {
+            if ((this_tick % (MACHINE_PUBLISHER_SPEED_MS / MACHINE_PUBLISHER_TICK_MS)) == 0) {
+                publish_speed(dawn_data.status, distance_um);
+            }
+            if ((this_tick % (MACHINE_PUBLISHER_HEADING_MS / MACHINE_PUBLISHER_TICK_MS)) == 0) {
+                publish_heading(dawn_data.status, last_heading, last_heading_us, now_us);
+            }
+            if ((this_tick % (MACHINE_PUBLISHER_COG_SOG_MS / MACHINE_PUBLISHER_TICK_MS)) == 0) {
+                publish_cog_sog(dawn_data.status);
+            }
+        } else {
+            // Don't derive a rate of turn across a gap in the data
+            last_heading_us = 0;
+        }
+        xSemaphoreGive(stackMutex);
+    }
+}
+
+bool machine_publisher_init(std::shared_ptr<isobus::InternalControlFunction> source, SemaphoreHandle_t stack_mutex)
+{
+    if (!source || !stack_mutex || publisherTaskHandle) {
+        return false;
+    }
+
+    publisherSource = source;
+    stackMutex = stack_mutex;
+    jitter_mutex = xSemaphoreCreateMutex();
+
+    // Only the transmit side of the interfaces is used, the publisher sends for them
+    speedInterface.reset(new TimedSpeedMessagesInterface(source, true, false, true, false));
+    nmea2000Interface.reset(new isobus::NMEA2000MessageInterface(source, true, false, false, false, false, true, true));
+
+    // Above the CAN task, so a tick isn't delayed by a busy polling loop
+    xTaskCreate(publisher_task, "publisher", 4096, NULL, 3, &publisherTaskHandle);
+
+    const esp_timer_create_args_t timer_args = {
+        .callback = &publisher_timer_callback,
+        .arg = NULL,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "publisher",
+        .skip_unhandled_events = true,
+    };
+    if ((esp_timer_create(&timer_args, &publisherTimer) != ESP_OK) ||
+        (esp_timer_start_periodic(publisherTimer, MACHINE_PUBLISHER_TICK_MS * 1000) != ESP_OK)) {
+        ESP_LOGE(TAG, "Failed to start publisher timer");
+        return false;
+    }
+
+    ESP_LOGI(TAG, "Publishing speed every %dms, heading every %dms, COG & SOG every %dms",
+             MACHINE_PUBLISHER_SPEED_MS, MACHINE_PUBLISHER_HEADING_MS, MACHINE_PUBLISHER_COG_SOG_MS);
+    return true;
+}
+
+bool machine_publisher_get_jitter(machine_publisher_jitter_t *jitter)
+{
+    if (!jitter || !jitter_mutex) {
+        return false;
+    }
+
+    bool result = false;
+    if (xSemaphoreTake(jitter_mutex, pdMS_TO_TICKS(10)) == pdTRUE) {
+        if (publisher_jitter.count > 0) {
+            memcpy(jitter, &publisher_jitter, sizeof(machine_publisher_jitter_t));
+            result = true;
+        }
+        xSemaphoreGive(jitter_mutex);
+    }
+
+    return result;
+}
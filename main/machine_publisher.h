@@ -0,0 +1,36 @@
+#ifndef MACHINE_PUBLISHER_H
+#define MACHINE_PUBLISHER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <memory>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "isobus/isobus/can_internal_control_function.hpp"
+
+// Publishes New Dawn's speed and heading on ISOBUS from a hardware timer,
+// instead of from the 10ms CAN polling loop.
+// Base tick of the publisher. Every message interval is a multiple of it.
+#define MACHINE_PUBLISHER_TICK_MS       50
+#define MACHINE_PUBLISHER_SPEED_MS      100 // ISO 11783-7 speed and distance messages
+#define MACHINE_PUBLISHER_HEADING_MS    100 // NMEA2000 vessel heading and rate of turn
+#define MACHINE_PUBLISHER_COG_SOG_MS    250 // NMEA2000 COG & SOG rapid update
+#define MACHINE_PUBLISHER_DATA_TIMEOUT_MS 250 // New Dawn data older than this is not published
+
+// Publisher tick jitter, the difference between each tick's interval and MACHINE_PUBLISHER_TICK_MS
+typedef struct {
+    uint32_t count;         // Number of ticks measured
+    int32_t last_us;        // Jitter of the most recent tick
+    int32_t min_us;         // Earliest tick seen
+    int32_t max_us;         // Latest tick seen
+    uint64_t total_abs_us;  // Sum of the absolute jitter, for the average
+    uint32_t published;     // Number of ticks that published New Dawn data
+} machine_publisher_jitter_t;
+
+// Function prototypes
+// The stack mutex must be held by anything else that uses the CAN stack, as it is not thread safe without threads enabled.
+bool machine_publisher_init(std::shared_ptr<isobus::InternalControlFunction> source, SemaphoreHandle_t stack_mutex);
+bool machine_publisher_get_jitter(machine_publisher_jitter_t *jitter);
+
+#endif // MACHINE_PUBLISHER_H
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: CC0-1.0
  */
 
+#include <math.h>
 #include <stdio.h>
 #include <string.h>
 #include "freertos/FreeRTOS.h"
@@ -19,12 +20,15 @@
 #include "isobus/isobus/can_network_manager.hpp"
 #include "isobus/isobus/can_partnered_control_function.hpp"
 #include "isobus/isobus/can_internal_control_function.hpp"
+#include "isobus/isobus/isobus_guidance_interface.hpp"
 #include "isobus/isobus/isobus_virtual_terminal_client.hpp"
 
 #include "esp32_logger.h"
 #include "vt_object_ids.h"
 #include "manual_pool.h"
 #include "new_dawn_serial.h"
+#include "machine_publisher.h"
+#include "bus_memory.h"
 #include "version.h"
 
 static const char *TAG = "LITTLE_DAWN";
@@ -37,11 +41,19 @@ static const char *TAG = "LITTLE_DAWN";
 // ISOBUS standard bitrate
 #define TWAI_BITRATE TWAI_TIMING_CONFIG_250KBITS()
 
+// Guidance bridge configuration
+#define GUIDANCE_WHEELBASE_M 2.5f          // Used to estimate curvature from WAS
+#define GUIDANCE_DATA_TIMEOUT_MS 250       // New Dawn data older than this is not used for guidance
+
 // Global ISOBUS objects
 static std::shared_ptr<isobus::CANHardwarePlugin> canDriver = nullptr;
 static std::shared_ptr<isobus::InternalControlFunction> internalECU = nullptr;
 static std::shared_ptr<isobus::PartneredControlFunction> partnerVT = nullptr;
 static std::shared_ptr<isobus::VirtualTerminalClient> vtClient = nullptr;
+static std::shared_ptr<isobus::AgriculturalGuidanceInterface> guidanceInterface = nullptr;
+
+// The stack isn't thread safe without threads enabled, so the CAN task and the publisher share it through this
+static SemaphoreHandle_t canStackMutex = NULL;
 
 // Variables for VT display updates
 static uint32_t displayValue = 0;
@@ -75,10 +87,39 @@ void blink_led(int times, int duration_ms)
     }
 }
 
+// Publishes the estimated curvature from WAS, and whether we can be steered, in Guidance Machine Info
+static void update_guidance_machine_info(void)
+{
+    new_dawn_data_t dawn_data;
+    uint32_t currentTime = xTaskGetTickCount() * portTICK_PERIOD_MS;
+    bool dataFresh = new_dawn_get_data(&dawn_data) && (currentTime - dawn_data.timestamp < GUIDANCE_DATA_TIMEOUT_MS);
+
+    if (dataFresh)
+    {
+        // Bicycle model: curvature = tan(steer angle) / wheelbase, converted from m^-1 to km^-1
+        float steerAngle_rad = (dawn_data.status.steerAngle / 10.0f) * (float)M_PI / 180.0f;
+        float curvature_km = (tanf(steerAngle_rad) / GUIDANCE_WHEELBASE_M) * 1000.0f;
+
+        guidanceInterface->guidanceMachineInfoTransmitData.set_estimated_curvature(curvature_km);
+        guidanceInterface->guidanceMachineInfoTransmitData.set_guidance_steering_system_readiness_state(
+            isobus::AgriculturalGuidanceInterface::GuidanceMachineInfo::GenericSAEbs02SlotValue::EnabledOnActive);
+    }
+    else
+    {
+        guidanceInterface->guidanceMachineInfoTransmitData.set_estimated_curvature(0.0f);
+        guidanceInterface->guidanceMachineInfoTransmitData.set_guidance_steering_system_readiness_state(
+            isobus::AgriculturalGuidanceInterface::GuidanceMachineInfo::GenericSAEbs02SlotValue::DisabledOffPassive);
+    }
+}
+
 void can_update_task(void *arg)
 {
     TickType_t xLastWakeTime = xTaskGetTickCount();
-    const TickType_t xFrequency = pdMS_TO_TICKS(10); // Back to 10ms - 5ms causes kernel panic
+    // Back to 10ms - 5ms causes kernel panic. This period also bounds the guidance bridge latency: a curvature
+    // command can wait up to one period (plus the time to run the update below) in the TWAI receive queue before
+    // it is read and forwarded, so the bridge adds up to ~10ms, not one CAN frame time (~0.5ms at 250kbit/s).
+    // The reported bridge latency starts when the frame is read from the driver, so it doesn't include that wait.
+    const TickType_t xFrequency = pdMS_TO_TICKS(10);
     static uint32_t lastVTUpdateTime = 0;
 
     while (1)
@@ -86,9 +127,23 @@ void can_update_task(void *arg)
         // Feed the watchdog for this task
         esp_task_wdt_reset();
 
+        xSemaphoreTake(canStackMutex, portMAX_DELAY);
+
+        // Refresh Guidance Machine Info first, it is sent from the hardware interface update when it is due
+        if (guidanceInterface)
+        {
+            update_guidance_machine_info();
+        }
+
         // Update the CAN hardware interface (required when threads are disabled)
         isobus::CANHardwareInterface::update();
 
+        // Process received guidance commands, and retry Guidance Machine Info if it couldn't be sent
+        if (guidanceInterface)
+        {
+            guidanceInterface->update();
+        }
+
         // Update VT client if it exists
         if (vtClient)
         {
@@ -119,6 +174,8 @@ void can_update_task(void *arg)
             taskYIELD();
         }
 
+        xSemaphoreGive(canStackMutex);
+
         // Yield to other tasks to prevent watchdog/kernel panic
         taskYIELD();
 
@@ -181,6 +238,9 @@ extern "C" void app_main(void)
     deviceNAME.set_device_class_instance(0);
     deviceNAME.set_manufacturer_code(1407); // Open-Agriculture
 
+    // Load what the bus looked like last time, before anything is claimed
+    bus_memory_init();
+
     // Create internal control function (our ECU)
     internalECU = isobus::CANNetworkManager::CANNetwork.create_internal_control_function(deviceNAME, 0, 0x80);
 
@@ -290,6 +350,35 @@ extern "C" void app_main(void)
 
 #endif
 
+    // Claim our last address straight away and expect the last bus, now the VT partner exists to be matched
+    bus_memory_restore(internalECU);
+
+    // Initialize New Dawn serial communication before anything can forward to it
+    new_dawn_serial_init();
+
+    // Create the guidance interface. We only send Guidance Machine Info, and receive commands from any source.
+    // Machine Info is sent on a 100ms schedule kept by the hardware interface, instead of whenever the interface is updated.
+    guidanceInterface = std::make_shared<isobus::AgriculturalGuidanceInterface>(internalECU, nullptr, false, true);
+    guidanceInterface->set_deadline_driven_transmit(true);
+    guidanceInterface->initialize();
+
+    // Forward curvature commands to New Dawn straight away, from the same CAN update that received them.
+    // Each command carries the receive timestamp of its own frame, so the latency stays right when several are drained at once.
+    guidanceInterface->get_guidance_system_command_event_publisher().add_listener(
+        [](const std::shared_ptr<isobus::AgriculturalGuidanceInterface::GuidanceSystemCommand> command, bool)
+        {
+            uint8_t status = (command->get_status() == isobus::AgriculturalGuidanceInterface::GuidanceSystemCommand::CurvatureCommandStatus::IntendedToSteer) ? 1 : 0;
+            new_dawn_send_guidance_curvature(command->get_curvature(), status, command->get_received_timestamp_us());
+        });
+    ESP_LOGI(TAG, "Guidance bridge initialized");
+
+    // Publish New Dawn's speed and heading on ISOBUS and NMEA2000 from a timer
+    canStackMutex = xSemaphoreCreateMutex();
+    if (!machine_publisher_init(internalECU, canStackMutex))
+    {
+        ESP_LOGE(TAG, "Failed to start the machine data publisher");
+    }
+
     // Create task for updating CAN hardware (since threads are disabled)
     // Priority 2 for timely CAN updates (idle=0, main loop=1)
     // Increased stack size to 16KB for VT message processing
@@ -302,8 +391,7 @@ extern "C" void app_main(void)
         esp_task_wdt_add(canTaskHandle);
     }
 
-    // Initialize and start New Dawn serial communication
-    new_dawn_serial_init();
+    // Start New Dawn serial communication
     xTaskCreate(new_dawn_serial_task, "NewDawn_serial", 4096, NULL, 1, NULL);
 
     // Main loop
@@ -329,6 +417,9 @@ extern "C" void app_main(void)
                 blink_led(2, 200); // Double blink during address claim
             }
 
+            // Remember the bus for the next power up, if it changed
+            bus_memory_save(internalECU, canStackMutex);
+
             // Get TWAI status
             twai_status_info_t status;
             twai_get_status_info(&status);
@@ -339,6 +430,49 @@ extern "C" void app_main(void)
                      status.bus_error_count,
                      status.arb_lost_count);
 
+            // Report guidance bridge latency
+            new_dawn_latency_t latency;
+            if (new_dawn_get_guidance_latency(&latency))
+            {
+                ESP_LOGI(TAG, "Guidance bridge: %lu commands, latency last: %luus, min: %luus, avg: %luus, max: %luus",
+                         latency.count,
+                         latency.last_us,
+                         latency.min_us,
+                         (uint32_t)(latency.total_us / latency.count),
+                         latency.max_us);
+            }
+
+            // Report publisher timing
+            machine_publisher_jitter_t jitter;
+            if (machine_publisher_get_jitter(&jitter))
+            {
+                ESP_LOGI(TAG, "Publisher: %lu ticks (%lu with data), jitter last: %ldus, min: %ldus, avg: %luus, max: %ldus",
+                         jitter.count,
+                         jitter.published,
+                         jitter.last_us,
+                         jitter.min_us,
+                         (uint32_t)(jitter.total_abs_us / jitter.count),
+                         jitter.max_us);
+            }
+
+            // Report Guidance Machine Info transmit timing
+            if (guidanceInterface)
+            {
+                xSemaphoreTake(canStackMutex, portMAX_DELAY);
+                isobus::AgriculturalGuidanceInterface::TransmitJitterHistogram histogram = guidanceInterface->get_transmit_jitter_histogram();
+                xSemaphoreGive(canStackMutex);
+
+                if (histogram.numberOfMessages > 0)
+                {
+                    ESP_LOGI(TAG, "Guidance TX: %lu messages, lateness avg: %luus, max: %luus, <=0.1/0.25/0.5/1/2/5/10ms/more: %lu/%lu/%lu/%lu/%lu/%lu/%lu/%lu",
+                             histogram.numberOfMessages,
+                             (uint32_t)(histogram.totalLateness_us / histogram.numberOfMessages),
+                             histogram.maximumLateness_us,
+                             histogram.bins[0], histogram.bins[1], histogram.bins[2], histogram.bins[3],
+                             histogram.bins[4], histogram.bins[5], histogram.bins[6], histogram.bins[7]);
+                }
+            }
+
             // Report VT client status
             if (vtClient)
             {
@@ -366,10 +500,12 @@ extern "C" void app_main(void)
                         vtConnected = true;
 
                         // Send change active mask: Working Set 0 to Data Mask 1000
+                        xSemaphoreTake(canStackMutex, portMAX_DELAY);
                         if (vtClient->send_change_active_mask(0, 1000))
                         {
                             ESP_LOGI(TAG, "Sent change active mask command: WS 0 to Data Mask 1000");
                         }
+                        xSemaphoreGive(canStackMutex);
                     }
 
                     // Update the display value periodically
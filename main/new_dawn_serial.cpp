@@ -4,6 +4,7 @@
 #include "esp_log.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "isobus/utility/system_timing.hpp"
 #include <string.h>
 #include <stdlib.h>
 
@@ -13,6 +14,10 @@ static const char *TAG = "NEW_DAWN";
 static new_dawn_data_t current_data = {0, 0, false, 0};
 static SemaphoreHandle_t data_mutex = NULL;
 
+// Guidance bridge latency statistics
+static new_dawn_latency_t guidance_latency = {0, 0, UINT32_MAX, 0, 0};
+static SemaphoreHandle_t latency_mutex = NULL;
+
 void new_dawn_serial_init(void)
 {
     // Configure UART parameters
@@ -33,6 +38,7 @@ void new_dawn_serial_init(void)
     
     // Create mutex for thread-safe data access
     data_mutex = xSemaphoreCreateMutex();
+    latency_mutex = xSemaphoreCreateMutex();
     
     ESP_LOGI(TAG, "Serial interface initialized on UART%d (TX: GPIO%d, RX: GPIO%d)", 
              NEW_DAWN_UART_NUM, NEW_DAWN_TX_PIN, NEW_DAWN_RX_PIN);
@@ -90,6 +96,75 @@ static void sendHandshakeResponse(void)
     ESP_LOGD(TAG, "Sent handshake response to New Dawn");  // Use debug level for periodic messages
 }
 
+// Forward a guidance curvature command to New Dawn
+// Called from the CAN task as soon as the command is received, so it bypasses the serial task.
+// The UART has no TX ring buffer, so this returns once the frame is in the hardware FIFO,
+// which is where the latency from the CAN frame's receive timestamp is measured.
+bool new_dawn_send_guidance_curvature(float curvature_km, uint8_t status, uint64_t rx_timestamp_us)
+{
+    if (!latency_mutex) {
+        return false;
+    }
+
+    // Clamp to the range ISO 11783-7 allows, then convert to 0.25 km^-1 per bit
+    if (curvature_km > 8031.75f) {
+        curvature_km = 8031.75f;
+    } else if (curvature_km < -8032.0f) {
+        curvature_km = -8032.0f;
+    }
+
+    GuidanceCurvatureCommand command;
+    command.curvature = (int16_t)(curvature_km * 4.0f);
+    command.status = status;
+
+    uint8_t message[3 + sizeof(GuidanceCurvatureCommand)];
+    message[0] = MSG_GUIDANCE_CURVATURE;
+    message[1] = sizeof(GuidanceCurvatureCommand);
+    memcpy(&message[2], &command, sizeof(GuidanceCurvatureCommand));
+    message[sizeof(message) - 1] = calculateChecksum(message, sizeof(message) - 1);
+
+    if (uart_write_bytes(NEW_DAWN_UART_NUM, message, sizeof(message)) != (int)sizeof(message)) {
+        ESP_LOGW(TAG, "Failed to forward guidance command");
+        return false;
+    }
+
+    if (rx_timestamp_us != 0) {
+        uint32_t latency_us = (uint32_t)isobus::SystemTiming::get_time_elapsed_us(rx_timestamp_us);
+
+        if (xSemaphoreTake(latency_mutex, 0) == pdTRUE) {
+            guidance_latency.count++;
+            guidance_latency.last_us = latency_us;
+            guidance_latency.total_us += latency_us;
+            if (latency_us < guidance_latency.min_us) {
+                guidance_latency.min_us = latency_us;
+            }
+            if (latency_us > guidance_latency.max_us) {
+                guidance_latency.max_us = latency_us;
+            }
+            xSemaphoreGive(latency_mutex);
+        }
+    }
+    return true;
+}
+
+bool new_dawn_get_guidance_latency(new_dawn_latency_t *latency)
+{
+    if (!latency || !latency_mutex) {
+        return false;
+    }
+
+    bool result = false;
+    if (xSemaphoreTake(latency_mutex, pdMS_TO_TICKS(10)) == pdTRUE) {
+        if (guidance_latency.count > 0) {
+            memcpy(latency, &guidance_latency, sizeof(new_dawn_latency_t));
+            result = true;
+        }
+        xSemaphoreGive(latency_mutex);
+    }
+
+    return result;
+}
+
 // Parse incoming data from New Dawn
 // Expected format: [ID][LENGTH][DATA...][CHECKSUM]
 static bool parse_new_dawn_message(const uint8_t *buffer, size_t len, new_dawn_data_t *data)
@@ -15,6 +15,7 @@
 
 // Message IDs
 #define MSG_MACHINE_STATUS    0x01
+#define MSG_GUIDANCE_CURVATURE 0x02
 #define MSG_HANDSHAKE_REQUEST 0x10
 #define MSG_HANDSHAKE_RESPONSE 0x11
 
@@ -27,6 +28,21 @@ typedef struct __attribute__((packed)) {
     int16_t steerAngle;   // WAS - Steer angle in 0.1 degrees
 } MachineStatus;
 
+// Guidance curvature command forwarded from ISOBUS (must match New Dawn)
+typedef struct __attribute__((packed)) {
+    int16_t curvature;    // Commanded curvature in 0.25 km^-1, positive is a right turn
+    uint8_t status;       // 0 = not intended to steer, 1 = intended to steer
+} GuidanceCurvatureCommand;
+
+// Guidance bridge latency, from the CAN frame being read from the TWAI driver to the UART write completing
+typedef struct {
+    uint32_t count;         // Number of commands forwarded
+    uint32_t last_us;       // Latency of the most recent command
+    uint32_t min_us;        // Smallest latency seen
+    uint32_t max_us;        // Largest latency seen
+    uint64_t total_us;      // Sum of all latencies, for the average
+} new_dawn_latency_t;
+
 // New Dawn data structure
 typedef struct {
     MachineStatus status;   // Latest machine status
@@ -38,5 +54,7 @@ typedef struct {
 void new_dawn_serial_init(void);
 bool new_dawn_get_data(new_dawn_data_t *data);
 void new_dawn_serial_task(void *arg);
+bool new_dawn_send_guidance_curvature(float curvature_km, uint8_t status, uint64_t rx_timestamp_us);
+bool new_dawn_get_guidance_latency(new_dawn_latency_t *latency);
 
 #endif // NEW_DAWN_SERIAL_H
\ No newline at end of file